@@ -118,16 +118,44 @@ ENUM iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t
                                                                       const uint32_t userHeaderSize,
                                                                       const uint32_t userHeaderAlignment);
 
+/// @brief allocates multiple chunks with the same user-payload size and alignment in one pass
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array in which the pointers to the user-payloads of the allocated chunks are stored
+/// @param[in] numberOfChunks number of chunks which should be allocated; must not exceed the number of chunks which
+///            can be allocated in parallel
+/// @param[in] userPayloadSize user-payload size of the allocated chunks
+/// @param[in] userPayloadAlignment user-payload alignment of the allocated chunks
+/// @return on success it returns AllocationResult_SUCCESS and all chunks are allocated, otherwise a value which
+///         describes the error of the first failed allocation and none of the chunks is allocated
+ENUM iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                              void** const userPayloads,
+                                              const uint64_t numberOfChunks,
+                                              const uint64_t userPayloadSize,
+                                              const uint32_t userPayloadAlignment);
+
 /// @brief releases ownership of a previously allocated chunk without sending it
 /// @param[in] self handle of the publisher
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be free'd
 void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief releases ownership of multiple previously allocated chunks without sending them
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be free'd
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_pub_release_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief sends a previously allocated chunk
 /// @param[in] self handle of the publisher
 /// @param[in] userPayload pointer to the user-payload of the chunk which should be send
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload);
 
+/// @brief sends multiple previously allocated chunks in order with a single notification of each subscriber
+/// @param[in] self handle of the publisher
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be send
+/// @param[in] numberOfChunks number of elements in userPayloads; must not exceed the number of chunks which can be
+///            allocated in parallel
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief offers the service
 /// @param[in] self handle of the publisher
 void iox_pub_offer(iox_pub_t const self);
@@ -106,11 +106,30 @@ ENUM iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
+/// @brief retrieve up to capacity received chunks in one pass
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array in which the pointers to the user-payloads of the chunks are stored
+/// @param[in] capacity number of elements of the userPayloads array; at most
+///            MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY chunks are taken
+/// @param[out] numberOfChunks number of chunks which were stored in userPayloads
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t capacity,
+                                                uint64_t* const numberOfChunks);
+
 /// @brief release a previously acquired chunk (via iox_sub_take_chunk)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload);
 
+/// @brief release multiple previously acquired chunks (via iox_sub_take_chunk or iox_sub_take_chunks)
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array of pointers to the user-payloads of the chunks which should be released
+/// @param[in] numberOfChunks number of elements in userPayloads
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint64_t numberOfChunks);
+
 /// @brief release all chunks which are stored in the chunk queue
 /// @param[in] self handle to the subscriber
 void iox_sub_release_queued_chunks(iox_sub_t const self);
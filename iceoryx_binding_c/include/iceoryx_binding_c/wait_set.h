@@ -69,6 +69,38 @@ uint64_t iox_ws_wait(iox_ws_t const self,
                      const uint64_t notificationInfoArrayCapacity,
                      uint64_t* missedElements);
 
+/// @brief waits until an event occurred or the timeout was reached and provides only the notification ids
+/// @param[in] self handle to the wait set
+/// @param[in] timeout duration how long this method should wait
+/// @param[in] notificationIdArray preallocated memory to an array of uint64_t in which the notification ids of the
+///             occurred events, which were provided when attaching, can be written to
+/// @param[in] notificationIdArrayCapacity the capacity of the preallocated notificationIdArray
+/// @param[in] missedElements if the notificationIdArray has insufficient size the number of missed elements
+///             which could not be written into the array are stored here
+/// @return number of elements which were written into the notificationIdArray
+/// @note when the notification ids are unique, they can be used as index into an array of the attached origins;
+///       this avoids a call to the iox_notification_info_t functions for each occurred event
+uint64_t iox_ws_timed_wait_for_notification_ids(iox_ws_t const self,
+                                                struct timespec timeout,
+                                                uint64_t* const notificationIdArray,
+                                                const uint64_t notificationIdArrayCapacity,
+                                                uint64_t* missedElements);
+
+/// @brief waits until an event occurred and provides only the notification ids
+/// @param[in] self handle to the wait set
+/// @param[in] notificationIdArray preallocated memory to an array of uint64_t in which the notification ids of the
+///             occurred events, which were provided when attaching, can be written to
+/// @param[in] notificationIdArrayCapacity the capacity of the preallocated notificationIdArray
+/// @param[in] missedElements if the notificationIdArray has insufficient size the number of missed elements
+///             which could not be written into the array are stored here
+/// @return number of elements which were written into the notificationIdArray
+/// @note when the notification ids are unique, they can be used as index into an array of the attached origins;
+///       this avoids a call to the iox_notification_info_t functions for each occurred event
+uint64_t iox_ws_wait_for_notification_ids(iox_ws_t const self,
+                                          uint64_t* const notificationIdArray,
+                                          const uint64_t notificationIdArrayCapacity,
+                                          uint64_t* missedElements);
+
 /// @brief returns the number of registered events/states
 uint64_t iox_ws_size(iox_ws_t const self);
 
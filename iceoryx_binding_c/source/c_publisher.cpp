@@ -24,6 +24,7 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/vector.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -154,6 +155,39 @@ iox_AllocationResult iox_pub_loan_aligned_chunk_with_user_header(iox_pub_t const
     return AllocationResult_SUCCESS;
 }
 
+iox_AllocationResult iox_pub_loan_chunks(iox_pub_t const self,
+                                         void** const userPayloads,
+                                         const uint64_t numberOfChunks,
+                                         const uint64_t userPayloadSize,
+                                         const uint32_t userPayloadAlignment)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfChunks <= MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY,
+                "'numberOfChunks' must not exceed the number of chunks which can be allocated in parallel");
+
+    PublisherPortUser port(self->m_portData);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        auto result = port.tryAllocateChunk(userPayloadSize,
+                                            userPayloadAlignment,
+                                            IOX_C_CHUNK_NO_USER_HEADER_SIZE,
+                                            IOX_C_CHUNK_NO_USER_HEADER_ALIGNMENT);
+        if (result.has_error())
+        {
+            // all or nothing; the chunks which were already allocated are returned to the mempool
+            for (uint64_t j = 0U; j < i; ++j)
+            {
+                port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[j]));
+            }
+            return cpp2c::allocationResult(result.error());
+        }
+        userPayloads[i] = result.value()->userPayload();
+    }
+
+    return AllocationResult_SUCCESS;
+}
+
 void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -161,6 +195,19 @@ void iox_pub_release_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_release_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+
+    PublisherPortUser port(self->m_portData);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        IOX_ENFORCE(userPayloads[i] != nullptr, "'userPayloads' must not contain a 'nullptr'");
+        port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
 void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -168,6 +215,22 @@ void iox_pub_publish_chunk(iox_pub_t const self, void* const userPayload)
     PublisherPortUser(self->m_portData).sendChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_pub_publish_chunks(iox_pub_t const self, void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfChunks <= MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY,
+                "'numberOfChunks' must not exceed the number of chunks which can be allocated in parallel");
+
+    vector<ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        IOX_ENFORCE(userPayloads[i] != nullptr, "'userPayloads' must not contain a 'nullptr'");
+        chunkHeaders.push_back(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+    PublisherPortUser(self->m_portData).sendChunks(span<ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+}
+
 void iox_pub_offer(iox_pub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -24,8 +24,10 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/assertions.hpp"
 #include "iox/logging.hpp"
+#include "iox/uninitialized_array.hpp"
 
 using namespace iox;
 using namespace iox::popo;
@@ -164,6 +166,35 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t capacity,
+                                           uint64_t* const numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+    IOX_ENFORCE(numberOfChunks != nullptr, "'numberOfChunks' must not be a 'nullptr'");
+
+    *numberOfChunks = 0U;
+
+    UninitializedArray<const ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY> chunkHeaders;
+    const uint64_t count =
+        algorithm::minVal(capacity, static_cast<uint64_t>(MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+    auto result =
+        SubscriberPortUser(self->m_portData).tryGetChunks(span<const ChunkHeader*>(chunkHeaders.begin(), count));
+    if (result.has_error())
+    {
+        return cpp2c::chunkReceiveResult(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    *numberOfChunks = result.value();
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -171,6 +202,19 @@ void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
     SubscriberPortUser(self->m_portData).releaseChunk(ChunkHeader::fromUserPayload(userPayload));
 }
 
+void iox_sub_release_chunks(iox_sub_t const self, const void* const* const userPayloads, const uint64_t numberOfChunks)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(userPayloads != nullptr, "'userPayloads' must not be a 'nullptr'");
+
+    SubscriberPortUser port(self->m_portData);
+    for (uint64_t i = 0U; i < numberOfChunks; ++i)
+    {
+        IOX_ENFORCE(userPayloads[i] != nullptr, "'userPayloads' must not contain a 'nullptr'");
+        port.releaseChunk(ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+}
+
 void iox_sub_release_queued_chunks(iox_sub_t const self)
 {
     IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
@@ -36,30 +36,42 @@ extern "C" {
 #include "iceoryx_binding_c/wait_set.h"
 }
 
+template <typename T, typename Converter>
 static uint64_t notification_info_vector_to_c_array(const WaitSet<>::NotificationInfoVector& triggerVector,
-                                                    iox_notification_info_t* notificationInfoArray,
-                                                    const uint64_t notificationInfoArrayCapacity,
-                                                    uint64_t* missedElements)
+                                                    T* const cArray,
+                                                    const uint64_t cArrayCapacity,
+                                                    uint64_t* missedElements,
+                                                    const Converter& converter)
 {
-    uint64_t notificationInfoArraySize = 0U;
+    uint64_t cArraySize = 0U;
     uint64_t triggerVectorSize = triggerVector.size();
-    if (triggerVectorSize > notificationInfoArrayCapacity)
+    if (triggerVectorSize > cArrayCapacity)
     {
-        *missedElements = triggerVectorSize - notificationInfoArrayCapacity;
-        notificationInfoArraySize = notificationInfoArrayCapacity;
+        *missedElements = triggerVectorSize - cArrayCapacity;
+        cArraySize = cArrayCapacity;
     }
     else
     {
         *missedElements = 0U;
-        notificationInfoArraySize = triggerVectorSize;
+        cArraySize = triggerVectorSize;
     }
 
-    for (uint64_t i = 0U; i < notificationInfoArraySize; ++i)
+    for (uint64_t i = 0U; i < cArraySize; ++i)
     {
-        notificationInfoArray[i] = triggerVector[i];
+        cArray[i] = converter(triggerVector[i]);
     }
 
-    return notificationInfoArraySize;
+    return cArraySize;
+}
+
+static iox_notification_info_t to_notification_info(const NotificationInfo* const notificationInfo)
+{
+    return notificationInfo;
+}
+
+static uint64_t to_notification_id(const NotificationInfo* const notificationInfo)
+{
+    return notificationInfo->getNotificationId();
 }
 
 iox_ws_t iox_ws_init(iox_ws_storage_t* self)
@@ -90,7 +102,8 @@ uint64_t iox_ws_timed_wait(iox_ws_t const self,
     return notification_info_vector_to_c_array(self->timedWait(units::Duration(timeout)),
                                                notificationInfoArray,
                                                notificationInfoArrayCapacity,
-                                               missedElements);
+                                               missedElements,
+                                               to_notification_info);
 }
 
 uint64_t iox_ws_wait(iox_ws_t const self,
@@ -102,7 +115,35 @@ uint64_t iox_ws_wait(iox_ws_t const self,
     IOX_ENFORCE(missedElements != nullptr, "'missedElements' must not be a 'nullptr'");
 
     return notification_info_vector_to_c_array(
-        self->wait(), notificationInfoArray, notificationInfoArrayCapacity, missedElements);
+        self->wait(), notificationInfoArray, notificationInfoArrayCapacity, missedElements, to_notification_info);
+}
+
+uint64_t iox_ws_timed_wait_for_notification_ids(iox_ws_t const self,
+                                                struct timespec timeout,
+                                                uint64_t* const notificationIdArray,
+                                                const uint64_t notificationIdArrayCapacity,
+                                                uint64_t* missedElements)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(missedElements != nullptr, "'missedElements' must not be a 'nullptr'");
+
+    return notification_info_vector_to_c_array(self->timedWait(units::Duration(timeout)),
+                                               notificationIdArray,
+                                               notificationIdArrayCapacity,
+                                               missedElements,
+                                               to_notification_id);
+}
+
+uint64_t iox_ws_wait_for_notification_ids(iox_ws_t const self,
+                                          uint64_t* const notificationIdArray,
+                                          const uint64_t notificationIdArrayCapacity,
+                                          uint64_t* missedElements)
+{
+    IOX_ENFORCE(self != nullptr, "'self' must not be a 'nullptr'");
+    IOX_ENFORCE(missedElements != nullptr, "'missedElements' must not be a 'nullptr'");
+
+    return notification_info_vector_to_c_array(
+        self->wait(), notificationIdArray, notificationIdArrayCapacity, missedElements, to_notification_id);
 }
 
 uint64_t iox_ws_size(iox_ws_t const self)
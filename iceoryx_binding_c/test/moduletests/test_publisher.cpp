@@ -308,6 +308,39 @@ TEST_F(iox_pub_test, allocate_chunkFailsWhenOutOfChunks)
     EXPECT_EQ(AllocationResult_RUNNING_OUT_OF_CHUNKS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
 }
 
+TEST_F(iox_pub_test, loanChunksAllocatesAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "12f1a5a9-5ec6-40a3-b768-829c7e91ec1d");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{32U};
+    void* chunks[NUMBER_OF_CHUNKS] = {nullptr};
+    ASSERT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, sizeof(DummySample), USER_PAYLOAD_ALIGNMENT));
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    for (auto chunk : chunks)
+    {
+        ASSERT_THAT(chunk, Ne(nullptr));
+        EXPECT_THAT(reinterpret_cast<uint64_t>(chunk) % USER_PAYLOAD_ALIGNMENT, Eq(0U));
+    }
+}
+
+TEST_F(iox_pub_test, loanChunksAllocatesNoChunkWhenHoldingTooManyChunksInParallel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8bc272b-c4ab-43f2-a110-a0c8fbd72789");
+    void* chunk = nullptr;
+    ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunk, 100));
+
+    void* chunks[iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY] = {nullptr};
+    EXPECT_EQ(AllocationResult_TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL,
+              iox_pub_loan_chunks(&m_sut,
+                                  chunks,
+                                  iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY,
+                                  100,
+                                  IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+}
+
 TEST_F(iox_pub_test, allocatingChunkAcquiresMemory)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5a779236-0302-48b5-add7-0a2c33a9d86b");
@@ -325,6 +358,17 @@ TEST_F(iox_pub_test, freeingAnAllocatedChunkReleasesTheMemory)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0u));
 }
 
+TEST_F(iox_pub_test, releaseChunksReleasesTheMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ea4b0bda-3b6e-40e3-9193-3d433250b516");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS] = {nullptr};
+    ASSERT_EQ(AllocationResult_SUCCESS,
+              iox_pub_loan_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS, 100, IOX_C_CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT));
+    iox_pub_release_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_pub_test, sendDeliversChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "187d552a-6903-40cd-88a0-7722eb2a40a8");
@@ -343,6 +387,31 @@ TEST_F(iox_pub_test, sendDeliversChunk)
     EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711);
 }
 
+TEST_F(iox_pub_test, sendChunksDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a8d4c6e1-3f72-4b59-8e0d-9c1b5f2a7e46");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    void* chunks[NUMBER_OF_CHUNKS];
+    iox_pub_offer(&m_sut);
+    this->Subscribe(&m_publisherPortData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        ASSERT_EQ(AllocationResult_SUCCESS, iox_pub_loan_chunk(&m_sut, &chunks[i], 100));
+        static_cast<DummySample*>(chunks[i])->dummy = 4711 + i;
+    }
+    iox_pub_publish_chunks(&m_sut, chunks, NUMBER_OF_CHUNKS);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> m_chunkQueuePopper(&m_chunkQueueData);
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = m_chunkQueuePopper.tryPop();
+        ASSERT_TRUE(maybeSharedChunk.has_value());
+        EXPECT_TRUE(*maybeSharedChunk == chunks[i]);
+        EXPECT_TRUE(static_cast<DummySample*>(maybeSharedChunk->getUserPayload())->dummy == 4711 + i);
+    }
+    EXPECT_FALSE(m_chunkQueuePopper.tryPop().has_value());
+}
+
 TEST_F(iox_pub_test, correctServiceDescriptionReturned)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4f91cb12-fbfa-4bad-ad59-ab2579f83fbe");
@@ -375,6 +444,26 @@ TEST_F(iox_pub_test, pubPublishChunckWithNullptr)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunk(&m_sut, nullptr); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_pub_test, pubPublishChunksWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "57e3b0f8-2c19-4d6a-b4e7-0a8f3d5c9e12");
+    void* chunks[1] = {nullptr};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(nullptr, chunks, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(&m_sut, nullptr, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_publish_chunks(&m_sut, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(iox_pub_test, pubLoanAndReleaseChunksWithNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "caf92423-bab2-4109-9fb3-4482a33f6397");
+    void* chunks[1] = {nullptr};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_loan_chunks(nullptr, chunks, 1U, 100, 8U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_loan_chunks(&m_sut, nullptr, 1U, 100, 8U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_release_chunks(nullptr, chunks, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_release_chunks(&m_sut, nullptr, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_pub_release_chunks(&m_sut, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_pub_test, pubOfferWithNullptr)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5588dacf-6e6c-44c6-835d-1dfeb03ff2c1");
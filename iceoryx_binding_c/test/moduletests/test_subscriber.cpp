@@ -281,6 +281,39 @@ TEST_F(iox_sub_test, receiveChunkWhenToManyChunksAreHold)
     EXPECT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
 }
 
+TEST_F(iox_sub_test, takeChunksReceivesAllAvailableChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3127b897-d3fa-487f-8d51-eb3bdd40b4b7");
+    this->Subscribe(&m_portPtr);
+    struct data_t
+    {
+        int value;
+    };
+
+    constexpr int NUMBER_OF_CHUNKS{3};
+    for (int i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        static_cast<data_t*>(sharedChunk.getUserPayload())->value = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1] = {nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(static_cast<uint64_t>(NUMBER_OF_CHUNKS)));
+    for (int i = 0; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const data_t*>(chunks[i])->value, Eq(i));
+        iox_sub_release_chunk(m_sut, chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1, &numberOfChunks),
+              ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "53619897-cad8-4377-a877-4ec6971308fa");
@@ -295,6 +328,26 @@ TEST_F(iox_sub_test, releaseChunkWorks)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(iox_sub_test, releaseChunksWorks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d0b3633a-1690-44bb-aa8b-575006a58ac5");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        m_chunkPusher.push(getChunkFromMemoryManager());
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS] = {nullptr};
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS, &numberOfChunks), ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+    iox_sub_release_chunks(m_sut, chunks, numberOfChunks);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkQueuedChunksWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6e32b17f-7454-40fe-bf97-f742249fb7de");
@@ -458,6 +511,27 @@ TEST_F(iox_sub_test, subscriberTakeChunkWithNullptrFails)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunk(nullptr, &chunk); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_sub_test, subscriberTakeChunksWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0b0d9249-5f38-4eee-ba50-376819db39a8");
+    const void* chunks[1] = {nullptr};
+    uint64_t numberOfChunks{0U};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(nullptr, chunks, 1U, &numberOfChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, nullptr, 1U, &numberOfChunks); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_take_chunks(m_sut, chunks, 1U, nullptr); }, iox::er::ENFORCE_VIOLATION);
+}
+
+TEST_F(iox_sub_test, subReleaseChunksWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2607ab93-33f7-42c7-8199-2e53a7805356");
+    const void* chunks[1] = {nullptr};
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_release_chunks(nullptr, chunks, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_release_chunks(m_sut, nullptr, 0U); }, iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_sub_release_chunks(m_sut, chunks, 1U); }, iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_sub_test, subReleaseChunkWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "425c9e6c-5211-4f35-b1d9-408e328757d0");
@@ -492,6 +492,58 @@ TEST_F(iox_ws_test, MultiTriggerCaseTimedWaitReturnsCorrectTrigger)
     }
 }
 
+TEST_F(iox_ws_test, WaitForNotificationIdsReturnsTheIdsOfTheTriggers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "86774cb4-e342-47bf-9d06-e6ce9970d6cb");
+    for (uint64_t i = 0U; i < 8U; ++i)
+    {
+        iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[i], 1337U + i, userTriggerCallback);
+        iox_user_trigger_trigger(m_userTrigger[i]);
+    }
+
+    uint64_t notificationIds[MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET];
+    EXPECT_EQ(iox_ws_wait_for_notification_ids(
+                  m_sut, notificationIds, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              8U);
+    EXPECT_EQ(m_missedElements, 0U);
+
+    for (uint64_t i = 0U; i < 8U; ++i)
+    {
+        EXPECT_EQ(notificationIds[i], 1337U + i);
+    }
+}
+
+TEST_F(iox_ws_test, TimedWaitForNotificationIdsReturnsTheIdsOfTheTriggersAndTheMissedElements)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "985d32dd-02b0-4cb3-9fa4-cd78d53356ae");
+    for (uint64_t i = 0U; i < 12U; ++i)
+    {
+        iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[i], 42U + i, userTriggerCallback);
+        iox_user_trigger_trigger(m_userTrigger[i]);
+    }
+
+    uint64_t notificationIds[8U];
+    EXPECT_EQ(iox_ws_timed_wait_for_notification_ids(m_sut, m_timeout, notificationIds, 8U, &m_missedElements), 8U);
+    EXPECT_EQ(m_missedElements, 4U);
+
+    for (uint64_t i = 0U; i < 8U; ++i)
+    {
+        EXPECT_EQ(notificationIds[i], 42U + i);
+    }
+}
+
+TEST_F(iox_ws_test, TimedWaitForNotificationIdsReturnsNothingWhenNothingWasTriggered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "695e53a3-2c72-4f5d-aa02-983e5c8bc499");
+    iox_ws_attach_user_trigger_event(m_sut, m_userTrigger[0U], 42U, userTriggerCallback);
+
+    uint64_t notificationIds[MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET];
+    EXPECT_EQ(iox_ws_timed_wait_for_notification_ids(
+                  m_sut, m_timeout, notificationIds, MAX_NUMBER_OF_ATTACHMENTS_PER_WAITSET, &m_missedElements),
+              0U);
+    EXPECT_EQ(m_missedElements, 0U);
+}
+
 TEST_F(iox_ws_test, MaxTriggerCaseTimedWaitReturnsCorrectTrigger)
 {
     ::testing::Test::RecordProperty("TEST_ID", "343429f9-acba-498f-8b9b-20379960daf6");
@@ -588,6 +640,22 @@ TEST_F(iox_ws_test, WaitSetWaitWithNullptrFails)
     IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_wait(nullptr, NULL, 0U, nullptr); }, iox::er::ENFORCE_VIOLATION);
 }
 
+TEST_F(iox_ws_test, WaitSetWaitForNotificationIdsWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "520f9785-2ee4-448a-85ee-44e81b884a68");
+    uint64_t notificationIds[1];
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_wait_for_notification_ids(m_sut, notificationIds, 1U, nullptr); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE([&] { iox_ws_wait_for_notification_ids(nullptr, notificationIds, 1U, &m_missedElements); },
+                             iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE(
+        [&] { iox_ws_timed_wait_for_notification_ids(m_sut, m_timeout, notificationIds, 1U, nullptr); },
+        iox::er::ENFORCE_VIOLATION);
+    IOX_EXPECT_FATAL_FAILURE(
+        [&] { iox_ws_timed_wait_for_notification_ids(nullptr, m_timeout, notificationIds, 1U, &m_missedElements); },
+        iox::er::ENFORCE_VIOLATION);
+}
+
 TEST_F(iox_ws_test, WaitSetSizeWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1f4da6e0-4912-4863-af2f-4c46d9d843fa");
@@ -17,6 +17,11 @@
 #include "base.hpp"
 
 
+uint32_t IcePerfBase::maxPayloadSize() const noexcept
+{
+    return std::numeric_limits<uint32_t>::max();
+}
+
 void IcePerfBase::preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept
 {
     sendPerfTopic(payloadSizeInBytes, RunFlag::RUN);
@@ -24,6 +24,7 @@
 
 #include <chrono>
 #include <iostream>
+#include <limits>
 
 class IcePerfBase
 {
@@ -36,6 +37,9 @@ class IcePerfBase
     virtual void initFollower() noexcept = 0;
     virtual void shutdown() noexcept = 0;
 
+    /// @brief the largest payload size the technology supports; larger payload sizes are skipped by the leader
+    virtual uint32_t maxPayloadSize() const noexcept;
+
     void preLatencyPerfTestLeader(const uint32_t payloadSizeInBytes) noexcept;
     void postLatencyPerfTestLeader() noexcept;
     void releaseFollower() noexcept;
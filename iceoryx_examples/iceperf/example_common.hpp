@@ -30,6 +30,8 @@ enum class Technology
     ICEORYX_CPP_API,
     ICEORYX_CPP_WAIT_API,
     ICEORYX_C_API,
+    ICEORYX_C_WAIT_API,
+    ICEORYX_BROADCAST,
     POSIX_MESSAGE_QUEUE,
     UNIX_DOMAIN_SOCKET
 };
@@ -0,0 +1,92 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_broadcast.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+IceoryxBroadcast::IceoryxBroadcast(const iox::capro::IdString_t& publisherName,
+                                   const iox::capro::IdString_t& subscriberName) noexcept
+    : m_writer({"IcePerf", publisherName, "Broadcast"})
+    , m_reader({"IcePerf", subscriberName, "Broadcast"})
+{
+}
+
+void IceoryxBroadcast::initLeader() noexcept
+{
+    init();
+}
+
+void IceoryxBroadcast::initFollower() noexcept
+{
+    init();
+}
+
+void IceoryxBroadcast::init() noexcept
+{
+    std::cout << "Waiting for: subscription" << std::flush;
+    while (m_reader.getSubscriptionState() != iox::SubscribeState::SUBSCRIBED)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::cout << ", reader" << std::flush;
+    while (!m_writer.hasReaders())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::cout << " [ success ]" << std::endl;
+}
+
+void IceoryxBroadcast::shutdown() noexcept
+{
+    // the writer and the reader are disconnected by RouDi when they are destroyed
+}
+
+uint32_t IceoryxBroadcast::maxPayloadSize() const noexcept
+{
+    return static_cast<uint32_t>(iox::popo::BroadcastWriter::MAX_MESSAGE_SIZE);
+}
+
+void IceoryxBroadcast::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    // the whole message is copied into the ring in order to compare the latency with the same payload size
+    uint8_t message[iox::popo::BroadcastWriter::MAX_MESSAGE_SIZE]{};
+    PerfTopic sendSample;
+    sendSample.payloadSize = payloadSizeInBytes;
+    sendSample.runFlag = runFlag;
+    sendSample.subPackets = 1;
+    std::memcpy(message, &sendSample, sizeof(sendSample));
+
+    m_writer.write(message, payloadSizeInBytes).or_else([](auto) {
+        std::cerr << "failed to write the broadcast message" << std::endl;
+        std::exit(EXIT_FAILURE);
+    });
+}
+
+PerfTopic IceoryxBroadcast::receivePerfTopic() noexcept
+{
+    uint8_t message[iox::popo::BroadcastWriter::MAX_MESSAGE_SIZE];
+    while (m_reader.take(message, sizeof(message)).has_error())
+    {
+    }
+
+    PerfTopic receivedSample;
+    std::memcpy(&receivedSample, message, sizeof(receivedSample));
+    return receivedSample;
+}
@@ -0,0 +1,43 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_BROADCAST_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_BROADCAST_HPP
+
+#include "base.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/popo/broadcast_reader.hpp"
+#include "iceoryx_posh/popo/broadcast_writer.hpp"
+
+class IceoryxBroadcast : public IcePerfBase
+{
+  public:
+    IceoryxBroadcast(const iox::capro::IdString_t& publisherName,
+                     const iox::capro::IdString_t& subscriberName) noexcept;
+    void initLeader() noexcept override;
+    void initFollower() noexcept override;
+    void shutdown() noexcept override;
+    uint32_t maxPayloadSize() const noexcept override;
+
+  private:
+    void init() noexcept;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    iox::popo::BroadcastWriter m_writer;
+    iox::popo::BroadcastReader m_reader;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_BROADCAST_HPP
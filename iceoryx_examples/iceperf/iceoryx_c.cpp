@@ -20,17 +20,24 @@
 #include <thread>
 
 IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept
+    : IceoryxC(publisherName, subscriberName, "C-API")
+{
+}
+
+IceoryxC::IceoryxC(const iox::capro::IdString_t& publisherName,
+                   const iox::capro::IdString_t& subscriberName,
+                   const char* const eventName) noexcept
 {
     iox_pub_options_t publisherOptions;
     iox_pub_options_init(&publisherOptions);
     publisherOptions.historyCapacity = 1U;
-    m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), "C-API", &publisherOptions);
+    m_publisher = iox_pub_init(&m_publisherStorage, "IcePerf", publisherName.c_str(), eventName, &publisherOptions);
 
     iox_sub_options_t subscriberOptions;
     iox_sub_options_init(&subscriberOptions);
     subscriberOptions.queueCapacity = 1U;
     subscriberOptions.historyRequest = 1U;
-    m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), "C-API", &subscriberOptions);
+    m_subscriber = iox_sub_init(&m_subscriberStorage, "IcePerf", subscriberName.c_str(), eventName, &subscriberOptions);
 }
 
 IceoryxC::~IceoryxC()
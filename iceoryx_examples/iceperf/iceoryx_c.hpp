@@ -33,8 +33,11 @@ class IceoryxC : public IcePerfBase
     void initFollower() noexcept override;
     void shutdown() noexcept override;
 
-  private:
-    void init() noexcept;
+  protected:
+    IceoryxC(const iox::capro::IdString_t& publisherName,
+             const iox::capro::IdString_t& subscriberName,
+             const char* const eventName) noexcept;
+    virtual void init() noexcept;
     void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
     PerfTopic receivePerfTopic() noexcept override;
 
@@ -0,0 +1,96 @@
+// Copyright 2026, Eclipse Foundation and the iceoryx contributors. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_c_wait.hpp"
+
+#include <iostream>
+
+constexpr uint64_t SUBSCRIBER_NOTIFICATION_ID{0U};
+
+IceoryxCWait::IceoryxCWait(const iox::capro::IdString_t& publisherName,
+                           const iox::capro::IdString_t& subscriberName) noexcept
+    : IceoryxC(publisherName, subscriberName, "C-Wait-API")
+{
+    m_waitSet = iox_ws_init(&m_waitSetStorage);
+}
+
+IceoryxCWait::~IceoryxCWait()
+{
+    iox_ws_deinit(m_waitSet);
+}
+
+void IceoryxCWait::init() noexcept
+{
+    IceoryxC::init();
+
+    if (iox_ws_attach_subscriber_state(
+            m_waitSet, m_subscriber, SubscriberState_HAS_DATA, SUBSCRIBER_NOTIFICATION_ID, nullptr)
+        != WaitSetResult_SUCCESS)
+    {
+        std::cerr << "failed to attach subscriber" << std::endl;
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+void IceoryxCWait::sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept
+{
+    // the batch API is used with a batch of one chunk to measure its overhead compared to the single chunk API
+    void* userPayloads[1U] = {nullptr};
+    if (iox_pub_loan_chunks(m_publisher, userPayloads, 1U, payloadSizeInBytes, alignof(PerfTopic))
+        == AllocationResult_SUCCESS)
+    {
+        auto sendSample = static_cast<PerfTopic*>(userPayloads[0U]);
+        sendSample->payloadSize = payloadSizeInBytes;
+        sendSample->runFlag = runFlag;
+        sendSample->subPackets = 1;
+        iox_pub_publish_chunks(m_publisher, userPayloads, 1U);
+    }
+}
+
+PerfTopic IceoryxCWait::receivePerfTopic() noexcept
+{
+    bool hasReceivedSample{false};
+    PerfTopic receivedSample;
+
+    do
+    {
+        // the notification ids are used directly; no iox_notification_info_t needs to be inspected
+        uint64_t notificationIds[1U];
+        uint64_t missedElements{0U};
+        const uint64_t numberOfNotifications =
+            iox_ws_wait_for_notification_ids(m_waitSet, notificationIds, 1U, &missedElements);
+        for (uint64_t i = 0U; i < numberOfNotifications; ++i)
+        {
+            if (notificationIds[i] != SUBSCRIBER_NOTIFICATION_ID)
+            {
+                continue;
+            }
+
+            const void* userPayloads[iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+            uint64_t numberOfChunks{0U};
+            if (iox_sub_take_chunks(
+                    m_subscriber, userPayloads, iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, &numberOfChunks)
+                == ChunkReceiveResult_SUCCESS)
+            {
+                receivedSample = *(static_cast<const PerfTopic*>(userPayloads[numberOfChunks - 1U]));
+                hasReceivedSample = true;
+                iox_sub_release_chunks(m_subscriber, userPayloads, numberOfChunks);
+            }
+        }
+    } while (!hasReceivedSample);
+
+    return receivedSample;
+}
@@ -0,0 +1,40 @@
+// Copyright 2026, Eclipse Foundation and the iceoryx contributors. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_EXAMPLES_ICEPERF_ICEORYX_C_WAIT_HPP
+#define IOX_EXAMPLES_ICEPERF_ICEORYX_C_WAIT_HPP
+
+#include "iceoryx_c.hpp"
+
+extern "C" {
+#include "iceoryx_binding_c/wait_set.h"
+}
+
+class IceoryxCWait : public IceoryxC
+{
+  public:
+    IceoryxCWait(const iox::capro::IdString_t& publisherName, const iox::capro::IdString_t& subscriberName) noexcept;
+    ~IceoryxCWait();
+
+  private:
+    void init() noexcept override;
+    void sendPerfTopic(const uint32_t payloadSizeInBytes, const RunFlag runFlag) noexcept override;
+    PerfTopic receivePerfTopic() noexcept override;
+
+    iox_ws_storage_t m_waitSetStorage;
+    iox_ws_t m_waitSet;
+};
+
+#endif // IOX_EXAMPLES_ICEPERF_ICEORYX_C_WAIT_HPP
@@ -17,7 +17,9 @@
 
 #include "iceperf_follower.hpp"
 #include "iceoryx.hpp"
+#include "iceoryx_broadcast.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_c_wait.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iceoryx_wait.hpp"
 #include "mq.hpp"
@@ -128,6 +130,20 @@ int IcePerfFollower::run() noexcept
         doMeasurement(iceoryxwait);
     }
 
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_WAIT_API)
+    {
+        std::cout << std::endl << "******  ICEORYX C WAITSET ********" << std::endl;
+        IceoryxCWait iceoryxcwait(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxcwait);
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_BROADCAST)
+    {
+        std::cout << std::endl << "****** ICEORYX BROADCAST  ********" << std::endl;
+        IceoryxBroadcast iceoryxbroadcast(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxbroadcast);
+    }
+
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
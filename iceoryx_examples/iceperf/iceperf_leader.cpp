@@ -18,7 +18,9 @@
 
 #include "iceperf_leader.hpp"
 #include "iceoryx.hpp"
+#include "iceoryx_broadcast.hpp"
 #include "iceoryx_c.hpp"
+#include "iceoryx_c_wait.hpp"
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
@@ -97,6 +99,11 @@ void IcePerfLeader::doMeasurement(IcePerfBase& ipcTechnology) noexcept
     const char* separator = " ";
     for (const auto payloadSize : payloadSizes)
     {
+        if (payloadSize > ipcTechnology.maxPayloadSize())
+        {
+            continue;
+        }
+
         uint64_t humanReadablePayloadSize{0};
         iox::string<2> memorySizeUnit{};
         std::tie(humanReadablePayloadSize, memorySizeUnit) = humanReadableMemorySize(payloadSize);
@@ -201,6 +208,20 @@ int IcePerfLeader::run() noexcept
         IceoryxWait iceoryxwait(PUBLISHER, SUBSCRIBER);
         doMeasurement(iceoryxwait);
     }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_C_WAIT_API)
+    {
+        std::cout << std::endl << "******  ICEORYX C WAITSET ********" << std::endl;
+        IceoryxCWait iceoryxcwait(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxcwait);
+    }
+
+    if (m_settings.technology == Technology::ALL || m_settings.technology == Technology::ICEORYX_BROADCAST)
+    {
+        std::cout << std::endl << "****** ICEORYX BROADCAST  ********" << std::endl;
+        IceoryxBroadcast iceoryxbroadcast(PUBLISHER, SUBSCRIBER);
+        doMeasurement(iceoryxbroadcast);
+    }
     //! [create an run technologies]
 
     return EXIT_SUCCESS;
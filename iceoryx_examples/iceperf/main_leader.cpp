@@ -55,6 +55,8 @@ int main(int argc, char* argv[])
             std::cout << "                                          iceoryx-cpp-api," << std::endl;
             std::cout << "                                          iceoryx-cpp-waitset-api," << std::endl;
             std::cout << "                                          iceoryx-c-api," << std::endl;
+            std::cout << "                                          iceoryx-c-waitset-api," << std::endl;
+            std::cout << "                                          iceoryx-broadcast," << std::endl;
             std::cout << "                                          posix-message-queue," << std::endl;
             std::cout << "                                          unix-domain-sockets}" << std::endl;
             std::cout << "                                  default = 'all'" << std::endl;
@@ -99,6 +101,14 @@ int main(int argc, char* argv[])
             {
                 settings.technology = Technology::ICEORYX_C_API;
             }
+            else if (strcmp(optarg, "iceoryx-c-waitset-api") == 0)
+            {
+                settings.technology = Technology::ICEORYX_C_WAIT_API;
+            }
+            else if (strcmp(optarg, "iceoryx-broadcast") == 0)
+            {
+                settings.technology = Technology::ICEORYX_BROADCAST;
+            }
             else if (strcmp(optarg, "posix-message-queue") == 0)
             {
                 settings.technology = Technology::POSIX_MESSAGE_QUEUE;
@@ -109,8 +119,9 @@ int main(int argc, char* argv[])
             }
             else
             {
-                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-c-api', "
-                             "'posix-message-queue' and 'unix-domain-sockets'!"
+                std::cerr << "Options for 'technology' are 'all', 'iceoryx-cpp-api', 'iceoryx-cpp-waitset-api', "
+                             "'iceoryx-c-api', 'iceoryx-c-waitset-api', 'iceoryx-broadcast', 'posix-message-queue' "
+                             "and 'unix-domain-sockets'!"
                           << std::endl;
                 return EXIT_FAILURE;
             }
@@ -34,3 +34,4 @@ set(IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY 2 CACHE STRING "")
 set(IOX_MAX_RESPONSE_QUEUE_CAPACITY 2 CACHE STRING "")
 set(IOX_MAX_REQUEST_QUEUE_CAPACITY 2 CACHE STRING "")
 set(IOX_MAX_CLIENTS_PER_SERVER 2 CACHE STRING "")
+set(IOX_MAX_SERVERS_PER_CLIENT 2 CACHE STRING "")
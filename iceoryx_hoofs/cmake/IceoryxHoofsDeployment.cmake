@@ -30,5 +30,14 @@ configure_option(
     NAME IOX_MAX_NAMED_PIPE_NUMBER_OF_MESSAGES
     DEFAULT_VALUE 10
 )
+configure_option(
+    NAME IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE
+    DEFAULT_VALUE 64
+)
+math(EXPR IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE_MASK
+     "${IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE} & (${IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE} - 1)")
+if(IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE LESS 8 OR NOT IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE_MASK EQUAL 0)
+    message(FATAL_ERROR "IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE must be a power of two and at least 8!")
+endif()
 
 message(STATUS "[i] <<<<<<<<<<<<<< End iceoryx_hoofs configuration: >>>>>>>>>>>>>>")
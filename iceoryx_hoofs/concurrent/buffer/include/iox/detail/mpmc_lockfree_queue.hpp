@@ -19,7 +19,9 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_HPP
 
 #include "iox/detail/mpmc_lockfree_queue/mpmc_index_queue.hpp"
+#include "iox/memory.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/uninitialized_array.hpp"
 
 #include <atomic>
@@ -66,6 +68,13 @@ class MpmcLockFreeQueue
     /// @note threadsafe, lockfree
     bool tryPush(const ElementType& value) noexcept;
 
+    /// @brief tries to insert multiple values in FIFO order, copies the values internally
+    /// @param values to be inserted
+    /// @return the number of inserted values, i.e. less than values.size() if the queue became full
+    /// @note threadsafe, lockfree; the indices of the buffer cells are acquired and published in bulk
+    /// and values concurrently pushed by other producers might be interleaved
+    uint64_t tryPush(const span<const ElementType> values) noexcept;
+
     /// @brief inserts value in FIFO order, always succeeds by removing the oldest value
     /// when the queue is detected to be full (overflow)
     /// @param value to be inserted is copied into the queue
@@ -85,6 +94,13 @@ class MpmcLockFreeQueue
     /// @note threadsafe, lockfree
     iox::optional<ElementType> pop() noexcept;
 
+    /// @brief tries to remove multiple values in FIFO order
+    /// @param values storage for the removed values; at most values.size() values are removed
+    /// @return the number of removed values
+    /// @note threadsafe, lockfree; the indices of the buffer cells are acquired and released in bulk
+    /// and values concurrently popped by other consumers might be interleaved
+    uint64_t pop(const span<ElementType> values) noexcept;
+
     /// @brief check whether the queue is empty
     /// @return true iff the queue is empty
     /// @note that if the queue is used concurrently it might
@@ -103,6 +119,9 @@ class MpmcLockFreeQueue
   protected:
     using Queue = MpmcIndexQueue<Capacity>;
 
+    /// @brief the number of indices which are acquired at once by the bulk operations
+    static constexpr uint64_t MAX_INDICES_PER_BULK_OPERATION{Capacity < 64U ? Capacity : 64U};
+
     // remark: actually m_freeIndices do not have to be in a queue, it could be another
     // multi-push multi-pop capable lockfree container (e.g. a stack or a list)
     Queue m_freeIndices;
@@ -112,7 +131,7 @@ class MpmcLockFreeQueue
 
     UninitializedArray<ElementType, Capacity> m_buffer;
 
-    std::atomic<uint64_t> m_size{0U};
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_size{0U};
 
     // template is needed to distinguish between lvalue and rvalue T references
     // (universal reference type deduction)
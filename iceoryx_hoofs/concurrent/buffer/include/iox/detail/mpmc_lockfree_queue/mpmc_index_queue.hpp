@@ -19,7 +19,9 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOCKFREE_QUEUE_MPMC_INDEX_QUEUE_HPP
 
 #include "iox/detail/mpmc_lockfree_queue/cyclic_index.hpp"
+#include "iox/memory.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 #include <atomic>
 #include <type_traits>
@@ -85,10 +87,22 @@ class MpmcIndexQueue
     /// and the capacity is large enough to hold them all)
     void push(const ValueType index) noexcept;
 
+    /// @brief push multiple indices into the queue in FIFO order
+    /// @param indices to be pushed
+    /// note that the write position is only updated once after all indices are published
+    /// (concurrent pushes help with the update like with the single index push)
+    void push(const span<const ValueType> indices) noexcept;
+
     /// @brief pop an index from the queue in FIFO order if the queue not empty
     /// @return index if the queue was is empty, nullopt oterwise
     optional<ValueType> pop() noexcept;
 
+    /// @brief pop multiple consecutive indices from the queue in FIFO order
+    /// @param indices storage for the popped indices; at most indices.size() indices are popped
+    /// @return the number of popped indices
+    /// note that the range of indices is acquired with a single update of the read position
+    uint64_t pop(const span<ValueType> indices) noexcept;
+
     /// @brief pop an index from the queue in FIFO order if the queue is full
     /// @return index if the queue was full, nullopt otherwise
     optional<ValueType> popIfFull() noexcept;
@@ -119,8 +133,9 @@ class MpmcIndexQueue
     // NOLINTNEXTLINE(*avoid-c-arrays)
     Cell m_cells[Capacity];
 
-    std::atomic<Index> m_readPosition;
-    std::atomic<Index> m_writePosition;
+    // the positions are modified by different threads/processes and are therefore placed on separate cache lines
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<Index> m_readPosition;
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<Index> m_writePosition;
 
     /// @brief load the value from m_cells at a position with a given memory order
     /// @param position position to load the value from
@@ -135,6 +135,65 @@ inline void MpmcIndexQueue<Capacity, ValueType>::push(const ValueType index) noe
         writePosition, newWritePosition, std::memory_order_relaxed, std::memory_order_relaxed);
 }
 
+template <uint64_t Capacity, typename ValueType>
+inline void MpmcIndexQueue<Capacity, ValueType>::push(const span<const ValueType> indices) noexcept
+{
+    // the case analysis of the single index push applies; the only difference is that the write position is not
+    // updated after each published index but only once after all indices are published
+    // the local writePosition may therefore be ahead of m_writePosition; a concurrent push which detects one of
+    // the indices published by us (case (2)) helps with the update as usual and if we have to reload the write
+    // position in case (2) to (4) we might help with the update of our own indices, both is no problem
+
+    uint64_t numberOfPublishedIndices{0U};
+    auto writePosition = m_writePosition.load(std::memory_order_relaxed);
+    while (numberOfPublishedIndices < indices.size())
+    {
+        auto oldValue = loadvalueAt(writePosition, std::memory_order_relaxed);
+
+        auto cellIsFree = oldValue.isOneCycleBehind(writePosition);
+
+        if (cellIsFree)
+        {
+            // case (1)
+            Index newValue(indices[numberOfPublishedIndices], writePosition.getCycle());
+
+            bool published = m_cells[writePosition.getIndex()].compare_exchange_weak(
+                oldValue, newValue, std::memory_order_relaxed, std::memory_order_relaxed);
+
+            if (published)
+            {
+                ++numberOfPublishedIndices;
+                writePosition = writePosition + 1U;
+                continue;
+            }
+        }
+
+        auto writePositionRequiresUpdate = oldValue.getCycle() == writePosition.getCycle();
+
+        if (writePositionRequiresUpdate)
+        {
+            // case (2)
+            Index newWritePosition(writePosition + 1U);
+            m_writePosition.compare_exchange_strong(
+                writePosition, newWritePosition, std::memory_order_relaxed, std::memory_order_relaxed);
+        }
+        else
+        {
+            // case (3) and (4)
+            writePosition = m_writePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    // all cells before the local writePosition are published, therefore m_writePosition can be advanced to it
+    // unless a concurrent push has already advanced it even further
+    auto currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    while ((writePosition - currentWritePosition) > 0
+           && !m_writePosition.compare_exchange_weak(
+               currentWritePosition, writePosition, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
 template <uint64_t Capacity, typename ValueType>
 inline bool MpmcIndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
 {
@@ -195,6 +254,68 @@ inline bool MpmcIndexQueue<Capacity, ValueType>::pop(ValueType& index) noexcept
     return true;
 }
 
+template <uint64_t Capacity, typename ValueType>
+inline uint64_t MpmcIndexQueue<Capacity, ValueType>::pop(const span<ValueType> indices) noexcept
+{
+    // the case analysis of the single index pop applies to the cell at the read position; all consecutive cells
+    // with the same cycle as their position are valid to read as well and the ownership of the whole range is
+    // gained with a single compare-exchange of the read position
+
+    if (indices.empty())
+    {
+        return 0U;
+    }
+
+    auto readPosition = m_readPosition.load(std::memory_order_relaxed);
+    while (true)
+    {
+        auto value = loadvalueAt(readPosition, std::memory_order_relaxed);
+
+        auto cellIsValidToRead = readPosition.getCycle() == value.getCycle();
+
+        if (!cellIsValidToRead)
+        {
+            auto isEmpty = value.isOneCycleBehind(readPosition);
+
+            if (isEmpty)
+            {
+                // case (2)
+                return 0U;
+            }
+
+            // case (3) and (4)
+            readPosition = m_readPosition.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        // case (1)
+        indices[0] = value.getIndex();
+        uint64_t numberOfIndices{1U};
+        while (numberOfIndices < indices.size())
+        {
+            const auto position = readPosition + numberOfIndices;
+            value = loadvalueAt(position, std::memory_order_relaxed);
+            if (position.getCycle() != value.getCycle())
+            {
+                break;
+            }
+            indices[numberOfIndices] = value.getIndex();
+            ++numberOfIndices;
+        }
+
+        // the values cannot be overwritten as long as the read position is not advanced, hence if the
+        // compare-exchange succeeds all values read above are valid
+        Index newReadPosition(readPosition + numberOfIndices);
+        if (m_readPosition.compare_exchange_weak(
+                readPosition, newReadPosition, std::memory_order_relaxed, std::memory_order_relaxed))
+        {
+            return numberOfIndices;
+        }
+
+        // readPosition is outdated and was updated by the failed compare-exchange, retry operation
+    }
+}
+
 template <uint64_t Capacity, typename ValueType>
 inline bool MpmcIndexQueue<Capacity, ValueType>::popIfFull(ValueType& index) noexcept
 {
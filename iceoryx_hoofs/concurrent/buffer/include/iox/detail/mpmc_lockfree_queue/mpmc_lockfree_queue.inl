@@ -22,6 +22,7 @@
 #include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/optional.hpp"
 
+#include <algorithm>
 #include <utility>
 
 namespace iox
@@ -75,6 +76,36 @@ inline bool MpmcLockFreeQueue<ElementType, Capacity>::tryPush(ElementType&& valu
     return true;
 }
 
+template <typename ElementType, uint64_t Capacity>
+inline uint64_t MpmcLockFreeQueue<ElementType, Capacity>::tryPush(const span<const ElementType> values) noexcept
+{
+    UninitializedArray<uint64_t, MAX_INDICES_PER_BULK_OPERATION> indices;
+    uint64_t numberOfValues{0U};
+
+    while (numberOfValues < values.size())
+    {
+        const uint64_t requestedValues = std::min(values.size() - numberOfValues, MAX_INDICES_PER_BULK_OPERATION);
+        const uint64_t numberOfIndices = m_freeIndices.pop(span<uint64_t>(indices.begin(), requestedValues));
+        if (numberOfIndices == 0U)
+        {
+            break; // detected full queue
+        }
+
+        for (uint64_t i = 0U; i < numberOfIndices; ++i)
+        {
+            new (&m_buffer[indices[i]]) ElementType(values[numberOfValues + i]);
+        }
+
+        // also used for buffer synchronization
+        m_size.fetch_add(numberOfIndices, std::memory_order_release);
+
+        m_usedIndices.push(span<const uint64_t>(indices.begin(), numberOfIndices));
+        numberOfValues += numberOfIndices;
+    }
+
+    return numberOfValues;
+}
+
 template <typename ElementType, uint64_t Capacity>
 template <typename T>
 inline iox::optional<ElementType> MpmcLockFreeQueue<ElementType, Capacity>::pushImpl(T&& value) noexcept
@@ -142,6 +173,38 @@ inline iox::optional<ElementType> MpmcLockFreeQueue<ElementType, Capacity>::pop(
     return result;
 }
 
+template <typename ElementType, uint64_t Capacity>
+inline uint64_t MpmcLockFreeQueue<ElementType, Capacity>::pop(const span<ElementType> values) noexcept
+{
+    UninitializedArray<uint64_t, MAX_INDICES_PER_BULK_OPERATION> indices;
+    uint64_t numberOfValues{0U};
+
+    while (numberOfValues < values.size())
+    {
+        const uint64_t requestedValues = std::min(values.size() - numberOfValues, MAX_INDICES_PER_BULK_OPERATION);
+        const uint64_t numberOfIndices = m_usedIndices.pop(span<uint64_t>(indices.begin(), requestedValues));
+        if (numberOfIndices == 0U)
+        {
+            break; // detected empty queue
+        }
+
+        // also used for buffer synchronization
+        m_size.fetch_sub(numberOfIndices, std::memory_order_acquire);
+
+        for (uint64_t i = 0U; i < numberOfIndices; ++i)
+        {
+            auto& element = m_buffer[indices[i]];
+            values[numberOfValues + i] = std::move(element);
+            element.~ElementType();
+        }
+
+        m_freeIndices.push(span<const uint64_t>(indices.begin(), numberOfIndices));
+        numberOfValues += numberOfIndices;
+    }
+
+    return numberOfValues;
+}
+
 template <typename ElementType, uint64_t Capacity>
 inline bool MpmcLockFreeQueue<ElementType, Capacity>::empty() const noexcept
 {
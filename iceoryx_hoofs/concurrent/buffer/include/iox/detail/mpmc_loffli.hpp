@@ -18,6 +18,7 @@
 #ifndef IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOFFLI_HPP
 #define IOX_HOOFS_CONCURRENT_BUFFER_MPMC_LOFFLI_HPP
 
+#include "iox/memory.hpp"
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -71,8 +72,10 @@ class MpmcLoFFLi
 
     uint32_t m_size{0U};
     Index_t m_invalidIndex{0U};
-    std::atomic<Node> m_head{{0U, 1U}};
     iox::RelativePointer<Index_t> m_nextFreeIndex;
+    // the head is modified by every pop and push; it is placed on its own cache line so that the read-only members
+    // above and the neighbouring objects are not invalidated
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<Node> m_head{{0U, 1U}};
 
   public:
     MpmcLoFFLi() noexcept = default;
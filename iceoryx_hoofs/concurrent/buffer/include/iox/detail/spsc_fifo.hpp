@@ -18,7 +18,9 @@
 #ifndef IOX_HOOFS_CONCURRENT_BUFFER_SPSC_FIFO_HPP
 #define IOX_HOOFS_CONCURRENT_BUFFER_SPSC_FIFO_HPP
 
+#include "iox/memory.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/uninitialized_array.hpp"
 
 #include <atomic>
@@ -41,6 +43,14 @@ class SpscFifo
     ///         true, otherwise false
     bool push(const ValueType& value) noexcept;
 
+    /// @brief pushes multiple values into the fifo; the values are copied in contiguous runs and the write position is
+    /// advanced only once for all values
+    /// @note restricted thread-safe: can only be accessed from one thread. The authorization to push into the FIFO can
+    /// be transferred to another thread if appropriate synchronization mechanisms are used.
+    /// @param[in] values to push in FIFO order; only as many values as there is free space are pushed
+    /// @return the number of pushed values
+    uint64_t push(const span<const ValueType> values) noexcept;
+
     /// @brief returns the oldest value from the fifo and removes it
     /// @note restricted thread-safe: can only be accessed from one thread. The authorization to pop from the FIFO can
     /// be transferred to another thread if appropriate synchronization mechanisms are used.
@@ -48,6 +58,14 @@ class SpscFifo
     ///         otherwise it contains a nullopt
     optional<ValueType> pop() noexcept;
 
+    /// @brief removes the oldest values from the fifo and stores them in FIFO order in the provided storage; the values
+    /// are copied in contiguous runs and the read position is advanced only once for all values
+    /// @note restricted thread-safe: can only be accessed from one thread. The authorization to pop from the FIFO can
+    /// be transferred to another thread if appropriate synchronization mechanisms are used.
+    /// @param[out] values storage for the removed values; at most values.size() values are removed
+    /// @return the number of removed values
+    uint64_t pop(const span<ValueType> values) noexcept;
+
     /// @brief returns true when the fifo is empty, otherwise false
     /// @note thread safe (the result might already be outdated when used). Expected to be called from either the push
     /// or the pop thread but not from a third thread
@@ -67,8 +85,10 @@ class SpscFifo
 
   private:
     UninitializedArray<ValueType, Capacity> m_data;
-    std::atomic<uint64_t> m_writePos{0};
-    std::atomic<uint64_t> m_readPos{0};
+    // the producer and the consumer usually run in different processes; each position is placed on its own cache line
+    // to prevent that an update of one position invalidates the cached copy of the other one
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_writePos{0};
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_readPos{0};
 };
 
 } // namespace concurrent
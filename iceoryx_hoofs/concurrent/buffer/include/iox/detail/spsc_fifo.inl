@@ -20,6 +20,8 @@
 
 #include "iox/detail/spsc_fifo.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace concurrent
@@ -63,6 +65,27 @@ inline bool SpscFifo<ValueType, Capacity>::push(const ValueType& value) noexcept
     return true;
 }
 
+template <class ValueType, uint64_t Capacity>
+inline uint64_t SpscFifo<ValueType, Capacity>::push(const span<const ValueType> values) noexcept
+{
+    // see the single element push for the reasoning of the memory orders
+    auto currentWritePos = m_writePos.load(std::memory_order_relaxed);
+    auto currentReadPos = m_readPos.load(std::memory_order_acquire);
+
+    const uint64_t freeSpace = Capacity - (currentWritePos - currentReadPos);
+    const uint64_t numberOfValues = std::min(freeSpace, values.size());
+
+    // the values are written in at most two contiguous runs, up to the end of the buffer and from its beginning
+    const uint64_t startIndex = currentWritePos % Capacity;
+    const uint64_t firstRun = std::min(numberOfValues, Capacity - startIndex);
+    std::copy(values.data(), values.data() + firstRun, m_data.begin() + startIndex);
+    std::copy(values.data() + firstRun, values.data() + numberOfValues, m_data.begin());
+
+    // SYNC POINT WRITE: m_data
+    m_writePos.store(currentWritePos + numberOfValues, std::memory_order_release);
+    return numberOfValues;
+}
+
 template <class ValueType, uint64_t Capacity>
 inline bool SpscFifo<ValueType, Capacity>::is_full(uint64_t currentReadPos, uint64_t currentWritePos) const noexcept
 {
@@ -124,6 +147,27 @@ inline optional<ValueType> SpscFifo<ValueType, Capacity>::pop() noexcept
     m_readPos.store(currentReadPos + 1, std::memory_order_release);
     return out;
 }
+
+template <class ValueType, uint64_t Capacity>
+inline uint64_t SpscFifo<ValueType, Capacity>::pop(const span<ValueType> values) noexcept
+{
+    // see the single element pop for the reasoning of the memory orders
+    auto currentReadPos = m_readPos.load(std::memory_order_relaxed);
+    auto currentWritePos = m_writePos.load(std::memory_order_acquire);
+
+    const uint64_t availableValues = currentWritePos - currentReadPos;
+    const uint64_t numberOfValues = std::min(availableValues, values.size());
+
+    // the values are read in at most two contiguous runs, up to the end of the buffer and from its beginning
+    const uint64_t startIndex = currentReadPos % Capacity;
+    const uint64_t firstRun = std::min(numberOfValues, Capacity - startIndex);
+    std::copy(m_data.begin() + startIndex, m_data.begin() + startIndex + firstRun, values.data());
+    std::copy(m_data.begin(), m_data.begin() + (numberOfValues - firstRun), values.data() + firstRun);
+
+    // SYNC POINT READ: m_data
+    m_readPos.store(currentReadPos + numberOfValues, std::memory_order_release);
+    return numberOfValues;
+}
 } // namespace concurrent
 } // namespace iox
 
@@ -19,6 +19,8 @@
 #define IOX_HOOFS_CONCURRENT_BUFFER_SPSC_SOFI_HPP
 
 #include "iceoryx_platform/platform_correction.hpp"
+#include "iox/memory.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
 #include "iox/uninitialized_array.hpp"
 
@@ -103,6 +105,15 @@ class SpscSofi
     /// @endcode
     bool push(const ValueType& valueIn, ValueType& valueOut) noexcept;
 
+    /// @brief pushes multiple elements into SpscSofi with a single update of the write position. Other than the single
+    ///         element push, this does not overflow; only as many values as there is free space are pushed and the
+    ///         remaining ones can be pushed with the single element push which handles the overflow
+    /// @param[in] valuesIn values which should be stored in FIFO order
+    /// @concurrent restricted thread safe: single pop, single push no
+    ///             push calls from multiple contexts
+    /// @return the number of pushed values
+    uint64_t push(const span<const ValueType> valuesIn) noexcept;
+
     /// @brief pop the oldest element
     /// @param[out] valueOut storage of the pop'ed value
     /// @concurrent restricted thread safe: single pop, single push no
@@ -110,6 +121,13 @@ class SpscSofi
     /// @return false if SpscSofi is empty, otherwise true
     bool pop(ValueType& valueOut) noexcept;
 
+    /// @brief pop the oldest elements with a single update of the read position
+    /// @param[out] valuesOut storage of the pop'ed values in FIFO order; at most valuesOut.size() values are pop'ed
+    /// @concurrent restricted thread safe: single pop, single push no
+    ///             pop or popIf calls from multiple contexts
+    /// @return the number of pop'ed values
+    uint64_t pop(const span<ValueType> valuesOut) noexcept;
+
     /// @brief conditional pop call to provide an alternative for a peek
     ///         and pop approach. If the verificator returns true the
     ///         peeked element is returned.
@@ -158,9 +176,10 @@ class SpscSofi
     uint64_t m_size = INTERNAL_SPSC_SOFI_SIZE;
 
     /// @brief the write/read pointers are "atomic pointers" so that they are not
-    /// reordered (read or written too late)
-    std::atomic<uint64_t> m_readPosition{0};
-    std::atomic<uint64_t> m_writePosition{0};
+    /// reordered (read or written too late); each one is placed on its own cache line to avoid false sharing between
+    /// the producer and the consumer
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_readPosition{0};
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_writePosition{0};
 };
 
 } // namespace concurrent
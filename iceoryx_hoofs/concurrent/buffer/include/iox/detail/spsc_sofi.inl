@@ -20,6 +20,8 @@
 
 #include "iox/detail/spsc_sofi.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace concurrent
@@ -88,6 +90,31 @@ inline bool SpscSofi<ValueType, CapacityValue>::pop(ValueType& valueOut) noexcep
     return popIf(valueOut, [](ValueType) { return true; });
 }
 
+template <class ValueType, uint64_t CapacityValue>
+inline uint64_t SpscSofi<ValueType, CapacityValue>::pop(const span<ValueType> valuesOut) noexcept
+{
+    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+    uint64_t numberOfValues{0U};
+
+    do
+    {
+        const uint64_t availableValues = m_writePosition.load(std::memory_order_acquire) - currentReadPosition;
+        numberOfValues = std::min(availableValues, valuesOut.size());
+
+        // like in popIf the values are copied with memcpy since the push thread might overwrite them in case of an
+        // overflow; this is detected by a changed read position and the values are read again
+        const uint64_t startIndex = currentReadPosition % m_size;
+        const uint64_t firstRun = std::min(numberOfValues, m_size - startIndex);
+        std::memcpy(valuesOut.data(), m_data.begin() + startIndex, firstRun * sizeof(ValueType));
+        std::memcpy(valuesOut.data() + firstRun, m_data.begin(), (numberOfValues - firstRun) * sizeof(ValueType));
+    } while (!m_readPosition.compare_exchange_weak(currentReadPosition,
+                                                   currentReadPosition + numberOfValues,
+                                                   std::memory_order_acq_rel,
+                                                   std::memory_order_acquire));
+
+    return numberOfValues;
+}
+
 template <class ValueType, uint64_t CapacityValue>
 template <typename Verificator_T>
 inline bool SpscSofi<ValueType, CapacityValue>::popIf(ValueType& valueOut, const Verificator_T& verificator) noexcept
@@ -187,6 +214,26 @@ inline bool SpscSofi<ValueType, CapacityValue>::push(const ValueType& valueIn, V
     return !SOFI_OVERFLOW;
 }
 
+template <class ValueType, uint64_t CapacityValue>
+inline uint64_t SpscSofi<ValueType, CapacityValue>::push(const span<const ValueType> valuesIn) noexcept
+{
+    uint64_t currentWritePosition = m_writePosition.load(std::memory_order_relaxed);
+    uint64_t currentReadPosition = m_readPosition.load(std::memory_order_acquire);
+
+    // a concurrent pop can only increase the free space, therefore the values can be written without further checks;
+    // the slots are not accessed by the pop thread until the write position is updated
+    const uint64_t freeSpace = capacity() - (currentWritePosition - currentReadPosition);
+    const uint64_t numberOfValues = std::min(freeSpace, valuesIn.size());
+
+    const uint64_t startIndex = currentWritePosition % m_size;
+    const uint64_t firstRun = std::min(numberOfValues, m_size - startIndex);
+    std::memcpy(m_data.begin() + startIndex, valuesIn.data(), firstRun * sizeof(ValueType));
+    std::memcpy(m_data.begin(), valuesIn.data() + firstRun, (numberOfValues - firstRun) * sizeof(ValueType));
+
+    m_writePosition.store(currentWritePosition + numberOfValues, std::memory_order_release);
+    return numberOfValues;
+}
+
 } // namespace concurrent
 } // namespace iox
 
@@ -17,12 +17,21 @@
 #ifndef IOX_HOOFS_MEMORY_MEMORY_HPP
 #define IOX_HOOFS_MEMORY_MEMORY_HPP
 
+#include "iox/iceoryx_hoofs_deployment.hpp"
+
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
 
 namespace iox
 {
+/// @brief The minimal offset between two objects to avoid false sharing. Atomics which are modified concurrently by
+/// different threads or processes are aligned to this value so that they do not share a cache line. It can be
+/// configured with the cmake option 'IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE'.
+constexpr uint64_t HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE{build::IOX_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE};
+static_assert((HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE & (HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE - 1U)) == 0U
+                  && HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE >= alignof(uint64_t),
+              "The hardware destructive interference size must be a power of two and at least 8 bytes");
 
 /// @note value + alignment - 1 must not exceed the maximum value for type T
 /// @note alignment must be a power of two
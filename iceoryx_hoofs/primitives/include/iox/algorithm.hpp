@@ -236,6 +236,20 @@ constexpr bool isPowerOfTwo(const T n) noexcept
     // AXIVION Next Construct AutosarC++19_03-M0.1.2, AutosarC++19_03-M0.1.9, FaultDetection-DeadBranches : False positive! 'n' can be zero.
     return (n > 0) && ((n & (n - 1U)) == 0U);
 }
+
+/// @brief Returns the smallest power of two which is not less than the given unsigned integer
+/// @note the result must be representable by the type, i.e. 'n' must not exceed the largest power of two of 'T'
+template <typename T>
+constexpr T nextPowerOfTwo(const T n) noexcept
+{
+    static_assert(std::is_unsigned<T>::value && !std::is_same<T, bool>::value, "Only unsigned integer are allowed!");
+    T powerOfTwo{1U};
+    while (powerOfTwo < n)
+    {
+        powerOfTwo = static_cast<T>(powerOfTwo << 1U);
+    }
+    return powerOfTwo;
+}
 } // namespace iox
 
 #include "iox/detail/algorithm.inl"
@@ -67,7 +67,15 @@ inline void ConsoleLogger::logChar(const char value) noexcept
 template <typename T, typename std::enable_if_t<std::is_arithmetic<T>::value, bool>>
 inline void ConsoleLogger::logDec(const T value) noexcept
 {
-    logArithmetic(value, LOG_FORMAT_DEC<T>);
+    if constexpr (std::is_integral<T>::value && !std::is_same<T, char>::value)
+    {
+        constexpr int32_t DECIMAL_BASE{10};
+        logInteger(value, DECIMAL_BASE);
+    }
+    else
+    {
+        logArithmetic(value, LOG_FORMAT_DEC<T>);
+    }
 }
 
 template <typename T,
@@ -76,13 +84,22 @@ template <typename T,
                                     bool>>
 inline void ConsoleLogger::logHex(const T value) noexcept
 {
-    logArithmetic(value, LOG_FORMAT_HEX<T>);
+    if constexpr (std::is_integral<T>::value)
+    {
+        constexpr int32_t HEXADECIMAL_BASE{16};
+        logInteger(value, HEXADECIMAL_BASE);
+    }
+    else
+    {
+        logArithmetic(value, LOG_FORMAT_HEX<T>);
+    }
 }
 
 template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool>>
 inline void ConsoleLogger::logOct(const T value) noexcept
 {
-    logArithmetic(value, LOG_FORMAT_OCT<T>);
+    constexpr int32_t OCTAL_BASE{8};
+    logInteger(value, OCTAL_BASE);
 }
 
 template <typename T, typename std::enable_if_t<std::is_integral<T>::value && std::is_unsigned<T>::value, bool>>
@@ -151,6 +168,35 @@ inline void ConsoleLogger::logArithmetic(const T value, const char* format) noex
     }
 }
 
+template <typename T>
+inline void ConsoleLogger::logInteger(const T value, const int32_t base) noexcept
+{
+    // large enough for a 64 bit integer in base 8 and the sign
+    constexpr uint32_t MAX_INTEGER_CHARS{24U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char digits[MAX_INTEGER_CHARS];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const auto result = iox::to_chars(&digits[0], &digits[0] + MAX_INTEGER_CHARS, value, base);
+    auto stringSizeToLog = static_cast<uint32_t>(result.ptr - &digits[0]);
+
+    auto& data = getThreadLocalData();
+    const auto remainingBufferSize = ThreadLocalData::BUFFER_SIZE - data.bufferWriteIndex;
+    if (stringSizeToLog > remainingBufferSize)
+    {
+        /// @todo iox-#1755 currently we don't support log messages larger than the log buffer and everything larger
+        /// that the log buffer will be truncated;
+        /// it is intended to flush the buffer and create a new log message later on
+        stringSizeToLog = remainingBufferSize;
+    }
+
+    // NOLINTJUSTIFICATION it is ensured that the index cannot be out of bounds
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+    std::memcpy(&data.buffer[data.bufferWriteIndex], &digits[0], stringSizeToLog);
+    data.bufferWriteIndex += stringSizeToLog;
+    data.buffer[data.bufferWriteIndex] = 0;
+    // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
 } // namespace log
 } // namespace iox
 
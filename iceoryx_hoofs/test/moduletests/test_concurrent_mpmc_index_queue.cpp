@@ -19,6 +19,9 @@
 
 #include "iox/detail/mpmc_lockfree_queue/mpmc_index_queue.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -306,4 +309,122 @@ TYPED_TEST(MpmcIndexQueueTest, popIfSizeIsAtLeastCapacityReturnsNothingIfQueueIs
     ASSERT_FALSE(index.has_value());
 }
 
+TYPED_TEST(MpmcIndexQueueTest, bulkPopFromFullQueueReturnsAllIndicesInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3bedf0f8-0ed1-4473-ad9e-7d8ded38cb4a");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity + 1U);
+    ASSERT_EQ(q.pop(iox::span<index_t>(indices.data(), indices.size())), capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(q.pop(iox::span<index_t>(indices.data(), indices.size())), 0U);
+}
+
+TYPED_TEST(MpmcIndexQueueTest, bulkPopWithEmptySpanReturnsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e6145a8-09e5-4493-acf2-ba989239512f");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->fullQueue;
+
+    index_t index{0U};
+    EXPECT_EQ(q.pop(iox::span<index_t>(&index, 0U)), 0U);
+    EXPECT_TRUE(q.popIfSizeIsAtLeast(q.capacity()).has_value());
+}
+
+TYPED_TEST(MpmcIndexQueueTest, bulkPushOfAllIndicesResultsInFullQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a34de9fe-d205-42ad-bfdd-c46994f3d657");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity);
+    ASSERT_EQ(this->fullQueue.pop(iox::span<index_t>(indices.data(), indices.size())), capacity);
+    std::reverse(indices.begin(), indices.end());
+
+    q.push(iox::span<const index_t>(indices.data(), indices.size()));
+
+    // the write position must be up to date, otherwise the full queue is not detected
+    auto index = q.popIfFull();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(index.value(), capacity - 1U);
+    for (uint64_t i = 1U; i < capacity; ++i)
+    {
+        index = q.pop();
+        ASSERT_TRUE(index.has_value());
+        EXPECT_EQ(index.value(), capacity - 1U - i);
+    }
+    EXPECT_TRUE(q.empty());
+}
+
+TYPED_TEST(MpmcIndexQueueTest, bulkPushAndPopWorkForAllBatchSizesAndStartPositions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf7321b6-326a-4d45-8901-e62a16136d80");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity);
+    ASSERT_EQ(this->fullQueue.pop(iox::span<index_t>(indices.data(), indices.size())), capacity);
+    std::vector<index_t> poppedIndices(capacity);
+
+    // large queues are tested with a stride to keep the runtime reasonable
+    const uint64_t stride = std::max<uint64_t>(1U, capacity / 16U);
+    for (uint64_t startPosition = 0U; startPosition < capacity; startPosition += stride)
+    {
+        for (uint64_t batchSize = 1U; batchSize <= capacity; batchSize += stride)
+        {
+            // move the read and write position to the start position (relative to the current cycle)
+            for (uint64_t i = 0U; i < startPosition; ++i)
+            {
+                q.push(indices[0]);
+                ASSERT_TRUE(q.pop().has_value());
+            }
+
+            q.push(iox::span<const index_t>(indices.data(), batchSize));
+            ASSERT_EQ(q.pop(iox::span<index_t>(poppedIndices.data(), poppedIndices.size())), batchSize);
+            for (uint64_t i = 0U; i < batchSize; ++i)
+            {
+                EXPECT_EQ(poppedIndices[i], indices[i]);
+            }
+            ASSERT_TRUE(q.empty());
+        }
+    }
+}
+
+TYPED_TEST(MpmcIndexQueueTest, bulkAndSingleIndexOperationsCanBeMixed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "87836cd2-6798-4752-acbb-22e35aa93541");
+    using index_t = typename TestFixture::index_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<index_t> indices(capacity);
+    ASSERT_EQ(this->fullQueue.pop(iox::span<index_t>(indices.data(), indices.size())), capacity);
+
+    const uint64_t firstBatchSize = capacity / 2U;
+    q.push(iox::span<const index_t>(indices.data(), firstBatchSize));
+    for (uint64_t i = firstBatchSize; i < capacity; ++i)
+    {
+        q.push(indices[i]);
+    }
+
+    auto index = q.pop();
+    ASSERT_TRUE(index.has_value());
+    EXPECT_EQ(index.value(), 0U);
+
+    std::vector<index_t> poppedIndices(capacity);
+    ASSERT_EQ(q.pop(iox::span<index_t>(poppedIndices.data(), poppedIndices.size())), capacity - 1U);
+    for (uint64_t i = 1U; i < capacity; ++i)
+    {
+        EXPECT_EQ(poppedIndices[i - 1U], i);
+    }
+}
+
 } // namespace
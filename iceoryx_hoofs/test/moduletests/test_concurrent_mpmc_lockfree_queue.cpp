@@ -21,6 +21,11 @@
 #include "iox/detail/mpmc_lockfree_queue.hpp"
 #include "iox/detail/mpmc_resizeable_lockfree_queue.hpp"
 
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <vector>
+
 // We test the common functionality of LockFreeQueue and ResizableLockFreeQueue here
 // in typed tests to reduce code duplication.
 
@@ -281,6 +286,102 @@ TYPED_TEST(MpmcLockFreeQueueTest, poppedElementsAreInFifoOrder)
     EXPECT_EQ(q.size(), 0);
 }
 
+TYPED_TEST(MpmcLockFreeQueueTest, bulkPopRemovesAtMostSpanSizeElementsInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2523e0be-9125-4fee-b900-9b15153699e4");
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    auto capacity = q.capacity();
+
+    int value = 37;
+    this->fillQueue(value);
+
+    constexpr uint64_t BULK_SIZE{3U};
+    std::array<element_t, BULK_SIZE> elements;
+    uint64_t numberOfPoppedElements{0U};
+    while (numberOfPoppedElements < capacity)
+    {
+        auto expectedNumberOfElements = std::min(BULK_SIZE, capacity - numberOfPoppedElements);
+        ASSERT_EQ(q.pop(iox::span<element_t>(elements)), expectedNumberOfElements);
+        for (uint64_t i = 0; i < expectedNumberOfElements; ++i)
+        {
+            EXPECT_EQ(elements[i], value);
+            ++value;
+        }
+        numberOfPoppedElements += expectedNumberOfElements;
+    }
+
+    EXPECT_EQ(q.pop(iox::span<element_t>(elements)), 0U);
+    EXPECT_EQ(q.size(), 0);
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, bulkTryPushInsertsUntilFullCapacityIsUsed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5610722e-3526-48cd-8d8b-5e42f2c3b376");
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    std::vector<int> values(capacity + 3U);
+    std::iota(values.begin(), values.end(), 11);
+    if constexpr (std::is_copy_constructible<element_t>::value)
+    {
+        std::vector<element_t> elements(values.begin(), values.end());
+        EXPECT_EQ(q.tryPush(iox::span<const element_t>(elements.data(), elements.size())), capacity);
+        EXPECT_EQ(q.size(), capacity);
+        EXPECT_EQ(q.tryPush(iox::span<const element_t>(elements.data(), elements.size())), 0U);
+
+        for (uint64_t i = 0; i < capacity; ++i)
+        {
+            auto element = q.pop();
+            ASSERT_TRUE(element.has_value());
+            EXPECT_EQ(element.value(), values[i]);
+        }
+    }
+}
+
+TYPED_TEST(MpmcLockFreeQueueTest, bulkTryPushAndBulkPopWorkForAllBatchSizesAndStartPositions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "544f0c53-cd2a-48c6-a700-ebbe1942e14b");
+    using element_t = typename TestFixture::Queue::element_t;
+    auto& q = this->queue;
+    const auto capacity = q.capacity();
+
+    if constexpr (std::is_copy_constructible<element_t>::value)
+    {
+        std::vector<element_t> elements(capacity);
+        std::vector<element_t> poppedElements(capacity);
+        int value{0};
+
+        // large queues are tested with a stride to keep the runtime reasonable
+        const uint64_t stride = std::max<uint64_t>(1U, capacity / 16U);
+        for (uint64_t startPosition = 0U; startPosition < capacity; startPosition += stride)
+        {
+            for (uint64_t batchSize = 1U; batchSize <= capacity; batchSize += stride)
+            {
+                for (uint64_t i = 0U; i < startPosition; ++i)
+                {
+                    ASSERT_TRUE(q.tryPush(value));
+                    ASSERT_TRUE(q.pop().has_value());
+                }
+
+                for (uint64_t i = 0U; i < batchSize; ++i)
+                {
+                    elements[i] = ++value;
+                }
+                ASSERT_EQ(q.tryPush(iox::span<const element_t>(elements.data(), batchSize)), batchSize);
+                ASSERT_EQ(q.size(), batchSize);
+                ASSERT_EQ(q.pop(iox::span<element_t>(poppedElements.data(), poppedElements.size())), batchSize);
+                for (uint64_t i = 0U; i < batchSize; ++i)
+                {
+                    EXPECT_EQ(poppedElements[i], elements[i]);
+                }
+                ASSERT_TRUE(q.empty());
+            }
+        }
+    }
+}
+
 TYPED_TEST(MpmcLockFreeQueueTest, pushDoesNotOverflowIfQueueIsNotFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2096033c-5631-480e-8b9c-a8b472721cdb");
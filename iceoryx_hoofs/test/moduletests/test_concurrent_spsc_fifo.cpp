@@ -20,6 +20,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstdint>
 
 namespace
@@ -118,4 +119,133 @@ TEST_F(SpscFifo_Test, OverflowFromFullToEmptyRepetition)
         EXPECT_THAT(sut.empty(), Eq(true));
     }
 }
+
+TEST_F(SpscFifo_Test, BulkPopFromEmptyFifoReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b2fcb3b-1e22-4420-bf20-93a91f884517");
+    std::array<uint64_t, FIFO_CAPACITY> values{};
+    EXPECT_THAT(sut.pop(iox::span<uint64_t>(values)), Eq(0U));
+}
+
+TEST_F(SpscFifo_Test, BulkPopRemovesAtMostSpanSizeValuesInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a76318de-eda8-4172-ad6d-e898a756afdb");
+    constexpr uint64_t NUMBER_OF_PUSHED_VALUES{7U};
+    constexpr uint64_t BULK_SIZE{4U};
+
+    for (uint64_t k = 0; k < NUMBER_OF_PUSHED_VALUES; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+
+    std::array<uint64_t, BULK_SIZE> values{};
+    ASSERT_THAT(sut.pop(iox::span<uint64_t>(values)), Eq(BULK_SIZE));
+    for (uint64_t k = 0; k < BULK_SIZE; ++k)
+    {
+        EXPECT_THAT(values[k], Eq(k));
+    }
+
+    ASSERT_THAT(sut.pop(iox::span<uint64_t>(values)), Eq(NUMBER_OF_PUSHED_VALUES - BULK_SIZE));
+    for (uint64_t k = 0; k < NUMBER_OF_PUSHED_VALUES - BULK_SIZE; ++k)
+    {
+        EXPECT_THAT(values[k], Eq(BULK_SIZE + k));
+    }
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(SpscFifo_Test, BulkPopWorksAcrossTheWrapAround)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "44ebaa62-0f0c-4c1c-ab76-d646007a1581");
+    uint64_t m = 0;
+    std::array<uint64_t, FIFO_CAPACITY> values{};
+
+    for (uint64_t repetition = 0; repetition < 10; ++repetition)
+    {
+        for (uint64_t k = 0; k < FIFO_CAPACITY; ++k, ++m)
+        {
+            EXPECT_THAT(sut.push(m), Eq(true));
+        }
+
+        ASSERT_THAT(sut.pop(iox::span<uint64_t>(values)), Eq(FIFO_CAPACITY));
+        for (uint64_t k = 0; k < FIFO_CAPACITY; ++k)
+        {
+            EXPECT_THAT(values[k], Eq(m - FIFO_CAPACITY + k));
+        }
+        EXPECT_THAT(sut.empty(), Eq(true));
+        // shift the start position for the next repetition
+        EXPECT_THAT(sut.push(m), Eq(true));
+        EXPECT_THAT(sut.pop().value(), Eq(m));
+        ++m;
+    }
+}
+
+TEST_F(SpscFifo_Test, BulkPushIntoFullFifoPushesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88da7e65-da1b-4c2d-9646-33bd05dd3b99");
+    for (uint64_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+    std::array<uint64_t, 3> values{1, 2, 3};
+    EXPECT_THAT(sut.push(iox::span<const uint64_t>(values)), Eq(0U));
+    EXPECT_THAT(sut.size(), Eq(FIFO_CAPACITY));
+}
+
+TEST_F(SpscFifo_Test, BulkPushPushesOnlyAsManyValuesAsThereIsFreeSpace)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "babc898e-e2ce-4904-9687-7867369b1551");
+    constexpr uint64_t NUMBER_OF_PUSHED_VALUES{3U};
+    for (uint64_t k = 0; k < NUMBER_OF_PUSHED_VALUES; ++k)
+    {
+        EXPECT_THAT(sut.push(k), Eq(true));
+    }
+
+    std::array<uint64_t, FIFO_CAPACITY> values{};
+    for (uint64_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        values[k] = NUMBER_OF_PUSHED_VALUES + k;
+    }
+    EXPECT_THAT(sut.push(iox::span<const uint64_t>(values)), Eq(FIFO_CAPACITY - NUMBER_OF_PUSHED_VALUES));
+
+    for (uint64_t k = 0; k < FIFO_CAPACITY; ++k)
+    {
+        auto result = sut.pop();
+        ASSERT_THAT(result.has_value(), Eq(true));
+        EXPECT_THAT(result.value(), Eq(k));
+    }
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
+TEST_F(SpscFifo_Test, BulkPushAndBulkPopWorkForAllBatchSizesAndStartPositions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "399b545d-f197-4822-97a2-2f2215965e23");
+    uint64_t m = 0;
+    std::array<uint64_t, FIFO_CAPACITY> values{};
+    std::array<uint64_t, FIFO_CAPACITY> poppedValues{};
+
+    for (uint64_t startPosition = 0; startPosition < FIFO_CAPACITY; ++startPosition)
+    {
+        for (uint64_t batchSize = 1; batchSize <= FIFO_CAPACITY; ++batchSize)
+        {
+            for (uint64_t k = 0; k < startPosition; ++k)
+            {
+                EXPECT_THAT(sut.push(m), Eq(true));
+                EXPECT_THAT(sut.pop().value(), Eq(m));
+            }
+
+            for (uint64_t k = 0; k < batchSize; ++k)
+            {
+                values[k] = ++m;
+            }
+            ASSERT_THAT(sut.push(iox::span<const uint64_t>(values.data(), batchSize)), Eq(batchSize));
+            ASSERT_THAT(sut.size(), Eq(batchSize));
+            ASSERT_THAT(sut.pop(iox::span<uint64_t>(poppedValues)), Eq(batchSize));
+            for (uint64_t k = 0; k < batchSize; ++k)
+            {
+                EXPECT_THAT(poppedValues[k], Eq(values[k]));
+            }
+            ASSERT_THAT(sut.empty(), Eq(true));
+        }
+    }
+}
 } // namespace
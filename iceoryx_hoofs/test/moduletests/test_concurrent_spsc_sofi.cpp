@@ -17,6 +17,7 @@
 
 #include "iox/detail/spsc_sofi.hpp"
 
+#include <array>
 #include <cstdlib>
 #include <gtest/gtest.h>
 
@@ -470,4 +471,137 @@ TEST_F(SpscSofiTest, PopIfInvalidNotEmptyAfter)
 
     EXPECT_EQ(sofi.empty(), false);
 }
+
+TEST_F(SpscSofiTest, BulkPopFromEmptySofiReturnsZero)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ae9b4fb2-a1bd-488a-a55e-fdb8415eb814");
+    std::array<int, TEST_SOFI_CAPACITY> values{};
+
+    EXPECT_EQ(sofi.pop(iox::span<int>(values)), 0U);
+}
+
+TEST_F(SpscSofiTest, BulkPopRemovesAtMostSpanSizeValuesInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30e4b8d8-1b44-4a54-b7be-28c90929d33a");
+    constexpr uint64_t BULK_SIZE{4U};
+    constexpr int NUMBER_OF_PUSHED_VALUES{7};
+    for (int i = 0; i < NUMBER_OF_PUSHED_VALUES; i++)
+    {
+        sofi.push(i, returnVal);
+    }
+
+    std::array<int, BULK_SIZE> values{};
+    ASSERT_EQ(sofi.pop(iox::span<int>(values)), BULK_SIZE);
+    for (uint64_t i = 0; i < BULK_SIZE; i++)
+    {
+        EXPECT_EQ(values[i], static_cast<int>(i));
+    }
+
+    ASSERT_EQ(sofi.pop(iox::span<int>(values)), NUMBER_OF_PUSHED_VALUES - BULK_SIZE);
+    for (uint64_t i = 0; i < NUMBER_OF_PUSHED_VALUES - BULK_SIZE; i++)
+    {
+        EXPECT_EQ(values[i], static_cast<int>(BULK_SIZE + i));
+    }
+    EXPECT_EQ(sofi.empty(), true);
+}
+
+TEST_F(SpscSofiTest, BulkPopAfterOverflowReturnsTheNewestValues)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d6d5217a-5811-48a2-9e81-238e919b305c");
+    constexpr int NUMBER_OF_OVERFLOWS{3};
+    const auto capacity = static_cast<int>(sofi.capacity());
+    for (int i = 0; i < capacity + NUMBER_OF_OVERFLOWS; i++)
+    {
+        sofi.push(i, returnVal);
+    }
+
+    std::array<int, TEST_SOFI_CAPACITY + 1> values{};
+    ASSERT_EQ(sofi.pop(iox::span<int>(values)), sofi.capacity());
+    for (int i = 0; i < capacity; i++)
+    {
+        EXPECT_EQ(values[static_cast<uint64_t>(i)], i + NUMBER_OF_OVERFLOWS);
+    }
+    EXPECT_EQ(sofi.empty(), true);
+}
+
+TEST_F(SpscSofiTest, BulkPushDoesNotOverflow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "510a37b3-dc7b-4adc-8a51-633726a80695");
+    constexpr int NUMBER_OF_PUSHED_VALUES{4};
+    for (int i = 0; i < NUMBER_OF_PUSHED_VALUES; i++)
+    {
+        sofi.push(i, returnVal);
+    }
+
+    std::array<int, TEST_SOFI_CAPACITY> values{};
+    for (uint64_t i = 0; i < TEST_SOFI_CAPACITY; i++)
+    {
+        values[i] = NUMBER_OF_PUSHED_VALUES + static_cast<int>(i);
+    }
+    EXPECT_EQ(sofi.push(iox::span<const int>(values)), sofi.capacity() - NUMBER_OF_PUSHED_VALUES);
+    EXPECT_EQ(sofi.size(), sofi.capacity());
+    EXPECT_EQ(sofi.push(iox::span<const int>(values)), 0U);
+
+    for (int i = 0; i < static_cast<int>(sofi.capacity()); i++)
+    {
+        ASSERT_TRUE(sofi.pop(returnVal));
+        EXPECT_EQ(returnVal, i);
+    }
+    EXPECT_EQ(sofi.empty(), true);
+}
+
+TEST_F(SpscSofiTest, BulkPushAndBulkPopWorkForAllBatchSizesAndStartPositions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1e9c6416-0303-4a6d-ab31-a92159b1f998");
+    int serialNumber{0};
+    std::array<int, TEST_SOFI_CAPACITY> values{};
+    std::array<int, TEST_SOFI_CAPACITY> poppedValues{};
+
+    // the internal buffer is one element larger than the capacity, therefore all positions are covered
+    for (uint64_t startPosition = 0; startPosition <= TEST_SOFI_CAPACITY; startPosition++)
+    {
+        for (uint64_t batchSize = 1; batchSize <= TEST_SOFI_CAPACITY; batchSize++)
+        {
+            for (uint64_t i = 0; i < startPosition; i++)
+            {
+                sofi.push(serialNumber, returnVal);
+                ASSERT_TRUE(sofi.pop(returnVal));
+                EXPECT_EQ(returnVal, serialNumber);
+            }
+
+            for (uint64_t i = 0; i < batchSize; i++)
+            {
+                values[i] = ++serialNumber;
+            }
+            ASSERT_EQ(sofi.push(iox::span<const int>(values.data(), batchSize)), batchSize);
+            ASSERT_EQ(sofi.size(), batchSize);
+            ASSERT_EQ(sofi.pop(iox::span<int>(poppedValues)), batchSize);
+            for (uint64_t i = 0; i < batchSize; i++)
+            {
+                EXPECT_EQ(poppedValues[i], values[i]);
+            }
+            ASSERT_EQ(sofi.empty(), true);
+        }
+    }
+}
+
+TEST_F(SpscSofiTest, SinglePushOverflowsAfterBulkPushFilledTheSofi)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f2037e4-089d-4c42-bd7f-c6cc4a428544");
+    std::array<int, TEST_SOFI_CAPACITY> values{};
+    for (uint64_t i = 0; i < TEST_SOFI_CAPACITY; i++)
+    {
+        values[i] = static_cast<int>(i);
+    }
+    ASSERT_EQ(sofi.push(iox::span<const int>(values)), TEST_SOFI_CAPACITY);
+
+    EXPECT_EQ(sofi.push(static_cast<int>(TEST_SOFI_CAPACITY), returnVal), false);
+    EXPECT_EQ(returnVal, 0);
+
+    ASSERT_EQ(sofi.pop(iox::span<int>(values)), TEST_SOFI_CAPACITY);
+    for (uint64_t i = 0; i < TEST_SOFI_CAPACITY; i++)
+    {
+        EXPECT_EQ(values[i], static_cast<int>(i) + 1);
+    }
+}
 } // namespace
@@ -226,4 +226,25 @@ TYPED_TEST(algorithm_test_isPowerOfTwo, MaxValueForTypeIsNotPowerOfTwo)
     ::testing::Test::RecordProperty("TEST_ID", "2abdb27d-58de-4e3d-b8fb-8e5f1f3e6327");
     EXPECT_FALSE(isPowerOfTwo(static_cast<typename TestFixture::CurrentType>(TestFixture::MAX)));
 }
+TEST_F(algorithm_test, NextPowerOfTwoOfZeroAndOneIsOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fc285429-880e-4e08-9b2b-2458cdaf1bb1");
+    EXPECT_THAT(nextPowerOfTwo(0U), Eq(1U));
+    EXPECT_THAT(nextPowerOfTwo(1U), Eq(1U));
+}
+
+TEST_F(algorithm_test, NextPowerOfTwoOfPowerOfTwoIsTheValueItself)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "84e16f36-436e-4df0-abed-fd8cb33834da");
+    EXPECT_THAT(nextPowerOfTwo(64U), Eq(64U));
+    EXPECT_THAT(nextPowerOfTwo(static_cast<uint8_t>(128U)), Eq(128U));
+}
+
+TEST_F(algorithm_test, NextPowerOfTwoRoundsUpToTheNextPowerOfTwo)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "603b5db9-9ea4-4456-8dc4-f7db86c71a6f");
+    EXPECT_THAT(nextPowerOfTwo(3U), Eq(4U));
+    EXPECT_THAT(nextPowerOfTwo(42U), Eq(64U));
+    EXPECT_THAT(nextPowerOfTwo(static_cast<uint64_t>(1ULL << 40U) + 1U), Eq(1ULL << 41U));
+}
 } // namespace
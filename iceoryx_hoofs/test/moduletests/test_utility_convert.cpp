@@ -960,4 +960,59 @@ TEST_F(convert_test, fromString_ioxString)
     EXPECT_THAT(iox::convert::from_string<iox::string<STRING_CAPACITY>>(source.c_str()).has_value(), Eq(false));
 }
 
+TEST_F(convert_test, toIoxString_Integer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f4b922e2-ce3d-4b04-bac2-1424a1bf649e");
+    constexpr int64_t DATA = -9223372036854775807LL - 1LL;
+    auto result = iox::convert::toIoxString<20>(DATA);
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value().c_str(), StrEq("-9223372036854775808"));
+}
+
+TEST_F(convert_test, toIoxString_Float)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b28c2a41-ab6b-4e5d-88f2-fc45d9ec9012");
+    constexpr float DATA = 333.1F;
+    auto result = iox::convert::toIoxString<8>(DATA);
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value().c_str(), StrEq(iox::convert::toString(DATA).c_str()));
+}
+
+TEST_F(convert_test, toIoxString_ExceedingCapacityFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "23f816f1-dde9-4d34-820e-20a6eafd5d76");
+    EXPECT_THAT(iox::convert::toIoxString<3>(999U).has_value(), Eq(true));
+    EXPECT_THAT(iox::convert::toIoxString<3>(1000U).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::toIoxString<3>(-100).has_value(), Eq(false));
+}
+
+TEST_F(convert_test, fromIoxString_Integer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fe9b53b2-c8d2-44ea-8311-70ce05a4724c");
+    auto result = iox::convert::fromIoxString<int16_t>(iox::string<8>("-32768"));
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), Eq(-32768));
+
+    EXPECT_THAT(iox::convert::fromIoxString<int16_t>(iox::string<8>("32768")).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::fromIoxString<uint16_t>(iox::string<8>("-1")).has_value(), Eq(false));
+}
+
+TEST_F(convert_test, fromIoxString_RequiresTheWholeStringToBeANumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36cd0e19-6edc-4abf-a0b1-8a5152620dfd");
+    EXPECT_THAT(iox::convert::fromIoxString<uint32_t>(iox::string<8>("")).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::fromIoxString<uint32_t>(iox::string<8>(" 12")).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::fromIoxString<uint32_t>(iox::string<8>("+12")).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::fromIoxString<uint32_t>(iox::string<8>("12a")).has_value(), Eq(false));
+    EXPECT_THAT(iox::convert::fromIoxString<double>(iox::string<8>("1.5x")).has_value(), Eq(false));
+}
+
+TEST_F(convert_test, fromIoxString_Double)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cba804a8-f324-450c-8077-4f1126fd4914");
+    auto result = iox::convert::fromIoxString<double>(iox::string<16>("-123.04e2"));
+    ASSERT_THAT(result.has_value(), Eq(true));
+    EXPECT_THAT(result.value(), DoubleEq(-12304.0));
+}
+
 } // namespace
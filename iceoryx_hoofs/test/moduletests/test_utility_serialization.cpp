@@ -166,4 +166,130 @@ TEST_F(Serialization_test, SerializeSerializableClass)
     auto serial = iox::Serialization::create(obj, "asd");
     EXPECT_THAT(serial.toString(), Eq("7:5:asdgg3:asd"));
 }
+
+enum class BinarySerializationTestEnum : uint16_t
+{
+    FIRST,
+    SECOND = 0x1234,
+};
+
+TEST(BinarySerialization_test, CreateStoresFixedWidthLittleEndianFields)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e254f816-9e49-4252-a2e7-2bda6823deec");
+    const auto serial = iox::BinarySerialization<16>::create(uint32_t{0x12345678U}, true, int8_t{-1});
+
+    ASSERT_THAT(serial.size(), Eq(6U));
+    EXPECT_THAT(serial.data()[0], Eq(0x78U));
+    EXPECT_THAT(serial.data()[1], Eq(0x56U));
+    EXPECT_THAT(serial.data()[2], Eq(0x34U));
+    EXPECT_THAT(serial.data()[3], Eq(0x12U));
+    EXPECT_THAT(serial.data()[4], Eq(1U));
+    EXPECT_THAT(serial.data()[5], Eq(0xFFU));
+}
+
+TEST(BinarySerialization_test, MaxSerializedSizeIsSumOfFieldSizes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2a4b9135-9480-47e6-9281-9319aa261b6e");
+    constexpr uint64_t EXPECTED_SIZE{sizeof(uint64_t) + 1U + sizeof(uint16_t) + sizeof(double) + 4U + 10U};
+    EXPECT_THAT((iox::BinarySerialization<64>::maxSerializedSize<uint64_t,
+                                                                 bool,
+                                                                 BinarySerializationTestEnum,
+                                                                 double,
+                                                                 iox::string<10>>()),
+                Eq(EXPECTED_SIZE));
+}
+
+TEST(BinarySerialization_test, ExtractRestoresAllSupportedTypes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a48bbfe6-89a5-468e-9f03-f329a1f15310");
+    constexpr int64_t I{-123456789012};
+    constexpr float F{-1.5F};
+    constexpr double D{3.14159};
+    const iox::string<16> S("hypnotoad");
+    const auto serial = iox::BinarySerialization<64>::create(I, false, BinarySerializationTestEnum::SECOND, F, D, S);
+
+    int64_t i{0};
+    bool b{true};
+    BinarySerializationTestEnum e{BinarySerializationTestEnum::FIRST};
+    float f{0.0F};
+    double d{0.0};
+    iox::string<16> s;
+    ASSERT_TRUE(serial.extract(i, b, e, f, d, s));
+    EXPECT_THAT(i, Eq(I));
+    EXPECT_FALSE(b);
+    EXPECT_THAT(e, Eq(BinarySerializationTestEnum::SECOND));
+    EXPECT_THAT(f, Eq(F));
+    EXPECT_THAT(d, Eq(D));
+    EXPECT_THAT(s, Eq(S));
+}
+
+TEST(BinarySerialization_test, ExtractFailsWhenDataIsTooShort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd161973-6ce9-4b5c-9d95-18db9576c4e9");
+    const auto serial = iox::BinarySerialization<16>::create(uint32_t{42U});
+    uint64_t value{0U};
+    EXPECT_FALSE(serial.extract(value));
+}
+
+TEST(BinarySerialization_test, ExtractFailsWhenDataIsNotFullyConsumed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "607dcceb-afaa-40c4-86fe-cdeb868e3a59");
+    const auto serial = iox::BinarySerialization<16>::create(uint32_t{42U}, uint32_t{73U});
+    uint32_t value{0U};
+    EXPECT_FALSE(serial.extract(value));
+}
+
+TEST(BinarySerialization_test, ExtractFailsForInvalidBool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a7ac266-5b19-400c-98d2-62af9bbd4ec6");
+    const auto serial = iox::BinarySerialization<16>::create(uint8_t{2U});
+    bool value{false};
+    EXPECT_FALSE(serial.extract(value));
+}
+
+TEST(BinarySerialization_test, ExtractFailsWhenStringExceedsTargetCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "18d9417c-8230-4144-a89b-6a47d19476c9");
+    const auto serial = iox::BinarySerialization<32>::create(iox::string<16>("hypnotoad"));
+    iox::string<4> value;
+    EXPECT_FALSE(serial.extract(value));
+}
+
+TEST(BinarySerialization_test, HexStringRoundTripRestoresData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d83f969-4053-475c-97e2-f01bdca797f8");
+    const auto serial = iox::BinarySerialization<16>::create(uint16_t{0xABCDU}, iox::string<4>("a,b"));
+    const auto hexString = serial.toHexString();
+    EXPECT_THAT(hexString.c_str(), StrEq("cdab03000000612c62"));
+
+    auto restored = iox::BinarySerialization<16>::fromHexString(hexString.c_str(), hexString.size());
+    ASSERT_TRUE(restored.has_value());
+    uint16_t number{0U};
+    iox::string<4> text;
+    ASSERT_TRUE(restored->extract(number, text));
+    EXPECT_THAT(number, Eq(0xABCDU));
+    EXPECT_THAT(text, Eq(iox::string<4>("a,b")));
+}
+
+TEST(BinarySerialization_test, FromHexStringFailsForInvalidInput)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "638c8fca-23b2-41ac-841c-acee24c58fcb");
+    EXPECT_FALSE(iox::BinarySerialization<4>::fromHexString("abc", 3U).has_value());
+    EXPECT_FALSE(iox::BinarySerialization<4>::fromHexString("zz", 2U).has_value());
+    EXPECT_FALSE(iox::BinarySerialization<4>::fromHexString("1:2", 2U).has_value());
+    EXPECT_FALSE(iox::BinarySerialization<4>::fromHexString("0011223344", 10U).has_value());
+}
+
+TEST(BinarySerialization_test, FromBytesFailsWhenSizeExceedsCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f7c0f75-c9d2-4956-b6da-6b68efcd9065");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) raw bytes as received from a transport
+    constexpr uint8_t DATA[]{1U, 2U, 3U};
+    EXPECT_FALSE(iox::BinarySerialization<2>::fromBytes(&DATA[0], 3U).has_value());
+
+    auto serial = iox::BinarySerialization<4>::fromBytes(&DATA[0], 3U);
+    ASSERT_TRUE(serial.has_value());
+    EXPECT_THAT(serial->size(), Eq(3U));
+    EXPECT_THAT(serial->data()[2], Eq(3U));
+}
 } // namespace
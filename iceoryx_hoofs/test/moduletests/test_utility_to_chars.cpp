@@ -0,0 +1,222 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/detail/to_chars.hpp"
+#include "test.hpp"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace
+{
+using namespace ::testing;
+
+constexpr uint64_t BUFFER_SIZE{72U};
+
+template <typename T>
+std::string toChars(const T value, const int32_t base = 10)
+{
+    char buffer[BUFFER_SIZE];
+    const auto result = [&] {
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            return iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, value);
+        }
+        else
+        {
+            return iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, value, base);
+        }
+    }();
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    return std::string(&buffer[0], result.ptr);
+}
+
+template <typename T>
+class ToChars_test : public Test
+{
+};
+
+using IntegerTypes = Types<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t, uint64_t>;
+TYPED_TEST_SUITE(ToChars_test, IntegerTypes, );
+
+TYPED_TEST(ToChars_test, FormatsLimitsLikeStdToString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d771e258-519c-4284-8fff-dde2cfac2b19");
+    constexpr TypeParam MIN{std::numeric_limits<TypeParam>::lowest()};
+    constexpr TypeParam MAX{std::numeric_limits<TypeParam>::max()};
+
+    EXPECT_THAT(toChars(MIN), Eq(std::to_string(MIN)));
+    EXPECT_THAT(toChars(MAX), Eq(std::to_string(MAX)));
+    EXPECT_THAT(toChars(TypeParam{0}), Eq("0"));
+}
+
+TYPED_TEST(ToChars_test, FormatsAllNumbersOfDigitsLikeStdToString)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13dfe40d-6667-474b-a79d-4e05954fb450");
+    constexpr TypeParam MAX{std::numeric_limits<TypeParam>::max()};
+
+    for (uint64_t value = 1U; value <= static_cast<uint64_t>(MAX) / 10U; value *= 10U)
+    {
+        for (const auto number : {value - 1U, value, value + 1U, value * 10U - 1U})
+        {
+            const auto typedNumber = static_cast<TypeParam>(number);
+            EXPECT_THAT(toChars(typedNumber), Eq(std::to_string(typedNumber)));
+        }
+    }
+}
+
+TYPED_TEST(ToChars_test, ParsesFormattedLimits)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35eafc08-8cde-47f1-8de1-43ce8404d728");
+    for (const auto expected : {std::numeric_limits<TypeParam>::lowest(), std::numeric_limits<TypeParam>::max()})
+    {
+        const auto str = toChars(expected);
+        TypeParam value{0};
+        const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+        EXPECT_THAT(result.ec, Eq(std::errc{}));
+        EXPECT_THAT(result.ptr, Eq(str.data() + str.size()));
+        EXPECT_THAT(value, Eq(expected));
+    }
+}
+
+TYPED_TEST(ToChars_test, ParsingNumberExceedingTheLimitsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fe100f1b-958b-499f-9035-76db6430e53e");
+    const std::string str = toChars(std::numeric_limits<TypeParam>::max()) + "0";
+    TypeParam value{42};
+    const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+    EXPECT_THAT(result.ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(result.ptr, Eq(str.data() + str.size()));
+    EXPECT_THAT(value, Eq(42));
+}
+
+TEST(ToChars_test, FormatsOtherBases)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca05c80d-706c-4e23-8a6e-4b15346d72cc");
+    EXPECT_THAT(toChars(0xdeadbeefU, 16), Eq("deadbeef"));
+    EXPECT_THAT(toChars(0755U, 8), Eq("755"));
+    EXPECT_THAT(toChars(5U, 2), Eq("101"));
+    EXPECT_THAT(toChars(-35, 36), Eq("-z"));
+}
+
+TEST(ToChars_test, FormattingIntoTooSmallRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e7fee8f8-cce6-4605-b15f-153669570da0");
+    char buffer[3];
+    auto result = iox::to_chars(&buffer[0], &buffer[0] + 3, 1000);
+    EXPECT_THAT(result.ec, Eq(std::errc::value_too_large));
+    EXPECT_THAT(result.ptr, Eq(&buffer[0] + 3));
+
+    result = iox::to_chars(&buffer[0], &buffer[0] + 3, -100);
+    EXPECT_THAT(result.ec, Eq(std::errc::value_too_large));
+
+    result = iox::to_chars(&buffer[0], &buffer[0] + 3, 999);
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(&buffer[0] + 3));
+}
+
+TEST(ToChars_test, FormattingWithInvalidBaseFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "129a8e07-3cb0-4cbf-b421-7f565e406643");
+    char buffer[BUFFER_SIZE];
+    EXPECT_THAT(iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, 1, 1).ec, Eq(std::errc::invalid_argument));
+    EXPECT_THAT(iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, 1, 37).ec, Eq(std::errc::invalid_argument));
+}
+
+TEST(ToChars_test, FormatsFloatingPointNumbersLikeOstream)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ce9d6c4a-2c09-4362-9852-765ac69b57bb");
+    EXPECT_THAT(toChars(333.1F), Eq("333.1"));
+    EXPECT_THAT(toChars(-0.000125), Eq("-0.000125"));
+    EXPECT_THAT(toChars(1234567.0), Eq("1.23457e+06"));
+    EXPECT_THAT(toChars(1.0L), Eq("1"));
+}
+
+TEST(ToChars_test, ParsingStopsAtFirstNonDigit)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9567b084-28a9-4582-a80a-13d859b6c267");
+    const std::string str{"123abc"};
+    uint32_t value{0U};
+    const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(str.data() + 3));
+    EXPECT_THAT(value, Eq(123U));
+}
+
+TEST(ToChars_test, ParsingWithoutDigitsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fee4576-73a9-4ad8-81d9-46416531ac7e");
+    for (const std::string str : {"", "-", " 1", "+1", "x"})
+    {
+        int32_t value{42};
+        const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+        EXPECT_THAT(result.ec, Eq(std::errc::invalid_argument));
+        EXPECT_THAT(result.ptr, Eq(str.data()));
+        EXPECT_THAT(value, Eq(42));
+    }
+}
+
+TEST(ToChars_test, ParsingNegativeNumberIntoUnsignedTypeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f239b71-74e5-4f75-87a8-4c1d86c5f80f");
+    const std::string str{"-1"};
+    uint32_t value{42U};
+    EXPECT_THAT(iox::from_chars(str.data(), str.data() + str.size(), value).ec, Eq(std::errc::invalid_argument));
+}
+
+TEST(ToChars_test, ParsesHexadecimalNumbers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2e38c7b-11ae-4f1f-9229-840612bed1b3");
+    const std::string str{"DeadBeef"};
+    uint32_t value{0U};
+    EXPECT_THAT(iox::from_chars(str.data(), str.data() + str.size(), value, 16).ec, Eq(std::errc{}));
+    EXPECT_THAT(value, Eq(0xdeadbeefU));
+}
+
+TEST(ToChars_test, ParsesFloatingPointNumbers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "88ee4762-742f-4dae-915f-fd56e25da93b");
+    const std::string str{"-1.5e3x"};
+    double value{0.0};
+    const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+    EXPECT_THAT(result.ec, Eq(std::errc{}));
+    EXPECT_THAT(result.ptr, Eq(str.data() + 6));
+    EXPECT_THAT(value, DoubleEq(-1500.0));
+}
+
+TEST(ToChars_test, ParsingFloatingPointNumbersOutOfRangeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ece172eb-251f-4ad7-ae1b-75b44d1c24a8");
+    const std::string str{"1e40"};
+    float value{42.0F};
+    const auto result = iox::from_chars(str.data(), str.data() + str.size(), value);
+    EXPECT_THAT(result.ec, Eq(std::errc::result_out_of_range));
+    EXPECT_THAT(result.ptr, Eq(str.data() + str.size()));
+    EXPECT_THAT(value, FloatEq(42.0F));
+}
+
+TEST(ToChars_test, ParsingFloatingPointNumbersWithLeadingWhitespaceFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2655cea3-47a6-4ae4-955a-8ac48010e4be");
+    for (const std::string str : {" 1.0", "+1.0", ""})
+    {
+        double value{42.0};
+        EXPECT_THAT(iox::from_chars(str.data(), str.data() + str.size(), value).ec, Eq(std::errc::invalid_argument));
+    }
+}
+} // namespace
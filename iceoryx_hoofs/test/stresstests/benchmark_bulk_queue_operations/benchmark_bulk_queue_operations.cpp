@@ -0,0 +1,311 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/mpmc_lockfree_queue.hpp"
+#include "iox/detail/mpmc_lockfree_queue/mpmc_index_queue.hpp"
+#include "iox/detail/spsc_fifo.hpp"
+#include "iox/detail/spsc_sofi.hpp"
+#include "iox/span.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::concurrent;
+
+constexpr uint64_t QUEUE_CAPACITY{1024U};
+constexpr uint64_t MAX_BATCH_SIZE{256U};
+constexpr uint64_t NUMBER_OF_ELEMENTS{1U << 22U};
+
+struct SpscFifoAdapter
+{
+    static constexpr const char* NAME{"SpscFifo"};
+    static constexpr bool SUPPORTS_PRODUCER_CONSUMER{true};
+
+    bool pushSingle(const uint64_t value)
+    {
+        return queue.push(value);
+    }
+    bool popSingle(uint64_t& value)
+    {
+        auto result = queue.pop();
+        if (!result.has_value())
+        {
+            return false;
+        }
+        value = result.value();
+        return true;
+    }
+    uint64_t pushBulk(const span<const uint64_t> values)
+    {
+        return queue.push(values);
+    }
+    uint64_t popBulk(const span<uint64_t> values)
+    {
+        return queue.pop(values);
+    }
+
+    SpscFifo<uint64_t, QUEUE_CAPACITY> queue;
+};
+
+struct SpscSofiAdapter
+{
+    static constexpr const char* NAME{"SpscSofi"};
+    static constexpr bool SUPPORTS_PRODUCER_CONSUMER{false};
+
+    bool pushSingle(const uint64_t value)
+    {
+        uint64_t overflowValue{0U};
+        return queue.push(value, overflowValue);
+    }
+    bool popSingle(uint64_t& value)
+    {
+        return queue.pop(value);
+    }
+    uint64_t pushBulk(const span<const uint64_t> values)
+    {
+        return queue.push(values);
+    }
+    uint64_t popBulk(const span<uint64_t> values)
+    {
+        return queue.pop(values);
+    }
+
+    SpscSofi<uint64_t, QUEUE_CAPACITY> queue;
+};
+
+struct MpmcLockFreeQueueAdapter
+{
+    static constexpr const char* NAME{"MpmcLockFreeQueue"};
+    static constexpr bool SUPPORTS_PRODUCER_CONSUMER{true};
+
+    bool pushSingle(const uint64_t value)
+    {
+        return queue.tryPush(value);
+    }
+    bool popSingle(uint64_t& value)
+    {
+        auto result = queue.pop();
+        if (!result.has_value())
+        {
+            return false;
+        }
+        value = result.value();
+        return true;
+    }
+    uint64_t pushBulk(const span<const uint64_t> values)
+    {
+        return queue.tryPush(values);
+    }
+    uint64_t popBulk(const span<uint64_t> values)
+    {
+        return queue.pop(values);
+    }
+
+    MpmcLockFreeQueue<uint64_t, QUEUE_CAPACITY> queue;
+};
+
+/// @note the pushed values are used as indices and must therefore be smaller than the capacity
+struct MpmcIndexQueueAdapter
+{
+    static constexpr const char* NAME{"MpmcIndexQueue"};
+    static constexpr bool SUPPORTS_PRODUCER_CONSUMER{false};
+
+    bool pushSingle(const uint64_t value)
+    {
+        queue.push(value);
+        return true;
+    }
+    bool popSingle(uint64_t& value)
+    {
+        auto result = queue.pop();
+        if (!result.has_value())
+        {
+            return false;
+        }
+        value = result.value();
+        return true;
+    }
+    uint64_t pushBulk(const span<const uint64_t> values)
+    {
+        queue.push(values);
+        return values.size();
+    }
+    uint64_t popBulk(const span<uint64_t> values)
+    {
+        return queue.pop(values);
+    }
+
+    MpmcIndexQueue<QUEUE_CAPACITY> queue{MpmcIndexQueue<QUEUE_CAPACITY>::ConstructEmpty};
+};
+
+template <typename Function>
+double nanosecondsPerElement(const Function& function)
+{
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+           / static_cast<double>(NUMBER_OF_ELEMENTS);
+}
+
+void printResult(
+    const char* queueName, const char* mode, const uint64_t batchSize, const double single, const double bulk)
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(18) << queueName << " : " << std::setw(17) << mode << " : batch " << std::setw(3)
+              << batchSize << " : " << std::fixed << std::setprecision(2) << std::setw(7) << single
+              << " (ns/element single) : " << std::setw(7) << bulk << " (ns/element bulk) : " << std::setw(6)
+              << single / bulk << "x" << std::endl;
+}
+
+template <typename Adapter>
+void benchmarkSingleThreaded(const std::vector<uint64_t>& input, std::vector<uint64_t>& output)
+{
+    auto adapter = std::make_unique<Adapter>();
+    // the checksum verifies the popped values and prevents the compiler from optimizing the loops away
+    uint64_t checksum{0U};
+    uint64_t expectedChecksum{0U};
+
+    for (uint64_t batchSize = 1U; batchSize <= MAX_BATCH_SIZE; batchSize *= 2U)
+    {
+        const uint64_t numberOfBatches = NUMBER_OF_ELEMENTS / batchSize;
+
+        auto single = nanosecondsPerElement([&] {
+            for (uint64_t batch = 0U; batch < numberOfBatches; ++batch)
+            {
+                for (uint64_t i = 0U; i < batchSize; ++i)
+                {
+                    adapter->pushSingle(input[i]);
+                }
+                for (uint64_t i = 0U; i < batchSize; ++i)
+                {
+                    adapter->popSingle(output[i]);
+                }
+                checksum += output[batchSize - 1U];
+            }
+        });
+
+        auto bulk = nanosecondsPerElement([&] {
+            for (uint64_t batch = 0U; batch < numberOfBatches; ++batch)
+            {
+                adapter->pushBulk(span<const uint64_t>(input.data(), batchSize));
+                adapter->popBulk(span<uint64_t>(output.data(), batchSize));
+                checksum += output[batchSize - 1U];
+            }
+        });
+
+        expectedChecksum += 2U * numberOfBatches * input[batchSize - 1U];
+
+        printResult(Adapter::NAME, "single threaded", batchSize, single, bulk);
+    }
+
+    if (checksum != expectedChecksum)
+    {
+        std::cerr << "Unexpected checksum!" << std::endl;
+    }
+}
+
+template <typename Adapter>
+void benchmarkProducerConsumer(const std::vector<uint64_t>& input, std::vector<uint64_t>& output)
+{
+    if (!Adapter::SUPPORTS_PRODUCER_CONSUMER)
+    {
+        return;
+    }
+
+    for (uint64_t batchSize = 1U; batchSize <= MAX_BATCH_SIZE; batchSize *= 2U)
+    {
+        auto single = nanosecondsPerElement([&] {
+            auto adapter = std::make_unique<Adapter>();
+            std::thread producer([&] {
+                for (uint64_t numberOfPushedElements = 0U; numberOfPushedElements < NUMBER_OF_ELEMENTS;)
+                {
+                    for (uint64_t i = 0U; i < batchSize; ++i)
+                    {
+                        while (!adapter->pushSingle(input[i]))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                    numberOfPushedElements += batchSize;
+                }
+            });
+            for (uint64_t numberOfPoppedElements = 0U; numberOfPoppedElements < NUMBER_OF_ELEMENTS;)
+            {
+                if (adapter->popSingle(output[numberOfPoppedElements % batchSize]))
+                {
+                    ++numberOfPoppedElements;
+                }
+            }
+            producer.join();
+        });
+
+        auto bulk = nanosecondsPerElement([&] {
+            auto adapter = std::make_unique<Adapter>();
+            std::thread producer([&] {
+                for (uint64_t numberOfPushedElements = 0U; numberOfPushedElements < NUMBER_OF_ELEMENTS;)
+                {
+                    uint64_t numberOfPushedBatchElements{0U};
+                    while (numberOfPushedBatchElements < batchSize)
+                    {
+                        const auto numberOfPushed = adapter->pushBulk(span<const uint64_t>(
+                            input.data() + numberOfPushedBatchElements, batchSize - numberOfPushedBatchElements));
+                        if (numberOfPushed == 0U)
+                        {
+                            std::this_thread::yield();
+                        }
+                        numberOfPushedBatchElements += numberOfPushed;
+                    }
+                    numberOfPushedElements += batchSize;
+                }
+            });
+            for (uint64_t numberOfPoppedElements = 0U; numberOfPoppedElements < NUMBER_OF_ELEMENTS;)
+            {
+                numberOfPoppedElements += adapter->popBulk(span<uint64_t>(output.data(), batchSize));
+            }
+            producer.join();
+        });
+
+        printResult(Adapter::NAME, "producer/consumer", batchSize, single, bulk);
+    }
+}
+
+template <typename Adapter>
+void benchmark(const std::vector<uint64_t>& input, std::vector<uint64_t>& output)
+{
+    benchmarkSingleThreaded<Adapter>(input, output);
+    benchmarkProducerConsumer<Adapter>(input, output);
+}
+
+int main()
+{
+    std::vector<uint64_t> input(MAX_BATCH_SIZE);
+    std::iota(input.begin(), input.end(), 0U);
+    std::vector<uint64_t> output(MAX_BATCH_SIZE);
+
+    benchmark<SpscFifoAdapter>(input, output);
+    benchmark<SpscSofiAdapter>(input, output);
+    benchmark<MpmcLockFreeQueueAdapter>(input, output);
+    benchmark<MpmcIndexQueueAdapter>(input, output);
+
+    return 0;
+}
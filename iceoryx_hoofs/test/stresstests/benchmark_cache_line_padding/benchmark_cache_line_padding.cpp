@@ -0,0 +1,204 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/detail/spsc_fifo.hpp"
+#include "iox/memory.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace iox;
+using namespace iox::concurrent;
+
+constexpr uint64_t NUMBER_OF_OPERATIONS{1U << 24U};
+constexpr uint64_t FIFO_CAPACITY{1024U};
+
+/// @brief Counts the hardware cache misses of the calling thread and all threads which are started after the
+/// construction; the counts of the started threads are only included after they were joined
+class CacheMissCounter
+{
+  public:
+    CacheMissCounter() noexcept
+    {
+#if defined(__linux__)
+        perf_event_attr attributes{};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(perf_event_attr);
+        attributes.config = PERF_COUNT_HW_CACHE_MISSES;
+        attributes.disabled = 1U;
+        attributes.inherit = 1U;
+        attributes.exclude_kernel = 1U;
+        attributes.exclude_hv = 1U;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) syscall is the only way to access perf_event_open
+        m_fileDescriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        if (m_fileDescriptor >= 0)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) ioctl is required by the perf_event API
+            ioctl(m_fileDescriptor, PERF_EVENT_IOC_RESET, 0);
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) ioctl is required by the perf_event API
+            ioctl(m_fileDescriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter(CacheMissCounter&&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(CacheMissCounter&&) = delete;
+
+    ~CacheMissCounter() noexcept
+    {
+#if defined(__linux__)
+        if (m_fileDescriptor >= 0)
+        {
+            close(m_fileDescriptor);
+        }
+#endif
+    }
+
+    /// @brief returns the number of cache misses or -1 if the performance counters are not available
+    int64_t read() const noexcept
+    {
+#if defined(__linux__)
+        uint64_t count{0U};
+        if (m_fileDescriptor >= 0 && ::read(m_fileDescriptor, &count, sizeof(count)) == sizeof(count))
+        {
+            return static_cast<int64_t>(count);
+        }
+#endif
+        return -1;
+    }
+
+  private:
+    int m_fileDescriptor{-1};
+};
+
+struct PackedCounters
+{
+    std::atomic<uint64_t> first{0U};
+    std::atomic<uint64_t> second{0U};
+};
+
+struct PaddedCounters
+{
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> first{0U};
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> second{0U};
+};
+
+void printResult(const char* name, const double nanosecondsPerOperation, const int64_t cacheMisses)
+{
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(20) << name << " : " << std::setw(8) << std::fixed << std::setprecision(2)
+              << nanosecondsPerOperation << " (ns/operation) : ";
+    if (cacheMisses < 0)
+    {
+        std::cout << "cache misses not available" << std::endl;
+    }
+    else
+    {
+        std::cout << std::setw(12) << cacheMisses << " (cache misses) : " << std::setw(8) << std::setprecision(3)
+                  << static_cast<double>(cacheMisses) / static_cast<double>(NUMBER_OF_OPERATIONS)
+                  << " (cache misses/operation)" << std::endl;
+    }
+}
+
+template <typename Function>
+void benchmark(const char* name, const Function& function)
+{
+    CacheMissCounter counter;
+    auto start = std::chrono::steady_clock::now();
+    function();
+    auto end = std::chrono::steady_clock::now();
+    const auto cacheMisses = counter.read();
+
+    const auto nanosecondsPerOperation =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(NUMBER_OF_OPERATIONS);
+    printResult(name, nanosecondsPerOperation, cacheMisses);
+}
+
+template <typename Counters>
+void incrementCounters()
+{
+    auto counters = std::make_unique<Counters>();
+    std::thread other([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+        {
+            counters->second.fetch_add(1U, std::memory_order_relaxed);
+        }
+    });
+    for (uint64_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+    {
+        counters->first.fetch_add(1U, std::memory_order_relaxed);
+    }
+    other.join();
+}
+
+void transferViaFifo()
+{
+    auto fifo = std::make_unique<SpscFifo<uint64_t, FIFO_CAPACITY>>();
+    std::thread producer([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_OPERATIONS; ++i)
+        {
+            while (!fifo->push(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expectedValue{0U};
+    while (expectedValue < NUMBER_OF_OPERATIONS)
+    {
+        auto value = fifo->pop();
+        if (value.has_value())
+        {
+            if (value.value() != expectedValue)
+            {
+                std::cerr << "SpscFifo returned " << value.value() << " instead of " << expectedValue << std::endl;
+            }
+            ++expectedValue;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+}
+
+int main()
+{
+    std::cout << "hardware destructive interference size: " << HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE << " bytes"
+              << std::endl;
+
+    benchmark("counters (packed)", incrementCounters<PackedCounters>);
+    benchmark("counters (padded)", incrementCounters<PaddedCounters>);
+    benchmark("SpscFifo", transferViaFifo);
+
+    return 0;
+}
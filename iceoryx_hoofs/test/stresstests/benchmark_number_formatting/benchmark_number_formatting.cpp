@@ -0,0 +1,163 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iox/detail/convert.hpp"
+#include "iox/detail/to_chars.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace iox;
+
+constexpr uint64_t NUMBER_OF_VALUES{1024U};
+constexpr uint64_t NUMBER_OF_REPETITIONS{1000U};
+constexpr uint64_t BUFFER_SIZE{64U};
+
+/// @brief prevents the compiler from optimizing away the formatted characters
+volatile char globalSink{0};
+
+template <typename T>
+std::vector<T> createValues()
+{
+    std::vector<T> values;
+    values.reserve(NUMBER_OF_VALUES);
+    uint64_t seed{0x9E3779B97F4A7C15U};
+    for (uint64_t i = 0U; i < NUMBER_OF_VALUES; ++i)
+    {
+        seed = seed * 6364136223846793005U + 1442695040888963407U;
+        // mix small and large numbers like sizes, indices, ids and timestamps
+        const uint64_t shift = (seed >> 58U);
+        if constexpr (std::is_floating_point<T>::value)
+        {
+            values.push_back(static_cast<T>(seed >> shift) / static_cast<T>(1000));
+        }
+        else
+        {
+            values.push_back(static_cast<T>(seed >> shift));
+        }
+    }
+    return values;
+}
+
+template <typename Function>
+void benchmark(const char* name, const char* type, Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_REPETITIONS; ++i)
+    {
+        function();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const auto durationNanoseconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(32) << name << " : " << std::setw(8) << type << " : " << std::setw(8) << std::fixed
+              << std::setprecision(1)
+              << static_cast<double>(durationNanoseconds)
+                     / static_cast<double>(NUMBER_OF_REPETITIONS * NUMBER_OF_VALUES)
+              << " (nanosecs/number)" << std::endl;
+}
+
+template <typename T>
+void benchmarkFormatting(const char* type, const char* printfFormat)
+{
+    const auto values = createValues<T>();
+    char buffer[BUFFER_SIZE];
+
+    benchmark("std::stringstream", type, [&] {
+        for (const auto value : values)
+        {
+            std::stringstream ss;
+            ss << value;
+            globalSink = ss.str()[0];
+        }
+    });
+    benchmark("snprintf", type, [&] {
+        for (const auto value : values)
+        {
+            snprintf(&buffer[0], BUFFER_SIZE, printfFormat, value);
+            globalSink = buffer[0];
+        }
+    });
+    benchmark("convert::toString", type, [&] {
+        for (const auto value : values)
+        {
+            globalSink = convert::toString(value)[0];
+        }
+    });
+    benchmark("convert::toIoxString", type, [&] {
+        for (const auto value : values)
+        {
+            globalSink = convert::toIoxString<32>(value).value()[0];
+        }
+    });
+    benchmark("iox::to_chars", type, [&] {
+        for (const auto value : values)
+        {
+            iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, value);
+            globalSink = buffer[0];
+        }
+    });
+}
+
+template <typename T>
+void benchmarkParsing(const char* type)
+{
+    const auto values = createValues<T>();
+    std::vector<iox::string<32>> strings;
+    for (const auto value : values)
+    {
+        strings.push_back(convert::toIoxString<32>(value).value());
+    }
+
+    benchmark("convert::from_string", type, [&] {
+        for (const auto& str : strings)
+        {
+            globalSink = static_cast<char>(convert::from_string<T>(str.c_str()).value());
+        }
+    });
+    benchmark("convert::fromIoxString", type, [&] {
+        for (const auto& str : strings)
+        {
+            globalSink = static_cast<char>(convert::fromIoxString<T>(str).value());
+        }
+    });
+}
+
+int main()
+{
+    std::cout << "Formatting " << NUMBER_OF_VALUES << " numbers " << NUMBER_OF_REPETITIONS << " times" << std::endl;
+    benchmarkFormatting<uint64_t>("uint64_t", "%lu");
+    benchmarkFormatting<int32_t>("int32_t", "%i");
+    benchmarkFormatting<double>("double", "%g");
+
+    std::cout << std::endl
+              << "Parsing " << NUMBER_OF_VALUES << " numbers " << NUMBER_OF_REPETITIONS << " times" << std::endl;
+    benchmarkParsing<uint64_t>("uint64_t");
+    benchmarkParsing<int32_t>("int32_t");
+    benchmarkParsing<double>("double");
+
+    return EXIT_SUCCESS;
+}
@@ -20,6 +20,7 @@
 #ifndef IOX_HOOFS_UTILITY_CONVERT_HPP
 #define IOX_HOOFS_UTILITY_CONVERT_HPP
 
+#include "iox/detail/to_chars.hpp"
 #include "iox/posix_call.hpp"
 #include "iox/string.hpp"
 
@@ -82,6 +83,27 @@ class convert
     static typename std::enable_if<std::is_convertible<Source, std::string>::value, std::string>::type
     toString(const Source& t) noexcept;
 
+    /// @brief Converts a number into an 'iox::string' without a heap allocation. Integers are formatted in base 10 and
+    /// floating point numbers like 'toString' does.
+    /// @code
+    ///     auto number = iox::convert::toIoxString<20>(123); // iox::optional<iox::string<20>> containing "123"
+    /// @endcode
+    /// @tparam Capacity of the resulting string
+    /// @tparam Source arithmetic type of the number; 'char' and 'bool' are not supported
+    /// @param[in] value which should be converted to a string
+    /// @return the string representation of value or 'iox::nullopt' if it exceeds the capacity
+    template <uint64_t Capacity, typename Source>
+    static iox::optional<iox::string<Capacity>> toIoxString(const Source value) noexcept;
+
+    /// @brief Parses a number from an 'iox::string' without a heap allocation. In contrast to 'from_string' the whole
+    /// string must be a number; neither whitespace nor a plus sign are accepted.
+    /// @tparam TargetType arithmetic type of the number; 'char' and 'bool' are not supported
+    /// @tparam Capacity of the source string
+    /// @param[in] v the string to parse
+    /// @return the parsed number or 'iox::nullopt' if v is not a number or the number exceeds the range of TargetType
+    template <typename TargetType, uint64_t Capacity>
+    static iox::optional<TargetType> fromIoxString(const iox::string<Capacity>& v) noexcept;
+
     /// @brief  convert the input based on the 'Destination', allowing only 'iox::string' and numeric types as valid
     /// destination types
     /// @note   for the 'Destination' equal to 'std::string,' please include 'iox/std_string_support.hpp'
@@ -93,6 +115,11 @@ class convert
     static iox::optional<TargetType> from_string(const char* v) noexcept;
 
   private:
+    /// @brief numbers which are formatted with 'iox::to_chars'; 'char' is formatted as character and 'bool' as 0 or 1
+    template <typename T>
+    static constexpr bool IS_TO_CHARS_NUMBER{std::is_arithmetic<T>::value && !std::is_same<T, char>::value
+                                             && !std::is_same<T, bool>::value};
+
     template <typename TargetType, typename CallType>
     static iox::optional<TargetType> evaluate_return_value(CallType& call, const char* end_ptr, const char* v) noexcept;
 
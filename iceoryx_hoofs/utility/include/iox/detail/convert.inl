@@ -47,9 +47,22 @@ template <typename Source>
 inline typename std::enable_if<!std::is_convertible<Source, std::string>::value, std::string>::type
 convert::toString(const Source& t) noexcept
 {
-    std::stringstream ss;
-    ss << t;
-    return ss.str();
+    if constexpr (IS_TO_CHARS_NUMBER<Source>)
+    {
+        // large enough for all integers in base 10 and the floating point format of 'iox::to_chars'
+        constexpr uint64_t BUFFER_SIZE{64U};
+        // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+        char buffer[BUFFER_SIZE];
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto result = iox::to_chars(&buffer[0], &buffer[0] + BUFFER_SIZE, t);
+        return std::string(&buffer[0], result.ptr);
+    }
+    else
+    {
+        std::stringstream ss;
+        ss << t;
+        return ss.str();
+    }
 }
 
 template <typename Source>
@@ -59,6 +72,46 @@ convert::toString(const Source& t) noexcept
     return t;
 }
 
+template <uint64_t Capacity, typename Source>
+inline iox::optional<iox::string<Capacity>> convert::toIoxString(const Source value) noexcept
+{
+    static_assert(IS_TO_CHARS_NUMBER<Source>, "Only numbers can be converted with 'toIoxString'!");
+
+    iox::string<Capacity> result;
+    bool hasFit{false};
+    result.unsafe_raw_access([&](char* str, const iox::BufferInfo info) -> uint64_t {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto chars = iox::to_chars(str, str + (info.total_size - 1U), value);
+        hasFit = (chars.ec == std::errc{});
+        const auto size = hasFit ? static_cast<uint64_t>(chars.ptr - str) : 0U;
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        str[size] = '\0';
+        return size;
+    });
+
+    if (!hasFit)
+    {
+        return iox::nullopt;
+    }
+    return result;
+}
+
+template <typename TargetType, uint64_t Capacity>
+inline iox::optional<TargetType> convert::fromIoxString(const iox::string<Capacity>& v) noexcept
+{
+    static_assert(IS_TO_CHARS_NUMBER<TargetType>, "Only numbers can be parsed with 'fromIoxString'!");
+
+    TargetType value{};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const char* const end = v.c_str() + v.size();
+    const auto result = iox::from_chars(v.c_str(), end, value);
+    if (result.ec != std::errc{} || result.ptr != end)
+    {
+        return iox::nullopt;
+    }
+    return value;
+}
+
 template <typename TargetType>
 inline iox::optional<TargetType> convert::from_string(const char* v) noexcept
 {
@@ -19,10 +19,16 @@
 #define IOX_HOOFS_UTILITY_SERIALIZATION_HPP
 
 #include "iox/detail/convert.hpp"
+#include "iox/detail/string_type_traits.hpp"
+#include "iox/optional.hpp"
 #include "iox/std_string_support.hpp"
+#include "iox/string.hpp"
 
+#include <cstring>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <type_traits>
 
 namespace iox
 {
@@ -137,6 +143,106 @@ class Serialization
     static bool deserialize(const std::string& serializedString, T& t, Targs&... args) noexcept;
 };
 
+namespace detail
+{
+static constexpr uint64_t BINARY_SERIALIZATION_STRING_LENGTH_SIZE{sizeof(uint32_t)};
+
+template <typename T>
+constexpr uint64_t maxBinarySerializedSizeOf() noexcept;
+
+template <typename... Targs>
+constexpr uint64_t maxBinarySerializedSize() noexcept;
+} // namespace detail
+
+/// @brief Compact binary counterpart of the 'Serialization'. The values are stored as fixed-width little-endian fields
+///         in an inline buffer without any separators or length prefixes, except for strings:
+///             bool                     -> 1 byte, 0 or 1
+///             integral and enum types  -> sizeof(T) bytes
+///             float and double         -> sizeof(T) bytes of the IEEE-754 representation
+///             iox::string<N>           -> 4 byte length followed by the characters
+///         The capacity is checked at compile time against the maximum size of the given types, therefore 'create'
+///         cannot fail. Since the binary data might contain any byte, 'toHexString' and 'fromHexString' provide a
+///         fixed-width text representation for transports which are restricted to printable characters.
+/// @code
+///     auto serial = iox::BinarySerialization<32>::create(uint64_t{123}, true, iox::string<8>("fuu"));
+///
+///     uint64_t v1{0};
+///     bool v2{false};
+///     iox::string<8> v3;
+///     if (serial.extract(v1, v2, v3)) {} // succeeds since the types match the serialized ones
+/// @endcode
+/// @tparam Capacity the maximum number of bytes of the serialized data
+template <uint64_t Capacity>
+class BinarySerialization
+{
+    static_assert(Capacity > 0U, "The BinarySerialization requires a capacity of at least one byte");
+
+  public:
+    using HexString_t = string<2U * Capacity>;
+
+    /// @brief Creates an empty serialization
+    BinarySerialization() noexcept = default;
+
+    /// @brief Creates a BinarySerialization from the given values
+    /// @param[in] args list of bool, integral, enum, floating point or iox::string values
+    /// @return BinarySerialization object which contains the serialized data
+    template <typename... Targs>
+    static BinarySerialization create(const Targs&... args) noexcept;
+
+    /// @brief Extracts the values from the serialization and writes them into the given args
+    /// @param[in] args references where the values in the serialization will be stored in
+    /// @return true if all values could be extracted and the whole serialization was consumed, otherwise false
+    template <typename... Targs>
+    bool extract(Targs&... args) const noexcept;
+
+    /// @brief Creates a BinarySerialization from raw serialized bytes, e.g. received from a transport
+    /// @param[in] data pointer to the serialized bytes
+    /// @param[in] size number of serialized bytes
+    /// @return the BinarySerialization or nullopt if the size exceeds the capacity
+    static optional<BinarySerialization> fromBytes(const uint8_t* const data, const uint64_t size) noexcept;
+
+    /// @brief Creates a BinarySerialization from the representation created with 'toHexString'
+    /// @param[in] hexString pointer to the hex characters
+    /// @param[in] length number of hex characters
+    /// @return the BinarySerialization or nullopt if the string is not a valid hex representation or exceeds the
+    /// capacity
+    static optional<BinarySerialization> fromHexString(const char* const hexString, const uint64_t length) noexcept;
+
+    /// @brief Returns the serialized data as two lower case hex characters per byte
+    HexString_t toHexString() const noexcept;
+
+    /// @brief Returns a pointer to the serialized bytes
+    const uint8_t* data() const noexcept;
+
+    /// @brief Returns the number of serialized bytes
+    uint64_t size() const noexcept;
+
+    /// @brief Returns the maximum number of serialized bytes
+    static constexpr uint64_t capacity() noexcept;
+
+    /// @brief Returns the maximum number of bytes required to serialize the given types
+    template <typename... Targs>
+    static constexpr uint64_t maxSerializedSize() noexcept;
+
+  private:
+    void writeUnsigned(const uint64_t value, const uint64_t numberOfBytes) noexcept;
+    bool readUnsigned(uint64_t& position, const uint64_t numberOfBytes, uint64_t& value) const noexcept;
+
+    template <typename T>
+    void write(const T& value) noexcept;
+    template <typename T>
+    bool read(uint64_t& position, T& value) const noexcept;
+
+  private:
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    uint8_t m_data[Capacity]{};
+    uint64_t m_size{0U};
+};
+
+/// @brief BinarySerialization with exactly the capacity which is required to serialize the given types
+template <typename... Targs>
+using BinarySerializationFor = BinarySerialization<detail::maxBinarySerializedSize<Targs...>()>;
+
 } // namespace iox
 
 #include "iox/detail/serialization.inl"
@@ -22,6 +22,36 @@
 
 namespace iox
 {
+namespace detail
+{
+template <typename T>
+inline constexpr uint64_t maxBinarySerializedSizeOf() noexcept
+{
+    if constexpr (is_iox_string<T>::value)
+    {
+        static_assert(T::capacity() <= std::numeric_limits<uint32_t>::max(),
+                      "The length of the string must fit into the fixed-width length field");
+        return BINARY_SERIALIZATION_STRING_LENGTH_SIZE + T::capacity();
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        return sizeof(std::underlying_type_t<T>);
+    }
+    else
+    {
+        static_assert(std::is_integral<T>::value || std::is_same<T, float>::value || std::is_same<T, double>::value,
+                      "Only bool, integral, enum, float, double and iox::string types are supported");
+        return sizeof(T);
+    }
+}
+
+template <typename... Targs>
+inline constexpr uint64_t maxBinarySerializedSize() noexcept
+{
+    return (uint64_t{0U} + ... + maxBinarySerializedSizeOf<Targs>());
+}
+} // namespace detail
+
 inline Serialization::operator std::string() const noexcept
 {
     return m_value;
@@ -147,6 +177,240 @@ inline bool Serialization::getNth(const unsigned int index, T& t) const noexcept
     }
     return convert::from_string<T>(entry.c_str()).and_then([&t](const auto& value) { t = value; }).has_value();
 }
+
+template <uint64_t Capacity>
+template <typename... Targs>
+inline BinarySerialization<Capacity> BinarySerialization<Capacity>::create(const Targs&... args) noexcept
+{
+    static_assert(maxSerializedSize<Targs...>() <= Capacity,
+                  "The capacity of the BinarySerialization is too small for the given types");
+
+    BinarySerialization serialization;
+    (serialization.write(args), ...);
+    return serialization;
+}
+
+template <uint64_t Capacity>
+template <typename... Targs>
+inline bool BinarySerialization<Capacity>::extract(Targs&... args) const noexcept
+{
+    uint64_t position{0U};
+    const bool isExtracted = (read(position, args) && ...);
+    return isExtracted && position == m_size;
+}
+
+template <uint64_t Capacity>
+inline optional<BinarySerialization<Capacity>> BinarySerialization<Capacity>::fromBytes(const uint8_t* const data,
+                                                                                      const uint64_t size) noexcept
+{
+    if (size > Capacity)
+    {
+        return nullopt;
+    }
+
+    BinarySerialization serialization;
+    std::memcpy(&serialization.m_data[0], data, size);
+    serialization.m_size = size;
+    return serialization;
+}
+
+template <uint64_t Capacity>
+inline optional<BinarySerialization<Capacity>>
+BinarySerialization<Capacity>::fromHexString(const char* const hexString, const uint64_t length) noexcept
+{
+    constexpr uint32_t HEX_BASE{16U};
+    constexpr uint32_t BITS_PER_HEX_DIGIT{4U};
+
+    if (length % 2U != 0U || length / 2U > Capacity)
+    {
+        return nullopt;
+    }
+
+    BinarySerialization serialization;
+    for (uint64_t i = 0U; i < length / 2U; ++i)
+    {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto highNibble = detail::digitValue(hexString[2U * i]);
+        const auto lowNibble = detail::digitValue(hexString[2U * i + 1U]);
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        if (highNibble >= HEX_BASE || lowNibble >= HEX_BASE)
+        {
+            return nullopt;
+        }
+        serialization.m_data[i] = static_cast<uint8_t>((highNibble << BITS_PER_HEX_DIGIT) | lowNibble);
+    }
+    serialization.m_size = length / 2U;
+    return serialization;
+}
+
+template <uint64_t Capacity>
+inline typename BinarySerialization<Capacity>::HexString_t BinarySerialization<Capacity>::toHexString() const noexcept
+{
+    constexpr uint32_t BITS_PER_HEX_DIGIT{4U};
+    constexpr uint8_t LOW_NIBBLE_MASK{0x0FU};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    constexpr char HEX_DIGITS[]{"0123456789abcdef"};
+
+    HexString_t hexString;
+    hexString.unsafe_raw_access([this, &HEX_DIGITS](char* str, const BufferInfo) -> uint64_t {
+        // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        for (uint64_t i = 0U; i < m_size; ++i)
+        {
+            str[2U * i] = HEX_DIGITS[m_data[i] >> BITS_PER_HEX_DIGIT];
+            str[2U * i + 1U] = HEX_DIGITS[m_data[i] & LOW_NIBBLE_MASK];
+        }
+        str[2U * m_size] = '\0';
+        // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return 2U * m_size;
+    });
+    return hexString;
+}
+
+template <uint64_t Capacity>
+inline const uint8_t* BinarySerialization<Capacity>::data() const noexcept
+{
+    return &m_data[0];
+}
+
+template <uint64_t Capacity>
+inline uint64_t BinarySerialization<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint64_t Capacity>
+inline constexpr uint64_t BinarySerialization<Capacity>::capacity() noexcept
+{
+    return Capacity;
+}
+
+template <uint64_t Capacity>
+template <typename... Targs>
+inline constexpr uint64_t BinarySerialization<Capacity>::maxSerializedSize() noexcept
+{
+    return detail::maxBinarySerializedSize<Targs...>();
+}
+
+template <uint64_t Capacity>
+inline void BinarySerialization<Capacity>::writeUnsigned(const uint64_t value, const uint64_t numberOfBytes) noexcept
+{
+    constexpr uint64_t BITS_PER_BYTE{8U};
+    for (uint64_t i = 0U; i < numberOfBytes; ++i)
+    {
+        m_data[m_size + i] = static_cast<uint8_t>(value >> (BITS_PER_BYTE * i));
+    }
+    m_size += numberOfBytes;
+}
+
+template <uint64_t Capacity>
+inline bool BinarySerialization<Capacity>::readUnsigned(uint64_t& position,
+                                                        const uint64_t numberOfBytes,
+                                                        uint64_t& value) const noexcept
+{
+    constexpr uint64_t BITS_PER_BYTE{8U};
+    if (m_size - position < numberOfBytes)
+    {
+        return false;
+    }
+
+    value = 0U;
+    for (uint64_t i = 0U; i < numberOfBytes; ++i)
+    {
+        value |= static_cast<uint64_t>(m_data[position + i]) << (BITS_PER_BYTE * i);
+    }
+    position += numberOfBytes;
+    return true;
+}
+
+template <uint64_t Capacity>
+template <typename T>
+inline void BinarySerialization<Capacity>::write(const T& value) noexcept
+{
+    if constexpr (is_iox_string<T>::value)
+    {
+        writeUnsigned(value.size(), detail::BINARY_SERIALIZATION_STRING_LENGTH_SIZE);
+        std::memcpy(&m_data[m_size], value.c_str(), value.size());
+        m_size += value.size();
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        writeUnsigned(value ? 1U : 0U, sizeof(uint8_t));
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        write(static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        writeUnsigned(static_cast<std::make_unsigned_t<T>>(value), sizeof(T));
+    }
+    else
+    {
+        // the IEEE-754 representation is transferred bitwise
+        std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t> bits{0U};
+        static_assert(sizeof(bits) == sizeof(T), "Unsupported floating point type");
+        std::memcpy(&bits, &value, sizeof(T));
+        writeUnsigned(bits, sizeof(T));
+    }
+}
+
+template <uint64_t Capacity>
+template <typename T>
+inline bool BinarySerialization<Capacity>::read(uint64_t& position, T& value) const noexcept
+{
+    uint64_t rawValue{0U};
+    if constexpr (is_iox_string<T>::value)
+    {
+        if (!readUnsigned(position, detail::BINARY_SERIALIZATION_STRING_LENGTH_SIZE, rawValue)
+            || rawValue > T::capacity() || m_size - position < rawValue)
+        {
+            return false;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        value = T(TruncateToCapacity, reinterpret_cast<const char*>(&m_data[position]), rawValue);
+        position += rawValue;
+        return true;
+    }
+    else if constexpr (std::is_same<T, bool>::value)
+    {
+        if (!readUnsigned(position, sizeof(uint8_t), rawValue) || rawValue > 1U)
+        {
+            return false;
+        }
+        value = (rawValue == 1U);
+        return true;
+    }
+    else if constexpr (std::is_enum<T>::value)
+    {
+        std::underlying_type_t<T> underlyingValue{};
+        if (!read(position, underlyingValue))
+        {
+            return false;
+        }
+        value = static_cast<T>(underlyingValue);
+        return true;
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        if (!readUnsigned(position, sizeof(T), rawValue))
+        {
+            return false;
+        }
+        value = static_cast<T>(static_cast<std::make_unsigned_t<T>>(rawValue));
+        return true;
+    }
+    else
+    {
+        using Bits_t = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+        if (!readUnsigned(position, sizeof(T), rawValue))
+        {
+            return false;
+        }
+        const auto bits = static_cast<Bits_t>(rawValue);
+        std::memcpy(&value, &bits, sizeof(T));
+        return true;
+    }
+}
 } // namespace iox
 
 #endif // IOX_HOOFS_UTILITY_SERIALIZATION_INL
@@ -0,0 +1,101 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_UTILITY_TO_CHARS_HPP
+#define IOX_HOOFS_UTILITY_TO_CHARS_HPP
+
+#include <cstdint>
+#include <system_error>
+#include <type_traits>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief Maximum number of characters which are considered when a floating point number is parsed
+constexpr uint64_t MAX_FLOATING_POINT_CHARS{128U};
+} // namespace detail
+
+/// @brief Result of 'iox::to_chars'; on success 'ptr' is one past the last written character and 'ec' is
+/// value-initialized, on failure 'ptr' is 'last' and 'ec' is 'std::errc::value_too_large'
+struct to_chars_result
+{
+    char* ptr;
+    std::errc ec;
+};
+
+/// @brief Result of 'iox::from_chars'; 'ptr' is one past the last character which was parsed and 'ec' is
+/// value-initialized on success, 'std::errc::invalid_argument' if no number could be parsed or
+/// 'std::errc::result_out_of_range' if the parsed number does not fit into the target type
+struct from_chars_result
+{
+    const char* ptr;
+    std::errc ec;
+};
+
+/// @brief Formats an integer into the character range [first, last) without a heap allocation, a locale or a null
+/// termination, like 'std::to_chars' from C++17
+/// @code
+///     char buffer[20];
+///     auto result = iox::to_chars(buffer, buffer + 20, -42);
+///     if (result.ec == std::errc{}) {} // [buffer, result.ptr) contains "-42"
+/// @endcode
+/// @tparam T integral type of the value
+/// @param[in] first begin of the character range
+/// @param[in] last end of the character range
+/// @param[in] value which is formatted
+/// @param[in] base in the range of [2, 36]; digits greater than 9 are formatted as lower case letters
+/// @return the end of the written characters or an error if the range is too small
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> = 0>
+to_chars_result to_chars(char* first, char* last, const T value, const int32_t base = 10) noexcept;
+
+/// @brief Formats a floating point number into the character range [first, last) without a heap allocation or a null
+/// termination. The result equals the output of a 'std::ostream' with default formatting, i.e. the shortest of the
+/// fixed and the scientific notation with 6 significant digits.
+/// @tparam T floating point type of the value
+/// @param[in] first begin of the character range
+/// @param[in] last end of the character range
+/// @param[in] value which is formatted
+/// @return the end of the written characters or an error if the range is too small
+template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value, bool> = 0>
+to_chars_result to_chars(char* first, char* last, const T value) noexcept;
+
+/// @brief Parses an integer from the character range [first, last) like 'std::from_chars' from C++17; neither leading
+/// whitespace nor a plus sign are accepted and a minus sign only for signed types
+/// @tparam T integral type of the value
+/// @param[in] first begin of the character range
+/// @param[in] last end of the character range
+/// @param[out] value which is set only when the parsing succeeded
+/// @param[in] base in the range of [2, 36]
+/// @return the end of the parsed characters and the error if the parsing failed
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool> = 0>
+from_chars_result from_chars(const char* first, const char* last, T& value, const int32_t base = 10) noexcept;
+
+/// @brief Parses a floating point number from the character range [first, last); neither leading whitespace nor a
+/// plus sign are accepted. At most 'detail::MAX_FLOATING_POINT_CHARS' characters are considered.
+/// @tparam T floating point type of the value
+/// @param[in] first begin of the character range
+/// @param[in] last end of the character range
+/// @param[out] value which is set only when the parsing succeeded
+/// @return the end of the parsed characters and the error if the parsing failed
+template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value, bool> = 0>
+from_chars_result from_chars(const char* first, const char* last, T& value) noexcept;
+
+} // namespace iox
+
+#include "iox/detail/to_chars.inl"
+
+#endif // IOX_HOOFS_UTILITY_TO_CHARS_HPP
@@ -0,0 +1,361 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_HOOFS_UTILITY_TO_CHARS_INL
+#define IOX_HOOFS_UTILITY_TO_CHARS_INL
+
+#include "iox/detail/to_chars.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace iox
+{
+namespace detail
+{
+/// @brief unsigned type which is used for the arithmetic of 'to_chars' and 'from_chars'; types smaller than 32 bit are
+/// widened since the arithmetic is performed with at least 32 bit anyway
+template <typename T>
+using to_chars_unsigned_t = std::conditional_t<(sizeof(T) <= sizeof(uint32_t)), uint32_t, uint64_t>;
+
+// NOLINTJUSTIFICATION lookup table for two decimal digits at once; accessed only with indices smaller than 200
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr char TO_CHARS_DIGIT_PAIRS[]{"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                      "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                      "8081828384858687888990919293949596979899"};
+
+// NOLINTJUSTIFICATION lookup table for the digits of all supported bases; accessed only with indices smaller than 36
+// NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+constexpr char TO_CHARS_DIGITS[]{"0123456789abcdefghijklmnopqrstuvwxyz"};
+
+constexpr int32_t TO_CHARS_MIN_BASE{2};
+constexpr int32_t TO_CHARS_MAX_BASE{36};
+constexpr int32_t TO_CHARS_DECIMAL_BASE{10};
+
+template <typename UnsignedT>
+inline uint32_t numberOfDecimalDigits(UnsignedT value) noexcept
+{
+    uint32_t digits{1U};
+    while (true)
+    {
+        if (value < 10U)
+        {
+            return digits;
+        }
+        if (value < 100U)
+        {
+            return digits + 1U;
+        }
+        if (value < 1000U)
+        {
+            return digits + 2U;
+        }
+        if (value < 10000U)
+        {
+            return digits + 3U;
+        }
+        value /= 10000U;
+        digits += 4U;
+    }
+}
+
+template <typename UnsignedT>
+inline uint32_t numberOfDigits(UnsignedT value, const UnsignedT base) noexcept
+{
+    uint32_t digits{1U};
+    while (value >= base)
+    {
+        value /= base;
+        ++digits;
+    }
+    return digits;
+}
+
+/// @brief writes the decimal digits of value backwards, starting before end; the caller ensures the range is large
+/// enough
+template <typename UnsignedT>
+inline void writeDecimalDigits(char* end, UnsignedT value) noexcept
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+    while (value >= 100U)
+    {
+        const auto index = static_cast<uint32_t>(value % 100U) * 2U;
+        value /= 100U;
+        end -= 2;
+        end[0] = TO_CHARS_DIGIT_PAIRS[index];
+        end[1] = TO_CHARS_DIGIT_PAIRS[index + 1U];
+    }
+    if (value >= 10U)
+    {
+        const auto index = static_cast<uint32_t>(value) * 2U;
+        end -= 2;
+        end[0] = TO_CHARS_DIGIT_PAIRS[index];
+        end[1] = TO_CHARS_DIGIT_PAIRS[index + 1U];
+    }
+    else
+    {
+        --end;
+        *end = TO_CHARS_DIGITS[value];
+    }
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+/// @brief writes the digits of value in base backwards, starting before end; the caller ensures the range is large
+/// enough
+template <typename UnsignedT>
+inline void writeDigits(char* end, UnsignedT value, const UnsignedT base) noexcept
+{
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+    do
+    {
+        --end;
+        *end = TO_CHARS_DIGITS[value % base];
+        value /= base;
+    } while (value != 0U);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic, cppcoreguidelines-pro-bounds-constant-array-index)
+}
+
+/// @brief returns the value of a digit in the bases up to 36 or TO_CHARS_MAX_BASE if c is not a digit
+inline uint32_t digitValue(const char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+    {
+        return static_cast<uint32_t>(c - '0');
+    }
+    if (c >= 'a' && c <= 'z')
+    {
+        return static_cast<uint32_t>(c - 'a') + 10U;
+    }
+    if (c >= 'A' && c <= 'Z')
+    {
+        return static_cast<uint32_t>(c - 'A') + 10U;
+    }
+    return static_cast<uint32_t>(TO_CHARS_MAX_BASE);
+}
+
+inline int32_t formatFloatingPoint(char* buffer, const uint64_t size, const float value) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    return snprintf(buffer, size, "%g", static_cast<double>(value));
+}
+
+inline int32_t formatFloatingPoint(char* buffer, const uint64_t size, const double value) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    return snprintf(buffer, size, "%g", value);
+}
+
+inline int32_t formatFloatingPoint(char* buffer, const uint64_t size, const long double value) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+    return snprintf(buffer, size, "%Lg", value);
+}
+
+inline void parseFloatingPoint(const char* str, char** end, float& value) noexcept
+{
+    value = strtof(str, end);
+}
+
+inline void parseFloatingPoint(const char* str, char** end, double& value) noexcept
+{
+    value = strtod(str, end);
+}
+
+inline void parseFloatingPoint(const char* str, char** end, long double& value) noexcept
+{
+    value = strtold(str, end);
+}
+} // namespace detail
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool>>
+inline to_chars_result to_chars(char* first, char* last, const T value, const int32_t base) noexcept
+{
+    using Unsigned_t = detail::to_chars_unsigned_t<T>;
+
+    if (base < detail::TO_CHARS_MIN_BASE || base > detail::TO_CHARS_MAX_BASE)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    // the conversion wraps around for negative values; the subtraction below restores the magnitude
+    auto magnitude = static_cast<Unsigned_t>(value);
+    if constexpr (std::is_signed<T>::value)
+    {
+        if (value < 0)
+        {
+            if (first == last)
+            {
+                return {last, std::errc::value_too_large};
+            }
+            *first = '-';
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ++first;
+            magnitude = static_cast<Unsigned_t>(Unsigned_t{0U} - magnitude);
+        }
+    }
+
+    const auto unsignedBase = static_cast<Unsigned_t>(base);
+    const auto numberOfDigits = (base == detail::TO_CHARS_DECIMAL_BASE)
+                                    ? detail::numberOfDecimalDigits(magnitude)
+                                    : detail::numberOfDigits(magnitude, unsignedBase);
+    if (last - first < static_cast<std::ptrdiff_t>(numberOfDigits))
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    char* end = first + numberOfDigits;
+    if (base == detail::TO_CHARS_DECIMAL_BASE)
+    {
+        detail::writeDecimalDigits(end, magnitude);
+    }
+    else
+    {
+        detail::writeDigits(end, magnitude, unsignedBase);
+    }
+    return {end, std::errc{}};
+}
+
+template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value, bool>>
+inline to_chars_result to_chars(char* first, char* last, const T value) noexcept
+{
+    // large enough for 6 significant digits, the sign, the decimal point and a four digit exponent, e.g.
+    // '-1.23457e+4932'
+    constexpr uint64_t BUFFER_SIZE{32U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char buffer[BUFFER_SIZE];
+    const auto length = detail::formatFloatingPoint(&buffer[0], BUFFER_SIZE, value);
+    if (length < 0 || static_cast<uint64_t>(length) >= BUFFER_SIZE || last - first < length)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    std::memcpy(first, &buffer[0], static_cast<uint64_t>(length));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    return {first + length, std::errc{}};
+}
+
+template <typename T, typename std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, bool>::value, bool>>
+inline from_chars_result from_chars(const char* first, const char* last, T& value, const int32_t base) noexcept
+{
+    using Unsigned_t = detail::to_chars_unsigned_t<T>;
+
+    if (base < detail::TO_CHARS_MIN_BASE || base > detail::TO_CHARS_MAX_BASE)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const char* position = first;
+    bool isNegative{false};
+    if constexpr (std::is_signed<T>::value)
+    {
+        if (position != last && *position == '-')
+        {
+            isNegative = true;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            ++position;
+        }
+    }
+
+    const auto maxMagnitude =
+        static_cast<Unsigned_t>(static_cast<Unsigned_t>(std::numeric_limits<T>::max()) + (isNegative ? 1U : 0U));
+    const auto unsignedBase = static_cast<Unsigned_t>(base);
+    const char* const digitsBegin = position;
+    Unsigned_t magnitude{0U};
+    bool isOutOfRange{false};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    for (; position != last; ++position)
+    {
+        const auto digit = static_cast<Unsigned_t>(detail::digitValue(*position));
+        if (digit >= unsignedBase)
+        {
+            break;
+        }
+        // the remaining digits are consumed in order to return the end of the number like 'std::from_chars'
+        if (!isOutOfRange)
+        {
+            if (magnitude > (maxMagnitude - digit) / unsignedBase)
+            {
+                isOutOfRange = true;
+            }
+            else
+            {
+                magnitude = static_cast<Unsigned_t>(magnitude * unsignedBase + digit);
+            }
+        }
+    }
+
+    if (position == digitsBegin)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+    if (isOutOfRange)
+    {
+        return {position, std::errc::result_out_of_range};
+    }
+
+    value = isNegative ? static_cast<T>(Unsigned_t{0U} - magnitude) : static_cast<T>(magnitude);
+    return {position, std::errc{}};
+}
+
+template <typename T, typename std::enable_if_t<std::is_floating_point<T>::value, bool>>
+inline from_chars_result from_chars(const char* first, const char* last, T& value) noexcept
+{
+    if (first == last || *first == '+' || (isspace(static_cast<unsigned char>(*first)) != 0))
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // the C functions require a null-terminated string
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    char buffer[detail::MAX_FLOATING_POINT_CHARS + 1U];
+    const auto length = std::min(static_cast<uint64_t>(last - first), detail::MAX_FLOATING_POINT_CHARS);
+    std::memcpy(&buffer[0], first, length);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+    buffer[length] = '\0';
+
+    const auto previousErrno = errno;
+    errno = 0;
+    char* end{nullptr};
+    T result{0};
+    detail::parseFloatingPoint(&buffer[0], &end, result);
+    const auto parseErrno = errno;
+    errno = previousErrno;
+
+    if (end == &buffer[0])
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const char* const parsedEnd = first + (end - &buffer[0]);
+    if (parseErrno == ERANGE)
+    {
+        return {parsedEnd, std::errc::result_out_of_range};
+    }
+
+    value = result;
+    return {parsedEnd, std::errc{}};
+}
+} // namespace iox
+
+#endif // IOX_HOOFS_UTILITY_TO_CHARS_INL
@@ -17,6 +17,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/unistd.hpp"
+
+#include <cerrno>
 #include "iceoryx_platform/shm_file.hpp"
 
 #include "FreeRTOS.h"
@@ -98,3 +100,9 @@ iox_ssize_t iox_write(int, const void*, size_t)
 {
     return 0;
 }
+
+int iox_pidfd_open(pid_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
@@ -32,5 +32,8 @@ int iox_unlink(const char* pathname);
 iox_off_t iox_lseek(int fd, iox_off_t offset, int whence);
 iox_ssize_t iox_read(int fd, void* buf, size_t count);
 iox_ssize_t iox_write(int fd, const void* buf, size_t count);
+/// @brief Creates a file descriptor which refers to the process with the given pid and becomes readable when the
+/// process terminates, see pidfd_open(2)
+int iox_pidfd_open(pid_t pid);
 
 #endif // IOX_HOOFS_LINUX_PLATFORM_UNISTD_HPP
@@ -17,6 +17,9 @@
 
 #include "iceoryx_platform/unistd.hpp"
 
+#include <cerrno>
+#include <sys/syscall.h>
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_close(int fd)
 {
@@ -57,3 +60,15 @@ iox_ssize_t iox_write(int fd, const void* buf, size_t count)
 {
     return write(fd, buf, count);
 }
+
+int iox_pidfd_open(pid_t pid)
+{
+#if defined(SYS_pidfd_open)
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg) system call without glibc wrapper
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    static_cast<void>(pid);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
@@ -0,0 +1,30 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_HOOFS_UNIX_PLATFORM_POLL_HPP
+#define IOX_HOOFS_UNIX_PLATFORM_POLL_HPP
+
+#include <poll.h>
+
+#define IOX_POLLIN POLLIN
+
+using iox_pollfd_t = struct pollfd;
+using iox_nfds_t = nfds_t;
+
+int iox_poll(iox_pollfd_t* fds, iox_nfds_t nfds, int timeout);
+
+#endif // IOX_HOOFS_UNIX_PLATFORM_POLL_HPP
@@ -31,5 +31,7 @@ int iox_unlink(const char* pathname);
 iox_off_t iox_lseek(int fd, iox_off_t offset, int whence);
 iox_ssize_t iox_read(int fd, void* buf, size_t count);
 iox_ssize_t iox_write(int fd, const void* buf, size_t count);
+/// @brief Process file descriptors are not supported on this platform; fails with ENOSYS
+int iox_pidfd_open(pid_t pid);
 
 #endif // IOX_HOOFS_UNIX_PLATFORM_UNISTD_HPP
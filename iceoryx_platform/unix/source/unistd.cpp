@@ -17,6 +17,8 @@
 
 #include "iceoryx_platform/unistd.hpp"
 
+#include <cerrno>
+
 // NOLINTNEXTLINE(readability-identifier-naming)
 int iox_close(int fd)
 {
@@ -57,3 +59,9 @@ iox_ssize_t iox_write(int fd, const void* buf, size_t count)
 {
     return write(fd, buf, count);
 }
+
+int iox_pidfd_open(pid_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
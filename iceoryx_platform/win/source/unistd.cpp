@@ -16,6 +16,8 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/unistd.hpp"
+
+#include <cerrno>
 #include "iceoryx_platform/handle_translator.hpp"
 #include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
@@ -93,3 +95,9 @@ gid_t getgid()
 {
     return 0;
 }
+
+int iox_pidfd_open(pid_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
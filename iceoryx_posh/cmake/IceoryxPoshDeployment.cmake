@@ -123,6 +123,10 @@ configure_option(
     NAME IOX_MAX_CLIENTS_PER_SERVER
     DEFAULT_VALUE 256
 )
+configure_option(
+    NAME IOX_MAX_SERVERS_PER_CLIENT
+    DEFAULT_VALUE 8
+)
 configure_option(
     NAME IOX_MAX_NUMBER_OF_NOTIFIERS
     DEFAULT_VALUE 256
@@ -0,0 +1,128 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_HPP
+#define IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iox/expected.hpp"
+#include "iox/posh/experimental/node.hpp"
+
+#include <memory>
+
+namespace iox::posh::experimental
+{
+enum class ChunkForwardingError : uint8_t
+{
+    NO_CHUNK_AVAILABLE,
+    TOO_MANY_CHUNKS_HELD_IN_PARALLEL,
+    LOAN_FAILED,
+};
+
+enum class CrossDomainChannelError : uint8_t
+{
+    INVALID_NODE,
+    SUBSCRIBER_CREATION_FAILED,
+    PUBLISHER_CREATION_FAILED,
+};
+
+/// @brief Re-publishes the oldest chunk available at the subscriber with the publisher. A chunk with the same
+/// user-header size and user-payload size and alignment is loaned from the publisher and the user-header and
+/// user-payload are transferred with a single memcpy whenever both chunks have the same layout. The received chunk
+/// is released in any case.
+/// @tparam Subscriber type with the 'UntypedSubscriber' take/release API
+/// @tparam Publisher type with the 'UntypedPublisher' loan/publish API
+/// @param[in] subscriber to take the chunk from
+/// @param[in] publisher to re-publish the chunk with
+/// @return an empty expected on success, otherwise the reason why no chunk was forwarded
+template <typename Subscriber, typename Publisher>
+expected<void, ChunkForwardingError> forwardChunk(Subscriber& subscriber, Publisher& publisher) noexcept;
+
+/// @brief A gateway channel which re-publishes the chunks of a service received in one iceoryx domain into another
+/// iceoryx domain. Both terminals are regular iceoryx endpoints, created from a 'Node' registered at the respective
+/// domain, therefore the data is never copied into an intermediate buffer of an external transport.
+/// @note The channel fulfills the requirements of the 'channel_t' of the 'GatewayGeneric' and can be created via
+/// 'GatewayGeneric::addChannel' with 'CrossDomainChannel::Options'
+/// @note Separate domains do never share a shared memory segment, therefore exactly one copy into a loaned chunk of
+/// the target domain is required
+/// @note The subscriber and publisher of the channel use the 'capro::Interfaces::CROSS_DOMAIN' interface. Like for
+/// other gateways, RouDi does not connect endpoints with the same non-internal interface, therefore a chunk forwarded
+/// by one channel is never picked up by a channel in the opposite direction
+class CrossDomainChannel
+{
+  public:
+    using SubscriberPtr = std::shared_ptr<UntypedSubscriber>;
+    using PublisherPtr = std::shared_ptr<UntypedPublisher>;
+
+    struct Options
+    {
+        /// @brief The node registered at the domain the data is received from; must outlive the channel
+        Node* sourceNode{nullptr};
+        /// @brief The node registered at the domain the data is re-published to; must outlive the channel
+        Node* targetNode{nullptr};
+        /// @brief The queue capacity of the subscriber in the source domain
+        uint64_t queueCapacity{popo::SubscriberChunkQueueData_t::MAX_CAPACITY};
+        /// @brief The history capacity of the publisher in the target domain
+        uint64_t historyCapacity{0U};
+    };
+
+    CrossDomainChannel(const capro::ServiceDescription& service,
+                       const SubscriberPtr& subscriber,
+                       const PublisherPtr& publisher) noexcept;
+
+    /// @brief Creates a subscriber for the service in the source domain and a publisher for the same service in the
+    /// target domain
+    /// @param[in] service to create the channel for
+    /// @param[in] options with the nodes of the source and target domain
+    /// @return the created channel or the reason why the creation failed
+    static expected<CrossDomainChannel, CrossDomainChannelError> create(const capro::ServiceDescription& service,
+                                                                        const Options& options) noexcept;
+
+    /// @brief The default upper bound of chunks forwarded by one 'forward' call; a full subscriber queue is forwarded
+    /// in one call
+    static constexpr uint64_t DEFAULT_MAX_NUMBER_OF_CHUNKS_PER_FORWARD{popo::SubscriberChunkQueueData_t::MAX_CAPACITY};
+
+    /// @brief Forwards the chunks which are currently available in the source domain
+    /// @param[in] maxNumberOfChunks is the upper bound of chunks forwarded by this call; the call returns at the latest
+    /// when it is reached, even if the source domain publishes faster than the chunks are forwarded
+    /// @return the number of forwarded chunks
+    /// @note A chunk which cannot be loaned in the target domain is dropped and counted as lost. The call returns in
+    /// this case and the remaining chunks stay in the queue of the subscriber until the next call.
+    uint64_t forward(const uint64_t maxNumberOfChunks = DEFAULT_MAX_NUMBER_OF_CHUNKS_PER_FORWARD) noexcept;
+
+    /// @brief The number of chunks which were dropped since the creation of the channel because no chunk could be
+    /// loaned in the target domain
+    uint64_t numberOfLostChunks() const noexcept;
+
+    capro::ServiceDescription getServiceDescription() const noexcept;
+    SubscriberPtr getSourceSubscriber() const noexcept;
+    PublisherPtr getTargetPublisher() const noexcept;
+
+  private:
+    capro::ServiceDescription m_service;
+    SubscriberPtr m_subscriber;
+    PublisherPtr m_publisher;
+    uint64_t m_numberOfLostChunks{0U};
+};
+
+} // namespace iox::posh::experimental
+
+#include "iox/posh/experimental/detail/cross_domain_channel.inl"
+
+#endif // IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_HPP
@@ -0,0 +1,184 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_INL
+#define IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_INL
+
+#include "iox/logging.hpp"
+#include "iox/posh/experimental/cross_domain_channel.hpp"
+
+#include <cstring>
+
+namespace iox::posh::experimental
+{
+template <typename Subscriber, typename Publisher>
+inline expected<void, ChunkForwardingError> forwardChunk(Subscriber& subscriber, Publisher& publisher) noexcept
+{
+    auto takeResult = subscriber.take();
+    if (takeResult.has_error())
+    {
+        return err(takeResult.error() == popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE
+                       ? ChunkForwardingError::NO_CHUNK_AVAILABLE
+                       : ChunkForwardingError::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+
+    const void* sourceUserPayload = takeResult.value();
+    const auto* sourceChunkHeader = mepoo::ChunkHeader::fromUserPayload(sourceUserPayload);
+    const auto userHeaderSize = sourceChunkHeader->userHeaderSize();
+    const auto userPayloadSize = sourceChunkHeader->userPayloadSize();
+
+    // the user-header alignment is not stored in the chunk header; the user-header is always placed directly after the
+    // chunk header, therefore using the chunk header alignment results in the same layout
+    const uint32_t userHeaderAlignment = (userHeaderSize == 0U) ? iox::CHUNK_NO_USER_HEADER_ALIGNMENT
+                                                                : static_cast<uint32_t>(alignof(mepoo::ChunkHeader));
+
+    auto loanResult = publisher.loan(
+        userPayloadSize, sourceChunkHeader->userPayloadAlignment(), userHeaderSize, userHeaderAlignment);
+    if (loanResult.has_error())
+    {
+        subscriber.release(sourceUserPayload);
+        return err(ChunkForwardingError::LOAN_FAILED);
+    }
+
+    void* targetUserPayload = loanResult.value();
+    auto* targetChunkHeader = mepoo::ChunkHeader::fromUserPayload(targetUserPayload);
+
+    if (userHeaderSize == 0U)
+    {
+        std::memcpy(targetUserPayload, sourceUserPayload, userPayloadSize);
+    }
+    else
+    {
+        const auto* sourceUserHeader = static_cast<const uint8_t*>(sourceChunkHeader->userHeader());
+        auto* targetUserHeader = static_cast<uint8_t*>(targetChunkHeader->userHeader());
+        const auto sourceUserPayloadOffset =
+            static_cast<uint64_t>(static_cast<const uint8_t*>(sourceUserPayload) - sourceUserHeader);
+        const auto targetUserPayloadOffset =
+            static_cast<uint64_t>(static_cast<uint8_t*>(targetUserPayload) - targetUserHeader);
+
+        // the padding between user-header and user-payload depends on the chunk address when the user-payload
+        // alignment exceeds the chunk header alignment; only identical layouts can be transferred in one go
+        if (sourceUserPayloadOffset == targetUserPayloadOffset)
+        {
+            std::memcpy(targetUserHeader, sourceUserHeader, sourceUserPayloadOffset + userPayloadSize);
+        }
+        else
+        {
+            std::memcpy(targetUserHeader, sourceUserHeader, userHeaderSize);
+            std::memcpy(targetUserPayload, sourceUserPayload, userPayloadSize);
+        }
+    }
+
+    subscriber.release(sourceUserPayload);
+    publisher.publish(targetUserPayload);
+
+    return ok();
+}
+
+inline CrossDomainChannel::CrossDomainChannel(const capro::ServiceDescription& service,
+                                              const SubscriberPtr& subscriber,
+                                              const PublisherPtr& publisher) noexcept
+    : m_service(service)
+    , m_subscriber(subscriber)
+    , m_publisher(publisher)
+{
+}
+
+inline expected<CrossDomainChannel, CrossDomainChannelError>
+CrossDomainChannel::create(const capro::ServiceDescription& service, const Options& options) noexcept
+{
+    if (options.sourceNode == nullptr || options.targetNode == nullptr || options.sourceNode == options.targetNode)
+    {
+        return err(CrossDomainChannelError::INVALID_NODE);
+    }
+
+    // the interface prevents cyclic connections between channels in opposite directions
+    const capro::ServiceDescription channelService{service.getServiceIDString(),
+                                                   service.getInstanceIDString(),
+                                                   service.getEventIDString(),
+                                                   service.getClassHash(),
+                                                   capro::Interfaces::CROSS_DOMAIN};
+
+    auto subscriberResult =
+        options.sourceNode->subscriber(channelService).queue_capacity(options.queueCapacity).create();
+    if (subscriberResult.has_error())
+    {
+        return err(CrossDomainChannelError::SUBSCRIBER_CREATION_FAILED);
+    }
+
+    auto publisherResult =
+        options.targetNode->publisher(channelService).history_capacity(options.historyCapacity).create();
+    if (publisherResult.has_error())
+    {
+        return err(CrossDomainChannelError::PUBLISHER_CREATION_FAILED);
+    }
+
+    SubscriberPtr subscriber{unique_ptr<UntypedSubscriber>::release(std::move(subscriberResult.value())),
+                             [](auto* const sub) { delete sub; }};
+    PublisherPtr publisher{unique_ptr<UntypedPublisher>::release(std::move(publisherResult.value())),
+                           [](auto* const pub) { delete pub; }};
+
+    return ok(CrossDomainChannel(service, subscriber, publisher));
+}
+
+inline uint64_t CrossDomainChannel::forward(const uint64_t maxNumberOfChunks) noexcept
+{
+    uint64_t numberOfForwardedChunks{0U};
+    while (numberOfForwardedChunks < maxNumberOfChunks)
+    {
+        auto result = forwardChunk(*m_subscriber, *m_publisher);
+        if (result.has_error())
+        {
+            if (result.error() == ChunkForwardingError::LOAN_FAILED)
+            {
+                // the taken chunk is dropped; the remaining ones stay queued since the target domain is exhausted
+                ++m_numberOfLostChunks;
+                IOX_LOG(WARN,
+                        "The CrossDomainChannel for '"
+                            << m_service << "' dropped a chunk since no chunk could be loaned in the target domain ("
+                            << m_numberOfLostChunks << " in total)");
+            }
+            break;
+        }
+        ++numberOfForwardedChunks;
+    }
+
+    return numberOfForwardedChunks;
+}
+
+inline uint64_t CrossDomainChannel::numberOfLostChunks() const noexcept
+{
+    return m_numberOfLostChunks;
+}
+
+inline capro::ServiceDescription CrossDomainChannel::getServiceDescription() const noexcept
+{
+    return m_service;
+}
+
+inline CrossDomainChannel::SubscriberPtr CrossDomainChannel::getSourceSubscriber() const noexcept
+{
+    return m_subscriber;
+}
+
+inline CrossDomainChannel::PublisherPtr CrossDomainChannel::getTargetPublisher() const noexcept
+{
+    return m_publisher;
+}
+
+} // namespace iox::posh::experimental
+
+#endif // IOX_POSH_EXPERIMENTAL_CROSS_DOMAIN_CHANNEL_INL
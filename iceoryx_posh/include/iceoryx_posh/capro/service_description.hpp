@@ -61,12 +61,14 @@ enum class Interfaces : uint16_t
     MTA,
     /// @brief Robot Operating System 1
     ROS1,
+    /// @brief Another iceoryx domain connected via the 'CrossDomainChannel'
+    CROSS_DOMAIN,
     /// @brief End of enum
     INTERFACE_END
 };
 
 constexpr const char* INTERFACE_NAMES[] = {
-    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "END"};
+    "INTERNAL", "ESOC", "SOMEIP", "AMQP", "MQTT", "DDS", "SIGNAL", "MTA", "ROS1", "CROSS_DOMAIN", "END"};
 
 /// @brief Scope of a service description
 enum class Scope : uint16_t
@@ -110,7 +112,8 @@ class ServiceDescription
                        ClassHash m_classHash = {0U, 0U, 0U, 0U},
                        Interfaces interfaceSource = Interfaces::INTERNAL) noexcept;
 
-    /// @brief compare operator.
+    /// @brief compare operator. The precomputed hashes are compared first in order to reject different service
+    /// descriptions without comparing the strings.
     bool operator==(const ServiceDescription& rhs) const noexcept;
 
     /// @brief negation of compare operator.
@@ -151,6 +154,10 @@ class ServiceDescription
     ClassHash getClassHash() const noexcept;
     ///@}
 
+    /// @brief Returns the 64 bit hash of the service, instance and event string which is computed once on construction
+    /// and deserialization; equal service descriptions have equal hashes
+    uint64_t getHash() const noexcept;
+
     /// @brief Returns the interface form where the service is coming from.
     Interfaces getSourceInterface() const noexcept;
 
@@ -170,6 +177,12 @@ class ServiceDescription
 
     /// @brief If StopOffer or Offer message, this is set from which interface its coming
     Interfaces m_interfaceSource{Interfaces::INTERNAL};
+
+    /// @brief hash of the string IDs; it is not part of the serialization but recomputed on deserialization
+    uint64_t m_hash{0U};
+
+    static uint64_t
+    computeHash(const IdString_t& service, const IdString_t& instance, const IdString_t& event) noexcept;
 };
 
 /// @brief Compare two service descriptions via their values in member
@@ -93,11 +93,13 @@ constexpr uint32_t MAX_CLIENTS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_REQUESTS_ALLOCATED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY = build::IOX_MAX_RESPONSES_PROCESSED_SIMULTANEOUSLY;
 constexpr uint32_t MAX_RESPONSE_QUEUE_CAPACITY = build::IOX_MAX_RESPONSE_QUEUE_CAPACITY;
+constexpr uint32_t MAX_SERVERS_PER_CLIENT = build::IOX_MAX_SERVERS_PER_CLIENT;
 // Server
 constexpr uint32_t MAX_SERVERS = build::IOX_MAX_PUBLISHERS;
 constexpr uint32_t MAX_CLIENTS_PER_SERVER = build::IOX_MAX_CLIENTS_PER_SERVER;
 constexpr uint32_t MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY = 4U;
 constexpr uint32_t MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY = MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY;
+constexpr uint32_t MAX_SERVER_WORKERS = 16U;
 constexpr uint32_t MAX_REQUEST_QUEUE_CAPACITY = build::IOX_MAX_REQUEST_QUEUE_CAPACITY;
 // Waitset
 namespace popo
@@ -290,12 +292,23 @@ constexpr units::Duration PROCESS_DEFAULT_TERMINATION_DELAY = 0_s;
 constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
+/// @brief Maximum number of ports which are destroyed in a single discovery run; the teardown of a process with many
+/// ports is spread over multiple runs so that the discovery of the other processes is not stalled
+constexpr uint64_t MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN{64U};
+/// @brief Interval of the discovery runs while a port teardown is pending
+constexpr units::Duration PORT_TEARDOWN_DISCOVERY_INTERVAL = 1_ms;
+/// @brief Interval in which the process termination monitor picks up newly registered processes; the termination of
+/// an already monitored process is detected immediately
+constexpr units::Duration PROCESS_TERMINATION_MONITOR_UPDATE_INTERVAL = 20_ms;
+/// @brief Interval in which the introspection categories publish their data unless configured otherwise
+constexpr units::Duration DEFAULT_INTROSPECTION_INTERVAL = 1_s;
 
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
 /// Once Runlevel Management is extended, it will detect absent processes. Those processes can register again.
-/// ON - all processes are monitored
+/// ON - all processes are monitored; where supported (Linux) the termination of a process is additionally detected
+///      immediately via process file descriptors, with the heartbeat as fallback
 /// OFF - no process is monitored
 enum class MonitoringMode
 {
@@ -304,6 +317,20 @@ enum class MonitoringMode
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
+
+/// @brief Controls how much data an introspection category of RouDi collects and publishes
+/// OFF - the category is disabled; its topics are not offered and RouDi does not track any data for it
+/// BASIC - the port introspection only publishes the port list without the periodically sampled throughput and
+///         subscriber data; the mempool and process introspection do not distinguish between BASIC and FULL
+/// FULL - all data of the category is published
+enum class IntrospectionLevel : uint8_t
+{
+    OFF,
+    BASIC,
+    FULL
+};
+
+iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const IntrospectionLevel& level) noexcept;
 } // namespace roudi
 
 namespace mepoo
@@ -68,6 +68,26 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     }
     return logstream;
 }
+
+inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const IntrospectionLevel& level) noexcept
+{
+    switch (level)
+    {
+    case IntrospectionLevel::OFF:
+        logstream << "IntrospectionLevel::OFF";
+        break;
+    case IntrospectionLevel::BASIC:
+        logstream << "IntrospectionLevel::BASIC";
+        break;
+    case IntrospectionLevel::FULL:
+        logstream << "IntrospectionLevel::FULL";
+        break;
+    default:
+        logstream << "IntrospectionLevel::UNDEFINED";
+        break;
+    }
+    return logstream;
+}
 } // namespace roudi
 
 } // namespace iox
@@ -96,6 +96,7 @@ class CaproMessage
     ServiceDescription m_serviceDescription;
     void* m_chunkQueueData{nullptr};
     uint64_t m_historyCapacity{0u};
+    bool m_latestValueMode{false};
 };
 
 } // namespace capro
@@ -40,11 +40,19 @@ struct ChunkManagement
                     const not_null<MemPool*> mempool,
                     const not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief Creates a ChunkManagement which resides in the prefix of the chunk it manages, i.e. it is released
+    /// together with the chunk and has no 'm_chunkManagementPool'
+    ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept;
+
     iox::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
     iox::RelativePointer<MemPool> m_mempool;
     iox::RelativePointer<MemPool> m_chunkManagementPool;
+
+    /// @brief the id of the segment the ChunkManagement resides in; it is known at the allocation and spares the
+    /// search of the segment when the ChunkManagement is converted to a shared memory compatible representation
+    segment_id_underlying_t m_segmentId{0U};
 };
 } // namespace mepoo
 } // namespace iox
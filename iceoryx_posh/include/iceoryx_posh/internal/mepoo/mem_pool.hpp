@@ -22,6 +22,7 @@
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
+#include "iox/memory.hpp"
 #include "iox/relative_pointer.hpp"
 
 #include <atomic>
@@ -68,6 +69,9 @@ class MemPool
     uint32_t getMinFree() const noexcept;
     MemPoolInfo getInfo() const noexcept;
 
+    /// @brief Returns the id of the segment the chunks of the MemPool reside in
+    segment_id_underlying_t getSegmentId() const noexcept;
+
     void freeChunk(const void* chunk) noexcept;
 
     /// @brief Converts an index to a chunk in the MemPool to a pointer
@@ -96,7 +100,9 @@ class MemPool
     /// (cas is only 64 bit and we need the other 32 bit for the aba counter)
     uint32_t m_numberOfChunks{0U};
 
-    std::atomic<uint32_t> m_usedChunks{0U};
+    // the counters are updated by every chunk allocation and release from any process; they are kept apart from the
+    // read-only members above which are accessed on the same code paths
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint32_t> m_usedChunks{0U};
     std::atomic<uint32_t> m_minFree{0U};
 
     freeList_t m_freeIndices;
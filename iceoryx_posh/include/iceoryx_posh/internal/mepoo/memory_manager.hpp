@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
@@ -42,8 +43,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint64_t, 1, std::numeric_limits<uint64_t>::max() - sizeof(ChunkHeader)>;
@@ -82,6 +81,7 @@ class MemoryManager
 
   private:
     static uint64_t sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t size) noexcept;
+    static uint64_t chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept;
 
     void printMemPoolVector(log::LogStream& log) const noexcept;
     void addMemPool(BumpAllocator& managementAllocator,
@@ -92,6 +92,7 @@ class MemoryManager
 
   private:
     bool m_denyAddMemPool{false};
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
     uint32_t m_totalNumberOfChunks{0};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
@@ -28,6 +28,7 @@ namespace mepoo
 {
 template <typename>
 class SharedPointer;
+class ShmSafeUnmanagedChunk;
 
 /// @brief WARNING: SharedChunk is not thread safe! Don't share SharedChunk objects between threads! Use for each thread
 /// a separate copy
@@ -49,6 +50,18 @@ class SharedChunk
 
     ChunkManagement* release() noexcept;
 
+    /// @brief Increments the reference counter by 'count' with a single atomic operation, e.g. to hand over the chunk
+    /// to multiple owners at once. Each acquired reference must either be taken over by an owner or be returned with
+    /// 'releaseReferences'.
+    /// @param[in] count is the number of references to acquire
+    void acquireReferences(const uint64_t count) const noexcept;
+
+    /// @brief Decrements the reference counter by 'count' with a single atomic operation; this returns the references
+    /// acquired with 'acquireReferences' which were not taken over by an owner
+    /// @param[in] count is the number of references to release
+    /// @note The reference of the SharedChunk itself is never released, therefore the chunk is not freed
+    void releaseReferences(const uint64_t count) const noexcept;
+
     bool operator==(const SharedChunk& rhs) const noexcept;
     /// @todo iox-#1617 use the newtype pattern to avoid the void pointer
     bool operator==(const void* const rhs) const noexcept;
@@ -60,6 +73,7 @@ class SharedChunk
 
     template <typename>
     friend class SharedPointer;
+    friend class ShmSafeUnmanagedChunk;
 
   private:
     void decrementReferenceCounter() noexcept;
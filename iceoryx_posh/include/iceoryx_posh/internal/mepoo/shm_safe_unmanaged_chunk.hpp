@@ -35,12 +35,23 @@ class ShmSafeUnmanagedChunk
     /// @brief takes a SharedChunk without decrementing the chunk reference counter
     ShmSafeUnmanagedChunk(SharedChunk chunk) noexcept;
 
+    /// @brief refers to the chunk of a SharedChunk without taking over its reference; the caller must have acquired a
+    /// reference with SharedChunk::acquireReferences for each copy which is handed over to an owner
+    static ShmSafeUnmanagedChunk fromAcquiredReference(const SharedChunk& chunk) noexcept;
+
     /// @brief Creates a SharedChunk without incrementing the chunk reference counter and invalidates itself
     SharedChunk releaseToSharedChunk() noexcept;
 
     /// @brief Creates a SharedChunk with incrementing the chunk reference counter and does not invalidate itself
     SharedChunk cloneToSharedChunk() noexcept;
 
+    /// @brief Creates a SharedChunk with incrementing the chunk reference counter if the chunk was not released in the
+    /// meantime, i.e. if the reference counter is not zero, and does not invalidate itself
+    /// @return the SharedChunk or an empty SharedChunk if the chunk was already released or this is logically a nullptr
+    /// @note the chunk can be released and reused for a new chunk in between, the caller has to validate that the
+    /// acquired chunk is still the expected one
+    SharedChunk tryCloneToSharedChunk() noexcept;
+
     /// @brief Checks if the underlying RelativePointerData to the chunk is logically a nullptr
     /// @return true if logically a nullptr otherwise false
     bool isLogicalNullptr() const noexcept;
@@ -59,6 +70,13 @@ class ShmSafeUnmanagedChunk
     /// @return true if neither logically a nullptr nor other owner chunk owners present, otherwise false
     bool isNotLogicalNullptrAndHasNoOtherOwners() const noexcept;
 
+    /// @brief Checks if both refer to the same chunk
+    bool operator==(const ShmSafeUnmanagedChunk& rhs) const noexcept;
+    bool operator!=(const ShmSafeUnmanagedChunk& rhs) const noexcept;
+
+  private:
+    static RelativePointerData toRelativePointerData(ChunkManagement* const chunkManagement) noexcept;
+
   private:
     RelativePointerData m_chunkManagement;
 };
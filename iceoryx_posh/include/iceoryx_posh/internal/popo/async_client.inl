@@ -0,0 +1,379 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_INL
+#define IOX_POSH_POPO_ASYNC_CLIENT_INL
+
+#include "iceoryx_posh/popo/async_client.hpp"
+
+namespace iox
+{
+namespace popo
+{
+inline constexpr const char* asStringLiteral(const AsyncRequestError value) noexcept
+{
+    switch (value)
+    {
+    case AsyncRequestError::TOO_MANY_REQUESTS_IN_FLIGHT:
+        return "AsyncRequestError::TOO_MANY_REQUESTS_IN_FLIGHT";
+    case AsyncRequestError::SEND_FAILED:
+        return "AsyncRequestError::SEND_FAILED";
+    case AsyncRequestError::TIMEOUT:
+        return "AsyncRequestError::TIMEOUT";
+    case AsyncRequestError::CANCELLED:
+        return "AsyncRequestError::CANCELLED";
+    }
+
+    return "[Undefined AsyncRequestError]";
+}
+
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncRequestError value) noexcept
+{
+    stream << asStringLiteral(value);
+    return stream;
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline AsyncClient<Req, Res, InFlightCapacity>::InFlightRequest::InFlightRequest(
+    const int64_t sequenceId, const units::Duration timeout, const CompletionCallback& callback) noexcept
+    : sequenceId(sequenceId)
+    , deadline(timeout)
+    , callback(callback)
+{
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline AsyncClient<Req, Res, InFlightCapacity>::AsyncClient(const capro::ServiceDescription& service,
+                                                             const ClientOptions& clientOptions) noexcept
+    : m_client(service, clientOptions)
+{
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline AsyncClient<Req, Res, InFlightCapacity>::~AsyncClient() noexcept
+{
+    // the client and the deadline trigger detach themselves from the Listener on destruction
+    stopDeadlineWatcher();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+template <typename... Args>
+inline expected<Request<Req>, AllocationError>
+AsyncClient<Req, Res, InFlightCapacity>::loan(Args&&... args) noexcept
+{
+    return m_client.loan(std::forward<Args>(args)...);
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline expected<int64_t, AsyncRequestError> AsyncClient<Req, Res, InFlightCapacity>::send(
+    Request<Req>&& request, const units::Duration timeout, const CompletionCallback& callback) noexcept
+{
+    int64_t sequenceId{0};
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        if (m_inFlightRequests.size() >= m_inFlightRequests.capacity())
+        {
+            return err(AsyncRequestError::TOO_MANY_REQUESTS_IN_FLIGHT);
+        }
+        sequenceId = m_nextSequenceId++;
+        m_inFlightRequests.emplace_back(sequenceId, timeout, callback);
+    }
+    notifyDeadlineWatcher();
+
+    // the request is registered before it is sent since the response might be dispatched on another thread before
+    // 'send' returns
+    request.getRequestHeader().setSequenceId(sequenceId);
+    auto sendResult = m_client.send(std::move(request));
+    if (sendResult.has_error())
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        for (auto iter = m_inFlightRequests.begin(); iter != m_inFlightRequests.end(); ++iter)
+        {
+            if (iter->sequenceId == sequenceId)
+            {
+                m_inFlightRequests.erase(iter);
+                break;
+            }
+        }
+        return err(AsyncRequestError::SEND_FAILED);
+    }
+
+    return ok(sequenceId);
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline uint64_t AsyncClient<Req, Res, InFlightCapacity>::processResponses() noexcept
+{
+    using Result = expected<Response<const Res>, AsyncRequestError>;
+
+    // the response queue has a single consumer, therefore concurrent dispatches must not take in parallel
+    std::lock_guard<std::mutex> processingLock(m_processingMutex);
+
+    uint64_t numberOfCompletedRequests{0U};
+    while (true)
+    {
+        auto takeResult = m_client.take();
+        if (takeResult.has_error())
+        {
+            break;
+        }
+
+        auto& response = takeResult.value();
+        const auto sequenceId = response.getResponseHeader().getSequenceId();
+
+        optional<CompletionCallback> callback;
+        {
+            std::lock_guard<std::mutex> lock(m_inFlightMutex);
+            for (auto iter = m_inFlightRequests.begin(); iter != m_inFlightRequests.end(); ++iter)
+            {
+                if (iter->sequenceId == sequenceId)
+                {
+                    callback.emplace(std::move(iter->callback));
+                    m_inFlightRequests.erase(iter);
+                    break;
+                }
+            }
+        }
+
+        // a response without a matching request, e.g. a late response to an expired request, is released when it
+        // goes out of scope
+        if (callback.has_value())
+        {
+            callback.value()(Result(ok(std::move(response))));
+            ++numberOfCompletedRequests;
+        }
+    }
+
+    return numberOfCompletedRequests + expireRequests();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline uint64_t AsyncClient<Req, Res, InFlightCapacity>::expireRequests() noexcept
+{
+    using Result = expected<Response<const Res>, AsyncRequestError>;
+
+    vector<CompletionCallback, InFlightCapacity> expiredCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        auto iter = m_inFlightRequests.begin();
+        while (iter != m_inFlightRequests.end())
+        {
+            if (iter->deadline.hasExpired())
+            {
+                expiredCallbacks.emplace_back(std::move(iter->callback));
+                // erase shifts the subsequent requests to the position of 'iter'
+                m_inFlightRequests.erase(iter);
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+    }
+    // the watcher waits for the next deadline only after the previous one was handled
+    notifyDeadlineWatcher();
+
+    for (auto& callback : expiredCallbacks)
+    {
+        callback(Result(err(AsyncRequestError::TIMEOUT)));
+    }
+
+    return expiredCallbacks.size();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline uint64_t AsyncClient<Req, Res, InFlightCapacity>::cancelAll() noexcept
+{
+    using Result = expected<Response<const Res>, AsyncRequestError>;
+
+    vector<CompletionCallback, InFlightCapacity> cancelledCallbacks;
+    {
+        std::lock_guard<std::mutex> lock(m_inFlightMutex);
+        for (auto& inFlightRequest : m_inFlightRequests)
+        {
+            cancelledCallbacks.emplace_back(std::move(inFlightRequest.callback));
+        }
+        m_inFlightRequests.clear();
+    }
+
+    for (auto& callback : cancelledCallbacks)
+    {
+        callback(Result(err(AsyncRequestError::CANCELLED)));
+    }
+
+    return cancelledCallbacks.size();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline uint64_t AsyncClient<Req, Res, InFlightCapacity>::numberOfRequestsInFlight() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_inFlightMutex);
+    return m_inFlightRequests.size();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline optional<units::Duration> AsyncClient<Req, Res, InFlightCapacity>::timeUntilNextDeadline() const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_inFlightMutex);
+    optional<units::Duration> nextDeadline;
+    for (const auto& inFlightRequest : m_inFlightRequests)
+    {
+        const auto remainingTime = inFlightRequest.deadline.remainingTime();
+        if (!nextDeadline.has_value() || remainingTime < nextDeadline.value())
+        {
+            nextDeadline.emplace(remainingTime);
+        }
+    }
+    return nextDeadline;
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline expected<void, ListenerError>
+AsyncClient<Req, Res, InFlightCapacity>::attachToListener(Listener& listener,
+                                                          const optional<Executor>& executor) noexcept
+{
+    if (m_isAttached)
+    {
+        return err(ListenerError::EVENT_ALREADY_ATTACHED);
+    }
+
+    // the executor is set before the events are attached, the Listener thread reads it only afterwards
+    m_executor = executor;
+
+    auto attachResult = listener.attachEvent(
+        m_client, ClientEvent::RESPONSE_RECEIVED, createNotificationCallback(onResponseReceived, *this));
+    if (attachResult.has_error())
+    {
+        return attachResult;
+    }
+
+    attachResult = listener.attachEvent(m_deadlineTrigger, createNotificationCallback(onDeadlineReached, *this));
+    if (attachResult.has_error())
+    {
+        listener.detachEvent(m_client, ClientEvent::RESPONSE_RECEIVED);
+        return attachResult;
+    }
+
+    m_isAttached = true;
+    m_stopWatcher = false;
+    m_deadlineWatcher = std::thread([this] { watchDeadlines(); });
+
+    return ok();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::detachFromListener(Listener& listener) noexcept
+{
+    stopDeadlineWatcher();
+    listener.detachEvent(m_client, ClientEvent::RESPONSE_RECEIVED);
+    listener.detachEvent(m_deadlineTrigger);
+    m_isAttached = false;
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::onResponseReceived(Client<Req, Res>* const,
+                                                                        AsyncClient* const self) noexcept
+{
+    self->runOrPost(Task([self] { self->processResponses(); }));
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::onDeadlineReached(UserTrigger* const,
+                                                                       AsyncClient* const self) noexcept
+{
+    self->runOrPost(Task([self] { self->expireRequests(); }));
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::runOrPost(Task&& task) noexcept
+{
+    if (m_executor.has_value())
+    {
+        m_executor.value()(task);
+    }
+    else
+    {
+        task();
+    }
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::watchDeadlines() noexcept
+{
+    std::unique_lock<std::mutex> lock(m_watcherMutex);
+    const auto isWokenUp = [this] { return m_stopWatcher || m_deadlinesChanged; };
+    while (!m_stopWatcher)
+    {
+        m_deadlinesChanged = false;
+        // lock order is m_watcherMutex before m_inFlightMutex; 'send' and 'expireRequests' notify the watcher only
+        // after releasing m_inFlightMutex
+        const auto nextDeadline = timeUntilNextDeadline();
+        if (!nextDeadline.has_value())
+        {
+            m_watcherCondition.wait(lock, isWokenUp);
+            continue;
+        }
+
+        const auto waitTime = std::chrono::nanoseconds(nextDeadline->toNanoseconds());
+        if (!m_watcherCondition.wait_for(lock, waitTime, isWokenUp))
+        {
+            m_deadlineTrigger.trigger();
+            // the Listener calls 'expireRequests' which notifies the watcher to wait for the next deadline
+            m_watcherCondition.wait(lock, isWokenUp);
+        }
+    }
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::notifyDeadlineWatcher() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_watcherMutex);
+        m_deadlinesChanged = true;
+    }
+    m_watcherCondition.notify_one();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline void AsyncClient<Req, Res, InFlightCapacity>::stopDeadlineWatcher() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(m_watcherMutex);
+        m_stopWatcher = true;
+    }
+    m_watcherCondition.notify_one();
+
+    if (m_deadlineWatcher.joinable())
+    {
+        m_deadlineWatcher.join();
+    }
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline ConnectionState AsyncClient<Req, Res, InFlightCapacity>::getConnectionState() const noexcept
+{
+    return m_client.getConnectionState();
+}
+
+template <typename Req, typename Res, uint64_t InFlightCapacity>
+inline const capro::ServiceDescription& AsyncClient<Req, Res, InFlightCapacity>::getServiceDescription() const noexcept
+{
+    return m_client.getServiceDescription();
+}
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_INL
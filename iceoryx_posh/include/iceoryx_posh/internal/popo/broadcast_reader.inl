@@ -0,0 +1,56 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BROADCAST_READER_INL
+#define IOX_POSH_POPO_BROADCAST_READER_INL
+
+#include "iceoryx_posh/popo/broadcast_reader.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+inline expected<T, BroadcastReaderError> BroadcastReader::take() noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be broadcast!");
+    static_assert(sizeof(T) <= BroadcastRing::MAX_MESSAGE_SIZE,
+                  "The type exceeds the maximum message size of the broadcast!");
+
+    // the message is taken into a buffer of the maximum size in order to consume larger messages, too
+    uint8_t buffer[BroadcastRing::MAX_MESSAGE_SIZE];
+    auto result = take(buffer, sizeof(buffer));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    if (result.value() != sizeof(T))
+    {
+        return err(BroadcastReaderError::MESSAGE_SIZE_MISMATCH);
+    }
+
+    T message;
+    std::memcpy(&message, buffer, sizeof(T));
+    return ok(message);
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BROADCAST_READER_INL
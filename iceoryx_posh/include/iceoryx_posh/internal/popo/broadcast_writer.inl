@@ -0,0 +1,39 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BROADCAST_WRITER_INL
+#define IOX_POSH_POPO_BROADCAST_WRITER_INL
+
+#include "iceoryx_posh/popo/broadcast_writer.hpp"
+
+#include <type_traits>
+
+namespace iox
+{
+namespace popo
+{
+template <typename T>
+inline expected<void, BroadcastWriterError> BroadcastWriter::write(const T& message) noexcept
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be broadcast!");
+    static_assert(sizeof(T) <= MAX_MESSAGE_SIZE, "The type exceeds the maximum message size of the broadcast!");
+    return write(&message, sizeof(T));
+}
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BROADCAST_WRITER_INL
@@ -0,0 +1,136 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_HPP
+
+#include "iox/expected.hpp"
+#include "iox/memory.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class BroadcastRingError
+{
+    INVALID_CAPACITY,
+    MESSAGE_TOO_LARGE,
+    NO_MESSAGE_AVAILABLE,
+    BUFFER_TOO_SMALL,
+};
+
+/// @brief A ring of fixed-size message slots in shared memory for one writer and any number of readers. The messages
+/// are copied into and out of the slots, i.e. there are no chunks, reference counters or queues per reader involved.
+/// @details Each slot is protected by a sequence counter (seqlock). The writer makes the counter of a slot odd before
+/// it overwrites the message and even afterwards; a reader copies the message and accepts the copy only if the counter
+/// was the expected even value before and after the copy. The writer is never blocked by the readers, a reader which
+/// is overtaken by more than the capacity loses the overwritten messages and continues with the oldest one.
+/// The message words are accessed with relaxed atomics, therefore a torn copy is detected and discarded without a
+/// data race.
+/// @note there must be only one writer at a time; the ring has a standard layout and can be placed in any memory which
+/// is shared between the processes, it is created with 'create' and accessed with 'fromMemory'
+class BroadcastRing
+{
+  public:
+    static constexpr uint64_t MAX_MESSAGE_SIZE{256U};
+    static constexpr uint64_t MAX_CAPACITY{1024U};
+
+    BroadcastRing(const BroadcastRing&) = delete;
+    BroadcastRing(BroadcastRing&&) = delete;
+    BroadcastRing& operator=(const BroadcastRing&) = delete;
+    BroadcastRing& operator=(BroadcastRing&&) = delete;
+
+    /// @brief the size of the memory which is required for a ring with the given capacity
+    /// @param[in] capacity of the ring in messages
+    /// @return the size in bytes
+    static uint64_t requiredSize(const uint64_t capacity) noexcept;
+
+    /// @brief the alignment of the memory which is required for a ring
+    static uint64_t requiredAlignment() noexcept;
+
+    /// @brief creates an empty ring in the given memory
+    /// @param[in] memory with at least 'requiredSize(capacity)' bytes and 'requiredAlignment()'
+    /// @param[in] capacity of the ring in messages; must be in the range 1..MAX_CAPACITY
+    /// @return the ring or BroadcastRingError::INVALID_CAPACITY
+    static expected<BroadcastRing*, BroadcastRingError> create(void* const memory, const uint64_t capacity) noexcept;
+
+    /// @brief accesses a ring which was created with 'create'
+    /// @param[in] memory which was provided to 'create'
+    /// @return the ring or nullptr if the memory does not contain a ring
+    static const BroadcastRing* fromMemory(const void* const memory) noexcept;
+
+    /// @brief copies a message into the next slot and overwrites the oldest message if the ring is full
+    /// @param[in] message to copy
+    /// @param[in] size of the message in bytes
+    /// @return BroadcastRingError::MESSAGE_TOO_LARGE if the size exceeds MAX_MESSAGE_SIZE
+    expected<void, BroadcastRingError> write(const void* const message, const uint64_t size) noexcept;
+
+    /// @brief copies the message with the given index into the buffer
+    /// @param[in,out] readIndex index of the message to read; it is advanced behind the read message and, when the
+    /// message was already overwritten, to the oldest message which is still available
+    /// @param[in] buffer to copy the message to
+    /// @param[in] bufferSize size of the buffer in bytes
+    /// @param[out] hasLostMessages is set to true if messages were overwritten before they could be read
+    /// @return the size of the message, BroadcastRingError::NO_MESSAGE_AVAILABLE if no newer message was written or
+    /// the writer overtook the reader too often in a row, or BroadcastRingError::BUFFER_TOO_SMALL; in the latter case
+    /// the read index is not advanced behind the message
+    expected<uint64_t, BroadcastRingError> read(uint64_t& readIndex,
+                                                void* const buffer,
+                                                const uint64_t bufferSize,
+                                                bool& hasLostMessages) const noexcept;
+
+    /// @brief checks if a message with the given or a later index was written
+    bool hasMessage(const uint64_t readIndex) const noexcept;
+
+    /// @brief the number of messages which were written since the ring was created; it is also the index of the
+    /// next message
+    uint64_t writeIndex() const noexcept;
+
+    /// @brief the capacity of the ring in messages
+    uint64_t capacity() const noexcept;
+
+  private:
+    static constexpr uint64_t MESSAGE_WORD_SIZE{sizeof(uint64_t)};
+    static constexpr uint64_t MESSAGE_WORDS{MAX_MESSAGE_SIZE / MESSAGE_WORD_SIZE};
+    /// @brief readers give up after this number of attempts when the writer overtakes them all the time
+    static constexpr uint64_t MAX_READ_ATTEMPTS{16U};
+    static constexpr uint64_t MAGIC{0x696F782D62636173U};
+
+    struct alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) Slot
+    {
+        /// @brief '2 * index + 1' while the message with 'index' is written and '2 * index + 2' afterwards
+        std::atomic<uint64_t> sequenceNumber{0U};
+        std::atomic<uint64_t> size{0U};
+        std::atomic<uint64_t> words[MESSAGE_WORDS]{};
+    };
+
+    explicit BroadcastRing(const uint64_t capacity) noexcept;
+
+    Slot* slots() noexcept;
+    const Slot* slots() const noexcept;
+
+  private:
+    uint64_t m_magic{MAGIC};
+    uint64_t m_capacity{0U};
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic<uint64_t> m_writeIndex{0U};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_BROADCAST_RING_HPP
@@ -20,9 +20,12 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <algorithm>
 #include <iterator>
@@ -35,7 +38,8 @@ namespace popo
 enum class ChunkDistributorError
 {
     QUEUE_CONTAINER_OVERFLOW,
-    QUEUE_NOT_IN_CONTAINER
+    QUEUE_NOT_IN_CONTAINER,
+    LATEST_VALUE_SOURCE_OVERFLOW
 };
 
 /// @brief The ChunkDistributor is the low layer building block to send SharedChunks to a dynamic number of ChunkQueus.
@@ -45,6 +49,8 @@ enum class ChunkDistributorError
 /// allows to provide a newly added queue a number of last chunks to start from. This is needed for functionality
 /// known as latched topic in ROS or field in ara::com. A ChunkDistributor is used to build elements of higher
 /// abstraction layers that also do memory managemet and provide an API towards the real user
+/// Queues in the latest value mode do not get the chunks pushed. Instead, the ChunkDistributor stores the delivered
+/// chunk once in its LatestValueSlot, which is read by all these queues, and only notifies the queues.
 ///
 /// About Concurrency:
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
@@ -69,6 +75,9 @@ class ChunkDistributor
     using ChunkQueueData_t = typename ChunkDistributorDataType::ChunkQueueData_t;
     using ChunkQueuePusher_t = typename ChunkDistributorDataType::ChunkQueuePusher_t;
 
+    /// @brief Upper bound for the wait of a blocked producer until the stored queues are checked again
+    static constexpr units::Duration SPACE_AVAILABLE_RECHECK_INTERVAL{units::Duration::fromMilliseconds(100U)};
+
     explicit ChunkDistributor(not_null<MemberType_t* const> chunkDistrubutorDataPtr) noexcept;
 
     ChunkDistributor(const ChunkDistributor& other) = delete;
@@ -82,9 +91,12 @@ class ChunkDistributor
     /// @param[in] queueToAdd chunk queue to add to the list
     /// @param[in] requestedHistory number of last chunks from history to send if available. If history size is smaller
     /// then the available history size chunks are provided
+    /// @param[in] latestValueMode must be true if the queue was created in the latest value mode; the mode is provided
+    /// explicitly in order to not access a queue without history request when it is added
     /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error
     expected<void, ChunkDistributorError> tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
-                                                      const uint64_t requestedHistory = 0U) noexcept;
+                                                      const uint64_t requestedHistory = 0U,
+                                                      const bool latestValueMode = false) noexcept;
 
     /// @brief Remove a queue from the internal list of chunk queues
     /// @param[in] queueToRemove is the queue to remove from the list
@@ -98,21 +110,46 @@ class ChunkDistributor
     /// @return true if there are stored chunk queues, false if not
     bool hasStoredQueues() const noexcept;
 
+    /// @brief Notifies the stored chunk queues without delivering a chunk, e.g. when the data of a previously
+    /// delivered chunk was updated in place
+    void notifyAllStoredQueues() noexcept;
+
     /// @brief Deliver the provided shared chunk to all the stored chunk queues. The chunk will be added to the chunk
     /// history
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in order to all the stored chunk queues. In contrast to calling
+    /// deliverToAllStoredQueues for each chunk, the lock is acquired only once for the whole batch and each queue is
+    /// notified only once after all chunks are pushed to it. The chunks will be added to the chunk history
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the accumulated number of queues the chunks were delivered to
+    uint64_t deliverToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
     /// @param[in] chunk is the SharedChunk to be delivered
     /// @return ChunkDistributorError if the queue was not found
+    /// @note The lookup and the delivery happen with a single lock acquisition. If the queue is full and blocks the
+    /// producer, the lock is released and the producer registers at the queue in order to be woken up when the
+    /// consumer frees a slot
     expected<void, ChunkDistributorError>
     deliverToQueue(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunk to exactly one of the stored chunk queues which is selected with the
+    /// load balancing policy. The chunk will NOT be added to the chunk history
+    /// @param[in] policy is used to select the queue to which this chunk shall be delivered
+    /// @param[in] key selects the queue for ROUND_ROBIN and STICKY_BY_KEY; for LEAST_OUTSTANDING_REQUESTS it selects
+    /// the queue which is preferred when multiple queues have the same fill level
+    /// @param[in] chunk is the SharedChunk to be delivered
+    /// @return the number of queues the chunk was delivered to, i.e. 0 if there are no stored queues, otherwise 1
+    uint64_t deliverToOneOfStoredQueues(const LoadBalancingPolicy policy,
+                                        const uint64_t key,
+                                        mepoo::SharedChunk chunk) noexcept;
+
     /// @brief Lookup for the index of a queue with a specific iox::UniqueId
     /// @param[in] uniqueQueueId is the unique ID of the queue to query the index
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId; if the queue is not
@@ -145,6 +182,65 @@ class ChunkDistributor
 
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Pushes the chunks beginning at startIndex to the queue and notifies the queue once if at least one chunk
+    /// was pushed. A failed push to a non-blocking queue is treated as lost chunk.
+    /// @note The caller must have acquired a reference for the queue for each chunk with
+    /// SharedChunk::acquireReferences. The references of the chunks rejected by a non-blocking queue are released,
+    /// the chunks which could not be pushed to a blocking queue keep their reference for the retry.
+    /// @return the index of the first chunk which could not be pushed to a blocking queue or the number of chunks
+    uint64_t pushChunksToQueue(not_null<ChunkQueueData_t* const> queue,
+                               const span<const mepoo::SharedChunk> chunks,
+                               const uint64_t startIndex,
+                               const bool isBlockingQueue) noexcept;
+
+    /// @brief Selects the index of the stored queue a load balanced chunk is delivered to; must be called with the lock
+    /// held and at least one stored queue
+    uint32_t selectQueueIndex(const LoadBalancingPolicy policy, const uint64_t key) noexcept;
+
+    /// @brief Registers the space available condition variable at a queue which blocks the delivery; must be called
+    /// with the lock held and a push to the queue must be retried afterwards
+    /// @return true if registered, false if the queue cannot register further blocked producers
+    bool registerAsBlockedProducer(not_null<ChunkQueueData_t* const> queue) noexcept;
+
+    /// @brief Unregisters the space available condition variable from the stored queues in registeredQueues
+    void unregisterAsBlockedProducer(const span<const RelativePointer<ChunkQueueData_t>> registeredQueues) noexcept;
+
+    /// @brief Waits until a consumer of a queue the space available condition variable is registered at frees a slot.
+    /// If the registration failed at any queue the wait falls back to the adaptive wait. The wait is limited by
+    /// SPACE_AVAILABLE_RECHECK_INTERVAL as a safeguard since the producer might be the only one which checks.
+    void waitForSpaceAvailable(iox::detail::adaptive_wait& adaptiveWait, const bool isRegisteredAtAllQueues) noexcept;
+
+    /// @brief Looks up the index of the queue with uniqueQueueId at lastKnownQueueIndex, then at the index stored in
+    /// the queue index cache and finally by iteration over all stored queues; must be called with the lock held
+    /// @return the index of the queue with uniqueQueueId or nullopt if the queue was not found
+    optional<uint32_t> findQueueIndex(const UniqueId uniqueQueueId, const uint32_t lastKnownQueueIndex) const noexcept;
+
+    /// @brief Claims a source of a queue in the latest value mode for the LatestValueSlot; must be called with the lock
+    /// held
+    /// @param[in] queue to attach
+    /// @param[in] provideLatestValue if true, the currently stored chunk is published to the queue
+    /// @return true if a source was claimed, false if all sources of the queue are claimed by other producers
+    bool attachLatestValueSlot(not_null<ChunkQueueData_t* const> queue, const bool provideLatestValue) noexcept;
+
+    /// @brief Releases the source of a queue in the latest value mode which this producer claimed and releases the
+    /// stored chunk when no such queue is left; must be called with the lock held
+    void detachLatestValueSlot(not_null<ChunkQueueData_t* const> queue) noexcept;
+
+    /// @brief Looks up the source of a queue in the latest value mode which this producer claimed
+    /// @return the source or nullptr if this producer did not claim one
+    LatestValueSource* findLatestValueSource(not_null<ChunkQueueData_t* const> queue) noexcept;
+
+    /// @brief Marks the LatestValueSlot as the last publication to the queue
+    void publishLatestValue(not_null<ChunkQueueData_t* const> queue, LatestValueSource& source) noexcept;
+
+    /// @brief Stores the chunk in the LatestValueSlot if there are queues in the latest value mode; must be called
+    /// with the lock held
+    void storeLatestValue(const mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief Publishes the new chunk in the LatestValueSlot to a queue in the latest value mode and notifies it; must
+    /// be called with the lock held
+    void notifyLatestValueQueue(not_null<ChunkQueueData_t* const> queue) noexcept;
+
   private:
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
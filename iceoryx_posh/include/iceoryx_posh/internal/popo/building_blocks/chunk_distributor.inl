@@ -49,7 +49,8 @@ ChunkDistributor<ChunkDistributorDataType>::getMembers() noexcept
 template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
-                                                        const uint64_t requestedHistory) noexcept
+                                                        const uint64_t requestedHistory,
+                                                        const bool latestValueMode) noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
@@ -76,6 +77,26 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
                             << requestedHistory << ". Capacity is " << getMembers()->m_historyCapacity << ".");
             }
 
+            if (latestValueMode)
+            {
+                // the slot is only updated while queues in the latest value mode are stored, therefore the history
+                // provides the latest chunk for the first one
+                if ((getMembers()->m_numberOfLatestValueQueues == 0U) && !getMembers()->m_history.empty())
+                {
+                    getMembers()->m_latestValue.store(getMembers()->m_history.back().cloneToSharedChunk());
+                }
+                ++getMembers()->m_numberOfLatestValueQueues;
+                if (!attachLatestValueSlot(queueToAdd, requestedHistory > 0U))
+                {
+                    detachLatestValueSlot(queueToAdd);
+                    getMembers()->m_queues.pop_back();
+                    IOX_REPORT(PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_LATEST_VALUE_SOURCES,
+                               iox::er::RUNTIME_ERROR);
+                    return err(ChunkDistributorError::LATEST_VALUE_SOURCE_OVERFLOW);
+                }
+                return ok();
+            }
+
             // if the current history is large enough we send the requested number of chunks, else we send the
             // total history
             const auto startIndex =
@@ -111,6 +132,18 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
                                 static_cast<ChunkQueueData_t* const>(queueToRemove));
     if (iter != getMembers()->m_queues.end())
     {
+        // a producer which is blocked by the queue must not wait for it any longer
+        auto& spaceAvailable = getMembers()->m_spaceAvailableConditionVariableData;
+        if (ChunkQueuePusher_t(iter->get()).unregisterBlockedProducer(spaceAvailable))
+        {
+            ConditionNotifier(spaceAvailable, ChunkQueueData_t::SPACE_AVAILABLE_NOTIFICATION_INDEX).notify();
+        }
+
+        if ((*iter)->m_latestValueMode)
+        {
+            detachLatestValueSlot(iter->get());
+        }
+
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
 
@@ -127,6 +160,21 @@ inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexce
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    auto& spaceAvailable = getMembers()->m_spaceAvailableConditionVariableData;
+    bool wasBlockedByRemovedQueue{false};
+    for (auto& queue : getMembers()->m_queues)
+    {
+        wasBlockedByRemovedQueue |= ChunkQueuePusher_t(queue.get()).unregisterBlockedProducer(spaceAvailable);
+        if (queue->m_latestValueMode)
+        {
+            detachLatestValueSlot(queue.get());
+        }
+    }
+    if (wasBlockedByRemovedQueue)
+    {
+        ConditionNotifier(spaceAvailable, ChunkQueueData_t::SPACE_AVAILABLE_NOTIFICATION_INDEX).notify();
+    }
+
     getMembers()->m_queues.clear();
 }
 
@@ -138,94 +186,288 @@ inline bool ChunkDistributor<ChunkDistributorDataType>::hasStoredQueues() const
     return !getMembers()->m_queues.empty();
 }
 
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::notifyAllStoredQueues() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+
+    for (auto& queue : getMembers()->m_queues)
+    {
+        ChunkQueuePusher_t(queue.get()).notify();
+    }
+}
+
 template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
     using QueueContainer = decltype(getMembers()->m_queues);
     QueueContainer fullQueuesAwaitingDelivery;
+    bool isRegisteredAtAllFullQueues{true};
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
 
         bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+        // the queues in the latest value mode share the single reference of the slot
+        storeLatestValue(chunk);
+
+        // the references for all other queues are acquired upfront with a single update of the shared reference
+        // counter instead of one update per queue; acquiring them after the pushes would allow a fast consumer to
+        // release its reference before it was counted. The references of the queues which rejected the chunk are
+        // returned at once.
+        chunk.acquireReferences(getMembers()->m_queues.size() - getMembers()->m_numberOfLatestValueQueues);
+        const auto referencedChunk = mepoo::ShmSafeUnmanagedChunk::fromAcquiredReference(chunk);
+        uint64_t numberOfUnusedReferences{0U};
+
         // send to all the queues
         for (auto& queue : getMembers()->m_queues)
         {
+            if (queue->m_latestValueMode)
+            {
+                notifyLatestValueQueue(queue.get());
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+                continue;
+            }
+
             bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+            ChunkQueuePusher_t pusher(queue.get());
+            const auto pushResult = pusher.tryPushWithoutNotification(referencedChunk);
+            pusher.notify();
+
+            if (pushResult == ChunkQueuePushResult::STORED)
             {
                 ++numberOfQueuesTheChunkWasDeliveredTo;
             }
             else
             {
+                if (pushResult == ChunkQueuePushResult::REJECTED)
+                {
+                    ++numberOfUnusedReferences;
+                }
+
                 if (isBlockingQueue)
                 {
+                    isRegisteredAtAllFullQueues &= registerAsBlockedProducer(queue.get());
                     fullQueuesAwaitingDelivery.emplace_back(queue);
                 }
                 else
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
+                    pusher.lostAChunk();
                 }
             }
         }
+
+        chunk.releaseReferences(numberOfUnusedReferences);
     }
 
-    // busy waiting until every queue is served
+    // waiting until every queue is served; the queues are registered before the retry in order to not miss a slot
+    // which is freed in between
+    QueueContainer registeredQueues{fullQueuesAwaitingDelivery};
+    bool isFirstRetry{true};
     iox::detail::adaptive_wait adaptiveWait;
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
+        if (!isFirstRetry)
+        {
+            waitForSpaceAvailable(adaptiveWait, isRegisteredAtAllFullQueues);
+        }
+        isFirstRetry = false;
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
             typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
             using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](QueueContainerValue& a, QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
-
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
-#if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
-#pragma GCC diagnostic pop
-#endif
-
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
-
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+            auto& queues = getMembers()->m_queues;
+            for (uint64_t i = fullQueuesAwaitingDelivery.size(); i > 0U; --i)
             {
-                if (pushToQueue(queue.get(), chunk))
+                auto& queue = fullQueuesAwaitingDelivery[i - 1U];
+                // it is possible that since the last iteration the subscriber has already unsubscribed and without
+                // this check we would deliver to a dead queue
+                auto isStillStored =
+                    std::find_if(queues.begin(), queues.end(), [&](const QueueContainerValue& storedQueue) {
+                        return storedQueue.get() == queue.get();
+                    }) != queues.end();
+                const bool isDelivered = isStillStored && pushToQueue(queue.get(), chunk);
+                if (isDelivered)
                 {
                     ++numberOfQueuesTheChunkWasDeliveredTo;
                 }
-                else
+
+                if (!isStillStored || isDelivered)
                 {
-                    fullQueuesAwaitingDelivery.push_back(queue);
+                    fullQueuesAwaitingDelivery.erase(fullQueuesAwaitingDelivery.begin() + (i - 1U));
                 }
             }
         }
     }
 
+    unregisterAsBlockedProducer(
+        span<const RelativePointer<ChunkQueueData_t>>(registeredQueues.data(), registeredQueues.size()));
+
     addToHistoryWithoutDelivery(chunk);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const span<const mepoo::SharedChunk> chunks) noexcept
+{
+    if (chunks.empty())
+    {
+        return 0U;
+    }
+
+    using QueueContainer = decltype(getMembers()->m_queues);
+    using QueueContainerValue = typename QueueContainer::value_type;
+    struct PendingDelivery
+    {
+        QueueContainerValue queue;
+        uint64_t nextChunkIndex;
+    };
+
+    uint64_t numberOfDeliveries{0U};
+    vector<PendingDelivery, QueueContainer::capacity()> pendingDeliveries;
+    QueueContainer registeredQueues;
+    bool isRegisteredAtAllFullQueues{true};
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+
+        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        // only the last chunk of the batch is relevant for the queues in the latest value mode
+        storeLatestValue(chunks[chunks.size() - 1U]);
+
+        // the references for all other queues are acquired upfront with a single update of the shared reference
+        // counter per chunk; pushChunksToQueue returns the references of rejected chunks and the chunks which are
+        // still pending for a blocking queue keep their reference until the retry
+        const auto numberOfReferencesPerChunk =
+            getMembers()->m_queues.size() - getMembers()->m_numberOfLatestValueQueues;
+        for (const auto& chunk : chunks)
+        {
+            chunk.acquireReferences(numberOfReferencesPerChunk);
+        }
+
+        for (auto& queue : getMembers()->m_queues)
+        {
+            if (queue->m_latestValueMode)
+            {
+                notifyLatestValueQueue(queue.get());
+                numberOfDeliveries += chunks.size();
+                continue;
+            }
+
+            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            auto nextChunkIndex = pushChunksToQueue(queue.get(), chunks, 0U, isBlockingQueue);
+            numberOfDeliveries += nextChunkIndex;
+            if (nextChunkIndex < chunks.size())
+            {
+                isRegisteredAtAllFullQueues &= registerAsBlockedProducer(queue.get());
+                registeredQueues.push_back(queue);
+                pendingDeliveries.push_back({queue, nextChunkIndex});
+            }
+        }
+    }
+
+    // waiting until every blocking queue got all the chunks; the queues are registered before the retry in order to
+    // not miss a slot which is freed in between
+    bool isFirstRetry{true};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (!pendingDeliveries.empty())
+    {
+        if (!isFirstRetry)
+        {
+            waitForSpaceAvailable(adaptiveWait, isRegisteredAtAllFullQueues);
+        }
+        isFirstRetry = false;
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
+            auto& queues = getMembers()->m_queues;
+            for (uint64_t i = pendingDeliveries.size(); i > 0U; --i)
+            {
+                auto& pending = pendingDeliveries[i - 1U];
+                // it is possible that since the last iteration the subscriber has already unsubscribed and without
+                // this check we would deliver to a dead queue
+                auto isStillStored = std::find_if(queues.begin(), queues.end(), [&](const QueueContainerValue& queue) {
+                                         return queue.get() == pending.queue.get();
+                                     }) != queues.end();
+                if (isStillStored)
+                {
+                    auto nextChunkIndex = pushChunksToQueue(pending.queue.get(), chunks, pending.nextChunkIndex, true);
+                    numberOfDeliveries += nextChunkIndex - pending.nextChunkIndex;
+                    pending.nextChunkIndex = nextChunkIndex;
+                }
+                else
+                {
+                    // the references reserved for the removed queue are returned
+                    for (auto chunkIndex = pending.nextChunkIndex; chunkIndex < chunks.size(); ++chunkIndex)
+                    {
+                        chunks[chunkIndex].releaseReferences(1U);
+                    }
+                }
+
+                if (!isStillStored || pending.nextChunkIndex == chunks.size())
+                {
+                    pendingDeliveries.erase(pendingDeliveries.begin() + (i - 1U));
+                }
+            }
+        }
+    }
+
+    unregisterAsBlockedProducer(
+        span<const RelativePointer<ChunkQueueData_t>>(registeredQueues.data(), registeredQueues.size()));
+
+    {
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (const auto& chunk : chunks)
+        {
+            addToHistoryWithoutDelivery(chunk);
+        }
+    }
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::pushChunksToQueue(
+    not_null<ChunkQueueData_t* const> queue,
+    const span<const mepoo::SharedChunk> chunks,
+    const uint64_t startIndex,
+    const bool isBlockingQueue) noexcept
+{
+    ChunkQueuePusher_t pusher(queue);
+    auto chunkIndex = startIndex;
+    for (; chunkIndex < chunks.size(); ++chunkIndex)
+    {
+        const auto& chunk = chunks[chunkIndex];
+        const auto pushResult =
+            pusher.tryPushWithoutNotification(mepoo::ShmSafeUnmanagedChunk::fromAcquiredReference(chunk));
+        if (pushResult == ChunkQueuePushResult::STORED)
+        {
+            continue;
+        }
+
+        if (pushResult == ChunkQueuePushResult::REJECTED)
+        {
+            if (isBlockingQueue)
+            {
+                // the reference is kept for the retry
+                break;
+            }
+            chunk.releaseReferences(1U);
+        }
+        pusher.lostAChunk();
+    }
+
+    if (chunkIndex > startIndex)
+    {
+        pusher.notify();
+    }
+
+    return chunkIndex;
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -239,39 +481,170 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
-    bool retry{false};
-    do
+    using QueueContainer = decltype(getMembers()->m_queues);
+    QueueContainer registeredQueues;
+    bool isRegisteredAtFullQueue{true};
+    bool isQueueInContainer{true};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (true)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        {
+            typename MemberType_t::LockGuard_t lock(*getMembers());
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+            auto queueIndex = findQueueIndex(uniqueQueueId, lastKnownQueueIndex);
 
-        if (!queueIndex.has_value())
-        {
-            return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+            if (!queueIndex.has_value())
+            {
+                isQueueInContainer = false;
+                break;
+            }
+
+            const auto cacheSlot =
+                static_cast<uint64_t>(uniqueQueueId) % MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES;
+            getMembers()->m_queueIndexCache[cacheSlot] = queueIndex.value();
+
+            auto& queue = getMembers()->m_queues[queueIndex.value()];
+
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            if (pushToQueue(queue.get(), chunk))
+            {
+                break;
+            }
+
+            if (!isBlockingQueue)
+            {
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
+                break;
+            }
+
+            // the queue is registered before the retry in order to not miss a slot which is freed in between
+            if (registeredQueues.empty())
+            {
+                isRegisteredAtFullQueue = registerAsBlockedProducer(queue.get());
+                registeredQueues.push_back(queue);
+                continue;
+            }
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
+        // wait for the consumer without holding the lock in order to not block other producers and the removal of
+        // the queue
+        waitForSpaceAvailable(adaptiveWait, isRegisteredAtFullQueue);
+    }
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    unregisterAsBlockedProducer(
+        span<const RelativePointer<ChunkQueueData_t>>(registeredQueues.data(), registeredQueues.size()));
 
-        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+    if (!isQueueInContainer)
+    {
+        return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
+    }
+    return ok();
+}
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToOneOfStoredQueues(
+    const LoadBalancingPolicy policy, const uint64_t key, mepoo::SharedChunk chunk) noexcept
+{
+    using QueueContainer = decltype(getMembers()->m_queues);
+    using QueueContainerValue = typename QueueContainer::value_type;
+    QueueContainer registeredQueues;
+    bool isRegisteredAtAllFullQueues{true};
+    uint64_t numberOfDeliveries{0U};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (true)
+    {
         {
-            if (isBlockingQueue)
+            typename MemberType_t::LockGuard_t lock(*getMembers());
+
+            if (getMembers()->m_queues.empty())
             {
-                retry = true;
+                break;
             }
-            else
+
+            // the queue is selected again on a retry since a blocking queue might not be the least filled one anymore
+            auto& queue = getMembers()->m_queues[selectQueueIndex(policy, key)];
+
+            bool willWaitForConsumer =
+                getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+            bool isBlockingQueue =
+                (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+
+            if (pushToQueue(queue.get(), chunk))
+            {
+                numberOfDeliveries = 1U;
+                break;
+            }
+
+            if (!isBlockingQueue)
             {
                 ChunkQueuePusher_t(queue.get()).lostAChunk();
+                numberOfDeliveries = 1U;
+                break;
+            }
+
+            // every selected queue is registered before the retry in order to not miss a slot which is freed in
+            // between
+            auto isRegistered = std::find_if(registeredQueues.begin(),
+                                             registeredQueues.end(),
+                                             [&](const QueueContainerValue& registeredQueue) {
+                                                 return registeredQueue.get() == queue.get();
+                                             })
+                                != registeredQueues.end();
+            if (!isRegistered)
+            {
+                if (registeredQueues.push_back(queue))
+                {
+                    isRegisteredAtAllFullQueues &= registerAsBlockedProducer(queue.get());
+                    continue;
+                }
+                // without a registration the consumer does not wake up the producer, therefore it has to poll
+                isRegisteredAtAllFullQueues = false;
             }
         }
-    } while (retry);
 
-    return ok();
+        waitForSpaceAvailable(adaptiveWait, isRegisteredAtAllFullQueues);
+    }
+
+    unregisterAsBlockedProducer(
+        span<const RelativePointer<ChunkQueueData_t>>(registeredQueues.data(), registeredQueues.size()));
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint32_t ChunkDistributor<ChunkDistributorDataType>::selectQueueIndex(const LoadBalancingPolicy policy,
+                                                                              const uint64_t key) noexcept
+{
+    auto& queues = getMembers()->m_queues;
+    const auto numberOfQueues = static_cast<uint64_t>(queues.size());
+    const auto preferredIndex = static_cast<uint32_t>(key % numberOfQueues);
+
+    if (policy != LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS)
+    {
+        return preferredIndex;
+    }
+
+    // the search starts at the preferred queue in order to distribute the chunks evenly over idle queues
+    uint32_t selectedIndex{preferredIndex};
+    uint64_t smallestFillLevel{queues[preferredIndex]->m_queue.size()};
+    for (uint64_t offset = 1U; offset < numberOfQueues && smallestFillLevel > 0U; ++offset)
+    {
+        const auto index = static_cast<uint32_t>((preferredIndex + offset) % numberOfQueues);
+        const auto fillLevel = queues[index]->m_queue.size();
+        if (fillLevel < smallestFillLevel)
+        {
+            smallestFillLevel = fillLevel;
+            selectedIndex = index;
+        }
+    }
+
+    return selectedIndex;
 }
 
 template <typename ChunkDistributorDataType>
@@ -281,6 +654,63 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
+    return findQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::registerAsBlockedProducer(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    return ChunkQueuePusher_t(queue).registerBlockedProducer(getMembers()->m_spaceAvailableConditionVariableData);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::unregisterAsBlockedProducer(
+    const span<const RelativePointer<ChunkQueueData_t>> registeredQueues) noexcept
+{
+    if (registeredQueues.empty())
+    {
+        return;
+    }
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    // a queue which was removed in the meantime is already unregistered and might not exist anymore
+    for (const auto& queue : getMembers()->m_queues)
+    {
+        const auto isRegistered = std::find_if(registeredQueues.begin(),
+                                               registeredQueues.end(),
+                                               [&](const RelativePointer<ChunkQueueData_t>& registeredQueue) {
+                                                   return registeredQueue.get() == queue.get();
+                                               })
+                                  != registeredQueues.end();
+        if (isRegistered)
+        {
+            IOX_DISCARD_RESULT(ChunkQueuePusher_t(queue.get())
+                                   .unregisterBlockedProducer(getMembers()->m_spaceAvailableConditionVariableData));
+        }
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::waitForSpaceAvailable(iox::detail::adaptive_wait& adaptiveWait,
+                                                                  const bool isRegisteredAtAllQueues) noexcept
+{
+    if (!isRegisteredAtAllQueues)
+    {
+        adaptiveWait.wait();
+        return;
+    }
+
+    ConditionListener spaceAvailable(getMembers()->m_spaceAvailableConditionVariableData);
+    IOX_DISCARD_RESULT(spaceAvailable.timedWait(SPACE_AVAILABLE_RECHECK_INTERVAL));
+}
+
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) const noexcept
+{
     auto& queues = getMembers()->m_queues;
 
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
@@ -288,6 +718,14 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
         return lastKnownQueueIndex;
     }
 
+    const auto cacheSlot =
+        static_cast<uint64_t>(uniqueQueueId) % MemberType_t::ChunkDistributorDataProperties_t::MAX_QUEUES;
+    const auto cachedQueueIndex = getMembers()->m_queueIndexCache[cacheSlot];
+    if (queues.size() > cachedQueueIndex && queues[cachedQueueIndex]->m_uniqueId == uniqueQueueId)
+    {
+        return cachedQueueIndex;
+    }
+
     uint32_t index{0};
     for (auto& queue : queues)
     {
@@ -300,6 +738,94 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
     return nullopt;
 }
 
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::attachLatestValueSlot(not_null<ChunkQueueData_t* const> queue,
+                                                                              const bool provideLatestValue) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    const auto slot = LatestValueSlot::toRelativePointerData(&getMembers()->m_latestValue);
+    for (auto& source : queueData->m_latestValueSources)
+    {
+        // other producers claim sources of the same queue concurrently
+        auto freeSlot = RelativePointerData();
+        if (source.m_slot.compare_exchange_strong(freeSlot, slot, std::memory_order_acq_rel))
+        {
+            if (provideLatestValue && !getMembers()->m_latestValue.isEmpty())
+            {
+                publishLatestValue(queue, source);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::detachLatestValueSlot(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    auto source = findLatestValueSource(queue);
+    if (source != nullptr)
+    {
+        // the publication number is reset first since a consumer only reads the slot of a published source
+        source->m_publicationNumber.store(0U, std::memory_order_relaxed);
+        source->m_slot.store(RelativePointerData(), std::memory_order_release);
+    }
+
+    --getMembers()->m_numberOfLatestValueQueues;
+    if (getMembers()->m_numberOfLatestValueQueues == 0U)
+    {
+        getMembers()->m_latestValue.reset();
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline LatestValueSource*
+ChunkDistributor<ChunkDistributorDataType>::findLatestValueSource(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    for (auto& source : queueData->m_latestValueSources)
+    {
+        if (LatestValueSlot::fromRelativePointerData(source.m_slot.load(std::memory_order_relaxed))
+            == &getMembers()->m_latestValue)
+        {
+            return &source;
+        }
+    }
+    return nullptr;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::publishLatestValue(not_null<ChunkQueueData_t* const> queue,
+                                                                           LatestValueSource& source) noexcept
+{
+    ChunkQueueData_t* const queueData = queue;
+    const auto publicationNumber =
+        queueData->m_latestValuePublicationCounter.fetch_add(1U, std::memory_order_relaxed) + 1U;
+    source.m_publicationNumber.store(publicationNumber, std::memory_order_release);
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::storeLatestValue(const mepoo::SharedChunk& chunk) noexcept
+{
+    if (getMembers()->m_numberOfLatestValueQueues > 0U)
+    {
+        getMembers()->m_latestValue.store(chunk);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline void
+ChunkDistributor<ChunkDistributorDataType>::notifyLatestValueQueue(not_null<ChunkQueueData_t* const> queue) noexcept
+{
+    auto source = findLatestValueSource(queue);
+    if (source != nullptr)
+    {
+        publishLatestValue(queue, *source);
+    }
+    ChunkQueuePusher_t(queue).notify();
+}
+
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDelivery(mepoo::SharedChunk chunk) noexcept
 {
@@ -353,6 +879,13 @@ inline void ChunkDistributor<ChunkDistributorDataType>::cleanup() noexcept
     if (getMembers()->tryLock())
     {
         clearHistory();
+        getMembers()->m_latestValue.reset();
+        // a terminated producer might still be registered at the queues it was blocked by
+        for (auto& queue : getMembers()->m_queues)
+        {
+            IOX_DISCARD_RESULT(ChunkQueuePusher_t(queue.get())
+                                   .unregisterBlockedProducer(getMembers()->m_spaceAvailableConditionVariableData));
+        }
         getMembers()->unlock();
     }
     else
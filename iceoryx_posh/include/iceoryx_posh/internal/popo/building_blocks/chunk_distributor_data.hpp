@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
@@ -50,6 +51,11 @@ struct ChunkDistributorData : public LockingPolicy
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
+    /// @brief Direct-mapped cache from the unique id of a queue to its last known index in m_queues. An entry is only
+    /// a hint which is verified against the unique id of the queue at the cached index, therefore it does not need to
+    /// be updated when queues are added or removed
+    uint32_t m_queueIndexCache[ChunkDistributorDataProperties_t::MAX_QUEUES]{};
+
     /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
     /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
     /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
@@ -58,6 +64,15 @@ struct ChunkDistributorData : public LockingPolicy
         vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
     HistoryContainer_t m_history;
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+
+    /// @brief Registered at the queues which block the delivery with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER; their
+    /// consumers notify it when a slot is freed
+    ConditionVariableData m_spaceAvailableConditionVariableData;
+
+    /// @brief Holds the latest delivered chunk for the queues in the latest value mode; it is only updated while such
+    /// queues are stored, their number is guarded by the lock
+    LatestValueSlot m_latestValue;
+    uint64_t m_numberOfLatestValueQueues{0U};
 };
 
 } // namespace popo
@@ -20,17 +20,44 @@
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/detail/unique_id.hpp"
+#include "iox/memory.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/vector.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
 {
 namespace popo
 {
+/// @brief Counters of a chunk queue which are updated by the producers with relaxed atomics and aggregated by the port
+/// introspection of RouDi
+struct ChunkQueueStatistics
+{
+    /// @brief number of chunks which were dropped or rejected since the queue was full
+    std::atomic<uint64_t> m_lostChunks{0U};
+    /// @brief highest number of chunks which were stored in the queue at the same time
+    std::atomic<uint64_t> m_maxQueueDepth{0U};
+    /// @brief the maximum queue depth requires to read both queue positions on each push, therefore it is only
+    /// tracked when the port introspection publishes it, i.e. with IntrospectionLevel::FULL; set by RouDi
+    std::atomic_bool m_isMaxQueueDepthTracked{false};
+};
+
+/// @brief The LatestValueSlot of one producer which a chunk queue in the latest value mode reads
+struct LatestValueSource
+{
+    /// @brief the slot of the producer; claimed by the producer when it adds the queue and reset when it removes it
+    std::atomic<RelativePointerData> m_slot{RelativePointerData()};
+    /// @brief the number of the last publication of the producer to the queue; zero if the producer did not provide a
+    /// value to the queue yet
+    std::atomic<uint64_t> m_publicationNumber{0U};
+};
+
 template <typename ChunkQueueDataProperties, typename LockingPolicy>
 struct ChunkQueueData : public LockingPolicy
 {
@@ -38,17 +65,43 @@ struct ChunkQueueData : public LockingPolicy
     using LockGuard_t = std::lock_guard<const ThisType_t>;
     using ChunkQueueDataProperties_t = ChunkQueueDataProperties;
 
-    ChunkQueueData(const QueueFullPolicy policy, const VariantQueueTypes queueType) noexcept;
+    ChunkQueueData(const QueueFullPolicy policy,
+                   const VariantQueueTypes queueType,
+                   const bool latestValueMode = false) noexcept;
 
     UniqueId m_uniqueId{};
 
     static constexpr uint64_t MAX_CAPACITY = ChunkQueueDataProperties_t::MAX_QUEUE_CAPACITY;
     VariantQueue<mepoo::ShmSafeUnmanagedChunk, MAX_CAPACITY> m_queue;
-    std::atomic_bool m_queueHasLostChunks{false};
+    // placed on its own cache line in order to not share it with the positions of the queue
+    alignas(HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE) std::atomic_bool m_queueHasLostChunks{false};
+    // shares the cache line with m_queueHasLostChunks; the producers set the flag and update the statistics while the
+    // consumer only resets the flag when it queries the lost chunks, which is rare compared to the pushes
+    ChunkQueueStatistics m_statistics;
 
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief Space available condition variables of the producers which are blocked by this queue; they are notified
+    /// by the consumer whenever it frees a slot. Guarded by the lock, except m_numberOfBlockedProducers which allows
+    /// the consumer to skip the lock when no producer is blocked
+    static constexpr uint64_t MAX_BLOCKED_PRODUCERS{8U};
+    static constexpr uint64_t SPACE_AVAILABLE_NOTIFICATION_INDEX{0U};
+    vector<RelativePointer<ConditionVariableData>, MAX_BLOCKED_PRODUCERS> m_blockedProducers;
+    std::atomic<uint64_t> m_numberOfBlockedProducers{0U};
+
+    /// @brief In the latest value mode the queue is not used. Every producer which stores the queue claims one source
+    /// for its LatestValueSlot and numbers its publications with the publication counter of the queue. The consumer
+    /// reads the source with the highest publication number, i.e. the value which was published last. The read
+    /// members are only written by the consumer and identify the last value it read.
+    static constexpr uint64_t MAX_LATEST_VALUE_SOURCES{8U};
+    const bool m_latestValueMode;
+    LatestValueSource m_latestValueSources[MAX_LATEST_VALUE_SOURCES];
+    std::atomic<uint64_t> m_latestValuePublicationCounter{0U};
+    std::atomic<uint64_t> m_latestValueReadPublicationNumber{0U};
+    std::atomic<RelativePointerData> m_latestValueReadSlot{RelativePointerData()};
+    std::atomic<uint64_t> m_latestValueReadSequenceNumber{0U};
 };
 
 } // namespace popo
@@ -23,9 +23,11 @@ namespace popo
 {
 template <typename ChunkQueueProperties, typename LockingPolicy>
 inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(const QueueFullPolicy policy,
-                                                                           const VariantQueueTypes queueType) noexcept
+                                                                           const VariantQueueTypes queueType,
+                                                                           const bool latestValueMode) noexcept
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
+    , m_latestValueMode(latestValueMode)
 {
 }
 
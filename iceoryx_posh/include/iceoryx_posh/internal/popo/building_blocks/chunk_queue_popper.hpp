@@ -22,6 +22,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/uninitialized_array.hpp"
 
 namespace iox
 {
@@ -31,7 +33,8 @@ namespace popo
 /// principle. Together with the ChunkDistributor and the ChunkQueuePusher, the ChunkQueuePopper builds the
 /// infrastructure to exchange memory chunks between different data producers and consumers that could be located in
 /// different processes. A ChunkQueuePopper is used to build elements of higher abstraction layers that also do memory
-/// managemet and provide an API towards the real user
+/// managemet and provide an API towards the real user. In the latest value mode, the ChunkQueuePopper does not use the
+/// queue but provides the chunk of the LatestValueSlot of the producer which published last if it was not popped before
 template <typename ChunkQueueDataType>
 class ChunkQueuePopper
 {
@@ -50,6 +53,14 @@ class ChunkQueuePopper
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
+    /// @brief pop multiple chunks from the chunk queue in one pass
+    /// @param[in] maxCount the maximum number of chunks to pop
+    /// @param[in] callback callable with the signature void(mepoo::SharedChunk) which is called for every popped chunk
+    /// in FIFO order
+    /// @return the number of chunks the callback was called with
+    template <typename Callback>
+    uint64_t tryPopMultiple(const uint64_t maxCount, const Callback& callback) noexcept;
+
     /// @brief check if chunks were lost and reset flag
     /// @return true if the underlying queue has lost chunks due to an overflow since the last call of this method
     bool hasLostChunks() noexcept;
@@ -96,6 +107,27 @@ class ChunkQueuePopper
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    bool hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) const noexcept;
+
+    /// @brief notifies the producers which wait for this queue to free a slot
+    void notifyBlockedProducers() noexcept;
+
+    /// @brief looks up the LatestValueSlot of the producer which published last
+    /// @param[out] publicationNumber of the returned slot
+    /// @return the slot or nullptr if no producer published to the queue
+    LatestValueSlot* newestLatestValueSlot(uint64_t& publicationNumber) const noexcept;
+
+    /// @brief the LatestValueSlot the value which was popped last was read from
+    /// @return the slot or nullptr if no value was popped yet
+    LatestValueSlot* readLatestValueSlot() const noexcept;
+
+    /// @brief acquires the chunk of the newest LatestValueSlot if it was not popped before
+    optional<mepoo::SharedChunk> tryPopLatestValue() noexcept;
+
+    /// @brief checks if the newest LatestValueSlot holds a chunk which was not popped before
+    bool hasUnreadLatestValue() const noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr;
 };
@@ -48,22 +48,22 @@ ChunkQueuePopper<ChunkQueueDataType>::getMembers() noexcept
 template <typename ChunkQueueDataType>
 inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop() noexcept
 {
+    if (getMembers()->m_latestValueMode)
+    {
+        return tryPopLatestValue();
+    }
+
     auto retVal = getMembers()->m_queue.pop();
 
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyBlockedProducers();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
-        auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
-        if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+        if (!hasCompatibleChunkHeaderVersion(chunk))
         {
-            IOX_LOG(ERROR,
-                    "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
-                                                                 << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
-                                                                 << "'! Dropping chunk!");
-            IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
-                       iox::er::RUNTIME_ERROR);
             return nullopt_t();
         }
         return make_optional<mepoo::SharedChunk>(chunk);
@@ -74,6 +74,66 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     }
 }
 
+template <typename ChunkQueueDataType>
+template <typename Callback>
+inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::tryPopMultiple(const uint64_t maxCount,
+                                                                     const Callback& callback) noexcept
+{
+    if (getMembers()->m_latestValueMode)
+    {
+        if (maxCount == 0U)
+        {
+            return 0U;
+        }
+        auto chunk = tryPopLatestValue();
+        if (!chunk.has_value())
+        {
+            return 0U;
+        }
+        callback(chunk.value());
+        return 1U;
+    }
+
+    UninitializedArray<mepoo::ShmSafeUnmanagedChunk, MemberType_t::MAX_CAPACITY> unmanagedChunks;
+    const auto numberOfPoppedChunks = getMembers()->m_queue.pop(span<mepoo::ShmSafeUnmanagedChunk>(
+        unmanagedChunks.begin(), (maxCount < MemberType_t::MAX_CAPACITY) ? maxCount : MemberType_t::MAX_CAPACITY));
+
+    if (numberOfPoppedChunks > 0U)
+    {
+        notifyBlockedProducers();
+    }
+
+    uint64_t numberOfChunks{0U};
+    for (uint64_t i = 0U; i < numberOfPoppedChunks; ++i)
+    {
+        auto chunk = unmanagedChunks[i].releaseToSharedChunk();
+        if (hasCompatibleChunkHeaderVersion(chunk))
+        {
+            callback(chunk);
+            ++numberOfChunks;
+        }
+    }
+    return numberOfChunks;
+}
+
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePopper<ChunkQueueDataType>::hasCompatibleChunkHeaderVersion(const mepoo::SharedChunk& chunk) const noexcept
+{
+    auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
+    if (receivedChunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        IOX_LOG(ERROR,
+                "Received chunk with CHUNK_HEADER_VERSION '" << receivedChunkHeaderVersion << "' but expected '"
+                                                             << mepoo::ChunkHeader::CHUNK_HEADER_VERSION
+                                                             << "'! Dropping chunk!");
+        IOX_REPORT(PoshError::POPO__CHUNK_QUEUE_POPPER_CHUNK_WITH_INCOMPATIBLE_CHUNK_HEADER_VERSION,
+                   iox::er::RUNTIME_ERROR);
+        return false;
+    }
+    return true;
+}
+
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 {
@@ -88,12 +148,20 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::hasLostChunks() noexcept
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePopper<ChunkQueueDataType>::empty() const noexcept
 {
+    if (getMembers()->m_latestValueMode)
+    {
+        return !hasUnreadLatestValue();
+    }
     return getMembers()->m_queue.empty();
 }
 
 template <typename ChunkQueueDataType>
 inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::size() noexcept
 {
+    if (getMembers()->m_latestValueMode)
+    {
+        return hasUnreadLatestValue() ? 1U : 0U;
+    }
     return getMembers()->m_queue.size();
 }
 
@@ -118,12 +186,28 @@ inline uint64_t ChunkQueuePopper<ChunkQueueDataType>::getMaximumCapacity() const
 template <typename ChunkQueueDataType>
 inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
 {
+    if (getMembers()->m_latestValueMode)
+    {
+        // the current value is marked as read without acquiring it
+        uint64_t publicationNumber{0U};
+        auto slot = newestLatestValueSlot(publicationNumber);
+        if (slot != nullptr)
+        {
+            getMembers()->m_latestValueReadPublicationNumber.store(publicationNumber, std::memory_order_relaxed);
+            getMembers()->m_latestValueReadSlot.store(LatestValueSlot::toRelativePointerData(slot),
+                                                      std::memory_order_relaxed);
+            getMembers()->m_latestValueReadSequenceNumber.store(slot->sequenceNumber(), std::memory_order_relaxed);
+        }
+        return;
+    }
+
     while (auto maybeUnmanagedChunk = getMembers()->m_queue.pop())
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+    notifyBlockedProducers();
 }
 
 template <typename ChunkQueueDataType>
@@ -151,6 +235,98 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr.operator bool();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyBlockedProducers() noexcept
+{
+    // pairs with the fence in ChunkQueuePusher::registerBlockedProducer; either the consumer sees the registration or
+    // the retried push of the producer sees the freed slot
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfBlockedProducers.load(std::memory_order_relaxed) == 0U)
+    {
+        return;
+    }
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    for (auto& blockedProducer : getMembers()->m_blockedProducers)
+    {
+        ConditionNotifier(*blockedProducer.get(), MemberType_t::SPACE_AVAILABLE_NOTIFICATION_INDEX).notify();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline LatestValueSlot*
+ChunkQueuePopper<ChunkQueueDataType>::newestLatestValueSlot(uint64_t& publicationNumber) const noexcept
+{
+    LatestValueSlot* newestSlot{nullptr};
+    publicationNumber = 0U;
+    for (auto& source : getMembers()->m_latestValueSources)
+    {
+        const auto sourcePublicationNumber = source.m_publicationNumber.load(std::memory_order_acquire);
+        if (sourcePublicationNumber > publicationNumber)
+        {
+            auto slot = LatestValueSlot::fromRelativePointerData(source.m_slot.load(std::memory_order_acquire));
+            if (slot != nullptr)
+            {
+                newestSlot = slot;
+                publicationNumber = sourcePublicationNumber;
+            }
+        }
+    }
+    return newestSlot;
+}
+
+template <typename ChunkQueueDataType>
+inline LatestValueSlot* ChunkQueuePopper<ChunkQueueDataType>::readLatestValueSlot() const noexcept
+{
+    return LatestValueSlot::fromRelativePointerData(
+        getMembers()->m_latestValueReadSlot.load(std::memory_order_relaxed));
+}
+
+template <typename ChunkQueueDataType>
+inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPopLatestValue() noexcept
+{
+    uint64_t publicationNumber{0U};
+    auto slot = newestLatestValueSlot(publicationNumber);
+    // a value which is older than the one read last, e.g. of another producer, is not provided
+    if ((slot == nullptr)
+        || (publicationNumber <= getMembers()->m_latestValueReadPublicationNumber.load(std::memory_order_relaxed)))
+    {
+        return nullopt_t();
+    }
+
+    // the producer may have replaced the chunk it published with a newer one which was already read
+    auto sequenceNumber = (readLatestValueSlot() == slot)
+                              ? getMembers()->m_latestValueReadSequenceNumber.load(std::memory_order_relaxed)
+                              : LatestValueSlot::UNREAD_SEQUENCE_NUMBER;
+    auto chunk = slot->tryAcquireNewerThan(sequenceNumber);
+    getMembers()->m_latestValueReadPublicationNumber.store(publicationNumber, std::memory_order_relaxed);
+    getMembers()->m_latestValueReadSlot.store(LatestValueSlot::toRelativePointerData(slot), std::memory_order_relaxed);
+    getMembers()->m_latestValueReadSequenceNumber.store(sequenceNumber, std::memory_order_relaxed);
+
+    if (!chunk.has_value() || !hasCompatibleChunkHeaderVersion(chunk.value()))
+    {
+        return nullopt_t();
+    }
+    return chunk;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePopper<ChunkQueueDataType>::hasUnreadLatestValue() const noexcept
+{
+    uint64_t publicationNumber{0U};
+    auto slot = newestLatestValueSlot(publicationNumber);
+    if ((slot == nullptr)
+        || (publicationNumber <= getMembers()->m_latestValueReadPublicationNumber.load(std::memory_order_relaxed)))
+    {
+        return false;
+    }
+    // a slot which was emptied or holds the value which was read last is not reported as unread value
+    const bool isReadValue =
+        (readLatestValueSlot() == slot)
+        && (slot->sequenceNumber() == getMembers()->m_latestValueReadSequenceNumber.load(std::memory_order_relaxed));
+    return !isReadValue && !slot->isEmpty();
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -18,15 +18,29 @@
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_QUEUE_PUSHER_HPP
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 
+#include <algorithm>
+
 namespace iox
 {
 namespace popo
 {
+/// @brief The outcome of ChunkQueuePusher::tryPushWithoutNotification
+enum class ChunkQueuePushResult : uint8_t
+{
+    /// @brief the chunk is stored in the queue
+    STORED,
+    /// @brief the chunk is stored in the queue and an older chunk was dropped due to an overflow
+    STORED_WITH_OVERFLOW,
+    /// @brief the queue is full and discards new chunks; the chunk is not stored
+    REJECTED
+};
+
 /// @brief The ChunkQueuePusher is the low layer building block to push SharedChunks in a chunk queue.
 /// Together with the ChunkDistributor and ChunkQueuePopper the ChunkQueuePusher builds the infrastructure
 /// to exchange memory chunks between different data producers and consumers that could be located in different
@@ -50,13 +64,49 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
+    /// @brief push a new chunk to the chunk queue without notifying an attached condition variable; this allows to
+    /// push multiple chunks in a row and wake up the consumer only once with a subsequent call to notify
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief push a chunk for which the caller already acquired a reference on behalf of the queue without notifying
+    /// an attached condition variable; this allows to fan out a chunk to multiple queues with a single update of the
+    /// reference counter. A chunk which is dropped by an overflow of the queue is released.
+    /// @param[in] chunk with a reference acquired by SharedChunk::acquireReferences
+    /// @return the result of the push; with ChunkQueuePushResult::REJECTED the acquired reference was not taken over
+    /// by the queue and must be released by the caller
+    ChunkQueuePushResult tryPushWithoutNotification(mepoo::ShmSafeUnmanagedChunk chunk) noexcept;
+
+    /// @brief notify the condition variable attached to the chunk queue, if any, that new chunks are available
+    void notify() noexcept;
+
+    /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry); this is
+    /// counted in ChunkQueueStatistics::m_lostChunks
     void lostAChunk() noexcept;
 
+    /// @brief registers the space available condition variable of a producer which waits for the consumer to free a
+    /// slot; a push must be retried after the registration in order to not miss a slot which was freed in between
+    /// @param[in] conditionVariableDataRef the condition variable which is notified with
+    /// ChunkQueueData::SPACE_AVAILABLE_NOTIFICATION_INDEX
+    /// @return true if the condition variable is registered, false if the maximum number of blocked producers is
+    /// reached
+    bool registerBlockedProducer(ConditionVariableData& conditionVariableDataRef) noexcept;
+
+    /// @brief unregisters the space available condition variable of a producer
+    /// @param[in] conditionVariableDataRef the condition variable to unregister
+    /// @return true if the condition variable was registered, otherwise false
+    bool unregisterBlockedProducer(ConditionVariableData& conditionVariableDataRef) noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+  private:
+    /// @brief raises ChunkQueueStatistics::m_maxQueueDepth to the current size of the queue if it exceeds the maximum;
+    /// does nothing when the maximum queue depth is not tracked
+    void updateMaxQueueDepth() noexcept;
+
   private:
     MemberType_t* m_chunkQueueDataPtr{nullptr};
 };
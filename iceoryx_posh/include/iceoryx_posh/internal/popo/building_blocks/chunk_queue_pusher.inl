@@ -44,6 +44,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notify();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -55,24 +63,126 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         // tell the ChunkDistributor that we had an overflow and dropped a sample
         hasQueueOverflow = true;
     }
+    updateMaxQueueDepth();
+
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline ChunkQueuePushResult
+ChunkQueuePusher<ChunkQueueDataType>::tryPushWithoutNotification(mepoo::ShmSafeUnmanagedChunk chunk) noexcept
+{
+    auto pushRet = getMembers()->m_queue.push(chunk);
+    if (!pushRet.has_value())
+    {
+        updateMaxQueueDepth();
+        return ChunkQueuePushResult::STORED;
+    }
 
+    // a FiFo returns the pushed chunk itself when it is full while a SoFi returns the oldest chunk it dropped
+    if (pushRet->getChunkHeader() == chunk.getChunkHeader())
+    {
+        return ChunkQueuePushResult::REJECTED;
+    }
+
+    pushRet->releaseToSharedChunk();
+    updateMaxQueueDepth();
+    return ChunkQueuePushResult::STORED_WITH_OVERFLOW;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notify() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
+    {
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
+{
+    getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    getMembers()->m_statistics.m_lostChunks.fetch_add(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::updateMaxQueueDepth() noexcept
+{
+    auto& statistics = getMembers()->m_statistics;
+    if (!statistics.m_isMaxQueueDepthTracked.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    auto& maxQueueDepth = statistics.m_maxQueueDepth;
+    const auto queueDepth = getMembers()->m_queue.size();
+    auto currentMaxQueueDepth = maxQueueDepth.load(std::memory_order_relaxed);
+    // multiple producers might raise the maximum concurrently; the exchange is only attempted when the maximum grows,
+    // which stops soon after the start of the communication
+    while (queueDepth > currentMaxQueueDepth
+           && !maxQueueDepth.compare_exchange_weak(
+               currentMaxQueueDepth, queueDepth, std::memory_order_relaxed, std::memory_order_relaxed))
+    {
+    }
+}
+
+template <typename ChunkQueueDataType>
+inline bool
+ChunkQueuePusher<ChunkQueueDataType>::registerBlockedProducer(ConditionVariableData& conditionVariableDataRef) noexcept
+{
     {
         typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
+        auto& blockedProducers = getMembers()->m_blockedProducers;
+
+        const auto isRegistered =
+            std::find_if(blockedProducers.begin(), blockedProducers.end(), [&](const auto& blockedProducer) {
+                return blockedProducer.get() == &conditionVariableDataRef;
+            }) != blockedProducers.end();
+
+        if (!isRegistered)
         {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
+            if (!blockedProducers.push_back(RelativePointer<ConditionVariableData>(&conditionVariableDataRef)))
+            {
+                return false;
+            }
+            getMembers()->m_numberOfBlockedProducers.store(blockedProducers.size(), std::memory_order_relaxed);
         }
     }
 
-    return !hasQueueOverflow;
+    // pairs with the fence in ChunkQueuePopper::notifyBlockedProducers; either the consumer sees the registration or
+    // the retried push of the producer sees the freed slot
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return true;
 }
 
 template <typename ChunkQueueDataType>
-inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
+inline bool ChunkQueuePusher<ChunkQueueDataType>::unregisterBlockedProducer(
+    ConditionVariableData& conditionVariableDataRef) noexcept
 {
-    getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
+    if (getMembers()->m_numberOfBlockedProducers.load(std::memory_order_relaxed) == 0U)
+    {
+        return false;
+    }
+
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    auto& blockedProducers = getMembers()->m_blockedProducers;
+
+    auto iter = std::find_if(blockedProducers.begin(), blockedProducers.end(), [&](const auto& blockedProducer) {
+        return blockedProducer.get() == &conditionVariableDataRef;
+    });
+    if (iter == blockedProducers.end())
+    {
+        return false;
+    }
+
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
+    blockedProducers.erase(iter);
+    getMembers()->m_numberOfBlockedProducers.store(blockedProducers.size(), std::memory_order_relaxed);
+    return true;
 }
 
 } // namespace popo
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -78,10 +79,33 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get the next received chunk like tryGet but the ownership of the SharedChunk is stored in the
+    /// provided UsedChunkList instead of the one of the ChunkReceiver. This allows multiple threads to concurrently
+    /// take chunks from a multi-consumer capable queue as long as each thread uses its own UsedChunkList
+    /// @param[in] chunksInUse the UsedChunkList which takes the ownership of the received chunk
+    /// @return New chunk header, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    template <uint32_t Capacity>
+    expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet(UsedChunkList<Capacity>& chunksInUse) noexcept;
+
+    /// @brief Tries to get multiple received chunks in one pass. The number of chunks is limited by the size of the
+    /// provided storage and by the number of chunks which can still be held in parallel; in contrast to tryGet, no
+    /// chunk is dropped when this limit is reached
+    /// @param[out] chunkHeaders storage for the ChunkHeaders of the received chunks in FIFO order
+    /// @return the number of received chunks, ChunkReceiveResult on error or if there are no new chunks in the
+    /// underlying queue
+    expected<uint64_t, ChunkReceiveResult> tryGetMultiple(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release a chunk that was obtained with the tryGet overload taking a UsedChunkList
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] chunksInUse the UsedChunkList which holds the ownership of the chunk
+    template <uint32_t Capacity>
+    void release(const mepoo::ChunkHeader* const chunkHeader, UsedChunkList<Capacity>& chunksInUse) noexcept;
+
     /// @brief Release all the chunks that are currently held. Caution: Only call this if the user process is no more
     /// running E.g. This cleans up chunks that were held by a user process that died unexpectetly, for avoiding lost
     /// chunks in the system
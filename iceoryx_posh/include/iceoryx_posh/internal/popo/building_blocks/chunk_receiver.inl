@@ -71,6 +71,14 @@ ChunkReceiver<ChunkReceiverDataType>::getMembers() noexcept
 
 template <typename ChunkReceiverDataType>
 inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<ChunkReceiverDataType>::tryGet() noexcept
+{
+    return tryGet(getMembers()->m_chunksInUse);
+}
+
+template <typename ChunkReceiverDataType>
+template <uint32_t Capacity>
+inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGet(UsedChunkList<Capacity>& chunksInUse) noexcept
 {
     auto popRet = this->tryPop();
 
@@ -79,7 +87,7 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
         auto sharedChunk = *popRet;
 
         // if the application holds too many chunks, don't provide more
-        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        if (chunksInUse.insert(sharedChunk))
         {
             return ok(const_cast<const mepoo::ChunkHeader*>(sharedChunk.getChunkHeader()));
         }
@@ -93,12 +101,50 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetMultiple(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    auto& chunksInUse = getMembers()->m_chunksInUse;
+    const uint64_t numberOfFreeSlots = chunksInUse.capacity() - chunksInUse.size();
+    const uint64_t maxCount = (chunkHeaders.size() < numberOfFreeSlots) ? chunkHeaders.size() : numberOfFreeSlots;
+
+    uint64_t numberOfChunks{0U};
+    if (maxCount > 0U)
+    {
+        this->tryPopMultiple(maxCount, [&](const mepoo::SharedChunk& sharedChunk) {
+            // there is a free slot for every popped chunk, therefore the insertion cannot fail
+            chunksInUse.insert(sharedChunk);
+            chunkHeaders[numberOfChunks] = sharedChunk.getChunkHeader();
+            ++numberOfChunks;
+        });
+    }
+
+    if (numberOfChunks > 0U)
+    {
+        return ok(numberOfChunks);
+    }
+    if (numberOfFreeSlots == 0U && !this->empty())
+    {
+        return err(ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+    }
+    return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    release(chunkHeader, getMembers()->m_chunksInUse);
+}
+
+template <typename ChunkReceiverDataType>
+template <uint32_t Capacity>
+inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader,
+                                                          UsedChunkList<Capacity>& chunksInUse) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
-    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    if (!chunksInUse.remove(chunkHeader, chunk))
     {
         IOX_REPORT(PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER, iox::er::RUNTIME_ERROR);
     }
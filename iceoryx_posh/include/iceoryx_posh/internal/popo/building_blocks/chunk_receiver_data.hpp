@@ -32,7 +32,8 @@ struct ChunkReceiverData : public ChunkQueueDataType
 {
     explicit ChunkReceiverData(const VariantQueueTypes queueType,
                                const QueueFullPolicy queueFullPolicy,
-                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                               const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                               const bool latestValueMode = false) noexcept;
 
     using ChunkQueueData_t = ChunkQueueDataType;
 
@@ -25,8 +25,9 @@ template <uint32_t MaxChunksHeldSimultaneously, typename ChunkQueueDataType>
 inline ChunkReceiverData<MaxChunksHeldSimultaneously, ChunkQueueDataType>::ChunkReceiverData(
     const VariantQueueTypes queueType,
     const QueueFullPolicy queueFullPolicy,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkQueueDataType(queueFullPolicy, queueType)
+    const mepoo::MemoryInfo& memoryInfo,
+    const bool latestValueMode) noexcept
+    : ChunkQueueDataType(queueFullPolicy, queueType, latestValueMode)
     , m_memoryInfo(memoryInfo)
 {
 }
@@ -28,6 +28,8 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -104,27 +106,88 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
                                                                const uint32_t userHeaderSize,
                                                                const uint32_t userHeaderAlignment) noexcept;
 
+    /// @brief allocate a chunk like tryAllocate but the ownership of the SharedChunk is stored in the provided
+    /// UsedChunkList instead of the one of the ChunkSender. This allows multiple threads to concurrently allocate
+    /// chunks as long as each thread uses its own UsedChunkList
+    /// @note The last sent chunk is never reused by this overload since it is shared by all users of the ChunkSender
+    /// @param[in] chunksInUse the UsedChunkList which takes the ownership of the allocated chunk
+    /// @param[in] originId, the unique id of the entity which requested this allocate
+    /// @param[in] userPayloadSize, size of the user-payload without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user-payload
+    /// @param[in] userHeaderSize, size of the user-header
+    /// @param[in] userHeaderAlignment, alignment of the user-header
+    /// @return on success pointer to a ChunkHeader which can be used to access the chunk-header, user-header and
+    /// user-payload fields, error if not
+    template <uint32_t Capacity>
+    expected<mepoo::ChunkHeader*, AllocationError> tryAllocate(UsedChunkList<Capacity>& chunksInUse,
+                                                               const UniquePortId originId,
+                                                               const uint64_t userPayloadSize,
+                                                               const uint32_t userPayloadAlignment,
+                                                               const uint32_t userHeaderSize,
+                                                               const uint32_t userHeaderAlignment) noexcept;
+
     /// @brief Release an allocated chunk without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Release a chunk allocated with the tryAllocate overload taking a UsedChunkList without sending it
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to release
+    /// @param[in] chunksInUse the UsedChunkList which holds the ownership of the chunk
+    template <uint32_t Capacity>
+    void release(const mepoo::ChunkHeader* const chunkHeader, UsedChunkList<Capacity>& chunksInUse) noexcept;
+
     /// @brief Send an allocated chunk to all connected ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in order to all connected ChunkQueuePopper. The chunks are delivered with
+    /// a single lock acquisition of the ChunkDistributor and each receiver is notified only once
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send; the ownership of the pointers is transferred to
+    /// this method
+    /// @return the accumulated number of receivers the chunks were send to
+    uint64_t sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
+    /// @brief Send an allocated chunk to one of the connected ChunkQueuePopper which is selected with the load
+    /// balancing policy
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @param[in] policy is used to select the ChunkQueuePopper
+    /// @param[in] key is passed to the policy, see ChunkDistributor::deliverToOneOfStoredQueues
+    /// @return the number of receiver the chunk was send to, i.e. 0 or 1
+    /// @note This method does not add the chunk to the history
+    uint64_t sendToOneOfStoredQueues(mepoo::ChunkHeader* const chunkHeader,
+                                     const LoadBalancingPolicy policy,
+                                     const uint64_t key) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
     /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
-    /// @return true when successful, false otherwise
+    /// @return true when successful, false otherwise; the chunk is released if the queue is not available
     /// @note This method does not add the chunk to the history
     bool sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                      const UniqueId uniqueQueueId,
                      const uint32_t lastKnownQueueIndex) noexcept;
 
+    /// @brief Send a chunk allocated with the tryAllocate overload taking a UsedChunkList to a specific
+    /// ChunkQueuePopper
+    /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
+    /// method
+    /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
+    /// @param[in] lastKnownQueueIndex is used for a fast lookup of the queue with uniqueQueueId
+    /// @param[in] chunksInUse the UsedChunkList which holds the ownership of the chunk
+    /// @return true when successful, false otherwise
+    /// @note This method neither adds the chunk to the history nor updates the previous chunk nor sets the sequence
+    /// number of the chunk since these are shared by all users of the ChunkSender
+    template <uint32_t Capacity>
+    bool sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                     const UniqueId uniqueQueueId,
+                     const uint32_t lastKnownQueueIndex,
+                     UsedChunkList<Capacity>& chunksInUse) noexcept;
+
     /// @brief Push an allocated chunk to the history without sending it
     /// @param[in] chunkHeader, pointer to the ChunkHeader to push to the history
     void pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -139,12 +202,21 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     void releaseAll() noexcept;
 
   private:
+    /// @brief Get a new chunk from the MemoryManager and store its ownership in the provided UsedChunkList
+    template <uint32_t Capacity>
+    expected<mepoo::ChunkHeader*, AllocationError> allocateNewChunk(UsedChunkList<Capacity>& chunksInUse,
+                                                                    const UniquePortId originId,
+                                                                    const mepoo::ChunkSettings& chunkSettings) noexcept;
+
     /// @brief Get the SharedChunk from the provided ChunkHeader and do all that is required to send the chunk
     /// @param[in] chunkHeader of the chunk that shall be send
     /// @param[in][out] chunk that corresponds to the chunk header
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Adds the chunk to the sent chunks and bytes of the ChunkSenderStatistics
+    void countSentChunk(const mepoo::ChunkHeader& chunkHeader) noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
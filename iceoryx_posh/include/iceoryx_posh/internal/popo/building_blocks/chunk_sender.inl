@@ -133,45 +133,86 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
         }
         else
         {
+            getMembers()->m_statistics.m_allocationFailures.fetch_add(1U, std::memory_order_relaxed);
             return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
     else
     {
-        // BEGIN of critical section, chunk will be lost if the process terminates in this section
-        // get a new chunk
-        auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+        return allocateNewChunk(getMembers()->m_chunksInUse, originId, chunkSettings);
+    }
+}
 
-        if (getChunkResult.has_error())
-        {
-            /// @todo iox-#1012 use error<E2>::from(E1); once available
-            return err(into<AllocationError>(getChunkResult.error()));
-        }
+template <typename ChunkSenderDataType>
+template <uint32_t Capacity>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::tryAllocate(UsedChunkList<Capacity>& chunksInUse,
+                                              const UniquePortId originId,
+                                              const uint64_t userPayloadSize,
+                                              const uint32_t userPayloadAlignment,
+                                              const uint32_t userHeaderSize,
+                                              const uint32_t userHeaderAlignment) noexcept
+{
+    const auto chunkSettingsResult =
+        mepoo::ChunkSettings::create(userPayloadSize, userPayloadAlignment, userHeaderSize, userHeaderAlignment);
+    if (chunkSettingsResult.has_error())
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_USER_PAYLOAD_OR_USER_HEADER);
+    }
 
-        auto& chunk = getChunkResult.value();
+    return allocateNewChunk(chunksInUse, originId, chunkSettingsResult.value());
+}
 
-        // if the application allocated too much chunks, return no more chunks
-        if (getMembers()->m_chunksInUse.insert(chunk))
-        {
-            // END of critical section
-            chunk.getChunkHeader()->setOriginId(originId);
-            return ok(chunk.getChunkHeader());
-        }
-        else
-        {
-            // release the allocated chunk
-            chunk = nullptr;
-            return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
-        }
+template <typename ChunkSenderDataType>
+template <uint32_t Capacity>
+inline expected<mepoo::ChunkHeader*, AllocationError>
+ChunkSender<ChunkSenderDataType>::allocateNewChunk(UsedChunkList<Capacity>& chunksInUse,
+                                                   const UniquePortId originId,
+                                                   const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    // get a new chunk
+    auto getChunkResult = getMembers()->m_memoryMgr->getChunk(chunkSettings);
+
+    if (getChunkResult.has_error())
+    {
+        getMembers()->m_statistics.m_allocationFailures.fetch_add(1U, std::memory_order_relaxed);
+        /// @todo iox-#1012 use error<E2>::from(E1); once available
+        return err(into<AllocationError>(getChunkResult.error()));
+    }
+
+    auto& chunk = getChunkResult.value();
+
+    // if the application allocated too much chunks, return no more chunks
+    if (chunksInUse.insert(chunk))
+    {
+        // END of critical section
+        chunk.getChunkHeader()->setOriginId(originId);
+        return ok(chunk.getChunkHeader());
+    }
+    else
+    {
+        // release the allocated chunk
+        chunk = nullptr;
+        getMembers()->m_statistics.m_allocationFailures.fetch_add(1U, std::memory_order_relaxed);
+        return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
     }
 }
 
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    release(chunkHeader, getMembers()->m_chunksInUse);
+}
+
+template <typename ChunkSenderDataType>
+template <uint32_t Capacity>
+inline void ChunkSender<ChunkSenderDataType>::release(const mepoo::ChunkHeader* const chunkHeader,
+                                                      UsedChunkList<Capacity>& chunksInUse) noexcept
 {
     mepoo::SharedChunk chunk(nullptr);
     // d'tor of SharedChunk will release the memory, we do not have to touch the returned chunk
-    if (!getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
+    if (!chunksInUse.remove(chunkHeader, chunk))
     {
         IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER, iox::er::RUNTIME_ERROR);
     }
@@ -195,6 +236,54 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    uint64_t numberOfDeliveries{0U};
+    // the number of chunks which can be sent at once is limited by the number of chunks which can be held in parallel
+    vector<mepoo::SharedChunk, MemberType_t::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (auto* const chunkHeader : chunkHeaders)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeader, chunk))
+        {
+            chunks.push_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfDeliveries = this->deliverToAllStoredQueues(span<const mepoo::SharedChunk>(chunks.data(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkSenderDataType>
+inline uint64_t ChunkSender<ChunkSenderDataType>::sendToOneOfStoredQueues(mepoo::ChunkHeader* const chunkHeader,
+                                                                          const LoadBalancingPolicy policy,
+                                                                          const uint64_t key) noexcept
+{
+    uint64_t numberOfReceiverTheChunkWasDelivered{0};
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    if (getChunkReadyForSend(chunkHeader, chunk))
+    {
+        numberOfReceiverTheChunkWasDelivered = this->deliverToOneOfStoredQueues(policy, key, chunk);
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunk;
+    }
+    // END of critical section
+
+    return numberOfReceiverTheChunkWasDelivered;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -204,18 +293,42 @@ inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* co
     // BEGIN of critical section, chunk will be lost if the process terminates in this section
     if (getChunkReadyForSend(chunkHeader, chunk))
     {
-        auto deliveryResult = this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk);
+        if (this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk).has_error())
+        {
+            // the chunk is released when it goes out of scope
+            return false;
+        }
 
         getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
         getMembers()->m_lastChunkUnmanaged = chunk;
 
-        return !deliveryResult.has_error();
+        return true;
     }
     // END of critical section
 
     return false;
 }
 
+template <typename ChunkSenderDataType>
+template <uint32_t Capacity>
+inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
+                                                          const UniqueId uniqueQueueId,
+                                                          const uint32_t lastKnownQueueIndex,
+                                                          UsedChunkList<Capacity>& chunksInUse) noexcept
+{
+    mepoo::SharedChunk chunk(nullptr);
+    // BEGIN of critical section, chunk will be lost if the process terminates in this section
+    if (chunksInUse.remove(chunkHeader, chunk))
+    {
+        countSentChunk(*chunk.getChunkHeader());
+        return !this->deliverToQueue(uniqueQueueId, lastKnownQueueIndex, chunk).has_error();
+    }
+    // END of critical section
+
+    IOX_REPORT(PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER, iox::er::RUNTIME_ERROR);
+    return false;
+}
+
 template <typename ChunkSenderDataType>
 inline void ChunkSender<ChunkSenderDataType>::pushToHistory(mepoo::ChunkHeader* const chunkHeader) noexcept
 {
@@ -259,6 +372,7 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     if (getMembers()->m_chunksInUse.remove(chunkHeader, chunk))
     {
         chunk.getChunkHeader()->setSequenceNumber(getMembers()->m_sequenceNumber++);
+        countSentChunk(*chunk.getChunkHeader());
         return true;
     }
     else
@@ -268,6 +382,15 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::countSentChunk(const mepoo::ChunkHeader& chunkHeader) noexcept
+{
+    // the counters are only read by the introspection, therefore no ordering with the delivery is required
+    auto& statistics = getMembers()->m_statistics;
+    statistics.m_sentChunks.fetch_add(1U, std::memory_order_relaxed);
+    statistics.m_sentBytes.fetch_add(chunkHeader.userPayloadSize(), std::memory_order_relaxed);
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -26,10 +26,25 @@
 #include "iox/not_null.hpp"
 #include "iox/relative_pointer.hpp"
 
+#include <atomic>
+
 namespace iox
 {
 namespace popo
 {
+/// @brief Counters of a chunk sender which are updated on the hot path with relaxed atomics and aggregated by the port
+/// introspection of RouDi
+struct ChunkSenderStatistics
+{
+    /// @brief number of chunks which were sent
+    std::atomic<uint64_t> m_sentChunks{0U};
+    /// @brief sum of the user-payload sizes of the sent chunks
+    std::atomic<uint64_t> m_sentBytes{0U};
+    /// @brief number of chunks which could not be allocated due to exhausted mempools or too many chunks held in
+    /// parallel
+    std::atomic<uint64_t> m_allocationFailures{0U};
+};
+
 template <uint32_t MaxChunksAllocatedSimultaneously, typename ChunkDistributorDataType>
 struct ChunkSenderData : public ChunkDistributorDataType
 {
@@ -39,12 +54,14 @@ struct ChunkSenderData : public ChunkDistributorDataType
                              const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
 
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    ChunkSenderStatistics m_statistics;
 };
 
 } // namespace popo
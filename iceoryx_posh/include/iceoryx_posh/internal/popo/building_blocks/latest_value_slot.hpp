@@ -0,0 +1,93 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+#ifndef IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
+#define IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
+
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
+#include "iox/detail/relative_pointer_data.hpp"
+#include "iox/optional.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief A single slot in shared memory which holds the latest chunk of a producer. The producer replaces the chunk
+/// with an atomic exchange and any number of consumers acquire a reference to it without a lock and without a queue
+/// per consumer, i.e. the cost of storing a chunk is independent of the number of consumers.
+/// @details The slot owns one reference of the stored chunk. A consumer acquires its own reference only if the
+/// reference counter is not already zero and validates afterwards that the slot still holds the same chunk, since the
+/// ChunkManagement of a chunk which was replaced and released in between could already be reused for another chunk.
+/// The sequence number is odd while the chunk is replaced and identifies the stored chunk when it is even.
+/// @note there must be only one producer at a time, i.e. store and reset must be synchronized by the caller; like the
+/// chunk history, the stored chunk is not released with the d'tor but has to be released with reset
+class LatestValueSlot
+{
+  public:
+    /// @brief the sequence number of a stored chunk is always even, therefore this one is never reported as read
+    static constexpr uint64_t UNREAD_SEQUENCE_NUMBER{1U};
+
+    LatestValueSlot() noexcept = default;
+    ~LatestValueSlot() noexcept = default;
+
+    LatestValueSlot(const LatestValueSlot&) = delete;
+    LatestValueSlot(LatestValueSlot&&) = delete;
+    LatestValueSlot& operator=(const LatestValueSlot&) = delete;
+    LatestValueSlot& operator=(LatestValueSlot&&) = delete;
+
+    /// @brief replaces the stored chunk and releases the reference of the slot to the previous one
+    /// @param[in] chunk which becomes the latest value; an empty chunk empties the slot
+    void store(const mepoo::SharedChunk& chunk) noexcept;
+
+    /// @brief releases the stored chunk
+    void reset() noexcept;
+
+    /// @brief acquires a reference to the stored chunk if it was stored after the given sequence number
+    /// @param[in,out] sequenceNumber of the chunk the consumer acquired last; it is updated to the sequence number of
+    /// the acquired chunk or of the empty slot
+    /// @return the stored chunk or nullopt if the slot is empty, holds no newer chunk or is concurrently replaced for
+    /// too long
+    optional<mepoo::SharedChunk> tryAcquireNewerThan(uint64_t& sequenceNumber) const noexcept;
+
+    /// @brief the sequence number of the stored chunk; it is odd while the chunk is replaced
+    uint64_t sequenceNumber() const noexcept;
+
+    /// @brief checks if the slot holds no chunk
+    bool isEmpty() const noexcept;
+
+    /// @brief the shared memory compatible representation of a pointer to a slot, e.g. to store it atomically
+    static RelativePointerData toRelativePointerData(LatestValueSlot* const slot) noexcept;
+
+    /// @brief the slot a shared memory compatible representation refers to
+    /// @return the pointer to the slot or nullptr if the representation is logically a nullptr
+    static LatestValueSlot* fromRelativePointerData(const RelativePointerData data) noexcept;
+
+  private:
+    /// @brief consumers give up after this number of attempts when the slot is replaced faster than they can acquire
+    /// the chunk; they are notified again anyway after the next replacement
+    static constexpr uint64_t MAX_ACQUIRE_ATTEMPTS{64U};
+
+    std::atomic<uint64_t> m_sequenceNumber{0U};
+    std::atomic<mepoo::ShmSafeUnmanagedChunk> m_chunk{mepoo::ShmSafeUnmanagedChunk()};
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_BUILDING_BLOCKS_LATEST_VALUE_SLOT_HPP
@@ -23,6 +23,7 @@
 #include "iox/detail/spsc_fifo.hpp"
 #include "iox/detail/spsc_sofi.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/variant.hpp"
 
 #include <cstdint>
@@ -92,6 +93,11 @@ class VariantQueue
     ///         otherwise the optional contains nullopt_t
     optional<ValueType> pop() noexcept;
 
+    /// @brief pops multiple elements from the fifo in one pass
+    /// @param[out] values storage for the popped elements in FIFO order; at most values.size() elements are popped
+    /// @return the number of popped elements
+    uint64_t pop(const span<ValueType> values) noexcept;
+
     /// @brief returns true if empty otherwise true
     bool empty() const noexcept;
 
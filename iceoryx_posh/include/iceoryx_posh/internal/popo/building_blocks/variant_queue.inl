@@ -131,6 +131,38 @@ inline optional<ValueType> VariantQueue<ValueType, Capacity>::pop() noexcept
     return nullopt;
 }
 
+template <typename ValueType, uint64_t Capacity>
+inline uint64_t VariantQueue<ValueType, Capacity>::pop(const span<ValueType> values) noexcept
+{
+    switch (m_type)
+    {
+    case VariantQueueTypes::FiFo_SingleProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_SingleProducerSingleConsumer)>();
+        return queue->pop(values);
+    }
+    case VariantQueueTypes::SoFi_SingleProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::SoFi_SingleProducerSingleConsumer)>();
+        return queue->pop(values);
+    }
+    case VariantQueueTypes::FiFo_MultiProducerSingleConsumer:
+    case VariantQueueTypes::SoFi_MultiProducerSingleConsumer:
+    {
+        // SAFETY: 'm_type' ist 'const' and does not change after construction
+        auto* queue = m_fifo.template unsafe_get_at_index_unchecked<static_cast<uint64_t>(
+            VariantQueueTypes::FiFo_MultiProducerSingleConsumer)>();
+        return queue->pop(values);
+    }
+    }
+
+    return 0U;
+}
+
 template <typename ValueType, uint64_t Capacity>
 inline bool VariantQueue<ValueType, Capacity>::empty() const noexcept
 {
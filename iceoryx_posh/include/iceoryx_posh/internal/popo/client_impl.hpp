@@ -64,6 +64,13 @@ class ClientImpl : public BaseClientT, private RpcInterface<Request<Req>, Client
     /// @return Error if sending was not successful
     expected<void, ClientSendError> send(Request<Req>&& request) noexcept override;
 
+    /// @brief Sends the given Request to one of the servers of the service and then releases its loan.
+    /// @param request to send.
+    /// @param loadBalancingKey Requests with the same key are sent to the same server with
+    ///        LoadBalancingPolicy::STICKY_BY_KEY; ignored by the other policies
+    /// @return Error if sending was not successful
+    expected<void, ClientSendError> send(Request<Req>&& request, const uint64_t loadBalancingKey) noexcept;
+
     /// @brief Take the Response from the top of the receive queue.
     /// @return Either a Response or a ChunkReceiveResult.
     /// @details The Response takes care of the cleanup. Don't store the raw pointer to the content of the Response, but
@@ -70,6 +70,16 @@ expected<void, ClientSendError> ClientImpl<Req, Res, BaseClientT>::send(Request<
     return port().sendRequest(requestHeader);
 }
 
+template <typename Req, typename Res, typename BaseClientT>
+expected<void, ClientSendError> ClientImpl<Req, Res, BaseClientT>::send(Request<Req>&& request,
+                                                                         const uint64_t loadBalancingKey) noexcept
+{
+    // take the ownership of the chunk from the Request to transfer it to 'sendRequest'
+    auto payload = request.release();
+    auto* requestHeader = static_cast<RequestHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
+    return port().sendRequest(requestHeader, loadBalancingKey);
+}
+
 template <typename Req, typename Res, typename BaseClientT>
 expected<Response<const Res>, ChunkReceiveResult> ClientImpl<Req, Res, BaseClientT>::take() noexcept
 {
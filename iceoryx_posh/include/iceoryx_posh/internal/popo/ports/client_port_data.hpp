@@ -47,6 +47,9 @@ struct ClientPortData : public BasePortData
     ClientChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_connectRequested{false};
     std::atomic<ConnectionState> m_connectionState{ConnectionState::NOT_CONNECTED};
+    LoadBalancingPolicy m_loadBalancingPolicy{LoadBalancingPolicy::ROUND_ROBIN};
+    /// @brief the number of requests which were sent with the load balancing policy; only used from the user side
+    uint64_t m_loadBalancingCounter{0U};
 };
 
 } // namespace popo
@@ -93,6 +93,16 @@ class ClientPortUser : public BasePort
     /// @return ClientSendError if sending was not successful
     expected<void, ClientSendError> sendRequest(RequestHeader* const requestHeader) noexcept;
 
+    /// @brief Send an allocated request chunk to one of the connected server ports which is selected with the
+    /// ClientOptions::loadBalancingPolicy
+    /// @param[in] requestHeader, pointer to the RequestHeader to send
+    /// @param[in] loadBalancingKey, requests with the same key are sent to the same server port with
+    /// LoadBalancingPolicy::STICKY_BY_KEY as long as the set of connected server ports does not change; ignored by the
+    /// other policies
+    /// @return ClientSendError if sending was not successful
+    expected<void, ClientSendError> sendRequest(RequestHeader* const requestHeader,
+                                                const uint64_t loadBalancingKey) noexcept;
+
     /// @brief try to connect to the server Caution: There can be delays between calling connect and a change
     /// in the connection state
     /// @code
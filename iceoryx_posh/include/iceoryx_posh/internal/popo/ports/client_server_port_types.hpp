@@ -31,7 +31,7 @@ namespace popo
 {
 struct ClientChunkDistributorConfig
 {
-    static constexpr uint32_t MAX_QUEUES = 1;
+    static constexpr uint32_t MAX_QUEUES = MAX_SERVERS_PER_CLIENT;
     static constexpr uint64_t MAX_HISTORY_CAPACITY = 1; // could be 0, but problem for the container then
 };
 
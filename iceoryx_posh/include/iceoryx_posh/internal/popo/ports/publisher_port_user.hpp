@@ -25,6 +25,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -69,6 +70,15 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in order to all connected subscriber ports; each subscriber is notified
+    /// only once for the whole batch
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    void sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
+    /// @brief Notify all connected subscriber ports without sending a chunk, e.g. when the data of a previously sent
+    /// chunk was updated in place
+    void notifySubscribers() noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/ports/base_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/client_server_port_types.hpp"
+#include "iceoryx_posh/internal/popo/used_chunk_list.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 
 #include <atomic>
@@ -31,6 +32,16 @@ namespace iox
 {
 namespace popo
 {
+/// @brief The bookkeeping of a worker which processes requests of a server port concurrently to other workers; each
+/// worker owns the requests it took and the responses it allocated, therefore no synchronization between the workers
+/// is required apart from the already multi-producer/multi-consumer capable request queue
+struct ServerWorkerData
+{
+    std::atomic_bool m_isAcquired{false};
+    UsedChunkList<MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY> m_requestsInUse;
+    UsedChunkList<MAX_RESPONSES_ALLOCATED_SIMULTANEOUSLY> m_responsesInUse;
+};
+
 struct ServerPortData : public BasePortData
 {
     ServerPortData(const capro::ServiceDescription& serviceDescription,
@@ -44,6 +55,10 @@ struct ServerPortData : public BasePortData
     ServerChunkReceiverData_t m_chunkReceiverData;
     std::atomic_bool m_offeringRequested{false};
     std::atomic_bool m_offered{false};
+    bool m_allowMultipleServers{false};
+    // NOLINTJUSTIFICATION the workers are addressed by index from the user side as well as from RouDi for the cleanup
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays)
+    ServerWorkerData m_workers[MAX_SERVER_WORKERS];
 
     static constexpr uint64_t HISTORY_REQUEST_OF_ZERO{0U};
 };
@@ -147,6 +147,53 @@ class ServerPortUser : public BasePort
     /// @return ServerSendError if sending was not successful
     expected<void, ServerSendError> sendResponse(ResponseHeader* const responseHeader) noexcept;
 
+    /// @brief Acquires a worker of this server port. Each worker has its own bookkeeping of the requests it took and
+    /// the responses it allocated, therefore the requests can be processed concurrently by multiple threads or
+    /// processes, each using its own worker. The requests are distributed to the workers by the shared request queue.
+    /// @return the index of the acquired worker or an empty optional if all MAX_SERVER_WORKERS workers are in use
+    /// @note The worker API must not be mixed with the non-worker API from multiple threads since the latter is not
+    /// thread-safe
+    optional<uint32_t> acquireWorker() noexcept;
+
+    /// @brief Releases a worker acquired with acquireWorker together with all the requests and responses it still
+    /// holds
+    /// @param[in] workerIndex the index of the worker to release
+    void releaseWorker(const uint32_t workerIndex) noexcept;
+
+    /// @brief Like getRequest but the request is owned by the worker with the given index
+    /// @param[in] workerIndex the index of the acquired worker
+    /// @return expected that has a new RequestHeader if there are new requests in the underlying queue,
+    /// ServerRequestResult on error
+    expected<const RequestHeader*, ServerRequestResult> getRequest(const uint32_t workerIndex) noexcept;
+
+    /// @brief Release a request that was obtained with getRequest by the worker with the given index
+    /// @param[in] workerIndex the index of the acquired worker
+    /// @param[in] requestHeader, pointer to the RequestHeader to release
+    void releaseRequest(const uint32_t workerIndex, const RequestHeader* const requestHeader) noexcept;
+
+    /// @brief Like allocateResponse but the response is owned by the worker with the given index
+    /// @param[in] workerIndex the index of the acquired worker
+    /// @param[in] requestHeader, the request header for the corresponding response
+    /// @param[in] userPayloadSize, size of the user user-paylaod without additional headers
+    /// @param[in] userPayloadAlignment, alignment of the user user-paylaod without additional headers
+    /// @return on success pointer to a ResponseHeader, error if not
+    expected<ResponseHeader*, AllocationError> allocateResponse(const uint32_t workerIndex,
+                                                                const RequestHeader* const requestHeader,
+                                                                const uint64_t userPayloadSize,
+                                                                const uint32_t userPayloadAlignment) noexcept;
+
+    /// @brief Releases a response allocated by the worker with the given index without sending it
+    /// @param[in] workerIndex the index of the acquired worker
+    /// @param[in] responseHeader, pointer to the ResponseHeader to free
+    void releaseResponse(const uint32_t workerIndex, const ResponseHeader* const responseHeader) noexcept;
+
+    /// @brief Send a response allocated by the worker with the given index to the client which sent the request
+    /// @param[in] workerIndex the index of the acquired worker
+    /// @param[in] responseHeader, pointer to the ResponseHeader to send
+    /// @return ServerSendError if sending was not successful
+    expected<void, ServerSendError> sendResponse(const uint32_t workerIndex,
+                                                 ResponseHeader* const responseHeader) noexcept;
+
     /// @brief offer this server port in the system
     void offer() noexcept;
 
@@ -176,6 +223,8 @@ class ServerPortUser : public BasePort
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
+    ServerWorkerData& getWorker(const uint32_t workerIndex) noexcept;
+
     ChunkSender<ServerChunkSenderData_t> m_chunkSender;
     ChunkReceiver<ServerChunkReceiverData_t> m_chunkReceiver;
 };
@@ -26,6 +26,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -67,7 +68,14 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
-    /// @brief Release a chunk that was obtained with tryGetChunk
+    /// @brief Tries to get multiple chunks from the queue in one pass. The ChunkHeaders of the oldest chunks in the
+    /// queue are stored in FIFO order
+    /// @param[out] chunkHeaders storage for the ChunkHeaders of the received chunks
+    /// @return The number of received chunks, ChunkReceiveResult on error
+    /// or if there are no new chunks in the underlying queue
+    expected<uint64_t, ChunkReceiveResult> tryGetChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
+    /// @brief Release a chunk that was obtained with tryGetChunk or tryGetChunks
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
 
 namespace iox
@@ -63,6 +64,14 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishBatch Publishes the given samples in order with a single notification of each subscriber and
+    /// releases their loans.
+    /// @param samples The samples to publish; they are empty afterwards.
+    /// @note The number of samples is limited by the number of samples which can be loaned in parallel.
+    ///
+    void publishBatch(const span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -98,6 +98,18 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishBatch(const span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto& sample : samples)
+    {
+        // release the Samples ownership of the chunk before publishing
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(sample.release()));
+    }
+    port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
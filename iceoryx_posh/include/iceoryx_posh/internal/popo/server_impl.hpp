@@ -26,6 +26,10 @@
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/assertions.hpp"
+#include "iox/optional.hpp"
+
+#include <array>
 
 namespace iox
 {
@@ -71,11 +75,66 @@ class ServerImpl : public BaseServerT, private RpcInterface<Response<Res>, Serve
     /// @return Error if sending was not successful
     expected<void, ServerSendError> send(Response<Res>&& response) noexcept override;
 
+    /// @brief Acquires a worker which allows to process requests concurrently to other threads or processes using
+    /// another worker of this server. Every request is taken by exactly one worker and the responses are sent
+    /// independently by each worker.
+    /// @return The index of the acquired worker or an empty optional if MAX_SERVER_WORKERS are already acquired
+    /// @note The worker overloads of 'take', 'loan' and 'send' must only be used by one thread per worker and must not
+    ///       be called concurrently to their non-worker counterparts
+    optional<uint32_t> acquireWorker() noexcept;
+
+    /// @brief Releases a worker together with all the requests and responses it still holds
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    /// @note All Requests and Responses of the worker must be destroyed or sent before since they would otherwise be
+    ///       released a second time
+    void releaseWorker(const uint32_t workerIndex) noexcept;
+
+    /// @brief Take the Request from the top of the receive queue with the given worker.
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    /// @return Either a Request or a ServerRequestResult.
+    /// @details The Request is released by the worker when it goes out of scope.
+    expected<Request<const Req>, ServerRequestResult> take(const uint32_t workerIndex) noexcept;
+
+    /// @brief Get a Response owned by the given worker from loaned shared memory and construct the data with the
+    /// given arguments.
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    /// @param[in] request The request to which the Response belongs to, to determine where to send the response
+    /// @param[in] args Arguments used to construct the data.
+    /// @return An instance of the Response that resides in shared memory or an error if unable to allocate memory to
+    /// loan.
+    /// @details The loaned Response is released by the worker when it goes out of scope and 'Response::send' sends it
+    /// with the worker.
+    template <typename... Args>
+    expected<Response<Res>, AllocationError>
+    loan(const uint32_t workerIndex, const Request<const Req>& request, Args&&... args) noexcept;
+
+    /// @brief Sends the given Response with the worker which loaned it and then releases its loan.
+    /// @param workerIndex the index of the worker which loaned the response
+    /// @param response to send.
+    /// @return Error if sending was not successful
+    expected<void, ServerSendError> send(const uint32_t workerIndex, Response<Res>&& response) noexcept;
+
   protected:
     using BaseServerT::port;
 
   private:
+    /// @brief Is the producer of the Responses of one worker and forwards 'Response::send' to the worker overload
+    class WorkerResponseSender : public RpcInterface<Response<Res>, ServerSendError>
+    {
+      public:
+        WorkerResponseSender() noexcept = default;
+
+        expected<void, ServerSendError> send(Response<Res>&& response) noexcept override;
+
+        ServerImpl* m_server{nullptr};
+        uint32_t m_workerIndex{0U};
+    };
+
     expected<Response<Res>, AllocationError> loanUninitialized(const Request<const Req>& request) noexcept;
+    expected<Response<Res>, AllocationError> loanUninitialized(const uint32_t workerIndex,
+                                                               const Request<const Req>& request) noexcept;
+
+    std::array<WorkerResponseSender, MAX_SERVER_WORKERS> m_workerResponseSenders;
 };
 } // namespace popo
 } // namespace iox
@@ -28,6 +28,11 @@ inline ServerImpl<Req, Res, BaseServerT>::ServerImpl(const capro::ServiceDescrip
                                                      const ServerOptions& serverOptions) noexcept
     : BaseServerT(service, serverOptions)
 {
+    for (uint32_t workerIndex = 0U; workerIndex < MAX_SERVER_WORKERS; ++workerIndex)
+    {
+        m_workerResponseSenders[workerIndex].m_server = this;
+        m_workerResponseSenders[workerIndex].m_workerIndex = workerIndex;
+    }
 }
 
 template <typename Req, typename Res, typename BaseServerT>
@@ -90,6 +95,85 @@ expected<void, ServerSendError> ServerImpl<Req, Res, BaseServerT>::send(Response
     return port().sendResponse(responseHeader);
 }
 
+template <typename Req, typename Res, typename BaseServerT>
+inline optional<uint32_t> ServerImpl<Req, Res, BaseServerT>::acquireWorker() noexcept
+{
+    return port().acquireWorker();
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+inline void ServerImpl<Req, Res, BaseServerT>::releaseWorker(const uint32_t workerIndex) noexcept
+{
+    port().releaseWorker(workerIndex);
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+expected<Request<const Req>, ServerRequestResult>
+ServerImpl<Req, Res, BaseServerT>::take(const uint32_t workerIndex) noexcept
+{
+    auto result = port().getRequest(workerIndex);
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    auto requestHeader = result.value();
+    auto payload = mepoo::ChunkHeader::fromUserHeader(requestHeader)->userPayload();
+    auto request = unique_ptr<const Req>(static_cast<const Req*>(payload), [this, workerIndex](const Req* payload) {
+        auto* requestHeader = iox::popo::RequestHeader::fromPayload(payload);
+        this->port().releaseRequest(workerIndex, requestHeader);
+    });
+    return ok(Request<const Req>{std::move(request)});
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+expected<Response<Res>, AllocationError>
+ServerImpl<Req, Res, BaseServerT>::loanUninitialized(const uint32_t workerIndex,
+                                                     const Request<const Req>& request) noexcept
+{
+    IOX_ENFORCE(workerIndex < MAX_SERVER_WORKERS, "Invalid server worker index");
+
+    const auto* requestHeader = &request.getRequestHeader();
+    auto result = port().allocateResponse(workerIndex, requestHeader, sizeof(Res), alignof(Res));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    auto responseHeader = result.value();
+    auto payload = mepoo::ChunkHeader::fromUserHeader(responseHeader)->userPayload();
+    auto response = unique_ptr<Res>(static_cast<Res*>(payload), [this, workerIndex](Res* payload) {
+        auto* responseHeader = iox::popo::ResponseHeader::fromPayload(payload);
+        this->port().releaseResponse(workerIndex, responseHeader);
+    });
+    return ok(Response<Res>{std::move(response), m_workerResponseSenders[workerIndex]});
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+template <typename... Args>
+expected<Response<Res>, AllocationError> ServerImpl<Req, Res, BaseServerT>::loan(const uint32_t workerIndex,
+                                                                                 const Request<const Req>& request,
+                                                                                 Args&&... args) noexcept
+{
+    return std::move(loanUninitialized(workerIndex, request).and_then(
+        [&](auto& response) { new (response.get()) Res(std::forward<Args>(args)...); }));
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+expected<void, ServerSendError> ServerImpl<Req, Res, BaseServerT>::send(const uint32_t workerIndex,
+                                                                        Response<Res>&& response) noexcept
+{
+    // take the ownership of the chunk from the Response to transfer it to 'sendResponse'
+    auto payload = response.release();
+    auto* responseHeader = static_cast<ResponseHeader*>(mepoo::ChunkHeader::fromUserPayload(payload)->userHeader());
+    return port().sendResponse(workerIndex, responseHeader);
+}
+
+template <typename Req, typename Res, typename BaseServerT>
+expected<void, ServerSendError>
+ServerImpl<Req, Res, BaseServerT>::WorkerResponseSender::send(Response<Res>&& response) noexcept
+{
+    return m_server->send(m_workerIndex, std::move(response));
+}
+
 } // namespace popo
 } // namespace iox
 
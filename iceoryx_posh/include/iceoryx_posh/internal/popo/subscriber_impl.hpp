@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/uninitialized_array.hpp"
 
 namespace iox
 {
@@ -54,11 +56,24 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Takes up to maxCount samples from the top of the receive queue in one pass.
+    /// @param maxCount The maximum number of samples to take; limited to MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY.
+    /// @param callback Callable with the signature void(Sample<const T, const H>&&) which is called for each sample in
+    /// FIFO order. The sample is released when the callback does not take its ownership.
+    /// @return Either the number of taken samples or a ChunkReceiveResult.
+    ///
+    template <typename Callable>
+    expected<uint64_t, ChunkReceiveResult> takeBatch(const uint64_t maxCount, const Callable& callback) noexcept;
+
   protected:
     using PortType = typename BaseSubscriberType::PortType;
     using BaseSubscriberType::port;
 
     SubscriberImpl(PortType&& port) noexcept;
+
+  private:
+    Sample<const T, const H> convertChunkHeaderToSample(const mepoo::ChunkHeader* const chunkHeader) noexcept;
 };
 
 } // namespace popo
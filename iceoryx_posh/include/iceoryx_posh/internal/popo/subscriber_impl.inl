@@ -45,12 +45,41 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     {
         return err(result.error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
+    return ok(convertChunkHeaderToSample(result.value()));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+template <typename Callable>
+inline expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::takeBatch(const uint64_t maxCount, const Callable& callback) noexcept
+{
+    UninitializedArray<const mepoo::ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY> chunkHeaders;
+    const uint64_t count =
+        algorithm::minVal(maxCount, static_cast<uint64_t>(MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+
+    auto result = BaseSubscriberType::takeChunks(span<const mepoo::ChunkHeader*>(chunkHeaders.begin(), count));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        callback(convertChunkHeaderToSample(chunkHeaders[i]));
+    }
+    return ok(result.value());
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline Sample<const T, const H> SubscriberImpl<T, H, BaseSubscriberType>::convertChunkHeaderToSample(
+    const mepoo::ChunkHeader* const chunkHeader) noexcept
+{
+    auto userPayloadPtr = static_cast<const T*>(chunkHeader->userPayload());
     auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
+    return Sample<const T, const H>(std::move(samplePtr));
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
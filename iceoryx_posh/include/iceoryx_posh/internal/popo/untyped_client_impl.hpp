@@ -62,6 +62,13 @@ class UntypedClientImpl : public BaseClientT
     /// @return Error if sending was not successful
     expected<void, ClientSendError> send(void* const requestPayload) noexcept;
 
+    /// @brief Sends the provided memory chunk as request to one of the servers of the service.
+    /// @param requestPayload Pointer to the payload of the allocated shared memory chunk.
+    /// @param loadBalancingKey Requests with the same key are sent to the same server with
+    ///        LoadBalancingPolicy::STICKY_BY_KEY; ignored by the other policies
+    /// @return Error if sending was not successful
+    expected<void, ClientSendError> send(void* const requestPayload, const uint64_t loadBalancingKey) noexcept;
+
     /// @brief Take the response chunk from the top of the receive queue.
     /// @return The payload pointer of the request chunk taken.
     /// @details No automatic cleanup of the associated chunk is performed
@@ -71,6 +71,19 @@ expected<void, ClientSendError> UntypedClientImpl<BaseClientT>::send(void* const
     return port().sendRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()));
 }
 
+template <typename BaseClientT>
+expected<void, ClientSendError> UntypedClientImpl<BaseClientT>::send(void* const requestPayload,
+                                                                      const uint64_t loadBalancingKey) noexcept
+{
+    auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(requestPayload);
+    if (chunkHeader == nullptr)
+    {
+        return err(ClientSendError::INVALID_REQUEST);
+    }
+
+    return port().sendRequest(static_cast<RequestHeader*>(chunkHeader->userHeader()), loadBalancingKey);
+}
+
 template <typename BaseClientT>
 expected<const void*, ChunkReceiveResult> UntypedClientImpl<BaseClientT>::take() noexcept
 {
@@ -20,6 +20,7 @@
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -62,6 +63,13 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in order with a single notification of each subscriber.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks.
+    /// @note The number of chunks is limited by the number of chunks which can be loaned in parallel.
+    ///
+    void publishBatch(const span<void* const> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -44,6 +44,17 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishBatch(const span<void* const> userPayloads) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (auto* const userPayload : userPayloads)
+    {
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+    port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint64_t userPayloadSize,
@@ -77,6 +77,50 @@ class UntypedServerImpl : public BaseServerT
     ///          as its memory may have been reclaimed.
     void releaseResponse(void* const responsePayload) noexcept;
 
+    /// @brief Acquires a worker which allows to process requests concurrently to other threads or processes using
+    /// another worker of this server. Every request is taken by exactly one worker and the responses are sent
+    /// independently by each worker.
+    /// @return The index of the acquired worker or an empty optional if MAX_SERVER_WORKERS are already acquired
+    /// @note The worker overloads of 'take', 'releaseRequest', 'loan', 'send' and 'releaseResponse' must only be used
+    ///       by one thread per worker and must not be called concurrently to their non-worker counterparts
+    optional<uint32_t> acquireWorker() noexcept;
+
+    /// @brief Releases a worker together with all the requests and responses it still holds
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    void releaseWorker(const uint32_t workerIndex) noexcept;
+
+    /// @brief Take the request chunk from the top of the receive queue with the given worker.
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    /// @return The payload pointer of the request chunk taken.
+    expected<const void*, ServerRequestResult> take(const uint32_t workerIndex) noexcept;
+
+    /// @brief Releases the ownership of a request chunk taken by the given worker.
+    /// @param workerIndex the index of the worker which took the request
+    /// @param requestPayload pointer to the payload of the chunk to be released
+    void releaseRequest(const uint32_t workerIndex, const void* const requestPayload) noexcept;
+
+    /// @brief Get a response chunk from loaned shared memory which is owned by the given worker.
+    /// @param workerIndex the index of the worker provided by 'acquireWorker'
+    /// @param[in] requestHeader The requestHeader to which the response belongs to
+    /// @param payloadSize The expected payload size of the chunk.
+    /// @param payloadAlignment The expected payload alignment of the chunk.
+    /// @return A pointer to the payload of the chunk or an AllocationError if no chunk could be loaned.
+    expected<void*, AllocationError> loan(const uint32_t workerIndex,
+                                          const RequestHeader* const requestHeader,
+                                          const uint64_t payloadSize,
+                                          const uint32_t payloadAlignment) noexcept;
+
+    /// @brief Sends the response chunk loaned by the given worker to the client.
+    /// @param workerIndex the index of the worker which loaned the response
+    /// @param responsePayload Pointer to the payload of the allocated shared memory chunk.
+    /// @return Error if sending was not successful
+    expected<void, ServerSendError> send(const uint32_t workerIndex, void* const responsePayload) noexcept;
+
+    /// @brief Releases the ownership of a response chunk loaned by the given worker.
+    /// @param workerIndex the index of the worker which loaned the response
+    /// @param responsePayload pointer to the payload of the chunk to be released
+    void releaseResponse(const uint32_t workerIndex, void* const responsePayload) noexcept;
+
   protected:
     using BaseServerT::port;
 };
@@ -94,6 +94,76 @@ void UntypedServerImpl<BaseServerT>::releaseResponse(void* const responsePayload
     }
 }
 
+template <typename BaseServerT>
+optional<uint32_t> UntypedServerImpl<BaseServerT>::acquireWorker() noexcept
+{
+    return port().acquireWorker();
+}
+
+template <typename BaseServerT>
+void UntypedServerImpl<BaseServerT>::releaseWorker(const uint32_t workerIndex) noexcept
+{
+    port().releaseWorker(workerIndex);
+}
+
+template <typename BaseServerT>
+expected<const void*, ServerRequestResult> UntypedServerImpl<BaseServerT>::take(const uint32_t workerIndex) noexcept
+{
+    auto requestResult = port().getRequest(workerIndex);
+    if (requestResult.has_error())
+    {
+        return err(requestResult.error());
+    }
+    return ok(mepoo::ChunkHeader::fromUserHeader(requestResult.value())->userPayload());
+}
+
+template <typename BaseServerT>
+void UntypedServerImpl<BaseServerT>::releaseRequest(const uint32_t workerIndex,
+                                                    const void* const requestPayload) noexcept
+{
+    auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(requestPayload);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseRequest(workerIndex, static_cast<const RequestHeader*>(chunkHeader->userHeader()));
+    }
+}
+
+template <typename BaseServerT>
+expected<void*, AllocationError> UntypedServerImpl<BaseServerT>::loan(const uint32_t workerIndex,
+                                                                      const RequestHeader* const requestHeader,
+                                                                      const uint64_t payloadSize,
+                                                                      const uint32_t payloadAlignment) noexcept
+{
+    auto allocationResult = port().allocateResponse(workerIndex, requestHeader, payloadSize, payloadAlignment);
+    if (allocationResult.has_error())
+    {
+        return err(allocationResult.error());
+    }
+    return ok(mepoo::ChunkHeader::fromUserHeader(allocationResult.value())->userPayload());
+}
+
+template <typename BaseServerT>
+expected<void, ServerSendError> UntypedServerImpl<BaseServerT>::send(const uint32_t workerIndex,
+                                                                     void* const responsePayload) noexcept
+{
+    auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(responsePayload);
+    if (chunkHeader == nullptr)
+    {
+        return err(ServerSendError::INVALID_RESPONSE);
+    }
+    return port().sendResponse(workerIndex, static_cast<ResponseHeader*>(chunkHeader->userHeader()));
+}
+
+template <typename BaseServerT>
+void UntypedServerImpl<BaseServerT>::releaseResponse(const uint32_t workerIndex, void* const responsePayload) noexcept
+{
+    auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(responsePayload);
+    if (chunkHeader != nullptr)
+    {
+        port().releaseResponse(workerIndex, static_cast<ResponseHeader*>(chunkHeader->userHeader()));
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
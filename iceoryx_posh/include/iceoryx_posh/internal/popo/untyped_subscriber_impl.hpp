@@ -21,7 +21,9 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
+#include "iox/uninitialized_array.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox
@@ -57,6 +59,18 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Takes up to maxCount chunks from the top of the receive queue in one pass.
+    /// @param maxCount The maximum number of chunks to take; limited to MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY.
+    /// @param callback Callable with the signature void(const void*) which is called with the user-payload pointer of
+    ///        each chunk in FIFO order.
+    /// @return Either the number of taken chunks or a ChunkReceiveResult.
+    /// @details No automatic cleanup of the associated chunks is performed
+    ///          and must be manually done by calling 'release'
+    ///
+    template <typename Callable>
+    expected<uint64_t, ChunkReceiveResult> takeBatch(const uint64_t maxCount, const Callable& callback) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
@@ -48,6 +48,28 @@ inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubsc
     return ok(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+template <typename Callable>
+inline expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeBatch(const uint64_t maxCount, const Callable& callback) noexcept
+{
+    UninitializedArray<const mepoo::ChunkHeader*, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY> chunkHeaders;
+    const uint64_t count =
+        algorithm::minVal(maxCount, static_cast<uint64_t>(MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY));
+
+    auto result = BaseSubscriber::takeChunks(span<const mepoo::ChunkHeader*>(chunkHeaders.begin(), count));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        callback(chunkHeaders[i]->userPayload());
+    }
+    return ok(result.value());
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
@@ -60,6 +60,19 @@ class UsedChunkList
     /// @note only from runtime context
     bool remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Returns the ChunkHeader of one of the chunks stored in the list, e.g. to release all of them one by one
+    /// with 'remove'
+    /// @return the ChunkHeader of the most recently inserted chunk or a nullptr if the list is empty
+    /// @note only from runtime context
+    const mepoo::ChunkHeader* peek() const noexcept;
+
+    /// @brief Returns the number of chunks currently stored in the list
+    /// @note only from runtime context
+    uint32_t size() const noexcept;
+
+    /// @brief Returns the maximum number of chunks which can be stored in the list
+    static constexpr uint32_t capacity() noexcept;
+
     /// @brief Cleans up all the remaining chunks from the list.
     /// @note from RouDi context once the applications walked the plank. It is unsafe to call this if the application is
     /// still running.
@@ -78,6 +91,7 @@ class UsedChunkList
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
     uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
+    uint32_t m_size{0u};
     uint32_t m_listIndices[Capacity];
     DataElement_t m_listData[Capacity];
 };
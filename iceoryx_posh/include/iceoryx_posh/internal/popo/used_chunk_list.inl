@@ -52,6 +52,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 
         // set freeListHead to the next free entry
         m_freeListHead = nextFree;
+        ++m_size;
 
         m_synchronizer.clear(std::memory_order_release);
         return true;
@@ -90,6 +91,7 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
                 // insert index to free list
                 m_listIndices[current] = m_freeListHead;
                 m_freeListHead = current;
+                --m_size;
 
                 m_synchronizer.clear(std::memory_order_release);
                 return true;
@@ -100,6 +102,31 @@ bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepo
     return false;
 }
 
+template <uint32_t Capacity>
+const mepoo::ChunkHeader* UsedChunkList<Capacity>::peek() const noexcept
+{
+    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    {
+        if (!m_listData[current].isLogicalNullptr())
+        {
+            return m_listData[current].getChunkHeader();
+        }
+    }
+    return nullptr;
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::size() const noexcept
+{
+    return m_size;
+}
+
+template <uint32_t Capacity>
+constexpr uint32_t UsedChunkList<Capacity>::capacity() noexcept
+{
+    return Capacity;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -138,6 +165,7 @@ void UsedChunkList<Capacity>::init() noexcept
 
     m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
+    m_size = 0U;
 
     // clear data
     for (auto& data : m_listData)
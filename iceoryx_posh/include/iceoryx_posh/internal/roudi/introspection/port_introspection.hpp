@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_INTROSPECTION_PORT_INTROSPECTION_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/assertions.hpp"
@@ -26,6 +27,7 @@
 #include "iox/function.hpp"
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 
 #include <map>
@@ -77,15 +79,28 @@ class PortIntrospection
                 , process(portData.m_runtimeName)
                 , service(portData.m_serviceDescription)
             {
+                topicEntry.m_publisherPortID = static_cast<uint64_t>(portData.m_uniqueId);
+                topicEntry.m_sourceInterface = service.getSourceInterface();
+                topicEntry.m_name = process;
+                topicEntry.m_caproInstanceID = service.getInstanceIDString();
+                topicEntry.m_caproServiceID = service.getServiceIDString();
+                topicEntry.m_caproEventMethodID = service.getEventIDString();
             }
 
             typename PublisherPort::MemberType_t* portData{nullptr};
             RuntimeName_t process;
             capro::ServiceDescription service;
+            /// the entry of the port in the PortIntrospectionTopic; it is created once when the port is added
+            PublisherPortData topicEntry;
 
             /// map from indices to ConnectionContainer indices
             std::map<int, ConnectionContainerIndexType> connectionMap;
             int index{-1};
+
+            /// counters of the chunk sender at the previous throughput topic, used to compute the rates
+            uint64_t lastSentChunks{0U};
+            uint64_t lastSentBytes{0U};
+            optional<std::chrono::steady_clock::time_point> lastThroughputUpdate;
         };
 
         struct SubscriberInfo
@@ -97,11 +112,17 @@ class PortIntrospection
                 , process(portData.m_runtimeName)
                 , service(portData.m_serviceDescription)
             {
+                topicEntry.m_name = process;
+                topicEntry.m_caproInstanceID = service.getInstanceIDString();
+                topicEntry.m_caproServiceID = service.getServiceIDString();
+                topicEntry.m_caproEventMethodID = service.getEventIDString();
             }
 
             typename SubscriberPort::MemberType_t* portData{nullptr};
             RuntimeName_t process;
             capro::ServiceDescription service;
+            /// the entry of the port in the PortIntrospectionTopic; it is created once when the port is added
+            SubscriberPortData topicEntry;
         };
 
         struct ConnectionInfo
@@ -171,12 +192,17 @@ class PortIntrospection
         /// which are subscribed to the same topic
         bool updateSubscriberConnectionState(const capro::CaproMessage& message, const popo::UniquePortId& id) noexcept;
 
-        /// @brief prepare the topic to be send based on the internal connection state of all tracked ports
+        /// @brief prepare the topic to be send from the entries which were created when the ports were added
         /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortIntrospectionTopic& topic) noexcept;
 
+        /// @brief prepare the throughput topic from the ChunkSenderStatistics of all tracked publisher ports; the
+        /// rates refer to the interval since the previous call
+        /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(PortThroughputIntrospectionTopic& topic) noexcept;
 
+        /// @brief prepare the subscriber topic including the fill level and the ChunkQueueStatistics of the queues
+        /// @param[out] topic data structure to be prepared for sending
         void prepareTopic(SubscriberPortChangingIntrospectionFieldTopic& topic) noexcept;
 
         /// @brief compute the next connection state based on the current connection state and a capro message type when
@@ -284,6 +310,12 @@ class PortIntrospection
     /// @param[in] interval duration between two send invocations
     void setSendInterval(const units::Duration interval) noexcept;
 
+    /// @brief set the level of detail of the introspection; with IntrospectionLevel::OFF the ports are not tracked
+    /// at all and with IntrospectionLevel::BASIC only the port list is published
+    /// @param[in] level the level of detail
+    /// @note must be called before any port is added and before run() is called
+    void setDetailLevel(const IntrospectionLevel level) noexcept;
+
 
     /// @brief start the internal send thread
     void run() noexcept;
@@ -310,9 +342,12 @@ class PortIntrospection
     optional<PublisherPort> m_publisherPortSubscriberPortsData;
 
   private:
+    bool isEnabled() const noexcept;
+
     PortData m_portData;
 
-    units::Duration m_sendInterval{units::Duration::fromSeconds(1U)};
+    IntrospectionLevel m_detailLevel{IntrospectionLevel::FULL};
+    units::Duration m_sendInterval{DEFAULT_INTROSPECTION_INTERVAL};
     concurrent::detail::PeriodicTask<function<void()>> m_publishingTask{
         concurrent::detail::PeriodicTaskManualStart, "PortIntr", *this, &PortIntrospection::send};
 };
@@ -43,14 +43,20 @@ inline PortIntrospection<PublisherPort, SubscriberPort>::~PortIntrospection() no
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::reportMessage(const capro::CaproMessage& message) noexcept
 {
-    m_portData.updateConnectionState(message);
+    if (isEnabled())
+    {
+        m_portData.updateConnectionState(message);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::reportMessage(const capro::CaproMessage& message,
                                                                             const popo::UniquePortId& id) noexcept
 {
-    m_portData.updateSubscriberConnectionState(message, id);
+    if (isEnabled())
+    {
+        m_portData.updateSubscriberConnectionState(message, id);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -74,17 +80,25 @@ inline bool PortIntrospection<PublisherPort, SubscriberPort>::registerPublisherP
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::run() noexcept
 {
+    if (!isEnabled())
+    {
+        return;
+    }
+
     IOX_ENFORCE(m_publisherPort.has_value(), "Port must be initialized");
     IOX_ENFORCE(m_publisherPortThroughput.has_value(), "Port must be initialized");
     IOX_ENFORCE(m_publisherPortSubscriberPortsData.has_value(), "Port must be initialized");
 
     // this is a field, there needs to be a sample before activate is called
     sendPortData();
-    sendThroughputData();
-    sendSubscriberPortsData();
     m_publisherPort->offer();
-    m_publisherPortThroughput->offer();
-    m_publisherPortSubscriberPortsData->offer();
+    if (m_detailLevel == IntrospectionLevel::FULL)
+    {
+        sendThroughputData();
+        sendSubscriberPortsData();
+        m_publisherPortThroughput->offer();
+        m_publisherPortSubscriberPortsData->offer();
+    }
 
     m_publishingTask.start(m_sendInterval);
 }
@@ -96,8 +110,12 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::send() noexcept
     {
         sendPortData();
     }
-    sendThroughputData();
-    sendSubscriberPortsData();
+    // the periodically sampled data requires to lock the port data and to iterate over all ports
+    if (m_detailLevel == IntrospectionLevel::FULL)
+    {
+        sendThroughputData();
+        sendSubscriberPortsData();
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -168,6 +186,18 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::setSendInterval(co
     }
 }
 
+template <typename PublisherPort, typename SubscriberPort>
+inline void PortIntrospection<PublisherPort, SubscriberPort>::setDetailLevel(const IntrospectionLevel level) noexcept
+{
+    m_detailLevel = level;
+}
+
+template <typename PublisherPort, typename SubscriberPort>
+inline bool PortIntrospection<PublisherPort, SubscriberPort>::isEnabled() const noexcept
+{
+    return m_detailLevel != IntrospectionLevel::OFF;
+}
+
 template <typename PublisherPort, typename SubscriberPort>
 inline void PortIntrospection<PublisherPort, SubscriberPort>::stop() noexcept
 {
@@ -547,17 +577,7 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
             if (m_publisherIndex >= 0)
             {
                 auto publisherInfo = m_publisherContainer.iter_from_index(m_publisherIndex);
-                PublisherPortData publisherData;
-                PublisherPort port(publisherInfo->portData);
-                publisherData.m_publisherPortID = static_cast<uint64_t>(port.getUniqueID());
-                publisherData.m_sourceInterface = publisherInfo->service.getSourceInterface();
-                publisherData.m_name = publisherInfo->process;
-
-                publisherData.m_caproInstanceID = publisherInfo->service.getInstanceIDString();
-                publisherData.m_caproServiceID = publisherInfo->service.getServiceIDString();
-                publisherData.m_caproEventMethodID = publisherInfo->service.getEventIDString();
-
-                m_publisherList.emplace_back(publisherData);
+                m_publisherList.emplace_back(publisherInfo->topicEntry);
                 publisherInfo->index = index++;
             }
         }
@@ -572,15 +592,7 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
             if (connectionIndex >= 0)
             {
                 auto connection = m_connectionContainer.iter_from_index(connectionIndex);
-                SubscriberPortData subscriberData;
-                auto& subscriberInfo = connection->subscriberInfo;
-
-                subscriberData.m_name = subscriberInfo.process;
-
-                subscriberData.m_caproInstanceID = subscriberInfo.service.getInstanceIDString();
-                subscriberData.m_caproServiceID = subscriberInfo.service.getServiceIDString();
-                subscriberData.m_caproEventMethodID = subscriberInfo.service.getEventIDString();
-                m_subscriberList.emplace_back(subscriberData);
+                m_subscriberList.emplace_back(connection->subscriberInfo.topicEntry);
             }
         }
     }
@@ -590,11 +602,55 @@ PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortInt
 }
 
 template <typename PublisherPort, typename SubscriberPort>
-inline void
-PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(PortThroughputIntrospectionTopic& topic
-                                                                         [[maybe_unused]]) noexcept
+inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareTopic(
+    PortThroughputIntrospectionTopic& topic) noexcept
 {
-    /// @todo iox-#402 re-add port throughput
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& publisherInfo : m_publisherContainer)
+    {
+        // the counters are updated with relaxed atomics by the publishing process; a value which is slightly outdated
+        // is taken into account with the next topic
+        const auto& statistics = publisherInfo.portData->m_chunkSenderData.m_statistics;
+        const auto sentChunks = statistics.m_sentChunks.load(std::memory_order_relaxed);
+        const auto sentBytes = statistics.m_sentBytes.load(std::memory_order_relaxed);
+
+        PortThroughputData throughputData;
+        throughputData.m_publisherPortID = publisherInfo.topicEntry.m_publisherPortID;
+        throughputData.m_sentChunks = sentChunks;
+        throughputData.m_sentBytes = sentBytes;
+        throughputData.m_allocationFailures = statistics.m_allocationFailures.load(std::memory_order_relaxed);
+
+        const auto chunksInInterval = sentChunks - publisherInfo.lastSentChunks;
+        const auto bytesInInterval = sentBytes - publisherInfo.lastSentBytes;
+        if (chunksInInterval > 0U)
+        {
+            throughputData.m_sampleSize = bytesInInterval / chunksInInterval;
+        }
+
+        // the rates require a previous topic as reference
+        if (publisherInfo.lastThroughputUpdate.has_value())
+        {
+            const auto interval = now - publisherInfo.lastThroughputUpdate.value();
+            const auto intervalInSeconds = std::chrono::duration<double>(interval).count();
+            if (intervalInSeconds > 0.0)
+            {
+                throughputData.m_chunksPerMinute = static_cast<double>(chunksInInterval) * 60.0 / intervalInSeconds;
+                throughputData.m_bytesPerSecond = static_cast<double>(bytesInInterval) / intervalInSeconds;
+            }
+            if (chunksInInterval > 0U)
+            {
+                throughputData.m_lastSendIntervalInNanoseconds =
+                    static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count())
+                    / chunksInInterval;
+            }
+        }
+
+        publisherInfo.lastSentChunks = sentChunks;
+        publisherInfo.lastSentBytes = sentBytes;
+        publisherInfo.lastThroughputUpdate.emplace(now);
+        topic.m_throughputList.emplace_back(throughputData);
+    }
 }
 
 template <typename PublisherPort, typename SubscriberPort>
@@ -617,8 +673,14 @@ inline void PortIntrospection<PublisherPort, SubscriberPort>::PortData::prepareT
                     SubscriberPort port(subscriberInfo.portData);
                     subscriberData.subscriptionState = port.getSubscriptionState();
 
-                    // subscriberData.fifoCapacity = port .getDeliveryFiFoCapacity();
-                    // subscriberData.fifoSize = port.getDeliveryFiFoSize();
+                    auto& queueData = subscriberInfo.portData->m_chunkReceiverData;
+                    popo::ChunkQueuePopper<typename std::remove_reference_t<decltype(queueData)>::ChunkQueueData_t>
+                        queue(&queueData);
+                    subscriberData.fifoCapacity = queue.getCurrentCapacity();
+                    subscriberData.fifoSize = queue.size();
+                    subscriberData.lostChunks = queueData.m_statistics.m_lostChunks.load(std::memory_order_relaxed);
+                    subscriberData.maxQueueDepth =
+                        queueData.m_statistics.m_maxQueueDepth.load(std::memory_order_relaxed);
                     subscriberData.propagationScope = port.getCaProServiceDescription().getScope();
                 }
                 else
@@ -650,6 +712,11 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool
 PortIntrospection<PublisherPort, SubscriberPort>::addPublisher(typename PublisherPort::MemberType_t& port) noexcept
 {
+    // disabled introspection does not track the ports and therefore does not take the lock of the port data
+    if (!isEnabled())
+    {
+        return false;
+    }
     return m_portData.addPublisher(port);
 }
 
@@ -657,18 +724,38 @@ template <typename PublisherPort, typename SubscriberPort>
 inline bool
 PortIntrospection<PublisherPort, SubscriberPort>::addSubscriber(typename SubscriberPort::MemberType_t& port) noexcept
 {
+    // disabled introspection does not track the ports and therefore does not take the lock of the port data
+    if (!isEnabled())
+    {
+        return false;
+    }
+    // the maximum queue depth is only published with the full introspection level
+    if (m_detailLevel == IntrospectionLevel::FULL)
+    {
+        port.m_chunkReceiverData.m_statistics.m_isMaxQueueDepthTracked.store(true, std::memory_order_relaxed);
+    }
     return m_portData.addSubscriber(port);
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::removePublisher(const PublisherPort& port) noexcept
 {
+    // disabled introspection does not track the ports and therefore does not take the lock of the port data
+    if (!isEnabled())
+    {
+        return false;
+    }
     return m_portData.removePublisher(port);
 }
 
 template <typename PublisherPort, typename SubscriberPort>
 inline bool PortIntrospection<PublisherPort, SubscriberPort>::removeSubscriber(const SubscriberPort& port) noexcept
 {
+    // disabled introspection does not track the ports and therefore does not take the lock of the port data
+    if (!isEnabled())
+    {
+        return false;
+    }
     return m_portData.removeSubscriber(port);
 }
 
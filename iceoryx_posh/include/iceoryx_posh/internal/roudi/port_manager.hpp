@@ -54,7 +54,12 @@ class PortManager
 {
   public:
     using PortConfigInfo = iox::runtime::PortConfigInfo;
-    PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept;
+    /// @param[in] roudiMemoryInterface provides the port pool and the memory managers for discovery and introspection
+    /// @param[in] portIntrospectionConfig the level of detail and the interval of the port introspection; with
+    /// IntrospectionLevel::OFF the introspection ports are not created and the ports are not reported
+    PortManager(RouDiMemoryInterface* roudiMemoryInterface,
+                const config::IntrospectionCategoryConfig& portIntrospectionConfig =
+                    config::IntrospectionCategoryConfig()) noexcept;
 
     virtual ~PortManager() noexcept = default;
 
@@ -122,8 +127,19 @@ class PortManager
     /// @brief Used to unblock potential locks in the shutdown phase of RouDi
     void unblockRouDiShutdown() noexcept;
 
+    /// @brief Destroys all ports and condition variables of a process immediately
+    /// @param [in] runtimeName of the process whose ports shall be destroyed
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Marks all ports and condition variables of a process to be destroyed; the actual teardown is done by
+    /// 'doDiscovery' with at most MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN destroyed ports per run
+    /// @param [in] runtimeName of the process whose ports shall be destroyed
+    void scheduleDeletionOfPortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
+
+    /// @brief Indicates whether the last 'doDiscovery' run left ports which are marked to be destroyed
+    /// @return true if another discovery run is required to finish the port teardown
+    bool hasPendingPortTeardowns() const noexcept;
+
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
@@ -157,6 +173,10 @@ class PortManager
 
     void handleConditionVariables() noexcept;
 
+    /// @brief Takes one port teardown from the budget of the current discovery run
+    /// @return true if the port can be destroyed in this run, false if the teardown has to be deferred
+    bool tryAcquirePortTeardown() noexcept;
+
     bool isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                             const SubscriberPortType& subscriber) const noexcept;
 
@@ -201,6 +221,8 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    uint64_t m_remainingPortTeardowns{MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN};
+    bool m_hasPendingPortTeardowns{false};
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
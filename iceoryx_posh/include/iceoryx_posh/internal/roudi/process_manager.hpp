@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/roudi/introspection/process_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
@@ -146,10 +147,22 @@ class ProcessManager : public ProcessManagerInterface
 
     void addConditionVariableForProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Sets the process introspection which is informed about registered and removed processes; without it the
+    /// processes are not reported
+    /// @param[in] processIntrospection the process introspection of RouDi
     void initIntrospection(ProcessIntrospectionType* processIntrospection) noexcept;
 
+    /// @brief Sets the monitor which detects the termination of monitored processes immediately; without it or when
+    /// the platform lacks support, crashed processes are only detected by the heartbeat timeout
+    /// @param[in] processTerminationMonitor must outlive the ProcessManager
+    void initProcessTerminationMonitor(ProcessTerminationMonitor* processTerminationMonitor) noexcept;
+
     void run() noexcept;
 
+    /// @brief Indicates whether the ports of removed processes are not yet completely destroyed
+    /// @return true if the discovery has to run again soon to finish the port teardown
+    bool hasPendingPortTeardowns() const noexcept;
+
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
@@ -229,6 +242,7 @@ class ProcessManager : public ProcessManagerInterface
     segment_id_underlying_t m_mgmtSegmentId{UntypedRelativePointer::NULL_POINTER_ID};
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
+    ProcessTerminationMonitor* m_processTerminationMonitor{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
     HeartbeatPool* m_heartbeatPool;
 };
@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#ifndef IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+#define IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/function.hpp"
+#include "iox/vector.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief Detects the termination of processes as soon as it happens by waiting on process file descriptors, see
+/// pidfd_open(2), in a background thread. This complements the heartbeat based monitoring which detects a crashed
+/// process only after 'PROCESS_KEEP_ALIVE_TIMEOUT'.
+/// @note On platforms without process file descriptors 'add' fails and the heartbeat remains the only mechanism
+class ProcessTerminationMonitor
+{
+  public:
+    using TerminationCallback = function<void()>;
+
+    /// @brief Starts the background thread
+    /// @param[in] onTermination is called from the background thread whenever the termination of at least one
+    /// monitored process was detected; must be thread-safe and must not block
+    explicit ProcessTerminationMonitor(const TerminationCallback& onTermination) noexcept;
+
+    /// @brief Stops the background thread and closes all process file descriptors
+    ~ProcessTerminationMonitor() noexcept;
+
+    ProcessTerminationMonitor(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor(ProcessTerminationMonitor&&) = delete;
+    ProcessTerminationMonitor& operator=(const ProcessTerminationMonitor&) = delete;
+    ProcessTerminationMonitor& operator=(ProcessTerminationMonitor&&) = delete;
+
+    /// @brief Checks whether the platform supports process file descriptors
+    static bool isSupported() noexcept;
+
+    /// @brief Starts monitoring the process with the given pid
+    /// @param[in] pid of the process to monitor
+    /// @return true if the process is monitored, false if process file descriptors are not supported, the process
+    /// does not exist anymore or the maximum number of monitored processes is reached
+    bool add(const uint32_t pid) noexcept;
+
+    /// @brief Stops monitoring the process with the given pid
+    /// @param[in] pid of the process
+    void remove(const uint32_t pid) noexcept;
+
+    /// @brief Checks whether the termination of a monitored process was detected
+    /// @param[in] pid of the process
+    /// @return true if the process is monitored and terminated, false otherwise
+    bool hasTerminated(const uint32_t pid) const noexcept;
+
+    /// @brief Stops the background thread; the termination callback is not called anymore afterwards
+    void stop() noexcept;
+
+  private:
+    struct MonitoredProcess
+    {
+        uint32_t pid{0U};
+        int32_t pidfd{-1};
+        bool hasTerminated{false};
+        bool isRemoved{false};
+    };
+
+    void run() noexcept;
+    void closeRemovedProcesses() noexcept;
+
+  private:
+    mutable std::mutex m_mutex;
+    vector<MonitoredProcess, MAX_PROCESS_NUMBER> m_processes;
+    TerminationCallback m_onTermination;
+    std::atomic_bool m_keepRunning{true};
+    std::thread m_thread;
+};
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_PROCESS_TERMINATION_MONITOR_HPP
@@ -21,6 +21,7 @@
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
 #include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
@@ -110,6 +111,10 @@ class RouDi
     popo::UserTrigger m_discoveryLoopTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
+    /// @note triggers an additional run of the discovery loop without signalling the discovery finished semaphore
+    popo::UserTrigger m_processTerminationTrigger;
+    optional<ProcessTerminationMonitor> m_processTerminationMonitor;
+
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
 
   protected:
@@ -132,7 +137,8 @@ class RouDi
 
   protected:
     ProcessIntrospectionType m_processIntrospection;
-    MemPoolIntrospectionType m_mempoolIntrospection;
+    /// @note only created when the mempool introspection is not disabled by the config
+    optional<MemPoolIntrospectionType> m_mempoolIntrospection;
 };
 
 } // namespace roudi
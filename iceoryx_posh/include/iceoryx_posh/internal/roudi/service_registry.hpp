@@ -19,12 +19,14 @@
 
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
 #include "iox/function_ref.hpp"
 #include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 
+#include <array>
 #include <cstdint>
 #include <utility>
 
@@ -106,8 +108,18 @@ class ServiceRegistry
 
     static constexpr uint32_t NO_INDEX = CAPACITY;
 
+    /// @brief the capacity of the hash index is a power of two which keeps the load factor at or below 0.5
+    static constexpr uint32_t HASH_INDEX_CAPACITY = nextPowerOfTwo(2U * CAPACITY);
+    static constexpr uint32_t HASH_INDEX_MASK = HASH_INDEX_CAPACITY - 1U;
+    /// @brief marks an unused slot of the hash index, the used slots store the entry index plus one
+    static constexpr uint32_t EMPTY_SLOT = 0U;
+
     ServiceDescriptionContainer_t m_serviceDescriptions;
 
+    // open addressing with linear probing, keyed by the precomputed hash of the service description; the registry is
+    // copied into shared memory for the service discovery, therefore the index is a plain array
+    std::array<uint32_t, HASH_INDEX_CAPACITY> m_hashIndex{};
+
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
@@ -117,6 +129,10 @@ class ServiceRegistry
 
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
+    void addToHashIndex(const uint32_t index) noexcept;
+    void removeFromHashIndex(const uint32_t index) noexcept;
+    void removeEntry(const uint32_t index) noexcept;
+    uint32_t hashIndexSlot(const uint32_t index) const noexcept;
 
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
@@ -29,6 +29,18 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Placement of the 'ChunkManagement' which holds the reference counter of a chunk
+enum class ChunkManagementLayout : uint8_t
+{
+    /// @brief the 'ChunkManagement' is taken from a separate pool in the management memory
+    SEPARATE_POOL,
+    /// @brief the 'ChunkManagement' is placed in a prefix of the chunk in front of the 'ChunkHeader'; this saves the
+    /// free list operations of the separate pool and keeps the reference counter close to the 'ChunkHeader'
+    /// @attention requires write access of all readers to the chunk memory and is therefore only applied to segments
+    /// where the reader group equals the writer group
+    CO_LOCATED,
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +58,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    ChunkManagementLayout m_chunkManagementLayout{ChunkManagementLayout::SEPARATE_POOL};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
@@ -41,6 +41,11 @@ struct SegmentConfig
             , m_memoryInfo(memoryInfo)
 
         {
+            // readers without write access cannot update a reference counter which resides in the chunk memory
+            if (!(m_readerGroup == m_writerGroup))
+            {
+                m_mempoolConfig.m_chunkManagementLayout = ChunkManagementLayout::SEPARATE_POOL;
+            }
         }
 
         PosixGroup::groupName_t m_readerGroup;
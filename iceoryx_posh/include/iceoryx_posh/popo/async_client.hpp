@@ -0,0 +1,197 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_ASYNC_CLIENT_HPP
+#define IOX_POSH_POPO_ASYNC_CLIENT_HPP
+
+#include "iceoryx_posh/popo/client.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/user_trigger.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/expected.hpp"
+#include "iox/function.hpp"
+#include "iox/log/logstream.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace iox
+{
+namespace popo
+{
+enum class AsyncRequestError : uint8_t
+{
+    TOO_MANY_REQUESTS_IN_FLIGHT,
+    SEND_FAILED,
+    TIMEOUT,
+    CANCELLED,
+};
+
+/// @brief Converts the AsyncRequestError to a string literal
+/// @param[in] value to convert to a string literal
+/// @return pointer to a string literal
+inline constexpr const char* asStringLiteral(const AsyncRequestError value) noexcept;
+
+/// @brief Convenience stream operator to easily use the 'asStringLiteral' function with iox::log::LogStream
+/// @param[in] stream sink to write the message to
+/// @param[in] value to convert to a string literal
+/// @return the reference to 'stream' which was provided as input parameter
+inline log::LogStream& operator<<(log::LogStream& stream, AsyncRequestError value) noexcept;
+
+/// @brief The AsyncClient wraps a 'Client' and correlates the received responses with the requests in flight. Each
+/// request gets a unique sequence id and a completion callback which is called exactly once, either with the matching
+/// response, with AsyncRequestError::TIMEOUT when the deadline of the request expired or with
+/// AsyncRequestError::CANCELLED.
+/// @details The responses are dispatched with 'processResponses', either called by the user, e.g. after a
+/// 'WaitSet::timedWait' with 'timeUntilNextDeadline', or by a 'Listener' the AsyncClient is attached to. Expired
+/// requests are detected on each dispatch and with 'expireRequests'; when attached to a Listener, they are also
+/// expired when no response arrives at all. Responses with an unknown sequence id, e.g. when the request already timed
+/// out, are released silently.
+/// @note The callbacks are called without holding any lock, therefore new requests can be sent from within a callback.
+/// Calling 'processResponses', 'expireRequests' or 'cancelAll' from within a callback is not allowed.
+/// @note Requests still in flight when the AsyncClient is destroyed are dropped without calling their callbacks; use
+/// 'cancelAll' beforehand if they must be notified
+/// @tparam Req type of request data
+/// @tparam Res type of response data
+/// @tparam InFlightCapacity maximum number of requests which are awaiting a response in parallel
+template <typename Req, typename Res, uint64_t InFlightCapacity = MAX_RESPONSE_QUEUE_CAPACITY>
+class AsyncClient
+{
+  public:
+    using CompletionCallback = function<void(expected<Response<const Res>, AsyncRequestError>&&)>;
+    using Task = function<void()>;
+    using Executor = function<void(const Task&)>;
+
+    /// @brief Constructor for an async client
+    /// @param[in] service is the ServiceDescription for the underlying client
+    /// @param[in] clientOptions like the queue capacity and queue full policy of the underlying client
+    explicit AsyncClient(const capro::ServiceDescription& service, const ClientOptions& clientOptions = {}) noexcept;
+    ~AsyncClient() noexcept;
+
+    AsyncClient(const AsyncClient&) = delete;
+    AsyncClient(AsyncClient&&) = delete;
+    AsyncClient& operator=(const AsyncClient&) = delete;
+    AsyncClient& operator=(AsyncClient&&) = delete;
+
+    /// @brief Get a Request from loaned shared memory and construct the data with the given arguments.
+    /// @param[in] args Arguments used to construct the data.
+    /// @return An instance of the Request that resides in shared memory or an error if unable to allocate memory to
+    /// loan.
+    template <typename... Args>
+    expected<Request<Req>, AllocationError> loan(Args&&... args) noexcept;
+
+    /// @brief Assigns the next sequence id to the Request, registers it as in flight and sends it
+    /// @param[in] request to send
+    /// @param[in] timeout after which the callback is called with AsyncRequestError::TIMEOUT if no response arrived
+    /// @param[in] callback which is called exactly once on completion of the request
+    /// @return the sequence id assigned to the request or an error if the request could not be sent; the callback
+    /// is not called in the error case unless the deadline already expired concurrently
+    expected<int64_t, AsyncRequestError>
+    send(Request<Req>&& request, const units::Duration timeout, const CompletionCallback& callback) noexcept;
+
+    /// @brief Takes all available responses, calls the callbacks of the matching requests and expires the requests
+    /// whose deadline passed
+    /// @return the number of completed requests, including the expired ones
+    uint64_t processResponses() noexcept;
+
+    /// @brief Calls the callbacks of all requests whose deadline passed with AsyncRequestError::TIMEOUT
+    /// @return the number of expired requests
+    uint64_t expireRequests() noexcept;
+
+    /// @brief Calls the callbacks of all requests in flight with AsyncRequestError::CANCELLED
+    /// @return the number of cancelled requests
+    uint64_t cancelAll() noexcept;
+
+    /// @brief Returns the number of requests which are awaiting a response
+    uint64_t numberOfRequestsInFlight() const noexcept;
+
+    /// @brief Returns the time until the earliest deadline of the requests in flight passes
+    /// @return the remaining time, zero if a deadline already passed or nullopt if no request is in flight
+    optional<units::Duration> timeUntilNextDeadline() const noexcept;
+
+    /// @brief Attaches the AsyncClient to a Listener which dispatches the responses whenever they arrive and expires
+    /// the requests when their deadline passes. A background thread waits for the next deadline and wakes up the
+    /// Listener, therefore requests also expire when the server never responds.
+    /// @param[in] listener to attach to; the AsyncClient must be detached or destroyed before the listener
+    /// @param[in] executor optional executor which runs the dispatch and expire tasks; without an executor the
+    /// callbacks are called on the Listener thread. The AsyncClient must outlive all posted tasks.
+    /// @return an error if the Listener could not attach the underlying client or the deadline trigger, or
+    /// ListenerError::EVENT_ALREADY_ATTACHED if the AsyncClient is already attached to a Listener
+    /// @note The AsyncClient occupies two events of the Listener. The executor can only be set while the AsyncClient
+    /// is not attached.
+    expected<void, ListenerError> attachToListener(Listener& listener,
+                                                   const optional<Executor>& executor = nullopt) noexcept;
+
+    /// @brief Detaches the AsyncClient from the Listener and stops the deadline watcher
+    /// @param[in] listener to detach from
+    void detachFromListener(Listener& listener) noexcept;
+
+    /// @brief Get current connection state of the underlying client
+    ConnectionState getConnectionState() const noexcept;
+
+    /// @brief Returns the service description of the underlying client
+    const capro::ServiceDescription& getServiceDescription() const noexcept;
+
+  private:
+    struct InFlightRequest
+    {
+        InFlightRequest(const int64_t sequenceId,
+                        const units::Duration timeout,
+                        const CompletionCallback& callback) noexcept;
+
+        int64_t sequenceId;
+        deadline_timer deadline;
+        CompletionCallback callback;
+    };
+
+    static void onResponseReceived(Client<Req, Res>* const client, AsyncClient* const self) noexcept;
+    static void onDeadlineReached(UserTrigger* const trigger, AsyncClient* const self) noexcept;
+
+    void runOrPost(Task&& task) noexcept;
+    void watchDeadlines() noexcept;
+    void notifyDeadlineWatcher() noexcept;
+    void stopDeadlineWatcher() noexcept;
+
+  private:
+    mutable std::mutex m_inFlightMutex;
+    vector<InFlightRequest, InFlightCapacity> m_inFlightRequests;
+    int64_t m_nextSequenceId{0};
+
+    std::mutex m_processingMutex;
+    // only written while not attached to a Listener, therefore the Listener thread reads it without a lock
+    optional<Executor> m_executor;
+    bool m_isAttached{false};
+
+    std::mutex m_watcherMutex;
+    std::condition_variable m_watcherCondition;
+    bool m_deadlinesChanged{false};
+    bool m_stopWatcher{false};
+    std::thread m_deadlineWatcher;
+    UserTrigger m_deadlineTrigger;
+
+    // declared last to be destroyed first; this detaches the client from a Listener before the in-flight table is
+    // gone
+    Client<Req, Res> m_client;
+};
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/async_client.inl"
+
+#endif // IOX_POSH_POPO_ASYNC_CLIENT_HPP
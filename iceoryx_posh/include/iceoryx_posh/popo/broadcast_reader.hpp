@@ -0,0 +1,145 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BROADCAST_READER_HPP
+#define IOX_POSH_POPO_BROADCAST_READER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/popo/enum_trigger_type.hpp"
+#include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class BroadcastReaderError : uint8_t
+{
+    NO_DATA_AVAILABLE,
+    BUFFER_TOO_SMALL,
+    MESSAGE_SIZE_MISMATCH,
+};
+
+enum class BroadcastReaderEvent : EventEnumIdentifier
+{
+    DATA_RECEIVED
+};
+
+enum class BroadcastReaderState : StateEnumIdentifier
+{
+    HAS_DATA
+};
+
+/// @brief The BroadcastReader receives the small messages of a BroadcastWriter by copying them out of the ring of the
+/// writer in shared memory.
+/// @details The reader subscribes to the service with a regular subscriber port which receives the chunk with the ring
+/// once and holds it afterwards; when the writer is replaced, the reader switches to the ring of the new writer. The
+/// reader starts with the oldest message which is still stored in the ring when it receives the ring. It can be
+/// attached to a WaitSet or Listener like a subscriber.
+/// @note The reader holds one chunk as long as it is connected to a writer
+class BroadcastReader
+{
+  public:
+    /// @brief creates a reader and subscribes to the service
+    /// @param[in] service of the writer
+    explicit BroadcastReader(const capro::ServiceDescription& service) noexcept;
+    ~BroadcastReader() noexcept;
+
+    BroadcastReader(const BroadcastReader&) = delete;
+    BroadcastReader(BroadcastReader&&) = delete;
+    BroadcastReader& operator=(const BroadcastReader&) = delete;
+    BroadcastReader& operator=(BroadcastReader&&) = delete;
+
+    /// @brief copies the next message into the buffer
+    /// @param[in] buffer to copy the message to
+    /// @param[in] bufferSize size of the buffer in bytes
+    /// @return the size of the message, BroadcastReaderError::NO_DATA_AVAILABLE or
+    /// BroadcastReaderError::BUFFER_TOO_SMALL; in the latter case the message is not consumed
+    expected<uint64_t, BroadcastReaderError> take(void* const buffer, const uint64_t bufferSize) noexcept;
+
+    /// @brief copies the next message into a trivially copyable type
+    /// @return the message, BroadcastReaderError::NO_DATA_AVAILABLE or BroadcastReaderError::MESSAGE_SIZE_MISMATCH
+    /// if the message has not the size of the type; the mismatching message is consumed
+    template <typename T>
+    expected<T, BroadcastReaderError> take() noexcept;
+
+    /// @brief checks if a message is available
+    bool hasData() const noexcept;
+
+    /// @brief checks if messages were overwritten before they could be read since the last call of this method
+    bool hasMissedData() noexcept;
+
+    /// @brief the service the reader subscribes to
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    /// @brief the current subscription state of the reader
+    SubscribeState getSubscriptionState() const noexcept;
+
+    friend class NotificationAttorney;
+
+  private:
+    /// @brief switches to the newest ring which was received from a writer, if any
+    void updateRing() noexcept;
+
+    void releaseRing() noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Invalidates the internal triggerHandle.
+    /// @param[in] uniqueTriggerId the id of the corresponding trigger
+    void invalidateTrigger(const uint64_t uniqueTriggerId) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] readerState the state which should be attached
+    void enableState(TriggerHandle&& triggerHandle, const BroadcastReaderState readerState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Returns method pointer to the event corresponding
+    /// hasTriggered method callback
+    /// @param[in] readerState the state to which the hasTriggeredCallback is required
+    WaitSetIsConditionSatisfiedCallback
+    getCallbackForIsStateConditionSatisfied(const BroadcastReaderState readerState) const noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] readerState the state which should be detached
+    void disableState(const BroadcastReaderState readerState) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
+    /// @param[in] triggerHandle rvalue reference to the triggerHandle. This class takes the ownership of that handle.
+    /// @param[in] readerEvent the event which should be attached
+    void enableEvent(TriggerHandle&& triggerHandle, const BroadcastReaderEvent readerEvent) noexcept;
+
+    /// @brief Only usable by the WaitSet, not for public use. Resets the internal triggerHandle
+    /// @param[in] readerEvent the event which should be detached
+    void disableEvent(const BroadcastReaderEvent readerEvent) noexcept;
+
+  private:
+    SubscriberPortUserType m_port;
+    const mepoo::ChunkHeader* m_ringChunk{nullptr};
+    const BroadcastRing* m_ring{nullptr};
+    uint64_t m_readIndex{0U};
+    bool m_hasMissedData{false};
+    TriggerHandle m_trigger;
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/broadcast_reader.inl"
+
+#endif // IOX_POSH_POPO_BROADCAST_READER_HPP
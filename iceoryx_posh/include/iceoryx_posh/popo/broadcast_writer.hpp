@@ -0,0 +1,99 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_BROADCAST_WRITER_HPP
+#define IOX_POSH_POPO_BROADCAST_WRITER_HPP
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+enum class BroadcastWriterError : uint8_t
+{
+    RING_ALLOCATION_FAILED,
+    MESSAGE_TOO_LARGE,
+};
+
+/// @brief The BroadcastWriter sends small messages to any number of BroadcastReaders without chunks, reference
+/// counters or queues per reader; it is intended for tiny messages with a high rate like clock or ticker data.
+/// @details The writer loans a single chunk which contains a BroadcastRing with inline message slots and sends it once
+/// with a regular publisher port, i.e. the discovery, the matching with the readers and the cleanup are done by RouDi
+/// like for any other publisher. Afterwards each message is copied into the ring and the readers which are attached to
+/// a WaitSet or Listener are notified. A reader which is slower than the writer by more than the capacity of the ring
+/// loses the overwritten messages.
+/// @note A service must only be used by broadcast writers and readers; a regular subscriber would receive the ring as
+/// a single sample
+class BroadcastWriter
+{
+  public:
+    static constexpr uint64_t DEFAULT_CAPACITY{64U};
+    static constexpr uint64_t MAX_CAPACITY{BroadcastRing::MAX_CAPACITY};
+    static constexpr uint64_t MAX_MESSAGE_SIZE{BroadcastRing::MAX_MESSAGE_SIZE};
+
+    /// @brief creates a writer and offers the service
+    /// @param[in] service which is offered
+    /// @param[in] capacity of the ring in messages; it is clamped to the range 1..MAX_CAPACITY
+    BroadcastWriter(const capro::ServiceDescription& service, const uint64_t capacity = DEFAULT_CAPACITY) noexcept;
+    ~BroadcastWriter() noexcept;
+
+    BroadcastWriter(const BroadcastWriter&) = delete;
+    BroadcastWriter(BroadcastWriter&&) = delete;
+    BroadcastWriter& operator=(const BroadcastWriter&) = delete;
+    BroadcastWriter& operator=(BroadcastWriter&&) = delete;
+
+    /// @brief copies a message into the ring and notifies the readers
+    /// @param[in] message to copy
+    /// @param[in] size of the message in bytes; must not exceed MAX_MESSAGE_SIZE
+    /// @return BroadcastWriterError::MESSAGE_TOO_LARGE or BroadcastWriterError::RING_ALLOCATION_FAILED if the chunk
+    /// for the ring could not be loaned; the loan is retried with the next message
+    expected<void, BroadcastWriterError> write(const void* const message, const uint64_t size) noexcept;
+
+    /// @brief copies a trivially copyable message into the ring and notifies the readers
+    /// @param[in] message to copy
+    /// @return BroadcastWriterError::RING_ALLOCATION_FAILED if the chunk for the ring could not be loaned
+    template <typename T>
+    expected<void, BroadcastWriterError> write(const T& message) noexcept;
+
+    /// @brief the service the writer offers
+    capro::ServiceDescription getServiceDescription() const noexcept;
+
+    /// @brief checks whether readers are currently connected to the writer
+    bool hasReaders() const noexcept;
+
+    /// @brief the capacity of the ring in messages
+    uint64_t capacity() const noexcept;
+
+  private:
+    expected<BroadcastRing*, BroadcastWriterError> ring() noexcept;
+
+  private:
+    PublisherPortUserType m_port;
+    uint64_t m_capacity{DEFAULT_CAPACITY};
+    BroadcastRing* m_ring{nullptr};
+};
+
+} // namespace popo
+} // namespace iox
+
+#include "iceoryx_posh/internal/popo/broadcast_writer.inl"
+
+#endif // IOX_POSH_POPO_BROADCAST_WRITER_HPP
@@ -50,11 +50,23 @@ struct ClientOptions
     /// @note Corresponds with ServerOptions::requestQueueFullPolicy
     ConsumerTooSlowPolicy serverTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The policy to select the server a request is delivered to when multiple servers offer the service
+    /// @note Only servers with ServerOptions::allowMultipleServers can offer the same service simultaneously
+    LoadBalancingPolicy loadBalancingPolicy{LoadBalancingPolicy::ROUND_ROBIN};
+
     /// @brief serialization of the ClientOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the ClientOptions
     static expected<ClientOptions, Serialization::Error> deserialize(const Serialization& serialized) noexcept;
 
+    /// @brief compact binary serialization of the ClientOptions which is used for the communication with RouDi
+    using BinarySerialization_t =
+        BinarySerializationFor<uint64_t, NodeName_t, bool, QueueFullPolicy, ConsumerTooSlowPolicy, LoadBalancingPolicy>;
+    /// @brief binary serialization of the ClientOptions
+    BinarySerialization_t serializeBinary() const noexcept;
+    /// @brief deserialization of the binary serialized ClientOptions
+    static expected<ClientOptions, Serialization::Error> deserialize(const BinarySerialization_t& serialized) noexcept;
+
     /// @brief comparison operator
     /// @param[in] rhs the right hand side of the comparison
     bool operator==(const ClientOptions& rhs) const noexcept;
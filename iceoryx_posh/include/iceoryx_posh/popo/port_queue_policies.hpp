@@ -41,6 +41,17 @@ enum class QueueFullPolicy : uint8_t
     DISCARD_OLDEST_DATA
 };
 
+/// @brief Used by clients to select the server a request is delivered to when multiple servers offer the same service
+enum class LoadBalancingPolicy : uint8_t
+{
+    /// Delivers the requests to the connected servers in turn
+    ROUND_ROBIN,
+    /// Delivers the request to the server with the least requests waiting in its request queue
+    LEAST_OUTSTANDING_REQUESTS,
+    /// Delivers all requests with the same load balancing key to the same server
+    STICKY_BY_KEY
+};
+
 } // namespace popo
 } // namespace iox
 #endif // IOX_POSH_POPO_PORT_QUEUE_POLICIES_HPP
@@ -49,6 +49,14 @@ struct PublisherOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the PublisherOptions
     static expected<PublisherOptions, Serialization::Error> deserialize(const Serialization& serialized) noexcept;
+
+    /// @brief compact binary serialization of the PublisherOptions which is used for the communication with RouDi
+    using BinarySerialization_t = BinarySerializationFor<uint64_t, NodeName_t, bool, ConsumerTooSlowPolicy>;
+    /// @brief binary serialization of the PublisherOptions
+    BinarySerialization_t serializeBinary() const noexcept;
+    /// @brief deserialization of the binary serialized PublisherOptions
+    static expected<PublisherOptions, Serialization::Error>
+    deserialize(const BinarySerialization_t& serialized) noexcept;
 };
 
 } // namespace popo
@@ -50,11 +50,24 @@ struct ServerOptions
     /// @note Corresponds with ClientOptions::responseQueueFullPolicy
     ConsumerTooSlowPolicy clientTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The option whether further servers are allowed to offer the same service; the requests are distributed
+    /// among the servers according to the ClientOptions::loadBalancingPolicy
+    /// @note All servers of the service must set this option, otherwise the creation of the server port fails
+    bool allowMultipleServers{false};
+
     /// @brief serialization of the ServerOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the ServerOptions
     static expected<ServerOptions, Serialization::Error> deserialize(const Serialization& serialized) noexcept;
 
+    /// @brief compact binary serialization of the ServerOptions which is used for the communication with RouDi
+    using BinarySerialization_t =
+        BinarySerializationFor<uint64_t, NodeName_t, bool, QueueFullPolicy, ConsumerTooSlowPolicy, bool>;
+    /// @brief binary serialization of the ServerOptions
+    BinarySerialization_t serializeBinary() const noexcept;
+    /// @brief deserialization of the binary serialized ServerOptions
+    static expected<ServerOptions, Serialization::Error> deserialize(const BinarySerialization_t& serialized) noexcept;
+
     /// @brief comparison operator
     /// @param[in] rhs the right hand side of the comparison
     bool operator==(const ServerOptions& rhs) const noexcept;
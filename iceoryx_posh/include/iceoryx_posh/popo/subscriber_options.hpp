@@ -52,10 +52,26 @@ struct SubscriberOptions
     ///        i.e. require historyCapacity > 0 to be eligible to be connected
     bool requiresPublisherHistorySupport{false};
 
+    /// @brief The option whether the subscriber reads only the latest sample of the publisher instead of queuing the
+    ///        samples. In this mode the publisher stores each sample in a single slot which is shared by all latest
+    ///        value subscribers, i.e. the queueCapacity and queueFullPolicy are not used. If the subscriber is
+    ///        connected to multiple publishers, it reads the sample of the publisher which published last. The
+    ///        subscriber can be connected to at most ChunkQueueData::MAX_LATEST_VALUE_SOURCES publishers.
+    bool latestValueMode{false};
+
     /// @brief serialization of the SubscriberOptions
     Serialization serialize() const noexcept;
     /// @brief deserialization of the SubscriberOptions
     static expected<SubscriberOptions, Serialization::Error> deserialize(const Serialization& serialized) noexcept;
+
+    /// @brief compact binary serialization of the SubscriberOptions which is used for the communication with RouDi
+    using BinarySerialization_t =
+        BinarySerializationFor<uint64_t, uint64_t, NodeName_t, bool, QueueFullPolicy, bool, bool>;
+    /// @brief binary serialization of the SubscriberOptions
+    BinarySerialization_t serializeBinary() const noexcept;
+    /// @brief deserialization of the binary serialized SubscriberOptions
+    static expected<SubscriberOptions, Serialization::Error>
+    deserialize(const BinarySerialization_t& serialized) noexcept;
 };
 
 } // namespace popo
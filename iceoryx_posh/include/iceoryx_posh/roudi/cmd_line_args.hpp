@@ -27,11 +27,21 @@ namespace iox
 {
 namespace config
 {
+/// @brief Tracks which introspection categories were set on the command line; these take precedence over the
+/// config file
+struct IntrospectionCmdLineOverrides_t
+{
+    bool mempool{false};
+    bool process{false};
+    bool port{false};
+};
+
 struct CmdLineArgs_t
 {
     bool run{true};
     RouDiConfig roudiConfig;
     roudi::ConfigFilePathString_t configFilePath;
+    IntrospectionCmdLineOverrides_t introspectionOverrides;
 };
 
 inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const CmdLineArgs_t& cmdLineArgs) noexcept
@@ -44,6 +54,13 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
               << static_cast<roudi::UniqueRouDiId::value_type>(cmdLineArgs.roudiConfig.uniqueRouDiId) << "\n";
     logstream << "Process termination delay: " << cmdLineArgs.roudiConfig.processTerminationDelay.toSeconds() << " s\n";
     logstream << "Process kill delay: " << cmdLineArgs.roudiConfig.processKillDelay.toSeconds() << " s\n";
+    const auto& introspection = cmdLineArgs.roudiConfig.introspection;
+    logstream << "MemPool introspection: " << introspection.mempool.level << " every "
+              << introspection.mempool.interval.toMilliseconds() << " ms\n";
+    logstream << "Process introspection: " << introspection.process.level << " every "
+              << introspection.process.interval.toMilliseconds() << " ms\n";
+    logstream << "Port introspection: " << introspection.port.level << " every "
+              << introspection.port.interval.toMilliseconds() << " ms\n";
     if (!cmdLineArgs.configFilePath.empty())
     {
         logstream << "Config file used is: " << cmdLineArgs.configFilePath;
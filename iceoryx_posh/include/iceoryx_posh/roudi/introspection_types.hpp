@@ -91,14 +91,24 @@ struct PortIntrospectionFieldTopic
 const capro::ServiceDescription
     IntrospectionPortThroughputService(INTROSPECTION_SERVICE_ID, "RouDi_ID", "PortThroughput");
 
+/// @brief throughput of a publisher port; the rates refer to the interval since the previous throughput topic
 struct PortThroughputData
 {
     uint64_t m_publisherPortID{0};
+    /// @brief average user-payload size of the chunks sent in the interval
     uint64_t m_sampleSize{0};
     uint64_t m_chunkSize{0};
     double m_chunksPerMinute{0};
+    /// @brief average interval between two chunks sent in the interval
     uint64_t m_lastSendIntervalInNanoseconds{0};
     bool m_isField{false};
+    double m_bytesPerSecond{0};
+    /// @brief number of chunks sent since the creation of the port
+    uint64_t m_sentChunks{0};
+    /// @brief sum of the user-payload sizes of the chunks sent since the creation of the port
+    uint64_t m_sentBytes{0};
+    /// @brief number of failed chunk allocations since the creation of the port
+    uint64_t m_allocationFailures{0};
 };
 
 /// @brief the topic for the port throughput that a user can subscribe to
@@ -117,6 +127,10 @@ struct SubscriberPortChangingData
     uint64_t fifoCapacity{0};
     iox::SubscribeState subscriptionState{iox::SubscribeState::NOT_SUBSCRIBED};
     capro::Scope propagationScope{capro::Scope::INVALID};
+    // number of chunks the subscriber lost due to a full queue since the creation of the port
+    uint64_t lostChunks{0};
+    // highest number of chunks in the queue since the creation of the port
+    uint64_t maxQueueDepth{0};
 };
 
 struct SubscriberPortChangingIntrospectionFieldTopic
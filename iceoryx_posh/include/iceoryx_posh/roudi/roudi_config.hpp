@@ -18,6 +18,7 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
+#include "iox/optional.hpp"
 
 #include <cstdint>
 
@@ -25,6 +26,28 @@ namespace iox
 {
 namespace config
 {
+/// @brief The configuration of a single introspection category
+struct IntrospectionCategoryConfig
+{
+    /// @brief The level of detail which is collected and published
+    roudi::IntrospectionLevel level{roudi::IntrospectionLevel::FULL};
+    /// @brief The interval in which the data is published
+    units::Duration interval{roudi::DEFAULT_INTROSPECTION_INTERVAL};
+};
+
+/// @brief The configuration of the introspection categories offered by RouDi
+struct IntrospectionConfig
+{
+    IntrospectionCategoryConfig mempool;
+    IntrospectionCategoryConfig process;
+    IntrospectionCategoryConfig port;
+};
+
+/// @brief Converts the representation of an introspection level used on the command line and in the config file
+/// @param[in] value is one of 'off', 'basic' and 'full'
+/// @return the corresponding level or an empty optional if the value is unknown
+optional<roudi::IntrospectionLevel> introspectionLevelFromString(const char* value) noexcept;
+
 struct RouDiConfig
 {
     /// @brief The domain ID which is used to tie the iceoryx resources to when created in the file system
@@ -53,6 +76,9 @@ struct RouDiConfig
     /// @brief The number of memory chunks used per introspection topic
     uint32_t introspectionChunkCount{10};
 
+    /// @brief The level of detail and the publishing interval of the mempool, process and port introspection
+    IntrospectionConfig introspection;
+
     /// @brief the number of memory chunks used for discovery
     uint32_t discoveryChunkCount{10};
 
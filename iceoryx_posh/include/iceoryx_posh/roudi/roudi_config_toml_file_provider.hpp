@@ -37,6 +37,9 @@ class TomlRouDiConfigFileProvider : public iox::roudi::RouDiConfigFileProvider
 
     static iox::expected<iox::IceoryxConfig, iox::roudi::RouDiConfigFileParseError>
     parse(std::istream& stream) noexcept;
+
+  private:
+    IntrospectionCmdLineOverrides_t m_introspectionOverrides;
 };
 } // namespace config
 } // namespace iox
@@ -86,11 +86,37 @@ ServiceDescription::ServiceDescription(const IdString_t& service,
     , m_eventString{event}
     , m_classHash(classHash)
     , m_interfaceSource(interfaceSource)
+    , m_hash(computeHash(service, instance, event))
 {
 }
 
+uint64_t
+ServiceDescription::computeHash(const IdString_t& service, const IdString_t& instance, const IdString_t& event) noexcept
+{
+    // 64 bit FNV-1a; the terminating zero of each string is included to distinguish e.g. {"ab", "c"} from {"a", "bc"}
+    constexpr uint64_t FNV_OFFSET_BASIS{14695981039346656037ULL};
+    constexpr uint64_t FNV_PRIME{1099511628211ULL};
+
+    uint64_t hash{FNV_OFFSET_BASIS};
+    for (const auto* id : {&service, &instance, &event})
+    {
+        const char* characters = id->c_str();
+        for (uint64_t i = 0U; i <= id->size(); ++i)
+        {
+            hash ^= static_cast<uint8_t>(characters[i]);
+            hash *= FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
 bool ServiceDescription::operator==(const ServiceDescription& rhs) const noexcept
 {
+    if (m_hash != rhs.m_hash)
+    {
+        return false;
+    }
+
     if (m_serviceString != rhs.m_serviceString)
     {
         return false;
@@ -180,6 +206,8 @@ ServiceDescription::deserialize(const Serialization& serialized) noexcept
 
     deserializedObject.m_scope = static_cast<Scope>(scope);
     deserializedObject.m_interfaceSource = static_cast<Interfaces>(interfaceSource);
+    deserializedObject.m_hash = computeHash(
+        deserializedObject.m_serviceString, deserializedObject.m_instanceString, deserializedObject.m_eventString);
 
     return ok(deserializedObject);
 }
@@ -224,6 +252,11 @@ Interfaces ServiceDescription::getSourceInterface() const noexcept
     return m_interfaceSource;
 }
 
+uint64_t ServiceDescription::getHash() const noexcept
+{
+    return m_hash;
+}
+
 bool serviceMatch(const ServiceDescription& first, const ServiceDescription& second) noexcept
 {
     return (first.getServiceIDString() == second.getServiceIDString());
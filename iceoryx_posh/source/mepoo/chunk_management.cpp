@@ -25,15 +25,22 @@ namespace mepoo
 ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader,
                                  const not_null<MemPool*> mempool,
                                  const not_null<MemPool*> chunkManagementPool) noexcept
-    : m_chunkHeader(chunkHeader)
+    : m_chunkHeader(chunkHeader, segment_id_t{static_cast<MemPool*>(mempool)->getSegmentId()})
     , m_mempool(mempool)
     , m_chunkManagementPool(chunkManagementPool)
+    , m_segmentId(static_cast<MemPool*>(chunkManagementPool)->getSegmentId())
 {
     static_assert(alignof(ChunkManagement) <= mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT,
                   "The ChunkManagement must not exceed the alignment of the mempool chunks, which are aligned to "
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept
+    : m_chunkHeader(chunkHeader, segment_id_t{static_cast<MemPool*>(mempool)->getSegmentId()})
+    , m_mempool(mempool)
+    , m_segmentId(static_cast<MemPool*>(mempool)->getSegmentId())
+{
+}
 
 } // namespace mepoo
 } // namespace iox
@@ -162,6 +162,11 @@ uint64_t MemPool::getChunkSize() const noexcept
     return m_chunkSize;
 }
 
+segment_id_underlying_t MemPool::getSegmentId() const noexcept
+{
+    return m_rawMemory.getId();
+}
+
 uint32_t MemPool::getChunkCount() const noexcept
 {
     return m_numberOfChunks;
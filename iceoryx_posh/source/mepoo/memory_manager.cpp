@@ -32,8 +32,8 @@ void MemoryManager::printMemPoolVector(log::LogStream& log) const noexcept
 {
     for (auto& l_mempool : m_memPoolVector)
     {
-        log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize()
-            << ", ChunkPayloadSize = " << l_mempool.getChunkSize() - sizeof(ChunkHeader)
+        log << "  MemPool [ ChunkSize = " << l_mempool.getChunkSize() << ", ChunkPayloadSize = "
+            << l_mempool.getChunkSize() - sizeof(ChunkHeader) - chunkManagementPrefixSize(m_chunkManagementLayout)
             << ", ChunkCount = " << l_mempool.getChunkCount() << " ]";
     }
 }
@@ -43,7 +43,8 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
                                const greater_or_equal<uint64_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                                const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept
 {
-    uint64_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize));
+    uint64_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint64_t>(chunkPayloadSize))
+                                 + chunkManagementPrefixSize(m_chunkManagementLayout);
     if (m_denyAddMemPool)
     {
         IOX_LOG(FATAL, "After the generation of the chunk management pool you are not allowed to create new mempools.");
@@ -70,6 +71,10 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
 void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept
 {
     m_denyAddMemPool = true;
+    if (m_chunkManagementLayout == ChunkManagementLayout::CO_LOCATED)
+    {
+        return;
+    }
     uint64_t chunkSize = sizeof(ChunkManagement);
     m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
 }
@@ -93,6 +98,13 @@ uint64_t MemoryManager::sizeWithChunkHeaderStruct(const MaxChunkPayloadSize_t si
     return size + sizeof(ChunkHeader);
 }
 
+uint64_t MemoryManager::chunkManagementPrefixSize(const ChunkManagementLayout layout) noexcept
+{
+    return (layout == ChunkManagementLayout::CO_LOCATED)
+               ? align(sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT)
+               : 0U;
+}
+
 uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0};
@@ -101,9 +113,11 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
         // for the required chunk memory size only the size of the ChunkHeader
         // and the the chunk-payload size is taken into account;
         // the user has the option to further partition the chunk-payload with
-        // a user-header and therefore reduce the user-payload size
+        // a user-header and therefore reduce the user-payload size;
+        // a co-located ChunkManagement is placed in front of the ChunkHeader
         memorySize += align(static_cast<uint64_t>(mempoolConfig.m_chunkCount)
-                                * MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size),
+                                * (MemoryManager::sizeWithChunkHeaderStruct(mempoolConfig.m_size)
+                                   + chunkManagementPrefixSize(mePooConfig.m_chunkManagementLayout)),
                             MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
     return memorySize;
@@ -120,8 +134,12 @@ uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooCon
             align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
 
-    memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    if (mePooConfig.m_chunkManagementLayout == ChunkManagementLayout::SEPARATE_POOL)
+    {
+        memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize +=
+            align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    }
 
     return memorySize;
 }
@@ -135,6 +153,7 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
                                            BumpAllocator& managementAllocator,
                                            BumpAllocator& chunkMemoryAllocator) noexcept
 {
+    m_chunkManagementLayout = mePooConfig.m_chunkManagementLayout;
     for (auto entry : mePooConfig.m_mempoolConfig)
     {
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
@@ -147,7 +166,8 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
-    const auto requiredChunkSize = chunkSettings.requiredChunkSize();
+    const auto chunkManagementPrefix = chunkManagementPrefixSize(m_chunkManagementLayout);
+    const auto requiredChunkSize = chunkSettings.requiredChunkSize() + chunkManagementPrefix;
 
     uint64_t aquiredChunkSize = 0U;
 
@@ -199,6 +219,14 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     }
     else
     {
+        if (m_chunkManagementLayout == ChunkManagementLayout::CO_LOCATED)
+        {
+            auto chunkHeader = new (static_cast<uint8_t*>(chunk) + chunkManagementPrefix)
+                ChunkHeader(aquiredChunkSize - chunkManagementPrefix, chunkSettings);
+            auto chunkManagement = new (chunk) ChunkManagement(chunkHeader, memPoolPointer);
+            return ok(SharedChunk(chunkManagement));
+        }
+
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
         auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
             ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
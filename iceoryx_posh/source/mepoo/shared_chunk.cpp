@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iox/assertions.hpp"
 
 namespace iox
 {
@@ -60,8 +61,16 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
-    m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    if (m_chunkManagement->m_chunkManagementPool)
+    {
+        m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
+        m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    }
+    else
+    {
+        // a co-located ChunkManagement is at the start of the mempool chunk and released with it
+        m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement));
+    }
     m_chunkManagement = nullptr;
 }
 
@@ -143,5 +152,23 @@ ChunkManagement* SharedChunk::release() noexcept
     return returnValue;
 }
 
+void SharedChunk::acquireReferences(const uint64_t count) const noexcept
+{
+    if ((m_chunkManagement != nullptr) && (count > 0U))
+    {
+        m_chunkManagement->m_referenceCounter.fetch_add(count, std::memory_order_relaxed);
+    }
+}
+
+void SharedChunk::releaseReferences(const uint64_t count) const noexcept
+{
+    if ((m_chunkManagement != nullptr) && (count > 0U))
+    {
+        const auto previousReferenceCount =
+            m_chunkManagement->m_referenceCounter.fetch_sub(count, std::memory_order_relaxed);
+        IOX_ENFORCE(previousReferenceCount > count, "Released more references than were acquired");
+    }
+}
+
 } // namespace mepoo
 } // namespace iox
@@ -38,18 +38,33 @@ static_assert(std::is_trivially_copyable<ShmSafeUnmanagedChunk>::value,
               "works on half dead objects!");
 
 ShmSafeUnmanagedChunk::ShmSafeUnmanagedChunk(mepoo::SharedChunk chunk) noexcept
+    : m_chunkManagement(toRelativePointerData(chunk.release()))
+{
+}
+
+ShmSafeUnmanagedChunk ShmSafeUnmanagedChunk::fromAcquiredReference(const SharedChunk& chunk) noexcept
+{
+    ShmSafeUnmanagedChunk unmanagedChunk;
+    unmanagedChunk.m_chunkManagement = toRelativePointerData(chunk.m_chunkManagement);
+    return unmanagedChunk;
+}
+
+RelativePointerData ShmSafeUnmanagedChunk::toRelativePointerData(ChunkManagement* const chunkManagement) noexcept
 {
     // this is only necessary if it's not an empty chunk
-    if (chunk)
+    if (chunkManagement == nullptr)
     {
-        RelativePointer<mepoo::ChunkManagement> ptr{chunk.release()};
-        auto id = ptr.getId();
-        auto offset = ptr.getOffset();
-        IOX_ENFORCE(id <= RelativePointerData::ID_RANGE, "RelativePointer id must fit into id type!");
-        IOX_ENFORCE(offset <= RelativePointerData::OFFSET_RANGE, "RelativePointer offset must fit into offset type!");
-        /// @todo iox-#1196 Unify types to uint64_t
-        m_chunkManagement = RelativePointerData(static_cast<RelativePointerData::identifier_t>(id), offset);
+        return RelativePointerData();
     }
+
+    // the segment id is taken from the ChunkManagement instead of searching the segment which contains the pointer
+    RelativePointer<mepoo::ChunkManagement> ptr{chunkManagement, segment_id_t{chunkManagement->m_segmentId}};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    IOX_ENFORCE(id <= RelativePointerData::ID_RANGE, "RelativePointer id must fit into id type!");
+    IOX_ENFORCE(offset <= RelativePointerData::OFFSET_RANGE, "RelativePointer offset must fit into offset type!");
+    /// @todo iox-#1196 Unify types to uint64_t
+    return RelativePointerData(static_cast<RelativePointerData::identifier_t>(id), offset);
 }
 
 SharedChunk ShmSafeUnmanagedChunk::releaseToSharedChunk() noexcept
@@ -83,6 +98,27 @@ SharedChunk ShmSafeUnmanagedChunk::cloneToSharedChunk() noexcept
     return SharedChunk(chunkMgmt.get());
 }
 
+SharedChunk ShmSafeUnmanagedChunk::tryCloneToSharedChunk() noexcept
+{
+    if (m_chunkManagement.isLogicalNullptr())
+    {
+        return SharedChunk();
+    }
+    auto chunkMgmt =
+        RelativePointer<mepoo::ChunkManagement>(m_chunkManagement.offset(), segment_id_t{m_chunkManagement.id()});
+    auto& referenceCounter = chunkMgmt->m_referenceCounter;
+    auto currentReferences = referenceCounter.load(std::memory_order_relaxed);
+    do
+    {
+        if (currentReferences == 0U)
+        {
+            return SharedChunk();
+        }
+    } while (!referenceCounter.compare_exchange_weak(
+        currentReferences, currentReferences + 1U, std::memory_order_acquire, std::memory_order_relaxed));
+    return SharedChunk(chunkMgmt.get());
+}
+
 bool ShmSafeUnmanagedChunk::isLogicalNullptr() const noexcept
 {
     return m_chunkManagement.isLogicalNullptr();
@@ -116,5 +152,16 @@ bool ShmSafeUnmanagedChunk::isNotLogicalNullptrAndHasNoOtherOwners() const noexc
     return chunkMgmt->m_referenceCounter.load(std::memory_order_relaxed) == 1U;
 }
 
+bool ShmSafeUnmanagedChunk::operator==(const ShmSafeUnmanagedChunk& rhs) const noexcept
+{
+    return (m_chunkManagement.id() == rhs.m_chunkManagement.id())
+           && (m_chunkManagement.offset() == rhs.m_chunkManagement.offset());
+}
+
+bool ShmSafeUnmanagedChunk::operator!=(const ShmSafeUnmanagedChunk& rhs) const noexcept
+{
+    return !(*this == rhs);
+}
+
 } // namespace mepoo
 } // namespace iox
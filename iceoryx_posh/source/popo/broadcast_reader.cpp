@@ -0,0 +1,213 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/broadcast_reader.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+SubscriberOptions broadcastSubscriberOptions() noexcept
+{
+    // only the chunk with the ring is received, the newest one replaces an older one which was not yet taken
+    SubscriberOptions options;
+    options.queueCapacity = 1U;
+    options.historyRequest = 1U;
+    options.requiresPublisherHistorySupport = true;
+    options.queueFullPolicy = QueueFullPolicy::DISCARD_OLDEST_DATA;
+    return options;
+}
+} // namespace
+
+BroadcastReader::BroadcastReader(const capro::ServiceDescription& service) noexcept
+    : m_port(runtime::PoshRuntime::getInstance().getMiddlewareSubscriber(service, broadcastSubscriberOptions()))
+{
+}
+
+BroadcastReader::~BroadcastReader() noexcept
+{
+    releaseRing();
+    m_port.destroy();
+}
+
+expected<uint64_t, BroadcastReaderError> BroadcastReader::take(void* const buffer, const uint64_t bufferSize) noexcept
+{
+    updateRing();
+    if (m_ring == nullptr)
+    {
+        return err(BroadcastReaderError::NO_DATA_AVAILABLE);
+    }
+
+    auto result = m_ring->read(m_readIndex, buffer, bufferSize, m_hasMissedData);
+    if (result.has_error())
+    {
+        return err((result.error() == BroadcastRingError::BUFFER_TOO_SMALL) ? BroadcastReaderError::BUFFER_TOO_SMALL
+                                                                           : BroadcastReaderError::NO_DATA_AVAILABLE);
+    }
+    return ok(result.value());
+}
+
+bool BroadcastReader::hasData() const noexcept
+{
+    return m_port.hasNewChunks() || (m_ring != nullptr && m_ring->hasMessage(m_readIndex));
+}
+
+bool BroadcastReader::hasMissedData() noexcept
+{
+    // a ring which is replaced by a newer one before it was taken is no missed data, therefore the port is not asked
+    const bool hasMissedData = m_hasMissedData;
+    m_hasMissedData = false;
+    return hasMissedData;
+}
+
+capro::ServiceDescription BroadcastReader::getServiceDescription() const noexcept
+{
+    return m_port.getCaProServiceDescription();
+}
+
+SubscribeState BroadcastReader::getSubscriptionState() const noexcept
+{
+    return m_port.getSubscriptionState();
+}
+
+void BroadcastReader::updateRing() noexcept
+{
+    while (true)
+    {
+        auto chunkHeader = m_port.tryGetChunk();
+        if (chunkHeader.has_error())
+        {
+            return;
+        }
+
+        const auto* ring = BroadcastRing::fromMemory(chunkHeader.value()->userPayload());
+        if (ring == nullptr)
+        {
+            IOX_LOG(WARN,
+                    "The BroadcastReader for '" << m_port.getCaProServiceDescription()
+                                                << "' received a sample which is not a broadcast ring! Only "
+                                                   "BroadcastWriters must offer the service.");
+            m_port.releaseChunk(chunkHeader.value());
+            continue;
+        }
+
+        releaseRing();
+        m_ringChunk = chunkHeader.value();
+        m_ring = ring;
+        // the ring acts as history, the reader starts with the oldest message which is still stored in it
+        const auto writeIndex = m_ring->writeIndex();
+        const auto capacity = m_ring->capacity();
+        m_readIndex = (writeIndex > capacity) ? writeIndex - capacity : 0U;
+    }
+}
+
+void BroadcastReader::releaseRing() noexcept
+{
+    if (m_ringChunk != nullptr)
+    {
+        m_port.releaseChunk(m_ringChunk);
+        m_ringChunk = nullptr;
+        m_ring = nullptr;
+        m_readIndex = 0U;
+    }
+}
+
+void BroadcastReader::invalidateTrigger(const uint64_t uniqueTriggerId) noexcept
+{
+    if (m_trigger.getUniqueId() == uniqueTriggerId)
+    {
+        m_port.unsetConditionVariable();
+        m_trigger.invalidate();
+    }
+}
+
+void BroadcastReader::enableState(TriggerHandle&& triggerHandle, const BroadcastReaderState readerState) noexcept
+{
+    switch (readerState)
+    {
+    case BroadcastReaderState::HAS_DATA:
+        if (m_trigger)
+        {
+            IOX_LOG(WARN,
+                    "The broadcast reader is already attached with either the BroadcastReaderState::HAS_DATA or "
+                    "BroadcastReaderEvent::DATA_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                    "attaching it to the new one with BroadcastReaderState::HAS_DATA. Best practice is to call detach "
+                    "first.");
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+WaitSetIsConditionSatisfiedCallback
+BroadcastReader::getCallbackForIsStateConditionSatisfied(const BroadcastReaderState readerState) const noexcept
+{
+    switch (readerState)
+    {
+    case BroadcastReaderState::HAS_DATA:
+        return WaitSetIsConditionSatisfiedCallback(in_place, *this, &BroadcastReader::hasData);
+    }
+    return nullopt;
+}
+
+void BroadcastReader::disableState(const BroadcastReaderState readerState) noexcept
+{
+    switch (readerState)
+    {
+    case BroadcastReaderState::HAS_DATA:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+void BroadcastReader::enableEvent(TriggerHandle&& triggerHandle, const BroadcastReaderEvent readerEvent) noexcept
+{
+    switch (readerEvent)
+    {
+    case BroadcastReaderEvent::DATA_RECEIVED:
+        if (m_trigger)
+        {
+            IOX_LOG(WARN,
+                    "The broadcast reader is already attached with either the BroadcastReaderState::HAS_DATA or "
+                    "BroadcastReaderEvent::DATA_RECEIVED to a WaitSet/Listener. Detaching it from previous one and "
+                    "attaching it to the new one with BroadcastReaderEvent::DATA_RECEIVED. Best practice is to call "
+                    "detach first.");
+        }
+        m_trigger = std::move(triggerHandle);
+        m_port.setConditionVariable(*m_trigger.getConditionVariableData(), m_trigger.getUniqueId());
+        break;
+    }
+}
+
+void BroadcastReader::disableEvent(const BroadcastReaderEvent readerEvent) noexcept
+{
+    switch (readerEvent)
+    {
+    case BroadcastReaderEvent::DATA_RECEIVED:
+        m_trigger.reset();
+        m_port.unsetConditionVariable();
+        break;
+    }
+}
+
+} // namespace popo
+} // namespace iox
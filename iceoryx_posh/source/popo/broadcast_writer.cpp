@@ -0,0 +1,118 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/broadcast_writer.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/logging.hpp"
+
+#include <algorithm>
+
+namespace iox
+{
+namespace popo
+{
+namespace
+{
+PublisherOptions broadcastPublisherOptions() noexcept
+{
+    // the history keeps the ring alive and provides it to the readers which connect later on
+    PublisherOptions options;
+    options.historyCapacity = 1U;
+    return options;
+}
+} // namespace
+
+BroadcastWriter::BroadcastWriter(const capro::ServiceDescription& service, const uint64_t capacity) noexcept
+    : m_port(runtime::PoshRuntime::getInstance().getMiddlewarePublisher(service, broadcastPublisherOptions()))
+    , m_capacity(std::min(std::max(capacity, uint64_t{1U}), MAX_CAPACITY))
+{
+    if (m_capacity != capacity)
+    {
+        IOX_LOG(WARN,
+                "The capacity of the BroadcastWriter must be in the range 1.." << MAX_CAPACITY << " but is "
+                                                                               << capacity << "! Using " << m_capacity
+                                                                               << " instead.");
+    }
+    // the ring is loaned upfront in order to have no allocation with the first message; when the mempools are
+    // exhausted, the loan is retried with the next message
+    IOX_DISCARD_RESULT(ring());
+}
+
+BroadcastWriter::~BroadcastWriter() noexcept
+{
+    m_port.destroy();
+}
+
+expected<void, BroadcastWriterError> BroadcastWriter::write(const void* const message, const uint64_t size) noexcept
+{
+    if (size > MAX_MESSAGE_SIZE)
+    {
+        return err(BroadcastWriterError::MESSAGE_TOO_LARGE);
+    }
+
+    auto ringResult = ring();
+    if (ringResult.has_error())
+    {
+        return err(ringResult.error());
+    }
+
+    // the size was already checked, therefore the write cannot fail
+    IOX_DISCARD_RESULT(ringResult.value()->write(message, size));
+    m_port.notifySubscribers();
+    return ok();
+}
+
+capro::ServiceDescription BroadcastWriter::getServiceDescription() const noexcept
+{
+    return m_port.getCaProServiceDescription();
+}
+
+bool BroadcastWriter::hasReaders() const noexcept
+{
+    return m_port.hasSubscribers();
+}
+
+uint64_t BroadcastWriter::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+expected<BroadcastRing*, BroadcastWriterError> BroadcastWriter::ring() noexcept
+{
+    if (m_ring != nullptr)
+    {
+        return ok(m_ring);
+    }
+
+    auto chunkHeader = m_port.tryAllocateChunk(BroadcastRing::requiredSize(m_capacity),
+                                               static_cast<uint32_t>(BroadcastRing::requiredAlignment()));
+    if (chunkHeader.has_error())
+    {
+        IOX_LOG(WARN,
+                "Unable to loan the ring of the BroadcastWriter for '" << m_port.getCaProServiceDescription()
+                                                                       << "': " << chunkHeader.error());
+        return err(BroadcastWriterError::RING_ALLOCATION_FAILED);
+    }
+
+    // the capacity was already clamped, therefore the creation cannot fail
+    m_ring = BroadcastRing::create(chunkHeader.value()->userPayload(), m_capacity).value();
+    // the chunk is sent only once, the port keeps it in the history until the writer is destroyed
+    m_port.sendChunk(chunkHeader.value());
+    return ok(m_ring);
+}
+
+} // namespace popo
+} // namespace iox
@@ -0,0 +1,182 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace iox
+{
+namespace popo
+{
+// the ring is accessed from multiple processes, therefore the atomics must not fall back to a process local lock
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "The atomics of the BroadcastRing must be lock-free!");
+
+BroadcastRing::BroadcastRing(const uint64_t capacity) noexcept
+    : m_capacity(capacity)
+{
+}
+
+uint64_t BroadcastRing::requiredSize(const uint64_t capacity) noexcept
+{
+    return sizeof(BroadcastRing) + capacity * sizeof(Slot);
+}
+
+uint64_t BroadcastRing::requiredAlignment() noexcept
+{
+    return alignof(BroadcastRing);
+}
+
+expected<BroadcastRing*, BroadcastRingError> BroadcastRing::create(void* const memory,
+                                                                   const uint64_t capacity) noexcept
+{
+    if (capacity == 0U || capacity > MAX_CAPACITY)
+    {
+        return err(BroadcastRingError::INVALID_CAPACITY);
+    }
+
+    auto* ring = new (memory) BroadcastRing(capacity);
+    for (uint64_t i = 0U; i < capacity; ++i)
+    {
+        new (&ring->slots()[i]) Slot();
+    }
+    return ok(ring);
+}
+
+const BroadcastRing* BroadcastRing::fromMemory(const void* const memory) noexcept
+{
+    const auto* ring = static_cast<const BroadcastRing*>(memory);
+    if (ring == nullptr || ring->m_magic != MAGIC || ring->m_capacity == 0U || ring->m_capacity > MAX_CAPACITY)
+    {
+        return nullptr;
+    }
+    return ring;
+}
+
+expected<void, BroadcastRingError> BroadcastRing::write(const void* const message, const uint64_t size) noexcept
+{
+    if (size > MAX_MESSAGE_SIZE)
+    {
+        return err(BroadcastRingError::MESSAGE_TOO_LARGE);
+    }
+
+    const auto index = m_writeIndex.load(std::memory_order_relaxed);
+    auto& slot = slots()[index % m_capacity];
+
+    // an odd sequence number tells the readers that the message is overwritten
+    slot.sequenceNumber.store(2U * index + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.size.store(size, std::memory_order_relaxed);
+    const auto* bytes = static_cast<const uint8_t*>(message);
+    for (uint64_t offset = 0U; offset < size; offset += MESSAGE_WORD_SIZE)
+    {
+        uint64_t word{0U};
+        std::memcpy(&word, bytes + offset, std::min(MESSAGE_WORD_SIZE, size - offset));
+        slot.words[offset / MESSAGE_WORD_SIZE].store(word, std::memory_order_relaxed);
+    }
+
+    slot.sequenceNumber.store(2U * index + 2U, std::memory_order_release);
+    m_writeIndex.store(index + 1U, std::memory_order_release);
+
+    return ok();
+}
+
+expected<uint64_t, BroadcastRingError> BroadcastRing::read(uint64_t& readIndex,
+                                                           void* const buffer,
+                                                           const uint64_t bufferSize,
+                                                           bool& hasLostMessages) const noexcept
+{
+    uint64_t words[MESSAGE_WORDS];
+    for (uint64_t attempt = 0U; attempt < MAX_READ_ATTEMPTS; ++attempt)
+    {
+        const auto writeIndex = m_writeIndex.load(std::memory_order_acquire);
+        if (readIndex >= writeIndex)
+        {
+            return err(BroadcastRingError::NO_MESSAGE_AVAILABLE);
+        }
+        if (writeIndex - readIndex > m_capacity)
+        {
+            readIndex = writeIndex - m_capacity;
+            hasLostMessages = true;
+        }
+
+        const auto& slot = slots()[readIndex % m_capacity];
+        const uint64_t expectedSequenceNumber{2U * readIndex + 2U};
+        const auto sequenceNumber = slot.sequenceNumber.load(std::memory_order_acquire);
+        if (sequenceNumber != expectedSequenceNumber)
+        {
+            // the writer already overwrites the slot with a newer message, the next attempt skips ahead
+            continue;
+        }
+
+        // the size can be torn, it is only trusted after the validation of the sequence number
+        const auto size = std::min(slot.size.load(std::memory_order_relaxed), MAX_MESSAGE_SIZE);
+        const auto numberOfWords = (size + MESSAGE_WORD_SIZE - 1U) / MESSAGE_WORD_SIZE;
+        for (uint64_t i = 0U; i < numberOfWords; ++i)
+        {
+            words[i] = slot.words[i].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequenceNumber.load(std::memory_order_relaxed) != expectedSequenceNumber)
+        {
+            continue;
+        }
+
+        if (size > bufferSize)
+        {
+            return err(BroadcastRingError::BUFFER_TOO_SMALL);
+        }
+        std::memcpy(buffer, words, size);
+        ++readIndex;
+        return ok(size);
+    }
+
+    return err(BroadcastRingError::NO_MESSAGE_AVAILABLE);
+}
+
+bool BroadcastRing::hasMessage(const uint64_t readIndex) const noexcept
+{
+    return readIndex < m_writeIndex.load(std::memory_order_acquire);
+}
+
+uint64_t BroadcastRing::writeIndex() const noexcept
+{
+    return m_writeIndex.load(std::memory_order_acquire);
+}
+
+uint64_t BroadcastRing::capacity() const noexcept
+{
+    return m_capacity;
+}
+
+BroadcastRing::Slot* BroadcastRing::slots() noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-A5.2.4 : the slots are created in the memory directly behind the ring
+    return reinterpret_cast<Slot*>(reinterpret_cast<uint8_t*>(this) + sizeof(BroadcastRing));
+}
+
+const BroadcastRing::Slot* BroadcastRing::slots() const noexcept
+{
+    // AXIVION Next Construct AutosarC++19_03-A5.2.4 : the slots are created in the memory directly behind the ring
+    return reinterpret_cast<const Slot*>(reinterpret_cast<const uint8_t*>(this) + sizeof(BroadcastRing));
+}
+
+} // namespace popo
+} // namespace iox
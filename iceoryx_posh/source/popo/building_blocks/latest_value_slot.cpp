@@ -0,0 +1,133 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
+#include "iox/assertions.hpp"
+#include "iox/relative_pointer.hpp"
+
+namespace iox
+{
+namespace popo
+{
+// the slot is accessed from multiple processes, therefore the atomics must not fall back to a process local lock
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "The sequence number of the LatestValueSlot must be lock-free!");
+static_assert(std::atomic<mepoo::ShmSafeUnmanagedChunk>::is_always_lock_free,
+              "The chunk of the LatestValueSlot must be lock-free!");
+
+void LatestValueSlot::store(const mepoo::SharedChunk& chunk) noexcept
+{
+    const auto sequenceNumber = m_sequenceNumber.load(std::memory_order_relaxed);
+    // an odd sequence number tells the consumers that the chunk is replaced
+    m_sequenceNumber.store(sequenceNumber + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // the slot takes over a reference; the reference of the previous chunk is released after the sequence number is
+    // even again, the consumers detect with the sequence number and the chunk that they raced with the replacement
+    auto previousChunk = m_chunk.exchange(mepoo::ShmSafeUnmanagedChunk(chunk), std::memory_order_acq_rel);
+    m_sequenceNumber.store(sequenceNumber + 2U, std::memory_order_release);
+
+    // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has the
+    // side effect here and return value does not need to be evaluated
+    previousChunk.releaseToSharedChunk();
+}
+
+void LatestValueSlot::reset() noexcept
+{
+    store(mepoo::SharedChunk());
+}
+
+optional<mepoo::SharedChunk> LatestValueSlot::tryAcquireNewerThan(uint64_t& sequenceNumber) const noexcept
+{
+    for (uint64_t attempt = 0U; attempt < MAX_ACQUIRE_ATTEMPTS; ++attempt)
+    {
+        const auto currentSequenceNumber = m_sequenceNumber.load(std::memory_order_acquire);
+        if ((currentSequenceNumber % 2U) != 0U)
+        {
+            continue;
+        }
+        if (currentSequenceNumber == sequenceNumber)
+        {
+            return nullopt;
+        }
+
+        auto unmanagedChunk = m_chunk.load(std::memory_order_acquire);
+        if (unmanagedChunk.isLogicalNullptr())
+        {
+            if (m_sequenceNumber.load(std::memory_order_acquire) == currentSequenceNumber)
+            {
+                sequenceNumber = currentSequenceNumber;
+                return nullopt;
+            }
+            continue;
+        }
+
+        // the reference is only acquired if the chunk was not released in the meantime; if it was released and
+        // reused, the validation below fails and the reference to the foreign chunk is returned with the d'tor
+        auto chunk = unmanagedChunk.tryCloneToSharedChunk();
+        if (!chunk)
+        {
+            continue;
+        }
+
+        if ((m_chunk.load(std::memory_order_acquire) == unmanagedChunk)
+            && (m_sequenceNumber.load(std::memory_order_acquire) == currentSequenceNumber))
+        {
+            sequenceNumber = currentSequenceNumber;
+            return chunk;
+        }
+    }
+    return nullopt;
+}
+
+uint64_t LatestValueSlot::sequenceNumber() const noexcept
+{
+    return m_sequenceNumber.load(std::memory_order_acquire);
+}
+
+bool LatestValueSlot::isEmpty() const noexcept
+{
+    return m_chunk.load(std::memory_order_acquire).isLogicalNullptr();
+}
+
+RelativePointerData LatestValueSlot::toRelativePointerData(LatestValueSlot* const slot) noexcept
+{
+    if (slot == nullptr)
+    {
+        return RelativePointerData();
+    }
+
+    RelativePointer<LatestValueSlot> ptr{slot};
+    auto id = ptr.getId();
+    auto offset = ptr.getOffset();
+    IOX_ENFORCE(id <= RelativePointerData::ID_RANGE, "RelativePointer id must fit into id type!");
+    IOX_ENFORCE(offset <= RelativePointerData::OFFSET_RANGE, "RelativePointer offset must fit into offset type!");
+    /// @todo iox-#1196 Unify types to uint64_t
+    return RelativePointerData(static_cast<RelativePointerData::identifier_t>(id), offset);
+}
+
+LatestValueSlot* LatestValueSlot::fromRelativePointerData(const RelativePointerData data) noexcept
+{
+    if (data.isLogicalNullptr())
+    {
+        return nullptr;
+    }
+    return RelativePointer<LatestValueSlot>(data.offset(), segment_id_t{data.id()}).get();
+}
+
+} // namespace popo
+} // namespace iox
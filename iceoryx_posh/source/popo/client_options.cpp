@@ -21,47 +21,78 @@ namespace iox
 {
 namespace popo
 {
-Serialization ClientOptions::serialize() const noexcept
+namespace
 {
-    return Serialization::create(responseQueueCapacity,
-                                 nodeName,
-                                 connectOnCreate,
-                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(responseQueueFullPolicy),
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(serverTooSlowPolicy));
-}
-
-expected<ClientOptions, Serialization::Error> ClientOptions::deserialize(const Serialization& serialized) noexcept
+template <typename SerializationType>
+expected<ClientOptions, Serialization::Error> deserializeFrom(const SerializationType& serialized) noexcept
 {
     using QueueFullPolicyUT = std::underlying_type_t<QueueFullPolicy>;
     using ConsumerTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
+    using LoadBalancingPolicyUT = std::underlying_type_t<LoadBalancingPolicy>;
 
     ClientOptions clientOptions{};
     QueueFullPolicyUT responseQueueFullPolicy{};
     ConsumerTooSlowPolicyUT serverTooSlowPolicy{};
+    LoadBalancingPolicyUT loadBalancingPolicy{};
 
     auto deserializationSuccessful = serialized.extract(clientOptions.responseQueueCapacity,
                                                         clientOptions.nodeName,
                                                         clientOptions.connectOnCreate,
                                                         responseQueueFullPolicy,
-                                                        serverTooSlowPolicy);
+                                                        serverTooSlowPolicy,
+                                                        loadBalancingPolicy);
 
     if (!deserializationSuccessful
         || responseQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
-        || serverTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
+        || serverTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
+        || loadBalancingPolicy > static_cast<LoadBalancingPolicyUT>(LoadBalancingPolicy::STICKY_BY_KEY))
     {
         return err(Serialization::Error::DESERIALIZATION_FAILED);
     }
 
     clientOptions.responseQueueFullPolicy = static_cast<QueueFullPolicy>(responseQueueFullPolicy);
     clientOptions.serverTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(serverTooSlowPolicy);
+    clientOptions.loadBalancingPolicy = static_cast<LoadBalancingPolicy>(loadBalancingPolicy);
     return ok(clientOptions);
 }
+} // namespace
+
+Serialization ClientOptions::serialize() const noexcept
+{
+    return Serialization::create(responseQueueCapacity,
+                                 nodeName,
+                                 connectOnCreate,
+                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(responseQueueFullPolicy),
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(serverTooSlowPolicy),
+                                 static_cast<std::underlying_type_t<LoadBalancingPolicy>>(loadBalancingPolicy));
+}
+
+expected<ClientOptions, Serialization::Error> ClientOptions::deserialize(const Serialization& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
+
+ClientOptions::BinarySerialization_t ClientOptions::serializeBinary() const noexcept
+{
+    return BinarySerialization_t::create(responseQueueCapacity,
+                                         nodeName,
+                                         connectOnCreate,
+                                         responseQueueFullPolicy,
+                                         serverTooSlowPolicy,
+                                         loadBalancingPolicy);
+}
+
+expected<ClientOptions, Serialization::Error>
+ClientOptions::deserialize(const BinarySerialization_t& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
 
 bool ClientOptions::operator==(const ClientOptions& rhs) const noexcept
 {
     return responseQueueCapacity == rhs.responseQueueCapacity && nodeName == rhs.nodeName
            && connectOnCreate == rhs.connectOnCreate && responseQueueFullPolicy == rhs.responseQueueFullPolicy
-           && serverTooSlowPolicy == rhs.serverTooSlowPolicy;
+           && serverTooSlowPolicy == rhs.serverTooSlowPolicy && loadBalancingPolicy == rhs.loadBalancingPolicy;
 }
 } // namespace popo
 } // namespace iox
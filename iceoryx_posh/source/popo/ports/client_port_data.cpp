@@ -41,6 +41,7 @@ ClientPortData::ClientPortData(const capro::ServiceDescription& serviceDescripti
                           clientOptions.responseQueueFullPolicy,
                           memoryInfo)
     , m_connectRequested(clientOptions.connectOnCreate)
+    , m_loadBalancingPolicy(clientOptions.loadBalancingPolicy)
 {
     m_chunkReceiverData.m_queue.setCapacity(clientOptions.responseQueueCapacity);
 }
@@ -206,8 +206,45 @@ ClientPortRouDi::handleCaProMessageForStateConnected(const capro::CaproMessage&
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::STOP_OFFER:
-        getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
-        m_chunkSender.removeAllQueues();
+        if (caProMessage.m_chunkQueueData != nullptr)
+        {
+            // further servers of the service might still be available
+            IOX_DISCARD_RESULT(
+                m_chunkSender.tryRemoveQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData)));
+        }
+        else
+        {
+            m_chunkSender.removeAllQueues();
+        }
+        if (!m_chunkSender.hasStoredQueues())
+        {
+            getMembers()->m_connectionState.store(ConnectionState::WAIT_FOR_OFFER, std::memory_order_relaxed);
+        }
+        return nullopt;
+    case capro::CaproMessageType::OFFER:
+    {
+        // an additional server of the service is available; connect to it in order to balance the requests
+        capro::CaproMessage caproMessage(capro::CaproMessageType::CONNECT,
+                                         BasePort::getMembers()->m_serviceDescription);
+        caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        caproMessage.m_historyCapacity = 0;
+
+        return make_optional<capro::CaproMessage>(caproMessage);
+    }
+    case capro::CaproMessageType::ACK:
+        IOX_ENFORCE(caProMessage.m_chunkQueueData != nullptr, "Invalid request queue passed to client");
+        m_chunkSender
+            .tryAddQueue(static_cast<ServerChunkQueueData_t*>(caProMessage.m_chunkQueueData),
+                         caProMessage.m_historyCapacity)
+            .or_else([this](auto&) {
+                IOX_LOG(WARN,
+                        "The client with service description '"
+                            << BasePort::getMembers()->m_serviceDescription << "' is already connected to "
+                            << MAX_SERVERS_PER_CLIENT << " servers; no requests are sent to the additional server");
+            });
+        return nullopt;
+    case capro::CaproMessageType::NACK:
+        // the additional server refused the connection; the client stays connected to the other servers
         return nullopt;
     case capro::CaproMessageType::DISCONNECT:
     {
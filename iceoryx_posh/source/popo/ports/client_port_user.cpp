@@ -69,6 +69,13 @@ void ClientPortUser::releaseRequest(const RequestHeader* const requestHeader) no
 }
 
 expected<void, ClientSendError> ClientPortUser::sendRequest(RequestHeader* const requestHeader) noexcept
+{
+    constexpr uint64_t DEFAULT_LOAD_BALANCING_KEY{0U};
+    return sendRequest(requestHeader, DEFAULT_LOAD_BALANCING_KEY);
+}
+
+expected<void, ClientSendError> ClientPortUser::sendRequest(RequestHeader* const requestHeader,
+                                                            const uint64_t loadBalancingKey) noexcept
 {
     if (requestHeader == nullptr)
     {
@@ -85,7 +92,15 @@ expected<void, ClientSendError> ClientPortUser::sendRequest(RequestHeader* const
         return err(ClientSendError::NO_CONNECT_REQUESTED);
     }
 
-    auto numberOfReceiver = m_chunkSender.send(requestHeader->getChunkHeader());
+    const auto loadBalancingPolicy = getMembers()->m_loadBalancingPolicy;
+    // with the other policies the counter rotates the selected server or, respectively, the starting point of the
+    // search for the least filled request queue
+    const auto key = (loadBalancingPolicy == LoadBalancingPolicy::STICKY_BY_KEY)
+                         ? loadBalancingKey
+                         : getMembers()->m_loadBalancingCounter++;
+
+    auto numberOfReceiver =
+        m_chunkSender.sendToOneOfStoredQueues(requestHeader->getChunkHeader(), loadBalancingPolicy, key);
     if (numberOfReceiver == 0U)
     {
         IOX_LOG(WARN, "Try to send request but server is not available!");
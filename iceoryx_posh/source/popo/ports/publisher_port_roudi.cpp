@@ -93,7 +93,8 @@ PublisherPortRouDi::dispatchCaProMessageAndGetPossibleResponse(const capro::Capr
         {
             const auto ret = m_chunkSender.tryAddQueue(
                 static_cast<PublisherPortData::ChunkQueueData_t*>(caProMessage.m_chunkQueueData),
-                caProMessage.m_historyCapacity);
+                caProMessage.m_historyCapacity,
+                caProMessage.m_latestValueMode);
             if (!ret.has_error())
             {
                 responseMessage.m_type = capro::CaproMessageType::ACK;
@@ -71,6 +71,29 @@ void PublisherPortUser::sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcep
     }
 }
 
+void PublisherPortUser::sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+
+    if (offerRequested)
+    {
+        m_chunkSender.sendChunks(chunkHeaders);
+    }
+    else
+    {
+        // see sendChunk for why the chunks are only put into the history if the publisher port is not offered
+        for (auto* const chunkHeader : chunkHeaders)
+        {
+            m_chunkSender.pushToHistory(chunkHeader);
+        }
+    }
+}
+
+void PublisherPortUser::notifySubscribers() noexcept
+{
+    m_chunkSender.notifyAllStoredQueues();
+}
+
 optional<const mepoo::ChunkHeader*> PublisherPortUser::tryGetPreviousChunk() const noexcept
 {
     return m_chunkSender.tryGetPreviousChunk();
@@ -40,6 +40,7 @@ ServerPortData::ServerPortData(const capro::ServiceDescription& serviceDescripti
     , m_chunkReceiverData(
           getRequestQueueType(serverOptions.requestQueueFullPolicy), serverOptions.requestQueueFullPolicy, memoryInfo)
     , m_offeringRequested(serverOptions.offerOnCreate)
+    , m_allowMultipleServers(serverOptions.allowMultipleServers)
 {
     m_chunkReceiverData.m_queue.setCapacity(serverOptions.requestQueueCapacity);
 }
@@ -106,9 +106,15 @@ ServerPortRouDi::handleCaProMessageForStateOffered(const capro::CaproMessage& ca
     switch (caProMessage.m_type)
     {
     case capro::CaproMessageType::STOP_OFFER:
+    {
         getMembers()->m_offered.store(false, std::memory_order_relaxed);
         m_chunkSender.removeAllQueues();
-        return caProMessage;
+
+        // the request queue identifies this server at clients which are connected to multiple servers of the service
+        capro::CaproMessage stopOfferMessage{caProMessage};
+        stopOfferMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
+        return stopOfferMessage;
+    }
     case capro::CaproMessageType::OFFER:
         return responseMessage;
     case capro::CaproMessageType::CONNECT:
@@ -167,6 +173,12 @@ ServerPortRouDi::handleCaProMessageForStateNotOffered(const capro::CaproMessage&
 
 void ServerPortRouDi::releaseAllChunks() noexcept
 {
+    for (auto& worker : getMembers()->m_workers)
+    {
+        worker.m_requestsInUse.cleanup();
+        worker.m_responsesInUse.cleanup();
+        worker.m_isAcquired.store(false, std::memory_order_relaxed);
+    }
     m_chunkSender.releaseAll();
     m_chunkReceiver.releaseAll();
 }
@@ -39,6 +39,12 @@ ServerPortUser::MemberType_t* ServerPortUser::getMembers() noexcept
     return reinterpret_cast<MemberType_t*>(BasePort::getMembers());
 }
 
+ServerWorkerData& ServerPortUser::getWorker(const uint32_t workerIndex) noexcept
+{
+    IOX_ENFORCE(workerIndex < MAX_SERVER_WORKERS, "Invalid server worker index");
+    return getMembers()->m_workers[workerIndex];
+}
+
 expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest() noexcept
 {
     auto getChunkResult = m_chunkReceiver.tryGet();
@@ -140,14 +146,148 @@ expected<void, ServerSendError> ServerPortUser::sendResponse(ResponseHeader* con
         return err(ServerSendError::NOT_OFFERED);
     }
 
-    bool responseSent{false};
-    m_chunkSender.getQueueIndex(responseHeader->m_uniqueClientQueueId, responseHeader->m_lastKnownClientQueueIndex)
-        .and_then([&](auto queueIndex) {
-            responseHeader->m_lastKnownClientQueueIndex = queueIndex;
-            responseSent = m_chunkSender.sendToQueue(
-                responseHeader->getChunkHeader(), responseHeader->m_uniqueClientQueueId, queueIndex);
-        })
-        .or_else([&] { releaseResponse(responseHeader); });
+    // the queue lookup and the delivery happen with a single lock acquisition; the response is released if the
+    // client is not available anymore
+    const bool responseSent = m_chunkSender.sendToQueue(responseHeader->getChunkHeader(),
+                                                        responseHeader->m_uniqueClientQueueId,
+                                                        responseHeader->m_lastKnownClientQueueIndex);
+
+    if (!responseSent)
+    {
+        IOX_LOG(WARN, "Could not deliver to client! Client not available anymore!");
+        return err(ServerSendError::CLIENT_NOT_AVAILABLE);
+    }
+
+    return ok();
+}
+
+optional<uint32_t> ServerPortUser::acquireWorker() noexcept
+{
+    for (uint32_t workerIndex = 0U; workerIndex < MAX_SERVER_WORKERS; ++workerIndex)
+    {
+        bool isAcquired{false};
+        if (getMembers()->m_workers[workerIndex].m_isAcquired.compare_exchange_strong(
+                isAcquired, true, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+            return workerIndex;
+        }
+    }
+    return nullopt;
+}
+
+void ServerPortUser::releaseWorker(const uint32_t workerIndex) noexcept
+{
+    auto& worker = getWorker(workerIndex);
+    // 'UsedChunkList::cleanup' is reserved for RouDi after the application terminated, the chunks are released one by
+    // one like with 'releaseRequest' and 'releaseResponse'
+    for (auto* chunkHeader = worker.m_requestsInUse.peek(); chunkHeader != nullptr;
+         chunkHeader = worker.m_requestsInUse.peek())
+    {
+        m_chunkReceiver.release(chunkHeader, worker.m_requestsInUse);
+    }
+    for (auto* chunkHeader = worker.m_responsesInUse.peek(); chunkHeader != nullptr;
+         chunkHeader = worker.m_responsesInUse.peek())
+    {
+        m_chunkSender.release(chunkHeader, worker.m_responsesInUse);
+    }
+    worker.m_isAcquired.store(false, std::memory_order_release);
+}
+
+expected<const RequestHeader*, ServerRequestResult> ServerPortUser::getRequest(const uint32_t workerIndex) noexcept
+{
+    auto getChunkResult = m_chunkReceiver.tryGet(getWorker(workerIndex).m_requestsInUse);
+
+    if (getChunkResult.has_error())
+    {
+        if (!isOffered())
+        {
+            return err(ServerRequestResult::NO_PENDING_REQUESTS_AND_SERVER_DOES_NOT_OFFER);
+        }
+        return err(into<ServerRequestResult>(getChunkResult.error()));
+    }
+
+    return ok(static_cast<const RequestHeader*>(getChunkResult.value()->userHeader()));
+}
+
+void ServerPortUser::releaseRequest(const uint32_t workerIndex, const RequestHeader* const requestHeader) noexcept
+{
+    if (requestHeader != nullptr)
+    {
+        m_chunkReceiver.release(requestHeader->getChunkHeader(), getWorker(workerIndex).m_requestsInUse);
+    }
+    else
+    {
+        IOX_LOG(ERROR, "Provided RequestHeader is a nullptr");
+        IOX_REPORT(PoshError::POPO__SERVER_PORT_INVALID_REQUEST_TO_RELEASE_FROM_USER, iox::er::RUNTIME_ERROR);
+    }
+}
+
+expected<ResponseHeader*, AllocationError>
+ServerPortUser::allocateResponse(const uint32_t workerIndex,
+                                 const RequestHeader* const requestHeader,
+                                 const uint64_t userPayloadSize,
+                                 const uint32_t userPayloadAlignment) noexcept
+{
+    if (requestHeader == nullptr)
+    {
+        return err(AllocationError::INVALID_PARAMETER_FOR_REQUEST_HEADER);
+    }
+
+    auto allocateResult = m_chunkSender.tryAllocate(getWorker(workerIndex).m_responsesInUse,
+                                                    getUniqueID(),
+                                                    userPayloadSize,
+                                                    userPayloadAlignment,
+                                                    sizeof(ResponseHeader),
+                                                    alignof(ResponseHeader));
+
+    if (allocateResult.has_error())
+    {
+        return err(allocateResult.error());
+    }
+
+    auto* responseHeader =
+        new (allocateResult.value()->userHeader()) ResponseHeader(requestHeader->m_uniqueClientQueueId,
+                                                                  requestHeader->m_lastKnownClientQueueIndex,
+                                                                  requestHeader->getSequenceId());
+
+    return ok(responseHeader);
+}
+
+void ServerPortUser::releaseResponse(const uint32_t workerIndex, const ResponseHeader* const responseHeader) noexcept
+{
+    if (responseHeader != nullptr)
+    {
+        m_chunkSender.release(responseHeader->getChunkHeader(), getWorker(workerIndex).m_responsesInUse);
+    }
+    else
+    {
+        IOX_LOG(ERROR, "Provided ResponseHeader is a nullptr");
+        IOX_REPORT(PoshError::POPO__SERVER_PORT_INVALID_RESPONSE_TO_FREE_FROM_USER, iox::er::RUNTIME_ERROR);
+    }
+}
+
+expected<void, ServerSendError> ServerPortUser::sendResponse(const uint32_t workerIndex,
+                                                             ResponseHeader* const responseHeader) noexcept
+{
+    if (responseHeader == nullptr)
+    {
+        IOX_LOG(ERROR, "Provided ResponseHeader is a nullptr");
+        IOX_REPORT(PoshError::POPO__SERVER_PORT_INVALID_RESPONSE_TO_SEND_FROM_USER, iox::er::RUNTIME_ERROR);
+        return err(ServerSendError::INVALID_RESPONSE);
+    }
+
+    const auto offerRequested = getMembers()->m_offeringRequested.load(std::memory_order_relaxed);
+    if (!offerRequested)
+    {
+        releaseResponse(workerIndex, responseHeader);
+        IOX_LOG(WARN, "Try to send response without having offered!");
+        return err(ServerSendError::NOT_OFFERED);
+    }
+
+    const bool responseSent = m_chunkSender.sendToQueue(responseHeader->getChunkHeader(),
+                                                        responseHeader->m_uniqueClientQueueId,
+                                                        responseHeader->m_lastKnownClientQueueIndex,
+                                                        getWorker(workerIndex).m_responsesInUse);
 
     if (!responseSent)
     {
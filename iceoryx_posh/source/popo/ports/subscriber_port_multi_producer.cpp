@@ -41,6 +41,7 @@ optional<capro::CaproMessage> SubscriberPortMultiProducer::tryGetCaProMessage()
         capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
         caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
         caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        caproMessage.m_latestValueMode = getMembers()->m_options.latestValueMode;
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -71,6 +72,7 @@ optional<capro::CaproMessage> SubscriberPortMultiProducer::dispatchCaProMessageA
         capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
         caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
         caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        caproMessage.m_latestValueMode = getMembers()->m_options.latestValueMode;
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -41,6 +41,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::tryGetCaProMessage()
         capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
         caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
         caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        caproMessage.m_latestValueMode = getMembers()->m_options.latestValueMode;
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
@@ -78,6 +79,7 @@ optional<capro::CaproMessage> SubscriberPortSingleProducer::dispatchCaProMessage
         capro::CaproMessage caproMessage(capro::CaproMessageType::SUB, BasePort::getMembers()->m_serviceDescription);
         caproMessage.m_chunkQueueData = static_cast<void*>(&getMembers()->m_chunkReceiverData);
         caproMessage.m_historyCapacity = getMembers()->m_options.historyRequest;
+        caproMessage.m_latestValueMode = getMembers()->m_options.latestValueMode;
 
         return make_optional<capro::CaproMessage>(caproMessage);
     }
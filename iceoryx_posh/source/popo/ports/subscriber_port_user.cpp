@@ -68,6 +68,12 @@ expected<const mepoo::ChunkHeader*, ChunkReceiveResult> SubscriberPortUser::tryG
     return m_chunkReceiver.tryGet();
 }
 
+expected<uint64_t, ChunkReceiveResult>
+SubscriberPortUser::tryGetChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    return m_chunkReceiver.tryGetMultiple(chunkHeaders);
+}
+
 void SubscriberPortUser::releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
     m_chunkReceiver.release(chunkHeader);
@@ -21,15 +21,10 @@ namespace iox
 {
 namespace popo
 {
-Serialization PublisherOptions::serialize() const noexcept
+namespace
 {
-    return Serialization::create(historyCapacity,
-                                 nodeName,
-                                 offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
-}
-
-expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
+template <typename SerializationType>
+expected<PublisherOptions, Serialization::Error> deserializeFrom(const SerializationType& serialized) noexcept
 {
     using ConsumerTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
 
@@ -50,5 +45,30 @@ expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(c
     publisherOptions.subscriberTooSlowPolicy = static_cast<ConsumerTooSlowPolicy>(subscriberTooSlowPolicy);
     return ok(publisherOptions);
 }
+} // namespace
+
+Serialization PublisherOptions::serialize() const noexcept
+{
+    return Serialization::create(historyCapacity,
+                                 nodeName,
+                                 offerOnCreate,
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+}
+
+expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
+
+PublisherOptions::BinarySerialization_t PublisherOptions::serializeBinary() const noexcept
+{
+    return BinarySerialization_t::create(historyCapacity, nodeName, offerOnCreate, subscriberTooSlowPolicy);
+}
+
+expected<PublisherOptions, Serialization::Error>
+PublisherOptions::deserialize(const BinarySerialization_t& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
 } // namespace popo
 } // namespace iox
@@ -21,16 +21,10 @@ namespace iox
 {
 namespace popo
 {
-Serialization ServerOptions::serialize() const noexcept
+namespace
 {
-    return Serialization::create(requestQueueCapacity,
-                                 nodeName,
-                                 offerOnCreate,
-                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(requestQueueFullPolicy),
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy));
-}
-
-expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const Serialization& serialized) noexcept
+template <typename SerializationType>
+expected<ServerOptions, Serialization::Error> deserializeFrom(const SerializationType& serialized) noexcept
 {
     using QueueFullPolicyUT = std::underlying_type_t<QueueFullPolicy>;
     using ClientTooSlowPolicyUT = std::underlying_type_t<ConsumerTooSlowPolicy>;
@@ -43,7 +37,8 @@ expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const S
                                                         serverOptions.nodeName,
                                                         serverOptions.offerOnCreate,
                                                         requestQueueFullPolicy,
-                                                        clientTooSlowPolicy);
+                                                        clientTooSlowPolicy,
+                                                        serverOptions.allowMultipleServers);
 
     if (!deserializationSuccessful
         || requestQueueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA)
@@ -57,12 +52,44 @@ expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const S
 
     return ok(serverOptions);
 }
+} // namespace
+
+Serialization ServerOptions::serialize() const noexcept
+{
+    return Serialization::create(requestQueueCapacity,
+                                 nodeName,
+                                 offerOnCreate,
+                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(requestQueueFullPolicy),
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(clientTooSlowPolicy),
+                                 allowMultipleServers);
+}
+
+expected<ServerOptions, Serialization::Error> ServerOptions::deserialize(const Serialization& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
+
+ServerOptions::BinarySerialization_t ServerOptions::serializeBinary() const noexcept
+{
+    return BinarySerialization_t::create(requestQueueCapacity,
+                                         nodeName,
+                                         offerOnCreate,
+                                         requestQueueFullPolicy,
+                                         clientTooSlowPolicy,
+                                         allowMultipleServers);
+}
+
+expected<ServerOptions, Serialization::Error>
+ServerOptions::deserialize(const BinarySerialization_t& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
 
 bool ServerOptions::operator==(const ServerOptions& rhs) const noexcept
 {
     return requestQueueCapacity == rhs.requestQueueCapacity && nodeName == rhs.nodeName
            && offerOnCreate == rhs.offerOnCreate && requestQueueFullPolicy == rhs.requestQueueFullPolicy
-           && clientTooSlowPolicy == rhs.clientTooSlowPolicy;
+           && clientTooSlowPolicy == rhs.clientTooSlowPolicy && allowMultipleServers == rhs.allowMultipleServers;
 }
 } // namespace popo
 } // namespace iox
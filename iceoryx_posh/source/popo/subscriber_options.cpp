@@ -21,18 +21,10 @@ namespace iox
 {
 namespace popo
 {
-Serialization SubscriberOptions::serialize() const noexcept
+namespace
 {
-    return Serialization::create(queueCapacity,
-                                 historyRequest,
-                                 nodeName,
-                                 subscribeOnCreate,
-                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
-                                 requiresPublisherHistorySupport);
-}
-
-expected<SubscriberOptions, Serialization::Error>
-SubscriberOptions::deserialize(const Serialization& serialized) noexcept
+template <typename SerializationType>
+expected<SubscriberOptions, Serialization::Error> deserializeFrom(const SerializationType& serialized) noexcept
 {
     using QueueFullPolicyUT = std::underlying_type_t<QueueFullPolicy>;
 
@@ -44,7 +36,8 @@ SubscriberOptions::deserialize(const Serialization& serialized) noexcept
                                                         subscriberOptions.nodeName,
                                                         subscriberOptions.subscribeOnCreate,
                                                         queueFullPolicy,
-                                                        subscriberOptions.requiresPublisherHistorySupport);
+                                                        subscriberOptions.requiresPublisherHistorySupport,
+                                                        subscriberOptions.latestValueMode);
 
     if (!deserializationSuccessful
         || queueFullPolicy > static_cast<QueueFullPolicyUT>(QueueFullPolicy::DISCARD_OLDEST_DATA))
@@ -55,5 +48,40 @@ SubscriberOptions::deserialize(const Serialization& serialized) noexcept
     subscriberOptions.queueFullPolicy = static_cast<QueueFullPolicy>(queueFullPolicy);
     return ok(subscriberOptions);
 }
+} // namespace
+
+Serialization SubscriberOptions::serialize() const noexcept
+{
+    return Serialization::create(queueCapacity,
+                                 historyRequest,
+                                 nodeName,
+                                 subscribeOnCreate,
+                                 static_cast<std::underlying_type_t<QueueFullPolicy>>(queueFullPolicy),
+                                 requiresPublisherHistorySupport,
+                                 latestValueMode);
+}
+
+expected<SubscriberOptions, Serialization::Error>
+SubscriberOptions::deserialize(const Serialization& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
+
+SubscriberOptions::BinarySerialization_t SubscriberOptions::serializeBinary() const noexcept
+{
+    return BinarySerialization_t::create(queueCapacity,
+                                         historyRequest,
+                                         nodeName,
+                                         subscribeOnCreate,
+                                         queueFullPolicy,
+                                         requiresPublisherHistorySupport,
+                                 latestValueMode);
+}
+
+expected<SubscriberOptions, Serialization::Error>
+SubscriberOptions::deserialize(const BinarySerialization_t& serialized) noexcept
+{
+    return deserializeFrom(serialized);
+}
 } // namespace popo
 } // namespace iox
@@ -52,6 +52,15 @@ RouDiApp::RouDiApp(const IceoryxConfig& config) noexcept
         IOX_LOG(TRACE, "  Compatibility Check Level = " << roudiConfig.compatibilityCheckLevel);
         IOX_LOG(TRACE, "  Introspection Chunk Count = " << roudiConfig.introspectionChunkCount);
         IOX_LOG(TRACE, "  Discovery Chunk Count = " << roudiConfig.discoveryChunkCount);
+        const auto& introspection = roudiConfig.introspection;
+        IOX_LOG(TRACE,
+                "  MemPool Introspection = " << introspection.mempool.level << " every "
+                                             << introspection.mempool.interval);
+        IOX_LOG(TRACE,
+                "  Process Introspection = " << introspection.process.level << " every "
+                                             << introspection.process.interval);
+        IOX_LOG(TRACE,
+                "  Port Introspection = " << introspection.port.level << " every " << introspection.port.interval);
     }
 }
 
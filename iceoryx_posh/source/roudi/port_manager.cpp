@@ -49,7 +49,8 @@ capro::Interfaces StringToCaProInterface(const capro::IdString_t& str) noexcept
     return static_cast<capro::Interfaces>(i);
 }
 
-PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
+PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface,
+                         const config::IntrospectionCategoryConfig& portIntrospectionConfig) noexcept
 {
     m_roudiMemoryInterface = roudiMemoryInterface;
 
@@ -84,6 +85,14 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
 
+    m_portIntrospection.setDetailLevel(portIntrospectionConfig.level);
+    m_portIntrospection.setSendInterval(portIntrospectionConfig.interval);
+    if (portIntrospectionConfig.level == IntrospectionLevel::OFF)
+    {
+        IOX_LOG(INFO, "The port introspection is disabled");
+        return;
+    }
+
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
     {
@@ -118,6 +127,9 @@ void PortManager::stopPortIntrospection() noexcept
 
 void PortManager::doDiscovery() noexcept
 {
+    m_remainingPortTeardowns = MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN;
+    m_hasPendingPortTeardowns = false;
+
     handlePublisherPorts();
 
     handleSubscriberPorts();
@@ -146,7 +158,7 @@ void PortManager::handlePublisherPorts() noexcept
         doDiscoveryForPublisherPort(publisherPort);
 
         // check if we have to destroy this publisher port
-        if (publisherPort.toBeDestroyed())
+        if (publisherPort.toBeDestroyed() && tryAcquirePortTeardown())
         {
             destroyPublisherPort(currentPort.to_ptr());
         }
@@ -195,7 +207,7 @@ void PortManager::handleSubscriberPorts() noexcept
         doDiscoveryForSubscriberPort(subscriberPort);
 
         // check if we have to destroy this subscriber port
-        if (subscriberPort.toBeDestroyed())
+        if (subscriberPort.toBeDestroyed() && tryAcquirePortTeardown())
         {
             destroySubscriberPort(currentPort.to_ptr());
         }
@@ -279,7 +291,7 @@ void PortManager::handleClientPorts() noexcept
         doDiscoveryForClientPort(clientPort);
 
         // check if we have to destroy this clinet port
-        if (clientPort.toBeDestroyed())
+        if (clientPort.toBeDestroyed() && tryAcquirePortTeardown())
         {
             destroyClientPort(currentPort.to_ptr());
         }
@@ -377,7 +389,7 @@ void PortManager::handleServerPorts() noexcept
         doDiscoveryForServerPort(serverPort);
 
         // check if we have to destroy this server port
-        if (serverPort.toBeDestroyed())
+        if (serverPort.toBeDestroyed() && tryAcquirePortTeardown())
         {
             destroyServerPort(currentPort.to_ptr());
         }
@@ -495,7 +507,8 @@ void PortManager::handleConditionVariables() noexcept
     while (condVar != condVars.end())
     {
         auto currentCondVar = condVar++;
-        if (currentCondVar->m_toBeDestroyed.load(std::memory_order_relaxed))
+        // a condition variable might still be referenced by a port which could not be destroyed in this run
+        if (currentCondVar->m_toBeDestroyed.load(std::memory_order_relaxed) && !m_hasPendingPortTeardowns)
         {
             IOX_LOG(DEBUG, "Destroy ConditionVariableData from runtime '" << currentCondVar->m_runtimeName << "'");
             m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
@@ -503,6 +516,23 @@ void PortManager::handleConditionVariables() noexcept
     }
 }
 
+bool PortManager::tryAcquirePortTeardown() noexcept
+{
+    if (m_remainingPortTeardowns == 0U)
+    {
+        m_hasPendingPortTeardowns = true;
+        return false;
+    }
+
+    --m_remainingPortTeardowns;
+    return true;
+}
+
+bool PortManager::hasPendingPortTeardowns() const noexcept
+{
+    return m_hasPendingPortTeardowns;
+}
+
 bool PortManager::isCompatiblePubSub(const PublisherPortRouDiType& publisher,
                                      const SubscriberPortType& subscriber) const noexcept
 {
@@ -669,7 +699,18 @@ void PortManager::sendToAllMatchingClientPorts(const capro::CaproMessage& messag
 bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& message,
                                                popo::ClientPortRouDi& clientSource) noexcept
 {
+    auto sendResponseToClient = [&clientSource](const capro::CaproMessage& serverResponse) {
+        clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse).and_then([](auto& response) {
+            IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
+            IOX_PANIC("Expected no response on ACK or NACK messages");
+        });
+    };
+
+    // with multiple servers for the service, the client is connected to every server which acknowledges the CONNECT
+    // but it expects a NACK only when no server acknowledged and only a single response to a DISCONNECT
     bool serverFound = false;
+    bool responseSent = false;
+    optional<capro::CaproMessage> pendingResponse;
     for (auto& serverPortData : m_portPool->getServerPortDataList())
     {
         popo::ServerPortRouDi serverPort(serverPortData);
@@ -681,18 +722,28 @@ bool PortManager::sendToAllMatchingServerPorts(const capro::CaproMessage& messag
             // if the server react on the change, process it immediately on client side
             if (serverResponse.has_value())
             {
-                // send response to client port
-                clientSource.dispatchCaProMessageAndGetPossibleResponse(serverResponse.value())
-                    .and_then([](auto& response) {
-                        IOX_LOG(FATAL, "Got response '" << response.m_type << "'");
-                        IOX_PANIC("Expected no response on ACK or NACK messages");
-                    });
+                if (capro::CaproMessageType::CONNECT == message.m_type
+                    && capro::CaproMessageType::ACK == serverResponse->m_type)
+                {
+                    sendResponseToClient(serverResponse.value());
+                    responseSent = true;
+                }
+                else if (!pendingResponse.has_value())
+                {
+                    pendingResponse = serverResponse;
+                }
 
                 /// @todo iox-#1128 inform port introspection about client
             }
             serverFound = true;
         }
     }
+
+    if (!responseSent && pendingResponse.has_value())
+    {
+        sendResponseToClient(pendingResponse.value());
+    }
+
     return serverFound;
 }
 
@@ -831,6 +882,67 @@ void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcep
     }
 }
 
+void PortManager::scheduleDeletionOfPortsOfProcess(const RuntimeName_t& runtimeName) noexcept
+{
+    // RouDi's own ports include the service registry publisher which needs special handling
+    if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
+    {
+        deletePortsOfProcess(runtimeName);
+        return;
+    }
+
+    // only the ports are marked here, the expensive teardown with the distribution of the STOP_OFFER and UNSUB
+    // messages to the peers is done by the discovery loop; ports which are acquired later by a new process with the
+    // same runtime name are not affected
+    for (auto& port : m_portPool->getPublisherPortDataList())
+    {
+        if (runtimeName == port.m_runtimeName)
+        {
+            port.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& port : m_portPool->getSubscriberPortDataList())
+    {
+        if (runtimeName == port.m_runtimeName)
+        {
+            port.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& port : m_portPool->getServerPortDataList())
+    {
+        if (runtimeName == port.m_runtimeName)
+        {
+            port.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& port : m_portPool->getClientPortDataList())
+    {
+        if (runtimeName == port.m_runtimeName)
+        {
+            port.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& port : m_portPool->getInterfacePortDataList())
+    {
+        if (runtimeName == port.m_runtimeName)
+        {
+            port.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+
+    for (auto& condVar : m_portPool->getConditionVariableDataList())
+    {
+        if (runtimeName == condVar.m_runtimeName)
+        {
+            condVar.m_toBeDestroyed.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
 {
     // create temporary publisher ports to orderly shut this publisher down
@@ -1034,7 +1146,7 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                                    mepoo::MemoryManager* const payloadDataSegmentMemoryManager,
                                    const PortConfigInfo& portConfigInfo) noexcept
 {
-    // it is not allowed to have two servers with the same ServiceDescription;
+    // it is not allowed to have two servers with the same ServiceDescription unless all of them allow it;
     // check if the server is already in the list
     auto& serverPorts = m_portPool->getServerPortDataList();
     auto port = serverPorts.begin();
@@ -1049,6 +1161,10 @@ PortManager::acquireServerPortData(const capro::ServiceDescription& service,
                 destroyServerPort(currentPort.to_ptr());
                 continue;
             }
+            if (serverOptions.allowMultipleServers && currentPort->m_allowMultipleServers)
+            {
+                continue;
+            }
             IOX_LOG(WARN,
                     "Process '"
                         << runtimeName
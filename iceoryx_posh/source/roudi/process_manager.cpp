@@ -306,6 +306,11 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     }
     m_processList.emplace_back(name, m_domainId, pid, user, heartbeatPoolIndex, sessionId);
 
+    if (isMonitored && m_processTerminationMonitor != nullptr)
+    {
+        IOX_DISCARD_RESULT(m_processTerminationMonitor->add(pid));
+    }
+
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
 
@@ -316,7 +321,10 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
-    m_processIntrospection->addProcess(static_cast<int>(pid), name);
+    if (m_processIntrospection != nullptr)
+    {
+        m_processIntrospection->addProcess(static_cast<int>(pid), name);
+    }
 
     IOX_LOG(DEBUG, "Registered new application " << name);
     return true;
@@ -358,8 +366,11 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
-        m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
+        m_portManager.scheduleDeletionOfPortsOfProcess(processIter->getName());
+        if (m_processIntrospection != nullptr)
+        {
+            m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
+        }
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
         {
@@ -369,6 +380,11 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
             processIter->sendViaIpcChannel(sendBuffer);
         }
 
+        if (m_processTerminationMonitor != nullptr)
+        {
+            m_processTerminationMonitor->remove(processIter->getPid());
+        }
+
         auto heartbeatIter = m_heartbeatPool->iter_from_index(processIter->getHeartbeatPoolIndex());
         if (heartbeatIter != m_heartbeatPool->end())
         {
@@ -676,12 +692,22 @@ void ProcessManager::initIntrospection(ProcessIntrospectionType* processIntrospe
     m_processIntrospection = processIntrospection;
 }
 
+void ProcessManager::initProcessTerminationMonitor(ProcessTerminationMonitor* processTerminationMonitor) noexcept
+{
+    m_processTerminationMonitor = processTerminationMonitor;
+}
+
 void ProcessManager::run() noexcept
 {
     monitorProcesses();
     discoveryUpdate();
 }
 
+bool ProcessManager::hasPendingPortTeardowns() const noexcept
+{
+    return m_portManager.hasPendingPortTeardowns();
+}
+
 popo::PublisherPortData*
 ProcessManager::addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept
 {
@@ -708,6 +734,24 @@ void ProcessManager::monitorProcesses() noexcept
 {
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
+    if (m_processTerminationMonitor != nullptr)
+    {
+        auto processIterator = m_processList.begin();
+        while (processIterator != m_processList.end())
+        {
+            if (!m_processTerminationMonitor->hasTerminated(processIterator->getPid()))
+            {
+                ++processIterator;
+                continue;
+            }
+
+            IOX_LOG(WARN, "Application " << processIterator->getName() << " terminated --> removing it");
+            // the iterator is advanced to the next process by the removal
+            IOX_DISCARD_RESULT(removeProcessAndDeleteRespectiveSharedMemoryObjects(
+                processIterator, TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS));
+        }
+    }
+
     auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
     auto heartbeatIterator = m_heartbeatPool->begin();
     while (heartbeatIterator != m_heartbeatPool->end())
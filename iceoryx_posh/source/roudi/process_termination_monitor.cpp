@@ -0,0 +1,213 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iceoryx_platform/poll.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/logging.hpp"
+#include "iox/thread.hpp"
+
+namespace iox
+{
+namespace roudi
+{
+ProcessTerminationMonitor::ProcessTerminationMonitor(const TerminationCallback& onTermination) noexcept
+    : m_onTermination(onTermination)
+{
+    if (isSupported())
+    {
+        m_thread = std::thread(&ProcessTerminationMonitor::run, this);
+    }
+}
+
+ProcessTerminationMonitor::~ProcessTerminationMonitor() noexcept
+{
+    stop();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& process : m_processes)
+    {
+        iox_close(process.pidfd);
+    }
+    m_processes.clear();
+}
+
+bool ProcessTerminationMonitor::isSupported() noexcept
+{
+    static const bool IS_SUPPORTED = [] {
+        const auto pidfd = iox_pidfd_open(getpid());
+        if (pidfd < 0)
+        {
+            IOX_LOG(INFO,
+                    "Process file descriptors are not supported; the termination of processes is only detected via "
+                    "the heartbeat");
+            return false;
+        }
+        iox_close(pidfd);
+        return true;
+    }();
+    return IS_SUPPORTED;
+}
+
+bool ProcessTerminationMonitor::add(const uint32_t pid) noexcept
+{
+    if (!m_thread.joinable())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& process : m_processes)
+    {
+        if (process.pid == pid && !process.isRemoved)
+        {
+            return true;
+        }
+    }
+
+    if (m_processes.size() >= m_processes.capacity())
+    {
+        IOX_LOG(WARN, "Too many processes to monitor the termination of process with pid " << pid);
+        return false;
+    }
+
+    const auto pidfd = iox_pidfd_open(static_cast<pid_t>(pid));
+    if (pidfd < 0)
+    {
+        IOX_LOG(WARN, "Unable to monitor the termination of process with pid " << pid);
+        return false;
+    }
+
+    MonitoredProcess process;
+    process.pid = pid;
+    process.pidfd = pidfd;
+    m_processes.push_back(process);
+    return true;
+}
+
+void ProcessTerminationMonitor::remove(const uint32_t pid) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& process : m_processes)
+    {
+        // the file descriptor is closed by the background thread in order to not close it while it is waited on;
+        // a new process file descriptor could otherwise get the same number and be mistaken as terminated
+        if (process.pid == pid)
+        {
+            process.isRemoved = true;
+        }
+    }
+}
+
+bool ProcessTerminationMonitor::hasTerminated(const uint32_t pid) const noexcept
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& process : m_processes)
+    {
+        if (process.pid == pid && !process.isRemoved)
+        {
+            return process.hasTerminated;
+        }
+    }
+    return false;
+}
+
+void ProcessTerminationMonitor::stop() noexcept
+{
+    m_keepRunning = false;
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void ProcessTerminationMonitor::closeRemovedProcesses() noexcept
+{
+    auto iter = m_processes.begin();
+    while (iter != m_processes.end())
+    {
+        if (iter->isRemoved)
+        {
+            iox_close(iter->pidfd);
+            // erase shifts the subsequent processes to the position of 'iter'
+            m_processes.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+void ProcessTerminationMonitor::run() noexcept
+{
+    setThreadName("ProcTermMon");
+
+    const auto timeout = static_cast<int>(PROCESS_TERMINATION_MONITOR_UPDATE_INTERVAL.toMilliseconds());
+    vector<iox_pollfd_t, MAX_PROCESS_NUMBER> pollfds;
+    while (m_keepRunning)
+    {
+        pollfds.clear();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            closeRemovedProcesses();
+            for (const auto& process : m_processes)
+            {
+                if (!process.hasTerminated)
+                {
+                    iox_pollfd_t entry{};
+                    entry.fd = process.pidfd;
+                    entry.events = IOX_POLLIN;
+                    pollfds.push_back(entry);
+                }
+            }
+        }
+
+        // without any process the call just waits for the timeout to pick up newly added processes
+        if (iox_poll(pollfds.data(), pollfds.size(), timeout) <= 0)
+        {
+            continue;
+        }
+
+        bool hasDetectedTermination{false};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& entry : pollfds)
+            {
+                if (entry.revents == 0)
+                {
+                    continue;
+                }
+                for (auto& process : m_processes)
+                {
+                    if (process.pidfd == entry.fd)
+                    {
+                        process.hasTerminated = true;
+                        hasDetectedTermination = true;
+                    }
+                }
+            }
+        }
+
+        if (hasDetectedTermination)
+        {
+            m_onTermination();
+        }
+    }
+}
+} // namespace roudi
+} // namespace iox
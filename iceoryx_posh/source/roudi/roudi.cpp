@@ -17,6 +17,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_posh/popo/client_options.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
 #include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
@@ -32,6 +35,24 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+/// @brief The runtime sends the port options as hex representation of their binary serialization. The textual
+/// serialization is still accepted, e.g. for messages which are written by hand while debugging; it always contains
+/// the ':' separator and can therefore not be mistaken for the hex representation.
+template <typename Options>
+expected<Options, Serialization::Error> deserializeOptions(const std::string& serializedOptions) noexcept
+{
+    auto binarySerialization =
+        Options::BinarySerialization_t::fromHexString(serializedOptions.c_str(), serializedOptions.size());
+    if (binarySerialization.has_value())
+    {
+        return Options::deserialize(binarySerialization.value());
+    }
+    return Options::deserialize(Serialization(serializedOptions));
+}
+} // namespace
+
 RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
              PortManager& portManager,
              const config::RouDiConfig& roudiConfig) noexcept
@@ -45,23 +66,48 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
                portManager,
                m_roudiConfig.domainId,
                m_roudiConfig.compatibilityCheckLevel)
-    , m_mempoolIntrospection(
-          *m_roudiMemoryInterface->introspectionMemoryManager().value(),
-          *m_roudiMemoryInterface->segmentManager().value(),
-          PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)))
 {
     if (detail::isCompiledOn32BitSystem())
     {
         IOX_LOG(WARN, "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!");
     }
-    m_processIntrospection.registerPublisherPort(
-        PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
-    m_prcMgr->initIntrospection(&m_processIntrospection);
-    m_processIntrospection.run();
-    m_mempoolIntrospection.run();
 
-    // since RouDi offers the introspection services, also add it to the list of processes
-    m_processIntrospection.addProcess(getpid(), IPC_CHANNEL_ROUDI_NAME);
+    // a disabled introspection category neither gets a publisher port nor a publishing thread
+    const auto& introspectionConfig = m_roudiConfig.introspection;
+    if (introspectionConfig.mempool.level != IntrospectionLevel::OFF)
+    {
+        m_mempoolIntrospection.emplace(
+            *m_roudiMemoryInterface->introspectionMemoryManager().value(),
+            *m_roudiMemoryInterface->segmentManager().value(),
+            PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionMempoolService)));
+        m_mempoolIntrospection->setSendInterval(introspectionConfig.mempool.interval);
+    }
+    if (introspectionConfig.process.level != IntrospectionLevel::OFF)
+    {
+        m_processIntrospection.registerPublisherPort(
+            PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
+        m_processIntrospection.setSendInterval(introspectionConfig.process.interval);
+        m_prcMgr->initIntrospection(&m_processIntrospection);
+    }
+
+    // the heartbeat detects crashed processes only after the keep alive timeout; where supported by the platform, the
+    // termination is additionally detected immediately and the discovery loop cleans up the resources right away
+    if (m_roudiConfig.monitoringMode == roudi::MonitoringMode::ON && !m_roudiConfig.sharesAddressSpaceWithApplications
+        && ProcessTerminationMonitor::isSupported())
+    {
+        m_processTerminationMonitor.emplace([this] { m_processTerminationTrigger.trigger(); });
+        m_prcMgr->initProcessTerminationMonitor(&m_processTerminationMonitor.value());
+    }
+    if (m_mempoolIntrospection.has_value())
+    {
+        m_mempoolIntrospection->run();
+    }
+    if (introspectionConfig.process.level != IntrospectionLevel::OFF)
+    {
+        m_processIntrospection.run();
+        // since RouDi offers the introspection services, also add it to the list of processes
+        m_processIntrospection.addProcess(getpid(), IPC_CHANNEL_ROUDI_NAME);
+    }
 
     // initialize semaphore for discovery loop finish indicator
     UnnamedSemaphoreBuilder()
@@ -98,9 +144,17 @@ void RouDi::shutdown() noexcept
     m_runMonitoringAndDiscoveryThread = false;
     m_discoveryLoopTrigger.trigger();
 
+    if (m_processTerminationMonitor.has_value())
+    {
+        m_processTerminationMonitor->stop();
+    }
+
     // stop the introspection
     m_processIntrospection.stop();
-    m_mempoolIntrospection.stop();
+    if (m_mempoolIntrospection.has_value())
+    {
+        m_mempoolIntrospection->stop();
+    }
     m_portManager->stopPortIntrospection();
 
     // wait for the monitoring and discovery thread to stop
@@ -202,7 +256,7 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
+    class DiscoveryWaitSet : public popo::WaitSet<2>
     {
       public:
         DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
@@ -213,7 +267,9 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
 
     popo::ConditionVariableData conditionVariableData;
     DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach the discovery loop trigger");
+    discoveryLoopWaitset.attachEvent(m_processTerminationTrigger)
+        .expect("Failed to attach the process termination trigger");
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
@@ -232,7 +288,11 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        // the ports of removed processes are destroyed in bounded chunks per run; keep the runs going until the
+        // teardown is finished but release the lock in between to not stall the runtime requests
+        const auto discoveryInterval =
+            m_prcMgr->hasPendingPortTeardowns() ? PORT_TEARDOWN_DISCOVERY_INTERVAL : DISCOVERY_INTERVAL;
+        for (const auto& notification : discoveryLoopWaitset.timedWait(discoveryInterval))
         {
             if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
             {
@@ -351,7 +411,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             const auto& service = deserializationResult.value();
 
             auto publisherOptionsDeserializationResult =
-                popo::PublisherOptions::deserialize(Serialization(message.getElementAtIndex(3)));
+                deserializeOptions<popo::PublisherOptions>(message.getElementAtIndex(3));
             if (publisherOptionsDeserializationResult.has_error())
             {
                 IOX_LOG(ERROR,
@@ -390,7 +450,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             const auto& service = deserializationResult.value();
 
             auto subscriberOptionsDeserializationResult =
-                popo::SubscriberOptions::deserialize(Serialization(message.getElementAtIndex(3)));
+                deserializeOptions<popo::SubscriberOptions>(message.getElementAtIndex(3));
             if (subscriberOptionsDeserializationResult.has_error())
             {
                 IOX_LOG(ERROR,
@@ -429,7 +489,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             const auto& service = deserializationResult.value();
 
             auto clientOptionsDeserializationResult =
-                popo::ClientOptions::deserialize(Serialization(message.getElementAtIndex(3)));
+                deserializeOptions<popo::ClientOptions>(message.getElementAtIndex(3));
             if (clientOptionsDeserializationResult.has_error())
             {
                 IOX_LOG(ERROR,
@@ -467,7 +527,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             const auto& service = deserializationResult.value();
 
             auto serverOptionsDeserializationResult =
-                popo::ServerOptions::deserialize(Serialization(message.getElementAtIndex(3)));
+                deserializeOptions<popo::ServerOptions>(message.getElementAtIndex(3));
             if (serverOptionsDeserializationResult.has_error())
             {
                 IOX_LOG(ERROR,
@@ -22,11 +22,79 @@
 
 #include "iceoryx_platform/getopt.hpp"
 #include <iostream>
+#include <string>
 
 namespace iox
 {
 namespace config
 {
+namespace
+{
+/// @brief applies an introspection option of the form '<CATEGORY>:<LEVEL>[:<INTERVAL_MS>]' to the command line args
+/// @return false if the option is malformed
+bool applyIntrospectionOption(const char* option, CmdLineArgs_t& cmdLineArgs) noexcept
+{
+    const std::string value{option};
+    const auto categoryEnd = value.find(':');
+    if (categoryEnd == std::string::npos)
+    {
+        return false;
+    }
+    const auto category = value.substr(0U, categoryEnd);
+    const auto levelEnd = value.find(':', categoryEnd + 1U);
+    const auto level = value.substr(categoryEnd + 1U,
+                                    (levelEnd == std::string::npos) ? std::string::npos : levelEnd - categoryEnd - 1U);
+
+    auto maybeLevel = introspectionLevelFromString(level.c_str());
+    if (!maybeLevel.has_value())
+    {
+        return false;
+    }
+
+    optional<units::Duration> maybeInterval;
+    if (levelEnd != std::string::npos)
+    {
+        auto maybeIntervalInMs = convert::from_string<uint32_t>(value.substr(levelEnd + 1U).c_str());
+        if (!maybeIntervalInMs.has_value() || maybeIntervalInMs.value() == 0U)
+        {
+            return false;
+        }
+        maybeInterval.emplace(units::Duration::fromMilliseconds(maybeIntervalInMs.value()));
+    }
+
+    const bool allCategories = (category == "all");
+    if (!allCategories && category != "mempool" && category != "process" && category != "port")
+    {
+        return false;
+    }
+
+    auto apply = [&](IntrospectionCategoryConfig& categoryConfig, bool& overridden) {
+        categoryConfig.level = maybeLevel.value();
+        if (maybeInterval.has_value())
+        {
+            categoryConfig.interval = maybeInterval.value();
+        }
+        overridden = true;
+    };
+
+    auto& introspection = cmdLineArgs.roudiConfig.introspection;
+    auto& overrides = cmdLineArgs.introspectionOverrides;
+    if (allCategories || category == "mempool")
+    {
+        apply(introspection.mempool, overrides.mempool);
+    }
+    if (allCategories || category == "process")
+    {
+        apply(introspection.process, overrides.process);
+    }
+    if (allCategories || category == "port")
+    {
+        apply(introspection.port, overrides.port);
+    }
+    return true;
+}
+} // namespace
+
 expected<CmdLineArgs_t, CmdLineParserResult>
 CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cmdLineParsingMode) noexcept
 {
@@ -39,10 +107,11 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {"compatibility", required_argument, nullptr, 'x'},
                                        {"termination-delay", required_argument, nullptr, 't'},
                                        {"kill-delay", required_argument, nullptr, 'k'},
+                                       {"introspection", required_argument, nullptr, 'i'},
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:l:d:u:x:t:k:i:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -92,6 +161,17 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  SIGKILL to application which did not respond" << std::endl;
             std::cout << "                                  to the initial SIGTERM signal." << std::endl;
             std::cout << "                                  default = '45'" << std::endl;
+            std::cout << "-i, --introspection <CATEGORY>:<LEVEL>[:<INTERVAL>]" << std::endl;
+            std::cout << "                                  Configures an introspection category; it can" << std::endl;
+            std::cout << "                                  be given multiple times and overrides" << std::endl;
+            std::cout << "                                  the config file." << std::endl;
+            std::cout << "                                  <CATEGORY> {mempool, process, port, all}" << std::endl;
+            std::cout << "                                  <LEVEL> {off, basic, full}" << std::endl;
+            std::cout << "                                  off: no data is tracked and published" << std::endl;
+            std::cout << "                                  basic: only the port list for 'port'" << std::endl;
+            std::cout << "                                  full: all data" << std::endl;
+            std::cout << "                                  <INTERVAL> publish interval in milliseconds" << std::endl;
+            std::cout << "                                  default = 'all:full:1000'" << std::endl;
 
             m_cmdLineArgs.run = false;
             break;
@@ -220,6 +300,18 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             m_cmdLineArgs.roudiConfig.processKillDelay = units::Duration::fromSeconds(maybeValue.value());
             break;
         }
+        case 'i':
+        {
+            if (!applyIntrospectionOption(optarg, m_cmdLineArgs))
+            {
+                IOX_LOG(ERROR,
+                        "The introspection option must be '<CATEGORY>:<LEVEL>[:<INTERVAL>]' with the categories "
+                        "'mempool', 'process', 'port' and 'all', the levels 'off', 'basic' and 'full' and an "
+                        "interval in milliseconds greater than 0!");
+                return err(CmdLineParserResult::INVALID_PARAMETER);
+            }
+            break;
+        }
         case 'x':
         {
             if (strcmp(optarg, "off") == 0)
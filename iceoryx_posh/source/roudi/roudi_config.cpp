@@ -16,10 +16,29 @@
 
 #include "iceoryx_posh/roudi/roudi_config.hpp"
 
+#include <cstring>
+
 namespace iox
 {
 namespace config
 {
+optional<roudi::IntrospectionLevel> introspectionLevelFromString(const char* value) noexcept
+{
+    if (strcmp(value, "off") == 0)
+    {
+        return roudi::IntrospectionLevel::OFF;
+    }
+    if (strcmp(value, "basic") == 0)
+    {
+        return roudi::IntrospectionLevel::BASIC;
+    }
+    if (strcmp(value, "full") == 0)
+    {
+        return roudi::IntrospectionLevel::FULL;
+    }
+    return nullopt;
+}
+
 RouDiConfig& RouDiConfig::setDefaults() noexcept
 {
     *this = RouDiConfig();
@@ -35,12 +35,51 @@ namespace iox
 {
 namespace config
 {
+namespace
+{
+iox::expected<void, iox::roudi::RouDiConfigFileParseError>
+parseIntrospectionCategory(const cpptoml::table& introspection,
+                           const std::string& category,
+                           IntrospectionCategoryConfig& categoryConfig) noexcept
+{
+    auto categoryTable = introspection.get_table(category);
+    if (!categoryTable)
+    {
+        return iox::ok();
+    }
+
+    auto level = categoryTable->get_as<std::string>("level");
+    if (level)
+    {
+        auto maybeLevel = introspectionLevelFromString(level->c_str());
+        if (!maybeLevel.has_value())
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_INTROSPECTION_LEVEL);
+        }
+        categoryConfig.level = maybeLevel.value();
+    }
+
+    auto intervalInMs = categoryTable->get_as<uint32_t>("interval_ms");
+    if (intervalInMs)
+    {
+        if (*intervalInMs == 0U)
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_INTROSPECTION_INTERVAL);
+        }
+        categoryConfig.interval = units::Duration::fromMilliseconds(*intervalInMs);
+    }
+
+    return iox::ok();
+}
+} // namespace
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
     if (cmdLineArgs.run)
     {
         m_roudiConfig = cmdLineArgs.roudiConfig;
+        m_introspectionOverrides = cmdLineArgs.introspectionOverrides;
         if (cmdLineArgs.configFilePath.empty())
         {
             FileReader configFile(defaultConfigFilePath, "", FileReader::ErrorMode::Ignore);
@@ -82,7 +121,21 @@ iox::expected<iox::IceoryxConfig, iox::roudi::RouDiConfigFileParseError> TomlRou
     }
 
     return TomlRouDiConfigFileProvider::parse(fileStream).and_then([this](auto& config) {
+        // only the introspection is configurable in the file; the categories set on the command line take precedence
+        const auto introspectionFromFile = config.introspection;
         static_cast<RouDiConfig&>(config) = m_roudiConfig;
+        if (!m_introspectionOverrides.mempool)
+        {
+            config.introspection.mempool = introspectionFromFile.mempool;
+        }
+        if (!m_introspectionOverrides.process)
+        {
+            config.introspection.process = introspectionFromFile.process;
+        }
+        if (!m_introspectionOverrides.port)
+        {
+            config.introspection.port = introspectionFromFile.port;
+        }
     });
 }
 
@@ -166,6 +219,24 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
              mempoolConfig});
     }
 
+    auto introspection = parsedFile->get_table("introspection");
+    if (introspection)
+    {
+        auto& introspectionConfig = parsedConfig.introspection;
+        const std::pair<const char*, IntrospectionCategoryConfig*> categories[] = {
+            {"mempool", &introspectionConfig.mempool},
+            {"process", &introspectionConfig.process},
+            {"port", &introspectionConfig.port}};
+        for (const auto& category : categories)
+        {
+            auto result = parseIntrospectionCategory(*introspection, category.first, *category.second);
+            if (result.has_error())
+            {
+                return iox::err(result.error());
+            }
+        }
+    }
+
     return iox::ok(parsedConfig);
 }
 } // namespace config
@@ -50,18 +50,21 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         auto& entry = m_serviceDescriptions[m_freeIndex];
         entry.emplace(serviceDescription);
         (*entry).*count = 1U;
+        addToHashIndex(m_freeIndex);
         m_dataChanged = true;
         m_freeIndex = NO_INDEX;
         return ok();
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
     {
+        auto& entry = m_serviceDescriptions[i];
         if (!entry)
         {
             entry.emplace(serviceDescription);
             (*entry).*count = 1U;
+            addToHashIndex(i);
             m_dataChanged = true;
             return ok();
         }
@@ -73,6 +76,7 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         auto& entry = m_serviceDescriptions.back();
         entry.emplace(serviceDescription);
         (*entry).*count = 1U;
+        addToHashIndex(static_cast<uint32_t>(m_serviceDescriptions.size() - 1U));
         m_dataChanged = true;
         return ok();
     }
@@ -103,10 +107,7 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -123,10 +124,7 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                removeEntry(index);
             }
         }
     }
@@ -137,19 +135,35 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        removeEntry(index);
     }
 }
 
+void ServiceRegistry::removeEntry(const uint32_t index) noexcept
+{
+    removeFromHashIndex(index);
+    m_serviceDescriptions[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = index;
+    m_dataChanged = true;
+}
+
 void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& instance,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
+    // without wildcards, the hash index yields the only possible entry
+    if (service && instance && event)
+    {
+        auto index = findIndex(capro::ServiceDescription(*service, *instance, *event));
+        if (index != NO_INDEX)
+        {
+            callable(*m_serviceDescriptions[index]);
+        }
+        return;
+    }
+
     for (auto& entry : m_serviceDescriptions)
     {
         if (entry)
@@ -168,17 +182,60 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
+    // an empty slot terminates the probe sequence, the entries with the same hash are compared completely
+    for (uint32_t slot = static_cast<uint32_t>(serviceDescription.getHash()) & HASH_INDEX_MASK;
+         m_hashIndex[slot] != EMPTY_SLOT;
+         slot = (slot + 1U) & HASH_INDEX_MASK)
     {
-        auto& entry = m_serviceDescriptions[i];
+        const auto index = m_hashIndex[slot] - 1U;
+        auto& entry = m_serviceDescriptions[index];
         if (entry && entry->serviceDescription == serviceDescription)
         {
-            return i;
+            return index;
         }
     }
     return NO_INDEX;
 }
 
+uint32_t ServiceRegistry::hashIndexSlot(const uint32_t index) const noexcept
+{
+    return static_cast<uint32_t>(m_serviceDescriptions[index]->serviceDescription.getHash()) & HASH_INDEX_MASK;
+}
+
+void ServiceRegistry::addToHashIndex(const uint32_t index) noexcept
+{
+    // the hash index has at least twice the capacity of the registry, therefore a free slot always exists
+    auto slot = hashIndexSlot(index);
+    while (m_hashIndex[slot] != EMPTY_SLOT)
+    {
+        slot = (slot + 1U) & HASH_INDEX_MASK;
+    }
+    m_hashIndex[slot] = index + 1U;
+}
+
+void ServiceRegistry::removeFromHashIndex(const uint32_t index) noexcept
+{
+    auto hole = hashIndexSlot(index);
+    while (m_hashIndex[hole] != index + 1U)
+    {
+        hole = (hole + 1U) & HASH_INDEX_MASK;
+    }
+
+    // backward shift deletion; entries behind the hole move into it unless this would place them in front of their
+    // home slot, so that no probe sequence is interrupted and no tombstones are required
+    for (uint32_t slot = (hole + 1U) & HASH_INDEX_MASK; m_hashIndex[slot] != EMPTY_SLOT;
+         slot = (slot + 1U) & HASH_INDEX_MASK)
+    {
+        const auto home = hashIndexSlot(m_hashIndex[slot] - 1U);
+        if (((slot - home) & HASH_INDEX_MASK) >= ((slot - hole) & HASH_INDEX_MASK))
+        {
+            m_hashIndex[hole] = m_hashIndex[slot];
+            hole = slot;
+        }
+    }
+    m_hashIndex[hole] = EMPTY_SLOT;
+}
+
 void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
     for (auto& entry : m_serviceDescriptions)
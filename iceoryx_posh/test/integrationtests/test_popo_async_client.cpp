@@ -0,0 +1,445 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/async_client.hpp"
+#include "iceoryx_posh/popo/listener.hpp"
+#include "iceoryx_posh/popo/server.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::capro;
+using namespace iox::runtime;
+using namespace iox::roudi_env;
+using namespace iox::units::duration_literals;
+
+struct DummyRequest
+{
+    uint64_t value{0U};
+};
+
+struct DummyResponse
+{
+    uint64_t value{0U};
+};
+
+struct Completion
+{
+    bool hasResponse{false};
+    uint64_t value{0U};
+    int64_t sequenceId{-1};
+    optional<AsyncRequestError> error;
+};
+
+class AsyncClient_test : public RouDi_GTest
+{
+  public:
+    static constexpr uint64_t IN_FLIGHT_CAPACITY{4U};
+    using SUT = AsyncClient<DummyRequest, DummyResponse, IN_FLIGHT_CAPACITY>;
+
+    AsyncClient_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().create())
+    {
+    }
+
+    void SetUp() override
+    {
+        PoshRuntime::initRuntime("AsyncClient_test");
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    expected<int64_t, AsyncRequestError>
+    sendRequest(SUT& sut, const uint64_t value, Completion& completion, const units::Duration timeout = 5_s)
+    {
+        auto loanResult = sut.loan();
+        if (loanResult.has_error())
+        {
+            return err(AsyncRequestError::SEND_FAILED);
+        }
+        auto& request = loanResult.value();
+        request->value = value;
+        return sut.send(std::move(request), timeout, [&completion](auto&& result) {
+            if (result.has_value())
+            {
+                completion.hasResponse = true;
+                completion.value = result.value()->value;
+                completion.sequenceId = result.value().getResponseHeader().getSequenceId();
+            }
+            else
+            {
+                completion.error.emplace(result.error());
+            }
+        });
+    }
+
+    /// @brief takes all requests and answers them in reverse order with the request value plus an offset
+    uint64_t respondInReverseOrder(Server<DummyRequest, DummyResponse>& server)
+    {
+        std::vector<Request<const DummyRequest>> requests;
+        while (true)
+        {
+            auto takeResult = server.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            requests.emplace_back(std::move(takeResult.value()));
+        }
+
+        const uint64_t numberOfRequests = requests.size();
+        while (!requests.empty())
+        {
+            auto& request = requests.back();
+            server.loan(request)
+                .and_then([&](auto& response) {
+                    response->value = request->value + RESPONSE_OFFSET;
+                    EXPECT_FALSE(server.send(std::move(response)).has_error());
+                })
+                .or_else([](const auto&) { GTEST_FAIL() << "Expected to loan a response"; });
+            requests.pop_back();
+        }
+        return numberOfRequests;
+    }
+
+    static constexpr uint64_t RESPONSE_OFFSET{1000U};
+    static constexpr units::Duration DEADLOCK_TIMEOUT{5_s};
+    Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
+    ServiceDescription sd{"Async", "Client", "Test"};
+};
+constexpr units::Duration AsyncClient_test::DEADLOCK_TIMEOUT;
+
+TEST_F(AsyncClient_test, SendWithoutServerFailsAndDoesNotKeepRequestInFlight)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b1f0d2c-8a3e-4f57-9c21-3d5e8a7b4f10");
+
+    SUT sut{sd};
+    Completion completion;
+
+    auto result = sendRequest(sut, 1U, completion);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(AsyncRequestError::SEND_FAILED));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+    EXPECT_FALSE(completion.hasResponse);
+    EXPECT_FALSE(completion.error.has_value());
+}
+
+TEST_F(AsyncClient_test, SendAssignsIncreasingSequenceIds)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d9e4a71-0c6b-4e38-b5f2-7a1c3e9d8b64");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion completions[2];
+
+    auto first = sendRequest(sut, 1U, completions[0]);
+    auto second = sendRequest(sut, 2U, completions[1]);
+
+    ASSERT_FALSE(first.has_error());
+    ASSERT_FALSE(second.has_error());
+    EXPECT_THAT(second.value(), Eq(first.value() + 1));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(2U));
+}
+
+TEST_F(AsyncClient_test, ResponsesAreDispatchedToTheCallbackOfTheMatchingRequest)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4c7e2f9-5b1d-4c63-8e0a-9f2b6d3c1e57");
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{3U};
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion completions[NUMBER_OF_REQUESTS];
+    int64_t sequenceIds[NUMBER_OF_REQUESTS];
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        auto result = sendRequest(sut, i, completions[i]);
+        ASSERT_FALSE(result.has_error());
+        sequenceIds[i] = result.value();
+    }
+
+    EXPECT_THAT(respondInReverseOrder(server), Eq(NUMBER_OF_REQUESTS));
+    EXPECT_THAT(sut.processResponses(), Eq(NUMBER_OF_REQUESTS));
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        EXPECT_TRUE(completions[i].hasResponse);
+        EXPECT_THAT(completions[i].value, Eq(i + RESPONSE_OFFSET));
+        EXPECT_THAT(completions[i].sequenceId, Eq(sequenceIds[i]));
+        EXPECT_FALSE(completions[i].error.has_value());
+    }
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, SendFailsWhenInFlightTableIsFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f3e8b1a6-7d2c-4b95-a0e4-1c6d9b2f7a38");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion completions[IN_FLIGHT_CAPACITY + 1U];
+
+    for (uint64_t i = 0U; i < IN_FLIGHT_CAPACITY; ++i)
+    {
+        ASSERT_FALSE(sendRequest(sut, i, completions[i]).has_error());
+    }
+
+    auto result = sendRequest(sut, IN_FLIGHT_CAPACITY, completions[IN_FLIGHT_CAPACITY]);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(AsyncRequestError::TOO_MANY_REQUESTS_IN_FLIGHT));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(IN_FLIGHT_CAPACITY));
+}
+
+TEST_F(AsyncClient_test, ExpiredRequestIsCompletedWithTimeoutAndLateResponseIsDropped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0e5a9c3d-4f8b-4a21-b7c6-2d1e8f3a9b05");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion expiringCompletion;
+    Completion pendingCompletion;
+
+    ASSERT_FALSE(sendRequest(sut, 1U, expiringCompletion, 0_s).has_error());
+    ASSERT_FALSE(sendRequest(sut, 2U, pendingCompletion).has_error());
+
+    EXPECT_THAT(sut.expireRequests(), Eq(1U));
+    ASSERT_TRUE(expiringCompletion.error.has_value());
+    EXPECT_THAT(expiringCompletion.error.value(), Eq(AsyncRequestError::TIMEOUT));
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(1U));
+
+    EXPECT_THAT(respondInReverseOrder(server), Eq(2U));
+    EXPECT_THAT(sut.processResponses(), Eq(1U));
+
+    EXPECT_FALSE(expiringCompletion.hasResponse);
+    EXPECT_TRUE(pendingCompletion.hasResponse);
+    EXPECT_THAT(pendingCompletion.value, Eq(2U + RESPONSE_OFFSET));
+}
+
+TEST_F(AsyncClient_test, CancelAllCompletesAllRequestsWithCancelled)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c2b5e8f-1a4d-4d06-9e3b-6f0a2c8d5e19");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion completions[2];
+
+    ASSERT_FALSE(sendRequest(sut, 1U, completions[0]).has_error());
+    ASSERT_FALSE(sendRequest(sut, 2U, completions[1]).has_error());
+
+    EXPECT_THAT(sut.cancelAll(), Eq(2U));
+
+    for (auto& completion : completions)
+    {
+        ASSERT_TRUE(completion.error.has_value());
+        EXPECT_THAT(completion.error.value(), Eq(AsyncRequestError::CANCELLED));
+    }
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, TimeUntilNextDeadlineReturnsTheEarliestDeadline)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8f1a3c5-9e2b-4f74-8a6d-3b7c0e1f2a96");
+
+    constexpr units::Duration SHORT_TIMEOUT{1_s};
+    constexpr units::Duration LONG_TIMEOUT{10_s};
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Completion completions[2];
+
+    EXPECT_FALSE(sut.timeUntilNextDeadline().has_value());
+
+    ASSERT_FALSE(sendRequest(sut, 1U, completions[0], LONG_TIMEOUT).has_error());
+    ASSERT_FALSE(sendRequest(sut, 2U, completions[1], SHORT_TIMEOUT).has_error());
+
+    auto nextDeadline = sut.timeUntilNextDeadline();
+    ASSERT_TRUE(nextDeadline.has_value());
+    EXPECT_THAT(nextDeadline.value(), Le(SHORT_TIMEOUT));
+}
+
+TEST_F(AsyncClient_test, ListenerDispatchesResponses)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5f9c2e7a-3b6d-4e18-a4f0-8c1d7b2e6a43");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Listener listener;
+    std::atomic<bool> isCompleted{false};
+
+    ASSERT_FALSE(sut.attachToListener(listener).has_error());
+
+    auto loanResult = sut.loan();
+    ASSERT_FALSE(loanResult.has_error());
+    loanResult.value()->value = 42U;
+    ASSERT_FALSE(sut.send(std::move(loanResult.value()), 5_s, [&](auto&& result) {
+                        EXPECT_TRUE(result.has_value());
+                        isCompleted = true;
+                    })
+                     .has_error());
+
+    EXPECT_THAT(respondInReverseOrder(server), Eq(1U));
+
+    while (!isCompleted)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+
+    sut.detachFromListener(listener);
+    EXPECT_THAT(listener.size(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, ListenerPostsDispatchToExecutor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2e6d9a1-8c4f-4b37-9d05-e7a3f1c8b264");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Listener listener;
+    std::mutex taskMutex;
+    std::vector<SUT::Task> tasks;
+    Completion completion;
+
+    SUT::Executor executor{[&](const SUT::Task& task) {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        tasks.emplace_back(task);
+    }};
+    ASSERT_FALSE(sut.attachToListener(listener, executor).has_error());
+
+    ASSERT_FALSE(sendRequest(sut, 7U, completion).has_error());
+    EXPECT_THAT(respondInReverseOrder(server), Eq(1U));
+
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(taskMutex);
+            if (!tasks.empty())
+            {
+                break;
+            }
+        }
+        std::this_thread::yield();
+    }
+
+    sut.detachFromListener(listener);
+    // the callback is only called when the executor runs the task
+    EXPECT_FALSE(completion.hasResponse);
+
+    for (auto& task : tasks)
+    {
+        task();
+    }
+    EXPECT_TRUE(completion.hasResponse);
+    EXPECT_THAT(completion.value, Eq(7U + RESPONSE_OFFSET));
+}
+
+TEST_F(AsyncClient_test, ListenerExpiresRequestsWhenTheServerDoesNotRespond)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8d3f5a1c-6e2b-4c97-b0a4-1f7e9c2d5b38");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Listener listener;
+    std::atomic<bool> isExpired{false};
+
+    ASSERT_FALSE(sut.attachToListener(listener).has_error());
+
+    auto loanResult = sut.loan();
+    ASSERT_FALSE(loanResult.has_error());
+    ASSERT_FALSE(sut.send(std::move(loanResult.value()), 10_ms, [&](auto&& result) {
+                        EXPECT_TRUE(result.has_error());
+                        if (result.has_error())
+                        {
+                            EXPECT_THAT(result.error(), Eq(AsyncRequestError::TIMEOUT));
+                        }
+                        isExpired = true;
+                    })
+                     .has_error());
+
+    // neither a response is sent nor is 'processResponses' called
+    while (!isExpired)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_THAT(sut.numberOfRequestsInFlight(), Eq(0U));
+
+    sut.detachFromListener(listener);
+    EXPECT_THAT(listener.size(), Eq(0U));
+}
+
+TEST_F(AsyncClient_test, AttachingTwiceFailsAndKeepsTheExecutor)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c41e7b9d-2a5f-4f06-8e3b-9d6a0c7f1e52");
+
+    SUT sut{sd};
+    Server<DummyRequest, DummyResponse> server{sd};
+    Listener listener;
+    std::mutex taskMutex;
+    std::vector<SUT::Task> tasks;
+    std::atomic<uint64_t> numberOfTasksOfSecondExecutor{0U};
+    Completion completion;
+
+    SUT::Executor executor{[&](const SUT::Task& task) {
+        std::lock_guard<std::mutex> lock(taskMutex);
+        tasks.emplace_back(task);
+    }};
+    SUT::Executor secondExecutor{[&](const SUT::Task&) { ++numberOfTasksOfSecondExecutor; }};
+    ASSERT_FALSE(sut.attachToListener(listener, executor).has_error());
+
+    auto secondAttachResult = sut.attachToListener(listener, secondExecutor);
+    ASSERT_TRUE(secondAttachResult.has_error());
+    EXPECT_THAT(secondAttachResult.error(), Eq(ListenerError::EVENT_ALREADY_ATTACHED));
+
+    ASSERT_FALSE(sendRequest(sut, 3U, completion).has_error());
+    EXPECT_THAT(respondInReverseOrder(server), Eq(1U));
+
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> lock(taskMutex);
+            if (!tasks.empty())
+            {
+                break;
+            }
+        }
+        std::this_thread::yield();
+    }
+
+    sut.detachFromListener(listener);
+    EXPECT_THAT(numberOfTasksOfSecondExecutor.load(), Eq(0U));
+
+    for (auto& task : tasks)
+    {
+        task();
+    }
+    EXPECT_TRUE(completion.hasResponse);
+    EXPECT_THAT(completion.value, Eq(3U + RESPONSE_OFFSET));
+}
+
+} // namespace
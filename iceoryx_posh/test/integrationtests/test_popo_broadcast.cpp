@@ -0,0 +1,224 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/popo/broadcast_reader.hpp"
+#include "iceoryx_posh/popo/broadcast_writer.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_posh/testing/roudi_gtest.hpp"
+
+#include "test.hpp"
+
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::capro;
+using namespace iox::runtime;
+using namespace iox::roudi_env;
+using namespace iox::units::duration_literals;
+
+struct Tick
+{
+    uint64_t counter{0U};
+    int64_t timestamp{0};
+};
+
+class Broadcast_test : public RouDi_GTest
+{
+  public:
+    static constexpr uint64_t CAPACITY{8U};
+
+    Broadcast_test()
+        : RouDi_GTest(MinimalIceoryxConfigBuilder().payloadChunkSize(4096U).create())
+    {
+    }
+
+    void SetUp() override
+    {
+        PoshRuntime::initRuntime("Broadcast_test");
+        deadlockWatchdog.watchAndActOnFailure([] { std::terminate(); });
+    }
+
+    static constexpr units::Duration DEADLOCK_TIMEOUT{5_s};
+    Watchdog deadlockWatchdog{DEADLOCK_TIMEOUT};
+    ServiceDescription sd{"Broadcast", "Ticker", "Test"};
+};
+constexpr uint64_t Broadcast_test::CAPACITY;
+constexpr units::Duration Broadcast_test::DEADLOCK_TIMEOUT;
+
+TEST_F(Broadcast_test, ReaderWithoutWriterHasNoData)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd321677-0d7d-46a1-9c7d-9a7e5c2481aa");
+    BroadcastReader reader{sd};
+
+    EXPECT_FALSE(reader.hasData());
+    auto result = reader.take<Tick>();
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(BroadcastReaderError::NO_DATA_AVAILABLE));
+}
+
+TEST_F(Broadcast_test, AllReadersReceiveAllMessagesOfTheWriter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65c602e2-a31a-45c2-9e37-d02666dd6a23");
+    BroadcastWriter writer{sd, CAPACITY};
+    BroadcastReader firstReader{sd};
+    BroadcastReader secondReader{sd};
+    EXPECT_TRUE(writer.hasReaders());
+
+    for (uint64_t i = 1U; i <= 3U; ++i)
+    {
+        ASSERT_FALSE(writer.write(Tick{i, static_cast<int64_t>(i) * 10}).has_error());
+    }
+
+    for (auto* reader : {&firstReader, &secondReader})
+    {
+        for (uint64_t i = 1U; i <= 3U; ++i)
+        {
+            EXPECT_TRUE(reader->hasData());
+            auto tick = reader->take<Tick>();
+            ASSERT_FALSE(tick.has_error());
+            EXPECT_THAT(tick->counter, Eq(i));
+            EXPECT_THAT(tick->timestamp, Eq(static_cast<int64_t>(i) * 10));
+        }
+        EXPECT_FALSE(reader->hasData());
+        EXPECT_FALSE(reader->hasMissedData());
+    }
+}
+
+TEST_F(Broadcast_test, LateReaderStartsWithTheOldestMessageInTheRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94941569-81de-4283-80e4-1c685d97a14f");
+    BroadcastWriter writer{sd, CAPACITY};
+    for (uint64_t i = 1U; i <= 3U; ++i)
+    {
+        ASSERT_FALSE(writer.write(Tick{i, 0}).has_error());
+    }
+
+    BroadcastReader reader{sd};
+
+    for (uint64_t i = 1U; i <= 3U; ++i)
+    {
+        auto tick = reader.take<Tick>();
+        ASSERT_FALSE(tick.has_error());
+        EXPECT_THAT(tick->counter, Eq(i));
+    }
+    EXPECT_FALSE(reader.hasData());
+    EXPECT_FALSE(reader.hasMissedData());
+}
+
+TEST_F(Broadcast_test, SlowReaderMissesOverwrittenMessages)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46b5cab9-d574-4c63-89e0-feb770338773");
+    BroadcastWriter writer{sd, CAPACITY};
+    BroadcastReader reader{sd};
+    ASSERT_FALSE(writer.write(Tick{1U, 0}).has_error());
+    ASSERT_FALSE(reader.take<Tick>().has_error());
+
+    constexpr uint64_t NUMBER_OF_MESSAGES{CAPACITY * 2U + 1U};
+    for (uint64_t i = 2U; i <= NUMBER_OF_MESSAGES; ++i)
+    {
+        ASSERT_FALSE(writer.write(Tick{i, 0}).has_error());
+    }
+
+    auto tick = reader.take<Tick>();
+
+    ASSERT_FALSE(tick.has_error());
+    EXPECT_THAT(tick->counter, Eq(NUMBER_OF_MESSAGES - CAPACITY + 1U));
+    EXPECT_TRUE(reader.hasMissedData());
+    EXPECT_FALSE(reader.hasMissedData());
+}
+
+TEST_F(Broadcast_test, MessagesWithWrongSizeAreRejected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c76c8b8-82d9-471a-8312-3c3dd9301730");
+    BroadcastWriter writer{sd, CAPACITY};
+    BroadcastReader reader{sd};
+    uint8_t tooLargeMessage[BroadcastWriter::MAX_MESSAGE_SIZE + 1U]{};
+
+    auto writeResult = writer.write(tooLargeMessage, sizeof(tooLargeMessage));
+    ASSERT_TRUE(writeResult.has_error());
+    EXPECT_THAT(writeResult.error(), Eq(BroadcastWriterError::MESSAGE_TOO_LARGE));
+
+    ASSERT_FALSE(writer.write(uint32_t{42U}).has_error());
+    auto readResult = reader.take<Tick>();
+    ASSERT_TRUE(readResult.has_error());
+    EXPECT_THAT(readResult.error(), Eq(BroadcastReaderError::MESSAGE_SIZE_MISMATCH));
+    EXPECT_FALSE(reader.hasData());
+}
+
+TEST_F(Broadcast_test, WriteFailsWhenTheRingDoesNotFitIntoTheMempools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eddff10e-e685-46d0-9787-026884a92b9f");
+    BroadcastWriter writer{sd, BroadcastWriter::MAX_CAPACITY};
+
+    auto result = writer.write(Tick{1U, 0});
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(BroadcastWriterError::RING_ALLOCATION_FAILED));
+}
+
+TEST_F(Broadcast_test, ReaderSwitchesToTheRingOfANewWriter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6d685333-208e-43e6-b5b4-70124209d977");
+    BroadcastReader reader{sd};
+    {
+        BroadcastWriter writer{sd, CAPACITY};
+        ASSERT_FALSE(writer.write(Tick{1U, 0}).has_error());
+        ASSERT_FALSE(reader.take<Tick>().has_error());
+    }
+
+    BroadcastWriter newWriter{sd, CAPACITY};
+    ASSERT_FALSE(newWriter.write(Tick{7U, 0}).has_error());
+
+    EXPECT_TRUE(reader.hasData());
+    auto tick = reader.take<Tick>();
+    ASSERT_FALSE(tick.has_error());
+    EXPECT_THAT(tick->counter, Eq(7U));
+}
+
+TEST_F(Broadcast_test, WaitSetIsWokenUpByTheWriter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa12e0a7-686d-4ce4-b119-487fb4669eed");
+    BroadcastWriter writer{sd, CAPACITY};
+    BroadcastReader reader{sd};
+    // the ring is received with the subscription and taken without a message
+    EXPECT_TRUE(reader.take<Tick>().has_error());
+    WaitSet<> waitset;
+    ASSERT_FALSE(waitset.attachState(reader, BroadcastReaderState::HAS_DATA).has_error());
+
+    std::thread writerThread([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        EXPECT_FALSE(writer.write(Tick{5U, 0}).has_error());
+    });
+
+    auto notifications = waitset.wait();
+    writerThread.join();
+
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_TRUE(notifications[0U]->doesOriginateFrom(&reader));
+    auto tick = reader.take<Tick>();
+    ASSERT_FALSE(tick.has_error());
+    EXPECT_THAT(tick->counter, Eq(5U));
+}
+
+} // namespace
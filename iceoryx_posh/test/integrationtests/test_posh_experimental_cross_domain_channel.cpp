@@ -0,0 +1,318 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iox/posh/experimental/cross_domain_channel.hpp"
+
+#include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env_node_builder.hpp"
+#include "test.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::posh::experimental;
+using namespace iox::roudi_env;
+
+struct Header
+{
+    uint64_t timestamp{0};
+};
+
+class CrossDomainChannel_test : public Test
+{
+  public:
+    static constexpr uint16_t DOMAIN_ID_A{13};
+    static constexpr uint16_t DOMAIN_ID_B{42};
+
+    RouDiEnv roudi_a{DomainId{DOMAIN_ID_A}};
+    RouDiEnv roudi_b{DomainId{DOMAIN_ID_B}};
+
+    Node node_a{
+        RouDiEnvNodeBuilder("hypnotoad").domain_id(DomainId{DOMAIN_ID_A}).create().expect("Creating a node")};
+    Node node_b{
+        RouDiEnvNodeBuilder("hypnotoad").domain_id(DomainId{DOMAIN_ID_B}).create().expect("Creating a node")};
+
+    ServiceDescription service_description{"all", "glory", "hypnotoad"};
+};
+
+TEST_F(CrossDomainChannel_test, CreatingChannelWithoutNodesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f0c3a4e-6a6b-4b49-8a2c-0d6d2e1b7f11");
+
+    CrossDomainChannel::Options options;
+    options.sourceNode = &node_a;
+
+    auto result = CrossDomainChannel::create(service_description, options);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CrossDomainChannelError::INVALID_NODE));
+}
+
+TEST_F(CrossDomainChannel_test, CreatingChannelWithSameSourceAndTargetNodeFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b1d2ad4-8f7e-4e4f-9d52-4d3d1ee0a7c2");
+
+    CrossDomainChannel::Options options;
+    options.sourceNode = &node_a;
+    options.targetNode = &node_a;
+
+    auto result = CrossDomainChannel::create(service_description, options);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(CrossDomainChannelError::INVALID_NODE));
+}
+
+TEST_F(CrossDomainChannel_test, ForwardWithoutDataForwardsNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c2a57b58-63a1-4e8e-b5c4-6d8e7b1f0a93");
+
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    EXPECT_THAT(channel.forward(), Eq(0U));
+    EXPECT_THAT(channel.getServiceDescription(), Eq(service_description));
+}
+
+TEST_F(CrossDomainChannel_test, ChunksAreForwardedFromSourceToTargetDomain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a7e1c0b-29a8-4d35-9c1b-1f6f1de4c0a7");
+
+    constexpr uint64_t NUMBER_OF_SAMPLES{5};
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create<uint64_t>().expect("Getting publisher");
+    auto subscriber = node_b.subscriber(service_description).create<uint64_t>().expect("Getting subscriber");
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        publisher->publishCopyOf(i).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    }
+
+    EXPECT_THAT(channel.forward(), Eq(NUMBER_OF_SAMPLES));
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        subscriber->take()
+            .and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(i)); })
+            .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+    }
+    EXPECT_FALSE(subscriber->hasData());
+}
+
+TEST_F(CrossDomainChannel_test, ChunksAreNotForwardedBackToTheSourceDomain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9fe0b1a-0d7c-4f3e-8b55-7b7a3d6a91f4");
+
+    auto channel_a_to_b =
+        CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+    auto channel_b_to_a =
+        CrossDomainChannel::create(service_description, {&node_b, &node_a}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create<uint64_t>().expect("Getting publisher");
+    auto subscriber_a = node_a.subscriber(service_description).create<uint64_t>().expect("Getting subscriber");
+    auto subscriber_b = node_b.subscriber(service_description).create<uint64_t>().expect("Getting subscriber");
+
+    constexpr uint64_t DATA{73};
+    publisher->publishCopyOf(DATA).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+
+    EXPECT_THAT(channel_a_to_b.forward(), Eq(1U));
+    EXPECT_FALSE(channel_b_to_a.getSourceSubscriber()->hasData());
+    EXPECT_THAT(channel_b_to_a.forward(), Eq(0U));
+
+    for (auto* subscriber : {&subscriber_a, &subscriber_b})
+    {
+        (*subscriber)
+            ->take()
+            .and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(DATA)); })
+            .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+        EXPECT_FALSE((*subscriber)->hasData());
+    }
+}
+
+TEST_F(CrossDomainChannel_test, ChunkWhichCannotBeLoanedInTheTargetDomainIsLostAndTheRemainingChunksStayQueued)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b0f6c1e-7d5a-4c8e-9f31-5a4e8d7c6b20");
+
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create<uint64_t>().expect("Getting publisher");
+    auto subscriber = node_b.subscriber(service_description).create<uint64_t>().expect("Getting subscriber");
+
+    // exhaust the mempool of the target domain
+    const ServiceDescription blocker_service{"all", "glory", "blocker"};
+    std::vector<std::pair<std::unique_ptr<UntypedPublisher>, std::vector<void*>>> blockers;
+    for (uint64_t i = 0; i < 2U; ++i)
+    {
+        blockers.emplace_back(
+            unique_ptr<UntypedPublisher>::release(node_b.publisher(blocker_service).create().expect("Getting blocker")),
+            std::vector<void*>{});
+        auto& blocker = blockers.back();
+        while (true)
+        {
+            auto loanResult = blocker.first->loan(sizeof(uint64_t));
+            if (loanResult.has_error())
+            {
+                break;
+            }
+            blocker.second.push_back(loanResult.value());
+        }
+    }
+
+    constexpr uint64_t NUMBER_OF_SAMPLES{3};
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        publisher->publishCopyOf(i).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    }
+
+    EXPECT_THAT(channel.forward(), Eq(0U));
+    EXPECT_THAT(channel.numberOfLostChunks(), Eq(1U));
+    EXPECT_FALSE(subscriber->hasData());
+
+    for (auto& blocker : blockers)
+    {
+        for (auto* userPayload : blocker.second)
+        {
+            blocker.first->release(userPayload);
+        }
+    }
+
+    constexpr uint64_t DATA{42};
+    publisher->publishCopyOf(DATA).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+
+    EXPECT_THAT(channel.forward(), Eq(NUMBER_OF_SAMPLES));
+    EXPECT_THAT(channel.numberOfLostChunks(), Eq(1U));
+    for (uint64_t i = 1; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        subscriber->take()
+            .and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(i)); })
+            .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+    }
+    subscriber->take()
+        .and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(DATA)); })
+        .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+}
+
+TEST_F(CrossDomainChannel_test, ForwardReturnsWhenTheMaxNumberOfChunksIsReached)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d07ae4dd-7ea5-4ddb-a094-f15aa7d7370b");
+
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create<uint64_t>().expect("Getting publisher");
+    auto subscriber = node_b.subscriber(service_description).create<uint64_t>().expect("Getting subscriber");
+
+    constexpr uint64_t NUMBER_OF_SAMPLES{5};
+    constexpr uint64_t MAX_NUMBER_OF_CHUNKS{2};
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        publisher->publishCopyOf(i).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    }
+
+    EXPECT_THAT(channel.forward(MAX_NUMBER_OF_CHUNKS), Eq(MAX_NUMBER_OF_CHUNKS));
+    EXPECT_THAT(channel.forward(), Eq(NUMBER_OF_SAMPLES - MAX_NUMBER_OF_CHUNKS));
+    EXPECT_THAT(channel.numberOfLostChunks(), Eq(0U));
+
+    for (uint64_t i = 0; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        subscriber->take()
+            .and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(i)); })
+            .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+    }
+}
+
+TEST_F(CrossDomainChannel_test, UserHeaderIsForwarded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0a5d77f2-1b38-4b6e-92f3-e1b3a5c6d2e8");
+
+    constexpr uint64_t DATA{666};
+    constexpr uint64_t TIMESTAMP{1337};
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create<uint64_t, Header>().expect("Getting publisher");
+    auto subscriber = node_b.subscriber(service_description).create<uint64_t, Header>().expect("Getting subscriber");
+
+    publisher->loan()
+        .and_then([&](auto& sample) {
+            sample.getUserHeader().timestamp = TIMESTAMP;
+            *sample = DATA;
+            sample.publish();
+        })
+        .or_else([](const auto) { GTEST_FAIL() << "Expected to loan a chunk"; });
+
+    EXPECT_THAT(channel.forward(), Eq(1U));
+
+    subscriber->take()
+        .and_then([&](const auto& sample) {
+            EXPECT_THAT(*sample, Eq(DATA));
+            EXPECT_THAT(sample.getUserHeader().timestamp, Eq(TIMESTAMP));
+            EXPECT_THAT(sample.getChunkHeader()->userHeaderSize(), Eq(sizeof(Header)));
+        })
+        .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+}
+
+TEST_F(CrossDomainChannel_test, UntypedChunkWithLargeAlignmentIsForwarded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d3c6e40-5f2a-49b1-a8f7-3c9b2e4d1a56");
+
+    constexpr uint64_t USER_PAYLOAD_SIZE{32};
+    constexpr uint32_t USER_PAYLOAD_ALIGNMENT{32};
+    constexpr uint32_t USER_HEADER_SIZE{8};
+    constexpr uint32_t USER_HEADER_ALIGNMENT{8};
+    auto channel = CrossDomainChannel::create(service_description, {&node_a, &node_b}).expect("Creating channel");
+
+    auto publisher = node_a.publisher(service_description).create().expect("Getting publisher");
+    auto subscriber = node_b.subscriber(service_description).create().expect("Getting subscriber");
+
+    publisher->loan(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT)
+        .and_then([&](auto* userPayload) {
+            auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+            std::memset(chunkHeader->userHeader(), 0xAB, USER_HEADER_SIZE);
+            for (uint64_t i = 0; i < USER_PAYLOAD_SIZE; ++i)
+            {
+                static_cast<uint8_t*>(userPayload)[i] = static_cast<uint8_t>(i);
+            }
+            publisher->publish(userPayload);
+        })
+        .or_else([](const auto) { GTEST_FAIL() << "Expected to loan a chunk"; });
+
+    EXPECT_THAT(channel.forward(), Eq(1U));
+
+    subscriber->take()
+        .and_then([&](const auto* userPayload) {
+            const auto* chunkHeader = mepoo::ChunkHeader::fromUserPayload(userPayload);
+            EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(USER_PAYLOAD_SIZE));
+            EXPECT_THAT(chunkHeader->userPayloadAlignment(), Eq(USER_PAYLOAD_ALIGNMENT));
+            EXPECT_THAT(chunkHeader->userHeaderSize(), Eq(USER_HEADER_SIZE));
+            const auto* userHeader = static_cast<const uint8_t*>(chunkHeader->userHeader());
+            for (uint64_t i = 0; i < USER_HEADER_SIZE; ++i)
+            {
+                EXPECT_THAT(userHeader[i], Eq(0xAB));
+            }
+            for (uint64_t i = 0; i < USER_PAYLOAD_SIZE; ++i)
+            {
+                EXPECT_THAT(static_cast<const uint8_t*>(userPayload)[i], Eq(static_cast<uint8_t>(i)));
+            }
+            subscriber->release(userPayload);
+        })
+        .or_else([](const auto) { GTEST_FAIL() << "Expected to receive data"; });
+}
+
+} // namespace
@@ -750,6 +750,63 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, LatestValueSubscribersReceiveOnlyTheLatestSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55345125-d815-4cb2-931e-e0a3d5872018");
+    auto publisher = createPublisher<int>(1U);
+    ASSERT_FALSE(publisher->publishCopyOf(1).has_error());
+
+    iox::popo::SubscriberOptions options;
+    options.latestValueMode = true;
+    options.historyRequest = 1U;
+    std::vector<std::unique_ptr<iox::popo::Subscriber<int>>> subscribers;
+    for (uint64_t i = 0U; i < 2U; ++i)
+    {
+        subscribers.emplace_back(std::make_unique<iox::popo::Subscriber<int>>(m_serviceDescription, options));
+    }
+
+    for (auto& subscriber : subscribers)
+    {
+        EXPECT_FALSE(subscriber->take().and_then([](auto& sample) { EXPECT_THAT(*sample, Eq(1)); }).has_error());
+    }
+
+    for (int i = 2; i <= 4; ++i)
+    {
+        ASSERT_FALSE(publisher->publishCopyOf(i).has_error());
+    }
+
+    for (auto& subscriber : subscribers)
+    {
+        EXPECT_TRUE(subscriber->hasData());
+        EXPECT_FALSE(subscriber->take().and_then([](auto& sample) { EXPECT_THAT(*sample, Eq(4)); }).has_error());
+        EXPECT_FALSE(subscriber->hasData());
+        auto result = subscriber->take();
+        ASSERT_TRUE(result.has_error());
+        EXPECT_THAT(result.error(), Eq(ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+    }
+}
+
+TEST_F(PublisherSubscriberCommunication_test, LatestValueSubscriberReceivesTheSampleOfThePublisherWhichPublishedLast)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "544f6527-dd77-418c-81fe-6d05fdb9e9df");
+    auto publisher1 = createPublisher<int>(0U);
+    auto publisher2 = createPublisher<int>(0U);
+
+    iox::popo::SubscriberOptions options;
+    options.latestValueMode = true;
+    iox::popo::Subscriber<int> subscriber(m_serviceDescription, options);
+
+    ASSERT_FALSE(publisher1->publishCopyOf(1).has_error());
+    ASSERT_FALSE(publisher2->publishCopyOf(2).has_error());
+    EXPECT_FALSE(subscriber.take().and_then([](auto& sample) { EXPECT_THAT(*sample, Eq(2)); }).has_error());
+    EXPECT_FALSE(subscriber.hasData());
+
+    ASSERT_FALSE(publisher1->publishCopyOf(3).has_error());
+    EXPECT_TRUE(subscriber.hasData());
+    EXPECT_FALSE(subscriber.take().and_then([](auto& sample) { EXPECT_THAT(*sample, Eq(3)); }).has_error());
+    EXPECT_FALSE(subscriber.hasData());
+}
+
 #ifdef TEST_WITH_HUGE_PAYLOAD
 
 TEST_F(PublisherSubscriberCommunicationWithBigPayload_test, SendingComplexDataType_BigPayloadStruct)
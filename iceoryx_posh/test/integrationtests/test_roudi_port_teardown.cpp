@@ -0,0 +1,92 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env_node_builder.hpp"
+#include "iox/detail/convert.hpp"
+#include "iox/posh/experimental/node.hpp"
+#include "iox/vector.hpp"
+
+#include "test.hpp"
+
+#include <chrono>
+
+namespace
+{
+using namespace ::testing;
+
+using namespace iox;
+using namespace iox::posh::experimental;
+using namespace iox::roudi_env;
+
+// one publisher slot is left for the publisher which measures the discovery latency
+constexpr uint64_t NUMBER_OF_PORT_PAIRS{iox::MAX_PUBLISHERS - iox::NUMBER_OF_INTERNAL_PUBLISHERS - 1U};
+
+void createNodeWithManyPortsAndDestroyIt(const NodeName_t& nodeName)
+{
+    auto node = RouDiEnvNodeBuilder(nodeName).create().expect("Creating a node should not fail!");
+
+    iox::vector<iox::unique_ptr<UntypedPublisher>, NUMBER_OF_PORT_PAIRS> publishers;
+    iox::vector<iox::unique_ptr<UntypedSubscriber>, NUMBER_OF_PORT_PAIRS> subscribers;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORT_PAIRS; ++i)
+    {
+        // every port has a peer so that the teardown has to distribute the STOP_OFFER and UNSUB messages
+        const ServiceDescription service{"Teardown", "ManyPorts", into<lossy<capro::IdString_t>>(convert::toString(i))};
+        publishers.emplace_back(node.publisher(service).create().expect("Getting publisher"));
+        subscribers.emplace_back(node.subscriber(service).create().expect("Getting subscriber"));
+    }
+}
+
+TEST(RouDiPortTeardown_test, DiscoveryIsNotStalledByTheTeardownOfANodeWithManyPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbbffa2b-04d4-41ba-8fe2-f1221bdd75e2");
+
+    RouDiEnv roudi;
+
+    auto node = RouDiEnvNodeBuilder("latency").create().expect("Creating a node should not fail!");
+
+    createNodeWithManyPortsAndDestroyIt("many_ports");
+
+    // the ports of the destroyed node are torn down by the discovery loop in the background while the new ports are
+    // created and connected
+    const ServiceDescription service{"Teardown", "Discovery", "Latency"};
+    const auto start = std::chrono::steady_clock::now();
+    auto publisher = node.publisher(service).create<uint64_t>().expect("Getting publisher");
+    auto subscriber = node.subscriber(service).create<uint64_t>().expect("Getting subscriber");
+
+    constexpr uint64_t DATA{42};
+    publisher->publishCopyOf(DATA).or_else([](const auto) { GTEST_FAIL() << "Expected to send data"; });
+    subscriber->take().and_then([&](const auto& sample) { EXPECT_THAT(*sample, Eq(DATA)); }).or_else([](const auto) {
+        GTEST_FAIL() << "Expected to receive data";
+    });
+    const auto discoveryLatency = std::chrono::steady_clock::now() - start;
+
+    ::testing::Test::RecordProperty(
+        "DISCOVERY_LATENCY_IN_US",
+        static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(discoveryLatency).count()));
+
+    // each discovery run destroys a bounded number of ports; after enough runs the resources must be available again
+    constexpr uint64_t NUMBER_OF_PORTS{2U * NUMBER_OF_PORT_PAIRS};
+    for (uint64_t i = 0U; i <= NUMBER_OF_PORTS / iox::roudi::MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN; ++i)
+    {
+        roudi.triggerDiscoveryLoopAndWaitToFinish();
+    }
+
+    createNodeWithManyPortsAndDestroyIt("many_ports_again");
+}
+
+} // namespace
@@ -55,6 +55,10 @@ class MockClientPortUser : public MockBasePort
                 sendRequest,
                 (iox::popo::RequestHeader* const),
                 (noexcept));
+    MOCK_METHOD((iox::expected<void, iox::popo::ClientSendError>),
+                sendRequest,
+                (iox::popo::RequestHeader* const, const uint64_t),
+                (noexcept));
     MOCK_METHOD(void, connect, (), (noexcept));
     MOCK_METHOD(void, disconnect, (), (noexcept));
     MOCK_METHOD(iox::ConnectionState, getConnectionState, (), (const, noexcept));
@@ -63,6 +63,22 @@ class MockServerPortUser : public MockBasePort
                 sendResponse,
                 (iox::popo::ResponseHeader* const),
                 (noexcept));
+    MOCK_METHOD(iox::optional<uint32_t>, acquireWorker, (), (noexcept));
+    MOCK_METHOD(void, releaseWorker, (const uint32_t), (noexcept));
+    MOCK_METHOD((iox::expected<const iox::popo::RequestHeader*, iox::popo::ServerRequestResult>),
+                getRequest,
+                (const uint32_t),
+                (noexcept));
+    MOCK_METHOD(void, releaseRequest, (const uint32_t, const iox::popo::RequestHeader* const), (noexcept));
+    MOCK_METHOD((iox::expected<iox::popo::ResponseHeader*, iox::popo::AllocationError>),
+                allocateResponse,
+                (const uint32_t, const iox::popo::RequestHeader* const, const uint64_t, const uint32_t),
+                (noexcept));
+    MOCK_METHOD(void, releaseResponse, (const uint32_t, const iox::popo::ResponseHeader* const), (noexcept));
+    MOCK_METHOD((iox::expected<void, iox::popo::ServerSendError>),
+                sendResponse,
+                (const uint32_t, iox::popo::ResponseHeader* const),
+                (noexcept));
     MOCK_METHOD(void, offer, (), (noexcept));
     MOCK_METHOD(void, stopOffer, (), (noexcept));
     MOCK_METHOD(bool, isOffered, (), (const, noexcept));
@@ -85,6 +101,22 @@ class MockBaseServer
 
     MOCK_METHOD(iox::popo::uid_t, getUid, (), (const, noexcept));
     MOCK_METHOD(const iox::capro::ServiceDescription&, getServiceDescription, (), (const, noexcept));
+    MOCK_METHOD(iox::optional<uint32_t>, acquireWorker, (), (noexcept));
+    MOCK_METHOD(void, releaseWorker, (const uint32_t), (noexcept));
+    MOCK_METHOD((iox::expected<const iox::popo::RequestHeader*, iox::popo::ServerRequestResult>),
+                getRequest,
+                (const uint32_t),
+                (noexcept));
+    MOCK_METHOD(void, releaseRequest, (const uint32_t, const iox::popo::RequestHeader* const), (noexcept));
+    MOCK_METHOD((iox::expected<iox::popo::ResponseHeader*, iox::popo::AllocationError>),
+                allocateResponse,
+                (const uint32_t, const iox::popo::RequestHeader* const, const uint64_t, const uint32_t),
+                (noexcept));
+    MOCK_METHOD(void, releaseResponse, (const uint32_t, const iox::popo::ResponseHeader* const), (noexcept));
+    MOCK_METHOD((iox::expected<void, iox::popo::ServerSendError>),
+                sendResponse,
+                (const uint32_t, iox::popo::ResponseHeader* const),
+                (noexcept));
     MOCK_METHOD(void, offer, (), (noexcept));
     MOCK_METHOD(void, stopOffer, (), (noexcept));
     MOCK_METHOD(bool, isOffered, (), (const, noexcept));
@@ -434,6 +434,56 @@ TEST_F(ServiceDescription_test, LessThanOperatorReturnsFalseIfEventStringOfFirst
     EXPECT_FALSE(serviceDescription1 < serviceDescription2);
 }
 
+TEST_F(ServiceDescription_test, ServiceDescriptionsWithSameStringsHaveSameHash)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5b020606-0d2a-4257-aabe-d646d62ad444");
+    ServiceDescription serviceDescription1("TestService", "TestInstance", "TestEvent", {1U, 2U, 3U, 4U});
+    ServiceDescription serviceDescription2("TestService", "TestInstance", "TestEvent", {5U, 6U, 7U, 8U});
+
+    ServiceDescription copiedServiceDescription{serviceDescription1};
+
+    EXPECT_EQ(serviceDescription1.getHash(), serviceDescription2.getHash());
+    EXPECT_EQ(serviceDescription1.getHash(), copiedServiceDescription.getHash());
+}
+
+TEST_F(ServiceDescription_test, HashIsRestoredOnDeserialization)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "866196c7-b06b-49ef-a2a7-833439a13bf2");
+    ServiceDescription serviceDescription("TestService", "TestInstance", "TestEvent");
+
+    auto deserializationResult = ServiceDescription::deserialize(iox::Serialization(serviceDescription));
+
+    ASSERT_FALSE(deserializationResult.has_error());
+    EXPECT_EQ(deserializationResult.value().getHash(), serviceDescription.getHash());
+    EXPECT_TRUE(deserializationResult.value() == serviceDescription);
+}
+
+TEST_F(ServiceDescription_test, ServiceDescriptionsWithShiftedStringBoundariesAreNotEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d007d283-9d96-499f-b522-23e922a96ba0");
+    ServiceDescription serviceDescription1("ab", "c", "d");
+    ServiceDescription serviceDescription2("a", "bc", "d");
+
+    EXPECT_NE(serviceDescription1.getHash(), serviceDescription2.getHash());
+    EXPECT_FALSE(serviceDescription1 == serviceDescription2);
+}
+
+TEST_F(ServiceDescription_test, ServiceDescriptionsWithLongCommonPrefixAreNotEqual)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d9a354d1-ae72-4597-8a50-4fb9c57ba6bc");
+    IdString_t prefix(iox::TruncateToCapacity, std::string(IdString_t::capacity() - 1U, 'x').c_str());
+    IdString_t service1{prefix};
+    IdString_t service2{prefix};
+    service1.unsafe_append('1');
+    service2.unsafe_append('2');
+    ServiceDescription serviceDescription1(service1, prefix, prefix);
+    ServiceDescription serviceDescription2(service2, prefix, prefix);
+
+    EXPECT_NE(serviceDescription1.getHash(), serviceDescription2.getHash());
+    EXPECT_FALSE(serviceDescription1 == serviceDescription2);
+    EXPECT_TRUE(serviceDescription1 != serviceDescription2);
+}
+
 TEST_F(ServiceDescription_test, LogStreamConvertsServiceDescriptionToString)
 {
     ::testing::Test::RecordProperty("TEST_ID", "42bc3f21-d9f4-4cc3-a37e-6508e1f981c1");
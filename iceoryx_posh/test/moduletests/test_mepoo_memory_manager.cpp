@@ -33,6 +33,7 @@ using namespace iox::testing;
 
 using iox::mepoo::ChunkHeader;
 using iox::mepoo::ChunkSettings;
+using iox::mepoo::MemPool;
 using UserPayloadOffset_t = iox::mepoo::ChunkHeader::UserPayloadOffset_t;
 
 class MemoryManager_test : public Test
@@ -443,6 +444,98 @@ TEST_F(MemoryManager_test, addMemPoolWithChunkCountZeroShouldFail)
     IOX_EXPECT_FATAL_FAILURE([&] { sut->configureMemoryManager(mempoolconf, *allocator, *allocator); }, iox::er::FATAL);
 }
 
+TEST_F(MemoryManager_test, CoLocatedChunkManagementIsPlacedInFrontOfTheChunkHeader)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6911cbd9-0424-4d7b-a912-27b9461de2cc");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::CO_LOCATED;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunk = sut->getChunk(chunkSettings_128).expect("Getting a chunk");
+    auto* chunkHeader = chunk.getChunkHeader();
+    ASSERT_THAT(chunkHeader, Ne(nullptr));
+    EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(CHUNK_SIZE_128));
+
+    auto* chunkManagement = chunk.release();
+    const auto chunkManagementPrefixSize =
+        iox::align(sizeof(iox::mepoo::ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    EXPECT_THAT(reinterpret_cast<uint8_t*>(chunkManagement) + chunkManagementPrefixSize,
+                Eq(reinterpret_cast<uint8_t*>(chunkHeader)));
+    EXPECT_FALSE(chunkManagement->m_chunkManagementPool);
+
+    {
+        // hand the chunk back to a SharedChunk to release it
+        iox::mepoo::SharedChunk releasedChunk(chunkManagement);
+    }
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, CoLocatedChunkManagementSingleMemPoolFullToEmptyToFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63617520-dddd-4958-960e-12310e7170f2");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::CO_LOCATED;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+        EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+
+        constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+        sut->getChunk(chunkSettings_128)
+            .and_then(
+                [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+            .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_128);
+    EXPECT_THAT(sut->getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, CoLocatedChunkManagementMovesTheManagementMemoryIntoTheChunkMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4e3f78e9-6f3c-49b3-8175-8dba63e532c6");
+    constexpr uint32_t CHUNK_COUNT{100U};
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    auto coLocatedConfig = mempoolconf;
+    coLocatedConfig.m_chunkManagementLayout = iox::mepoo::ChunkManagementLayout::CO_LOCATED;
+
+    using iox::mepoo::MemoryManager;
+    const auto chunkManagementPrefixSize =
+        iox::align(sizeof(iox::mepoo::ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    EXPECT_THAT(MemoryManager::requiredChunkMemorySize(coLocatedConfig),
+                Eq(MemoryManager::requiredChunkMemorySize(mempoolconf) + 2U * CHUNK_COUNT * chunkManagementPrefixSize));
+    EXPECT_THAT(MemoryManager::requiredManagementMemorySize(coLocatedConfig),
+                Lt(MemoryManager::requiredManagementMemorySize(mempoolconf)));
+
+    // the management memory of the co-located layout contains only the free lists of the mempools
+    void* managementMemory = malloc(MemoryManager::requiredManagementMemorySize(coLocatedConfig));
+    void* chunkMemory = malloc(MemoryManager::requiredChunkMemorySize(coLocatedConfig));
+    {
+        iox::BumpAllocator managementAllocator(managementMemory,
+                                               MemoryManager::requiredManagementMemorySize(coLocatedConfig));
+        iox::BumpAllocator chunkMemoryAllocator(chunkMemory, MemoryManager::requiredChunkMemorySize(coLocatedConfig));
+        MemoryManager memoryManager;
+        memoryManager.configureMemoryManager(coLocatedConfig, managementAllocator, chunkMemoryAllocator);
+
+        std::vector<iox::mepoo::SharedChunk> chunks;
+        for (uint32_t i = 0U; i < CHUNK_COUNT; ++i)
+        {
+            chunks.push_back(memoryManager.getChunk(chunkSettings_64).expect("Getting a chunk"));
+            chunks.push_back(memoryManager.getChunk(chunkSettings_256).expect("Getting a chunk"));
+        }
+        EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(CHUNK_COUNT));
+        EXPECT_THAT(memoryManager.getMemPoolInfo(1U).m_usedChunks, Eq(CHUNK_COUNT));
+    }
+    free(chunkMemory);
+    free(managementMemory);
+}
+
 TEST(MemoryManagerEnumString_test, asStringLiteralConvertsEnumValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5f6c3942-0af5-4c48-b44c-7268191dbac5");
@@ -207,4 +207,24 @@ TEST_F(SegmentManager_test, addingMaximumNumberOfSegmentsWorks)
     SegmentManager<MePooSegmentMock> sut{segmentConfig, DEFAULT_DOMAIN_ID, &allocator};
 }
 
+TEST_F(SegmentManager_test, CoLocatedChunkManagementIsKeptForSegmentWithWritingReaders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "509b2ff0-9900-4886-9e2c-874750df20cf");
+    mepooConfig.m_chunkManagementLayout = ChunkManagementLayout::CO_LOCATED;
+
+    SegmentConfig::SegmentEntry segmentEntry{"iox_roudi_test1", "iox_roudi_test1", mepooConfig};
+
+    EXPECT_THAT(segmentEntry.m_mempoolConfig.m_chunkManagementLayout, Eq(ChunkManagementLayout::CO_LOCATED));
+}
+
+TEST_F(SegmentManager_test, CoLocatedChunkManagementFallsBackToSeparatePoolForReadOnlyReaders)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b258af0-d87b-4939-9fea-5285cf5e1036");
+    mepooConfig.m_chunkManagementLayout = ChunkManagementLayout::CO_LOCATED;
+
+    SegmentConfig::SegmentEntry segmentEntry{"iox_roudi_test1", "iox_roudi_test2", mepooConfig};
+
+    EXPECT_THAT(segmentEntry.m_mempoolConfig.m_chunkManagementLayout, Eq(ChunkManagementLayout::SEPARATE_POOL));
+}
+
 } // namespace
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/assertions.hpp"
 #include "iox/bump_allocator.hpp"
+#include "iox/relative_pointer.hpp"
 
 #include "test.hpp"
 
@@ -49,6 +50,36 @@ class ShmSafeUnmanagedChunk_test : public Test
         return memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
     }
 
+    /// @brief creates a chunk in a registered segment and checks that the ChunkManagement carries the id of the
+    /// segment it resides in and that a ShmSafeUnmanagedChunk refers to the same chunk
+    void checkSegmentIdOfChunkInRegisteredSegment(const ChunkManagementLayout layout)
+    {
+        std::unique_ptr<char[]> segmentMemory{new char[MEMORY_SIZE]};
+        auto segmentId = iox::UntypedRelativePointer::registerPtr(segmentMemory.get(), MEMORY_SIZE);
+        ASSERT_TRUE(segmentId.has_value());
+
+        {
+            iox::BumpAllocator segmentAllocator{segmentMemory.get(), MEMORY_SIZE};
+            MePooConfig mempoolconf;
+            mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+            mempoolconf.m_chunkManagementLayout = layout;
+            iox::mepoo::MemoryManager segmentMemoryManager;
+            segmentMemoryManager.configureMemoryManager(mempoolconf, segmentAllocator, segmentAllocator);
+
+            auto chunkSettings =
+                iox::mepoo::ChunkSettings::create(sizeof(bool), alignof(bool)).expect("Valid 'ChunkSettings'");
+            auto* chunkManagement = segmentMemoryManager.getChunk(chunkSettings).expect("Obtaining chunk").release();
+            EXPECT_THAT(chunkManagement->m_segmentId, Eq(segmentId.value()));
+            EXPECT_THAT(chunkManagement->m_chunkHeader.getId(), Eq(segmentId.value()));
+
+            ShmSafeUnmanagedChunk sut(SharedChunk{chunkManagement});
+            EXPECT_THAT(sut.getChunkHeader(), Eq(chunkManagement->m_chunkHeader.get()));
+            EXPECT_TRUE(sut.releaseToSharedChunk());
+        }
+
+        iox::UntypedRelativePointer::unregisterPtr(iox::segment_id_t{segmentId.value()});
+    }
+
     iox::mepoo::MemoryManager memoryManager;
 
   private:
@@ -301,4 +332,66 @@ TEST_F(ShmSafeUnmanagedChunk_test,
     EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
 }
 
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnReferencedChunkIncrementsTheReferenceCounter)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5fc2bb9c-b394-4125-a056-ef9c95965c26");
+    ShmSafeUnmanagedChunk sut(getChunkFromMemoryManager());
+
+    {
+        auto clonedChunk = sut.tryCloneToSharedChunk();
+        EXPECT_TRUE(clonedChunk);
+        EXPECT_THAT(clonedChunk.getChunkHeader(), Eq(sut.getChunkHeader()));
+        EXPECT_FALSE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+    }
+
+    EXPECT_TRUE(sut.isNotLogicalNullptrAndHasNoOtherOwners());
+    sut.releaseToSharedChunk();
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnReleasedChunkResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5310992-f933-4f56-8c7b-992725f788d9");
+    auto sharedChunk = getChunkFromMemoryManager();
+    auto sut = ShmSafeUnmanagedChunk::fromAcquiredReference(sharedChunk);
+    sharedChunk = SharedChunk();
+
+    EXPECT_FALSE(sut.tryCloneToSharedChunk());
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CallTryCloneToSharedChunkOnDefaultConstructedResultsInEmptySharedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e2b4aaae-9c00-4cff-a881-ddb7bfd6e654");
+    ShmSafeUnmanagedChunk sut;
+
+    EXPECT_FALSE(sut.tryCloneToSharedChunk());
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, ComparisonDistinguishesTheReferredChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7531cea8-6554-4873-8213-152122b02c1a");
+    auto sharedChunk = getChunkFromMemoryManager();
+    auto otherSharedChunk = getChunkFromMemoryManager();
+    auto sut = ShmSafeUnmanagedChunk::fromAcquiredReference(sharedChunk);
+
+    EXPECT_TRUE(sut == ShmSafeUnmanagedChunk::fromAcquiredReference(sharedChunk));
+    EXPECT_FALSE(sut != ShmSafeUnmanagedChunk::fromAcquiredReference(sharedChunk));
+    EXPECT_TRUE(sut != ShmSafeUnmanagedChunk::fromAcquiredReference(otherSharedChunk));
+    EXPECT_TRUE(sut != ShmSafeUnmanagedChunk());
+    EXPECT_TRUE(ShmSafeUnmanagedChunk() == ShmSafeUnmanagedChunk());
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, ChunkManagementFromSeparatePoolCarriesIdOfRegisteredSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "98f2f338-15a5-4dba-9a84-aad998654ebf");
+    checkSegmentIdOfChunkInRegisteredSegment(ChunkManagementLayout::SEPARATE_POOL);
+}
+
+TEST_F(ShmSafeUnmanagedChunk_test, CoLocatedChunkManagementCarriesIdOfRegisteredSegment)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0ad8f6bc-3787-4245-9bed-959a926d9b15");
+    checkSegmentIdOfChunkInRegisteredSegment(ChunkManagementLayout::CO_LOCATED);
+}
+
 } // namespace
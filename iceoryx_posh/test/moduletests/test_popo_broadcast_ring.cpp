@@ -0,0 +1,276 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/popo/building_blocks/broadcast_ring.hpp"
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iox/memory.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::popo;
+using namespace iox::units::duration_literals;
+
+class BroadcastRing_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{4U};
+
+    void SetUp() override
+    {
+        auto ring = BroadcastRing::create(memory, CAPACITY);
+        ASSERT_FALSE(ring.has_error());
+        sut = ring.value();
+    }
+
+    void TearDown() override
+    {
+        iox::alignedFree(memory);
+    }
+
+    void writeValue(const uint64_t value)
+    {
+        ASSERT_FALSE(sut->write(&value, sizeof(value)).has_error());
+    }
+
+    void expectToReadValue(uint64_t& readIndex, const uint64_t expectedValue)
+    {
+        uint64_t value{0U};
+        auto result = sut->read(readIndex, &value, sizeof(value), hasLostMessages);
+        ASSERT_FALSE(result.has_error());
+        EXPECT_THAT(result.value(), Eq(sizeof(value)));
+        EXPECT_THAT(value, Eq(expectedValue));
+    }
+
+    void* memory{iox::alignedAlloc(BroadcastRing::requiredAlignment(), BroadcastRing::requiredSize(CAPACITY))};
+    BroadcastRing* sut{nullptr};
+    bool hasLostMessages{false};
+};
+constexpr uint64_t BroadcastRing_test::CAPACITY;
+
+TEST_F(BroadcastRing_test, CreateFailsWithInvalidCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f94afad3-8ad8-418b-a931-634b0e121725");
+    for (const uint64_t capacity : {uint64_t{0U}, BroadcastRing::MAX_CAPACITY + 1U})
+    {
+        auto result = BroadcastRing::create(memory, capacity);
+        ASSERT_TRUE(result.has_error());
+        EXPECT_THAT(result.error(), Eq(BroadcastRingError::INVALID_CAPACITY));
+    }
+}
+
+TEST_F(BroadcastRing_test, FromMemoryProvidesTheCreatedRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e576e519-f68b-43a8-a15b-c4b2f55700bf");
+    EXPECT_THAT(BroadcastRing::fromMemory(memory), Eq(sut));
+    EXPECT_THAT(sut->capacity(), Eq(CAPACITY));
+    EXPECT_THAT(sut->writeIndex(), Eq(0U));
+}
+
+TEST_F(BroadcastRing_test, FromMemoryReturnsNullptrForMemoryWithoutRing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f6caf63a-9ccc-4d13-ab31-d95defb8a920");
+    std::memset(memory, 0, BroadcastRing::requiredSize(CAPACITY));
+    EXPECT_THAT(BroadcastRing::fromMemory(memory), Eq(nullptr));
+    EXPECT_THAT(BroadcastRing::fromMemory(nullptr), Eq(nullptr));
+}
+
+TEST_F(BroadcastRing_test, ReadFromEmptyRingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "35301271-b771-42fd-b18e-fa1804c56787");
+    uint64_t readIndex{0U};
+    uint64_t value{0U};
+
+    EXPECT_FALSE(sut->hasMessage(readIndex));
+    auto result = sut->read(readIndex, &value, sizeof(value), hasLostMessages);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(BroadcastRingError::NO_MESSAGE_AVAILABLE));
+    EXPECT_THAT(readIndex, Eq(0U));
+    EXPECT_FALSE(hasLostMessages);
+}
+
+TEST_F(BroadcastRing_test, WrittenMessagesAreReadInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "08ea5a1c-c492-4c7a-83ec-5fee9eb24fa6");
+    uint64_t readIndex{0U};
+    writeValue(42U);
+    writeValue(73U);
+
+    EXPECT_TRUE(sut->hasMessage(readIndex));
+    expectToReadValue(readIndex, 42U);
+    expectToReadValue(readIndex, 73U);
+
+    EXPECT_THAT(readIndex, Eq(2U));
+    EXPECT_FALSE(sut->hasMessage(readIndex));
+    EXPECT_FALSE(hasLostMessages);
+}
+
+TEST_F(BroadcastRing_test, EachReaderReadsAllMessagesWithItsOwnReadIndex)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30a0dc71-3572-4cc9-889c-4438e1a860c6");
+    uint64_t firstReadIndex{0U};
+    uint64_t secondReadIndex{0U};
+    writeValue(1U);
+    writeValue(2U);
+
+    expectToReadValue(firstReadIndex, 1U);
+    expectToReadValue(firstReadIndex, 2U);
+    expectToReadValue(secondReadIndex, 1U);
+    expectToReadValue(secondReadIndex, 2U);
+}
+
+TEST_F(BroadcastRing_test, MessagesOfDifferentSizesAreReadWithTheirSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a2dea48-ddee-4652-b63d-fb941d0a68f1");
+    uint8_t message[BroadcastRing::MAX_MESSAGE_SIZE];
+    for (uint64_t i = 0U; i < sizeof(message); ++i)
+    {
+        message[i] = static_cast<uint8_t>(i);
+    }
+    ASSERT_FALSE(sut->write(message, 0U).has_error());
+    ASSERT_FALSE(sut->write(message, 13U).has_error());
+    ASSERT_FALSE(sut->write(message, sizeof(message)).has_error());
+
+    uint64_t readIndex{0U};
+    for (const uint64_t expectedSize : {uint64_t{0U}, uint64_t{13U}, uint64_t{sizeof(message)}})
+    {
+        uint8_t buffer[BroadcastRing::MAX_MESSAGE_SIZE]{};
+        auto result = sut->read(readIndex, buffer, sizeof(buffer), hasLostMessages);
+        ASSERT_FALSE(result.has_error());
+        EXPECT_THAT(result.value(), Eq(expectedSize));
+        EXPECT_THAT(std::memcmp(buffer, message, expectedSize), Eq(0));
+    }
+}
+
+TEST_F(BroadcastRing_test, WriteFailsForTooLargeMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d793c878-33b7-41c9-a89f-652caf6fff57");
+    uint8_t message[BroadcastRing::MAX_MESSAGE_SIZE + 1U]{};
+
+    auto result = sut->write(message, sizeof(message));
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(BroadcastRingError::MESSAGE_TOO_LARGE));
+    EXPECT_THAT(sut->writeIndex(), Eq(0U));
+}
+
+TEST_F(BroadcastRing_test, ReadWithTooSmallBufferFailsAndDoesNotConsumeTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65803372-04d1-48c4-b8c1-9551c8092374");
+    uint64_t readIndex{0U};
+    writeValue(42U);
+    uint32_t tooSmallBuffer{0U};
+
+    auto result = sut->read(readIndex, &tooSmallBuffer, sizeof(tooSmallBuffer), hasLostMessages);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(BroadcastRingError::BUFFER_TOO_SMALL));
+    EXPECT_THAT(readIndex, Eq(0U));
+    expectToReadValue(readIndex, 42U);
+}
+
+TEST_F(BroadcastRing_test, OvertakenReaderLosesTheOverwrittenMessagesAndContinuesWithTheOldestOne)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d31fe0f1-1c06-4a71-96ab-a56488e065fb");
+    uint64_t readIndex{0U};
+    constexpr uint64_t NUMBER_OF_MESSAGES{CAPACITY + 3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        writeValue(i);
+    }
+
+    for (uint64_t i = NUMBER_OF_MESSAGES - CAPACITY; i < NUMBER_OF_MESSAGES; ++i)
+    {
+        expectToReadValue(readIndex, i);
+    }
+
+    EXPECT_TRUE(hasLostMessages);
+    EXPECT_FALSE(sut->hasMessage(readIndex));
+}
+
+TEST_F(BroadcastRing_test, ConcurrentReadersReadOnlyCompleteMessagesInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f080ab7f-1404-4db2-b613-e08483352629");
+    constexpr uint64_t NUMBER_OF_MESSAGES{100000U};
+    constexpr uint64_t NUMBER_OF_READERS{2U};
+    constexpr uint64_t WORDS{BroadcastRing::MAX_MESSAGE_SIZE / sizeof(uint64_t)};
+    Watchdog watchdog{10_s};
+    watchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    std::atomic<bool> isWriterFinished{false};
+    std::atomic<uint64_t> numberOfTornMessages{0U};
+    std::atomic<uint64_t> numberOfMessagesOutOfOrder{0U};
+    std::vector<std::thread> readers;
+    for (uint64_t i = 0U; i < NUMBER_OF_READERS; ++i)
+    {
+        readers.emplace_back([&] {
+            uint64_t readIndex{0U};
+            uint64_t previousValue{0U};
+            bool hasLostReaderMessages{false};
+            uint64_t message[WORDS];
+            while (!isWriterFinished.load() || sut->hasMessage(readIndex))
+            {
+                auto result = sut->read(readIndex, message, sizeof(message), hasLostReaderMessages);
+                if (result.has_error())
+                {
+                    continue;
+                }
+                for (uint64_t word = 1U; word < WORDS; ++word)
+                {
+                    if (message[word] != message[0U])
+                    {
+                        ++numberOfTornMessages;
+                        break;
+                    }
+                }
+                if (message[0U] <= previousValue)
+                {
+                    ++numberOfMessagesOutOfOrder;
+                }
+                previousValue = message[0U];
+            }
+        });
+    }
+
+    uint64_t message[WORDS];
+    for (uint64_t value = 1U; value <= NUMBER_OF_MESSAGES; ++value)
+    {
+        for (auto& word : message)
+        {
+            word = value;
+        }
+        ASSERT_FALSE(sut->write(message, sizeof(message)).has_error());
+    }
+    isWriterFinished.store(true);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_THAT(numberOfTornMessages.load(), Eq(0U));
+    EXPECT_THAT(numberOfMessagesOutOfOrder.load(), Eq(0U));
+}
+
+} // namespace
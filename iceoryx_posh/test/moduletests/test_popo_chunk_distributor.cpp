@@ -23,6 +23,7 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "iceoryx_posh/internal/posh_error_reporting.hpp"
@@ -115,6 +116,12 @@ class ChunkDistributor_test : public Test
         return std::make_shared<ChunkQueueData_t>(policy, queueType);
     }
 
+    std::shared_ptr<ChunkQueueData_t> getLatestValueChunkQueueData()
+    {
+        return std::make_shared<ChunkQueueData_t>(
+            QueueFullPolicy::DISCARD_OLDEST_DATA, VariantQueueTypes::SoFi_SingleProducerSingleConsumer, true);
+    }
+
     std::shared_ptr<ChunkDistributorData_t>
     getChunkDistributorData(const ConsumerTooSlowPolicy policy = ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA)
     {
@@ -484,6 +491,151 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesReleasesChunkAfterLastQueueReleasedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca7271a1-c6be-4987-b17f-3baba0f71224");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(7331)), Eq(NUMBER_OF_QUEUES));
+    sut.clearHistory();
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(7331u));
+    }
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithFullDiscardingQueueReturnsTheUnusedReference)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "acdce2ad-8d3d-46da-a3a9-a18395afdef7");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto fullQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(fullQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    {
+        auto fillChunk = this->allocateChunk(1);
+        ChunkQueuePusher<ChunkQueueData_t> fullQueuePusher(fullQueueData.get());
+        for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY; ++i)
+        {
+            ASSERT_TRUE(fullQueuePusher.push(fillChunk));
+        }
+    }
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4242)), Eq(2U));
+    sut.clearHistory();
+
+    ChunkQueuePopper<ChunkQueueData_t> fullQueue(fullQueueData.get());
+    EXPECT_TRUE(fullQueue.hasLostChunks());
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(2U));
+
+    ChunkQueuePopper<ChunkQueueData_t> queue(queueData.get());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(4242u));
+    maybeSharedChunk.reset();
+
+    // only the chunk in the full queue is left
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithMultipleQueuesDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5b2e0c9-6a4d-4d3f-b8e1-2c7a9d0e4b61");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 8U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 21));
+    }
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES * NUMBER_OF_CHUNKS));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 21u));
+        }
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToAllStoredQueuesWithFullDiscardingQueueReturnsTheUnusedReferences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c2d9e47-b3a1-4f58-8e0c-5a7f3d1b9e26");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto fullQueueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_SingleProducerSingleConsumer);
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(fullQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    {
+        auto fillChunk = this->allocateChunk(1);
+        ChunkQueuePusher<ChunkQueueData_t> fullQueuePusher(fullQueueData.get());
+        for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY; ++i)
+        {
+            ASSERT_TRUE(fullQueuePusher.push(fillChunk));
+        }
+    }
+
+    {
+        std::vector<SharedChunk> chunks{this->allocateChunk(4242U), this->allocateChunk(4243U)};
+        EXPECT_THAT(sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size())), Eq(4U));
+    }
+    sut.clearHistory();
+
+    ChunkQueuePopper<ChunkQueueData_t> fullQueue(fullQueueData.get());
+    EXPECT_TRUE(fullQueue.hasLostChunks());
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(3U));
+
+    ChunkQueuePopper<ChunkQueueData_t> queue(queueData.get());
+    EXPECT_TRUE(queue.tryPop().has_value());
+    EXPECT_TRUE(queue.tryPop().has_value());
+
+    // only the chunk in the full queue is left
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -600,6 +752,71 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithMoreChunksThanCapacityLeadsT
     ASSERT_TRUE(queue.hasLostChunks());
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToOneOfStoredQueuesWithoutQueuesDeliversToNoQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e2c9a47-0d81-4b3f-96a7-c4f1e8b2d036");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto chunk = this->allocateChunk(42);
+
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::ROUND_ROBIN, 0U, chunk), Eq(0U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToOneOfStoredQueuesWithKeyBasedPolicyDeliversToQueueSelectedByKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b71f0e3c-2a94-4d68-8c5b-e09d3a6f7c21");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+
+    constexpr uint64_t KEY_OF_SECOND_QUEUE{3U};
+    constexpr uint64_t KEY_OF_FIRST_QUEUE{4U};
+    auto chunk = this->allocateChunk(1);
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::ROUND_ROBIN, KEY_OF_SECOND_QUEUE, chunk), Eq(1U));
+    chunk = this->allocateChunk(2);
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::STICKY_BY_KEY, KEY_OF_SECOND_QUEUE, chunk), Eq(1U));
+    chunk = this->allocateChunk(3);
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::STICKY_BY_KEY, KEY_OF_FIRST_QUEUE, chunk), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_THAT(queue1.size(), Eq(1U));
+    EXPECT_THAT(queue2.size(), Eq(2U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToOneOfStoredQueuesWithLeastOutstandingRequestsDeliversToLeastFilledQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c8d4f62-e13a-4b97-a25e-6f7b9c1d3e84");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData1->m_uniqueId, 0U, this->allocateChunk(1)).has_error());
+
+    constexpr uint64_t KEY_OF_FIRST_QUEUE{0U};
+    constexpr uint32_t DATA_TO_SEND{73};
+    constexpr auto POLICY{LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS};
+    auto chunk = this->allocateChunk(DATA_TO_SEND);
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(POLICY, KEY_OF_FIRST_QUEUE, chunk), Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue1(queueData1.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    EXPECT_THAT(queue1.size(), Eq(1U));
+    auto maybeSharedChunk = queue2.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(DATA_TO_SEND));
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionBlocksDelivery)
 {
     ::testing::Test::RecordProperty("TEST_ID", "9f594607-215e-4db5-bdae-433c185dbbcd");
@@ -640,6 +857,86 @@ TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionBlocksDelivery
     EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithBlockingOptionReturnsErrorWhenQueueIsRemovedWhileWaiting)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5d18e3a-7f42-4b09-a6e1-2b9f0c7d4e83");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    for (uint64_t i = 0; i < ChunkQueueData_t::MAX_CAPACITY; ++i)
+    {
+        auto chunk = this->allocateChunk(i);
+        ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, chunk).has_error());
+    }
+
+    Barrier isThreadStarted(1U);
+    auto chunk = this->allocateChunk(7373);
+    std::atomic_bool hasDeliveryFailed{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        hasDeliveryFailed = sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, chunk).has_error();
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+
+    // the waiting producer must not hold the lock, otherwise the queue could not be removed
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join();
+    EXPECT_THAT(hasDeliveryFailed.load(), Eq(true));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueWithUnknownIndexFindsQueueWhenCachedIndexIsStale)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e4b2f61-d93a-4c57-b0f8-1a6e3d9c2b75");
+    constexpr uint32_t UNKNOWN_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData1 = this->getChunkQueueData();
+    auto queueData2 = this->getChunkQueueData();
+    auto queueData3 = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData1.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData2.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData3.get()).has_error());
+
+    // caches the index of the second and third queue
+    ASSERT_FALSE(sut.deliverToQueue(queueData2->m_uniqueId, UNKNOWN_QUEUE_INDEX, this->allocateChunk(1)).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData3->m_uniqueId, UNKNOWN_QUEUE_INDEX, this->allocateChunk(2)).has_error());
+
+    // the cached index of the second queue now points to the third queue and the one of the third queue is invalid
+    ASSERT_FALSE(sut.tryRemoveQueue(queueData1.get()).has_error());
+
+    constexpr uint32_t DATA_TO_SECOND_QUEUE{3};
+    constexpr uint32_t DATA_TO_THIRD_QUEUE{4};
+    auto chunk = this->allocateChunk(DATA_TO_SECOND_QUEUE);
+    ASSERT_FALSE(sut.deliverToQueue(queueData2->m_uniqueId, UNKNOWN_QUEUE_INDEX, chunk).has_error());
+    chunk = this->allocateChunk(DATA_TO_THIRD_QUEUE);
+    ASSERT_FALSE(sut.deliverToQueue(queueData3->m_uniqueId, UNKNOWN_QUEUE_INDEX, chunk).has_error());
+
+    sut.getQueueIndex(queueData3->m_uniqueId, UNKNOWN_QUEUE_INDEX)
+        .and_then([&](const auto& index) { EXPECT_THAT(index, Eq(1U)); })
+        .or_else([] { GTEST_FAIL() << "Expected to get an index!"; });
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue2(queueData2.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue3(queueData3.get());
+    ASSERT_THAT(queue2.size(), Eq(2U));
+    ASSERT_THAT(queue3.size(), Eq(2U));
+    IOX_DISCARD_RESULT(queue2.tryPop());
+    IOX_DISCARD_RESULT(queue3.tryPop());
+    EXPECT_THAT(this->getSharedChunkValue(*queue2.tryPop()), Eq(DATA_TO_SECOND_QUEUE));
+    EXPECT_THAT(this->getSharedChunkValue(*queue3.tryPop()), Eq(DATA_TO_THIRD_QUEUE));
+}
+
 
 TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithLessThanAvailable)
 {
@@ -821,4 +1118,514 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverBatchToSingleQueueBlocksUntilAllChunksAreDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2d9a6f13-c8e7-4b05-a1f4-83e6b7d2c590");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(73U), this->allocateChunk(74U), this->allocateChunk(75U)};
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wereChunksDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        auto numberOfDeliveries =
+            sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size()));
+        EXPECT_THAT(numberOfDeliveries, Eq(chunks.size()));
+        wereChunksDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    for (auto value : {73U, 74U})
+    {
+        std::this_thread::sleep_for(this->BLOCKING_DURATION);
+        EXPECT_THAT(wereChunksDelivered.load(), Eq(false));
+
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(value));
+    }
+
+    t1.join(); // join needs to be before the load to ensure the wereChunksDelivered store happens before the read
+    EXPECT_THAT(wereChunksDelivered.load(), Eq(true));
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(75U));
+    EXPECT_THAT(sut.getHistorySize(), Eq(chunks.size()));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryRegistersAtFullQueueUntilChunkIsDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8a3a0999-d0df-4558-91a0-e97b4d417133");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(1U));
+
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingFullQueueWhileDeliveryIsBlockedUnregistersAndFinishesDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "54f6f882-5ee0-4cb8-81f0-7a864231adeb");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic<uint64_t> numberOfDeliveries{1U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    t1.join();
+
+    EXPECT_THAT(numberOfDeliveries.load(), Eq(0U));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingFullQueueWhileBatchDeliveryIsBlockedReturnsTheReservedReferences)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d80f4b1a-7e63-4c2d-b95a-3f1e6c8a2d47");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    {
+        std::vector<SharedChunk> chunks{this->allocateChunk(73U), this->allocateChunk(74U)};
+
+        Barrier isThreadStarted(1U);
+        std::atomic<uint64_t> numberOfDeliveries{1U};
+        std::thread t1([&] {
+            isThreadStarted.notify();
+            numberOfDeliveries =
+                sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size()));
+        });
+
+        isThreadStarted.wait();
+        std::this_thread::sleep_for(this->BLOCKING_DURATION);
+
+        EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+        t1.join();
+
+        EXPECT_THAT(numberOfDeliveries.load(), Eq(0U));
+    }
+    sut.clearHistory();
+
+    EXPECT_TRUE(queue.tryPop().has_value());
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedBatchDeliveryUnregistersFromQueueAfterAllChunksAreDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a16f5cb3-495f-4476-ad45-110cf138b7ae");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+
+    std::vector<SharedChunk> chunks{this->allocateChunk(73U), this->allocateChunk(74U)};
+
+    Barrier isThreadStarted(1U);
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        IOX_DISCARD_RESULT(sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size())));
+    });
+
+    isThreadStarted.wait();
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(1U));
+
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryToQueueRegistersAtFullQueueAndIsWokenUpWhenTheConsumerTakesAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b7e1d52-9c4a-4f86-a2d0-6e8f1c5b7a94");
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(155U)).has_error());
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        EXPECT_FALSE(
+            sut.deliverToQueue(queueData->m_uniqueId, EXPECTED_QUEUE_INDEX, this->allocateChunk(152U)).has_error());
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+    // the producer sleeps until the consumer frees a slot instead of polling the queue
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(1U));
+
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
+}
+
+TYPED_TEST(ChunkDistributor_test, BlockedDeliveryToOneOfStoredQueuesRegistersAtFullQueueUntilChunkIsDelivered)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e5a0c8f3-1d27-4b69-9f4e-7c3b2a8d6e15");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    EXPECT_THAT(sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::ROUND_ROBIN, 0U, this->allocateChunk(155U)),
+                Eq(1U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic<uint64_t> numberOfDeliveries{0U};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        numberOfDeliveries =
+            sut.deliverToOneOfStoredQueues(LoadBalancingPolicy::ROUND_ROBIN, 0U, this->allocateChunk(152U));
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(numberOfDeliveries.load(), Eq(0U));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(1U));
+
+    EXPECT_TRUE(queue.tryPop().has_value());
+    t1.join();
+
+    EXPECT_THAT(numberOfDeliveries.load(), Eq(1U));
+    EXPECT_THAT(queueData->m_numberOfBlockedProducers.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, NotifyAllStoredQueuesWakesUpTheQueuesWithoutDeliveringAChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a367d16-b0d5-419e-9651-91c8d3fdcdb9");
+    using namespace iox::units::duration_literals;
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setConditionVariable(condVar, 0U);
+
+    sut.notifyAllStoredQueues();
+
+    EXPECT_FALSE(condVarWaiter.timedWait(1_ns).empty());
+    EXPECT_TRUE(queue.empty());
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueuesReadTheDeliveredChunkWithoutAQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0061bef1-eb1e-420f-8baf-90506fb76920");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto latestValueQueueData1 = this->getLatestValueChunkQueueData();
+    auto latestValueQueueData2 = this->getLatestValueChunkQueueData();
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData1.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData2.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(4451U)), Eq(3U));
+
+    EXPECT_TRUE(latestValueQueueData1->m_queue.empty());
+    EXPECT_THAT(queueData->m_queue.size(), Eq(1U));
+    for (auto& latestValueQueueData : {latestValueQueueData1, latestValueQueueData2})
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+        EXPECT_THAT(queue.size(), Eq(1U));
+        auto maybeChunk = queue.tryPop();
+        ASSERT_TRUE(maybeChunk.has_value());
+        EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(4451U));
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.tryPop().has_value());
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueueReadsOnlyTheLatestDeliveredChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "625d15a6-f957-4816-9dbc-5707ce85f2ab");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+
+    for (uint32_t i = 1U; i <= 3U; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+    std::vector<SharedChunk> chunks{this->allocateChunk(4U), this->allocateChunk(5U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(iox::span<const SharedChunk>(chunks.data(), chunks.size())), Eq(2U));
+
+    std::vector<uint32_t> receivedValues;
+    auto collectValue = [&](auto& chunk) { receivedValues.push_back(this->getSharedChunkValue(chunk)); };
+    EXPECT_THAT(queue.tryPopMultiple(10U, collectValue), Eq(1U));
+    ASSERT_THAT(receivedValues.size(), Eq(1U));
+    EXPECT_THAT(receivedValues[0], Eq(5U));
+    EXPECT_THAT(queue.tryPopMultiple(10U, [](auto&) {}), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueueGetsTheLatestHistoryChunkOnlyWhenHistoryIsRequested)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1d31e041-101d-43f7-a247-a348c008b5df");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    sut.addToHistoryWithoutDelivery(this->allocateChunk(1U));
+    sut.addToHistoryWithoutDelivery(this->allocateChunk(2U));
+
+    auto latestValueQueueWithHistoryData = this->getLatestValueChunkQueueData();
+    auto latestValueQueueWithoutHistoryData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueWithHistoryData.get(), 1U, true).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueWithoutHistoryData.get(), 0U, true).has_error());
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queueWithHistory(latestValueQueueWithHistoryData.get());
+    auto maybeChunk = queueWithHistory.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(2U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queueWithoutHistory(
+        latestValueQueueWithoutHistoryData.get());
+    EXPECT_TRUE(queueWithoutHistory.empty());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingTheLastLatestValueQueueReleasesTheStoredChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4cdd57db-1186-438e-ac56-eb2c57fdb2b5");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto latestValueQueueData1 = this->getLatestValueChunkQueueData();
+    auto latestValueQueueData2 = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData1.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData2.get(), 0U, true).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut.clearHistory();
+
+    ASSERT_FALSE(sut.tryRemoveQueue(latestValueQueueData1.get()).has_error());
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+    EXPECT_TRUE(latestValueQueueData1->m_latestValueSources[0].m_slot.load().isLogicalNullptr());
+
+    sut.removeAllQueues();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+    EXPECT_TRUE(latestValueQueueData2->m_latestValueSources[0].m_slot.load().isLogicalNullptr());
+}
+
+TYPED_TEST(ChunkDistributor_test, ChunkHeldByLatestValueQueueIsNotReleasedWhenItIsReplaced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c81b78fb-b209-49c4-855b-4bc2450b2b95");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+
+    sut.deliverToAllStoredQueues(this->allocateChunk(1U));
+    auto maybeChunk = queue.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    sut.deliverToAllStoredQueues(this->allocateChunk(2U));
+    sut.clearHistory();
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(2U));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(1U));
+    maybeChunk.reset();
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(1U));
+
+    sut.removeAllQueues();
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueueReadsAnotherProducerWhenItsProducerRemovedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c8e15bf8-b10d-45e7-8224-fee08cf1f52c");
+    auto sutData1 = this->getChunkDistributorData();
+    auto sutData2 = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut1(sutData1.get());
+    typename TestFixture::ChunkDistributor_t sut2(sutData2.get());
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut1.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut2.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+
+    ASSERT_FALSE(sut2.tryRemoveQueue(latestValueQueueData.get()).has_error());
+    EXPECT_TRUE(queue.empty());
+    sut1.deliverToAllStoredQueues(this->allocateChunk(42U));
+
+    auto maybeChunk = queue.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(42U));
+
+    sut1.removeAllQueues();
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueueReadsTheValueOfTheProducerWhichPublishedLast)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a4cdc3cd-232d-41c0-a5d3-4e8eeaf5a56b");
+    auto sutData1 = this->getChunkDistributorData();
+    auto sutData2 = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut1(sutData1.get());
+    typename TestFixture::ChunkDistributor_t sut2(sutData2.get());
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut1.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut2.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+
+    sut1.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut2.deliverToAllStoredQueues(this->allocateChunk(2U));
+    auto maybeChunk = queue.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(2U));
+    EXPECT_TRUE(queue.empty());
+
+    sut1.deliverToAllStoredQueues(this->allocateChunk(3U));
+    EXPECT_FALSE(queue.empty());
+    maybeChunk = queue.tryPop();
+    ASSERT_TRUE(maybeChunk.has_value());
+    EXPECT_THAT(this->getSharedChunkValue(*maybeChunk), Eq(3U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    sut1.removeAllQueues();
+    sut2.removeAllQueues();
+}
+
+TYPED_TEST(ChunkDistributor_test, LatestValueQueueDoesNotReadAnOlderValueWhenTheProducerWhichPublishedLastRemovedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b90dfd57-bec7-4dc4-af9b-c59ae821ed23");
+    auto sutData1 = this->getChunkDistributorData();
+    auto sutData2 = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut1(sutData1.get());
+    typename TestFixture::ChunkDistributor_t sut2(sutData2.get());
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+    ASSERT_FALSE(sut1.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ASSERT_FALSE(sut2.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(latestValueQueueData.get());
+
+    sut1.deliverToAllStoredQueues(this->allocateChunk(1U));
+    sut2.deliverToAllStoredQueues(this->allocateChunk(2U));
+    ASSERT_TRUE(queue.tryPop().has_value());
+
+    ASSERT_FALSE(sut2.tryRemoveQueue(latestValueQueueData.get()).has_error());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.tryPop().has_value());
+
+    sut1.removeAllQueues();
+}
+
+TYPED_TEST(ChunkDistributor_test, AddingLatestValueQueueToMoreProducersThanItHasSourcesFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "16ff1f30-5253-4ad0-b375-2117c219a0a3");
+    using ChunkDistributorData_t = typename TestFixture::ChunkDistributorData_t;
+    constexpr uint64_t MAX_SOURCES{TestFixture::ChunkQueueData_t::MAX_LATEST_VALUE_SOURCES};
+    auto latestValueQueueData = this->getLatestValueChunkQueueData();
+
+    std::vector<std::shared_ptr<ChunkDistributorData_t>> sutData;
+    for (uint64_t i = 0U; i < MAX_SOURCES; ++i)
+    {
+        sutData.push_back(this->getChunkDistributorData());
+        typename TestFixture::ChunkDistributor_t sut(sutData.back().get());
+        ASSERT_FALSE(sut.tryAddQueue(latestValueQueueData.get(), 0U, true).has_error());
+    }
+
+    IOX_TESTING_ASSERT_OK();
+
+    auto overflowSutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t overflowSut(overflowSutData.get());
+    auto ret = overflowSut.tryAddQueue(latestValueQueueData.get(), 0U, true);
+    ASSERT_TRUE(ret.has_error());
+    EXPECT_THAT(ret.error(), Eq(iox::popo::ChunkDistributorError::LATEST_VALUE_SOURCE_OVERFLOW));
+    EXPECT_FALSE(overflowSut.hasStoredQueues());
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_DISTRIBUTOR_OVERFLOW_OF_LATEST_VALUE_SOURCES);
+
+    for (auto& data : sutData)
+    {
+        typename TestFixture::ChunkDistributor_t(data.get()).removeAllQueues();
+    }
+}
+
 } // namespace
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
@@ -161,6 +162,42 @@ TYPED_TEST(ChunkQueue_test, PopOneChunk)
     }
 }
 
+TYPED_TEST(ChunkQueue_test, PushRaisesMaxQueueDepthInStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7eff3e3a-8e66-4c30-8f25-cd2c59cc1b8d");
+    this->m_chunkData.m_statistics.m_isMaxQueueDepthTracked.store(true);
+    for (int i = 0; i < 3; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+    this->m_pusher.push(this->allocateChunk());
+
+    EXPECT_THAT(this->m_chunkData.m_statistics.m_maxQueueDepth.load(), Eq(3U));
+}
+
+TYPED_TEST(ChunkQueue_test, PushDoesNotRaiseMaxQueueDepthWhenItIsNotTracked)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2f8c6a1e-4d93-4b7e-a05c-9e1d3b7f5a28");
+    for (int i = 0; i < 3; ++i)
+    {
+        this->m_pusher.push(this->allocateChunk());
+    }
+
+    EXPECT_THAT(this->m_chunkData.m_statistics.m_maxQueueDepth.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueue_test, LostChunksAreCountedInStatisticsIndependentOfTheLostChunkIndication)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7ec75bb7-e88a-4639-a7b2-7ef26faa3623");
+    this->m_pusher.lostAChunk();
+    EXPECT_TRUE(this->m_popper.hasLostChunks());
+    this->m_pusher.lostAChunk();
+
+    EXPECT_THAT(this->m_chunkData.m_statistics.m_lostChunks.load(), Eq(2U));
+}
+
 TYPED_TEST(ChunkQueue_test, PushedChunksMustBePoppedInTheSameOrder)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6cbc1535-aea1-4d85-ae0a-a20e4fce3032");
@@ -259,6 +296,81 @@ TYPED_TEST(ChunkQueue_test, AttachSecondConditionVariable)
     EXPECT_THAT(condVarWaiter2.timedWait(1_ms).empty(), Eq(false));
 }
 
+TYPED_TEST(ChunkQueue_test, RegisterBlockedProducerTwiceKeepsOneRegistration)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b701106f-380a-4610-8044-0ff8bcd0d2f0");
+    ConditionVariableData condVar("Horscht");
+
+    EXPECT_TRUE(this->m_pusher.registerBlockedProducer(condVar));
+    EXPECT_TRUE(this->m_pusher.registerBlockedProducer(condVar));
+
+    EXPECT_TRUE(this->m_pusher.unregisterBlockedProducer(condVar));
+    EXPECT_FALSE(this->m_pusher.unregisterBlockedProducer(condVar));
+}
+
+TYPED_TEST(ChunkQueue_test, RegisterMoreThanMaxBlockedProducersFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8e3f0275-1f46-4068-bfa7-f067f6e726e9");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    constexpr uint64_t MAX_BLOCKED_PRODUCERS{ChunkQueueData_t::MAX_BLOCKED_PRODUCERS};
+    std::vector<std::unique_ptr<ConditionVariableData>> condVars;
+    for (uint64_t i = 0U; i <= MAX_BLOCKED_PRODUCERS; ++i)
+    {
+        condVars.emplace_back(std::make_unique<ConditionVariableData>("Horscht"));
+    }
+
+    for (uint64_t i = 0U; i < MAX_BLOCKED_PRODUCERS; ++i)
+    {
+        EXPECT_TRUE(this->m_pusher.registerBlockedProducer(*condVars[i]));
+    }
+    EXPECT_FALSE(this->m_pusher.registerBlockedProducer(*condVars[MAX_BLOCKED_PRODUCERS]));
+
+    EXPECT_TRUE(this->m_pusher.unregisterBlockedProducer(*condVars[0U]));
+    EXPECT_TRUE(this->m_pusher.registerBlockedProducer(*condVars[MAX_BLOCKED_PRODUCERS]));
+}
+
+TYPED_TEST(ChunkQueue_test, PopNotifiesRegisteredBlockedProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c8f3d05-3522-46b8-8514-f3b94ebb0501");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_pusher.push(this->allocateChunk());
+
+    ASSERT_TRUE(this->m_pusher.registerBlockedProducer(condVar));
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+
+    auto notifications = condVarWaiter.timedWait(1_ns);
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0U], Eq(TestFixture::ChunkQueueData_t::SPACE_AVAILABLE_NOTIFICATION_INDEX));
+}
+
+TYPED_TEST(ChunkQueue_test, ClearNotifiesRegisteredBlockedProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f9b2493-82c8-4677-b7dc-a04f90a6009e");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_pusher.push(this->allocateChunk());
+
+    ASSERT_TRUE(this->m_pusher.registerBlockedProducer(condVar));
+    this->m_popper.clear();
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(false));
+}
+
+TYPED_TEST(ChunkQueue_test, PopDoesNotNotifyUnregisteredBlockedProducer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "022739ba-3a02-42b7-86f1-3863fa89ffdb");
+    ConditionVariableData condVar("Horscht");
+    ConditionListener condVarWaiter{condVar};
+    this->m_pusher.push(this->allocateChunk());
+
+    ASSERT_TRUE(this->m_pusher.registerBlockedProducer(condVar));
+    ASSERT_TRUE(this->m_pusher.unregisterBlockedProducer(condVar));
+    EXPECT_TRUE(this->m_popper.tryPop().has_value());
+
+    EXPECT_THAT(condVarWaiter.timedWait(1_ns).empty(), Eq(true));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueSaturatingFIFO_test when there are more FIFOs available
 using ChunkQueueFiFoTestSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -323,6 +435,33 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, TryPushWithAcquiredReferenceToFullQueueRejectsChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "90283a31-3d8e-4986-a412-82eb7dd2027f");
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        chunk.acquireReferences(1U);
+        EXPECT_THAT(this->m_pusher.tryPushWithoutNotification(ShmSafeUnmanagedChunk::fromAcquiredReference(chunk)),
+                    Eq(ChunkQueuePushResult::STORED));
+    }
+
+    {
+        auto chunk = this->allocateChunk();
+        chunk.acquireReferences(1U);
+        EXPECT_THAT(this->m_pusher.tryPushWithoutNotification(ShmSafeUnmanagedChunk::fromAcquiredReference(chunk)),
+                    Eq(ChunkQueuePushResult::REJECTED));
+        // the queue did not take over the reference
+        chunk.releaseReferences(1U);
+    }
+
+    while (this->m_popper.tryPop().has_value())
+    {
+    }
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
@@ -387,6 +526,34 @@ TYPED_TEST(ChunkQueueSoFi_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueSoFi_test, TryPushWithAcquiredReferenceToFullQueueDropsOldestChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1bc28dcb-e82d-4022-8e06-370467b33904");
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        auto chunk = this->allocateChunk();
+        chunk.acquireReferences(1U);
+        EXPECT_THAT(this->m_pusher.tryPushWithoutNotification(ShmSafeUnmanagedChunk::fromAcquiredReference(chunk)),
+                    Eq(ChunkQueuePushResult::STORED));
+    }
+
+    {
+        auto chunk = this->allocateChunk();
+        chunk.acquireReferences(1U);
+        EXPECT_THAT(this->m_pusher.tryPushWithoutNotification(ShmSafeUnmanagedChunk::fromAcquiredReference(chunk)),
+                    Eq(ChunkQueuePushResult::STORED_WITH_OVERFLOW));
+    }
+
+    // the dropped chunk was released
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+
+    while (this->m_popper.tryPop().has_value())
+    {
+    }
+
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
 
 TYPED_TEST(ChunkQueueSoFi_test, InitialNoLostChunks)
 {
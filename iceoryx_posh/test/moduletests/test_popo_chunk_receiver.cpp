@@ -31,7 +31,9 @@
 #include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
 #include "test.hpp"
 
+#include <array>
 #include <memory>
+#include <vector>
 
 namespace
 {
@@ -123,6 +125,38 @@ TEST_F(ChunkReceiver_test, getAndReleaseOneChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkReceiver_test, getAndReleaseChunksWithExternalUsedChunkList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf0168fb-42e4-4d05-b0f1-63ddcba1e6f4");
+    constexpr uint32_t CAPACITY{2U};
+    iox::popo::UsedChunkList<CAPACITY> chunksInUse;
+    std::vector<const iox::mepoo::ChunkHeader*> chunks;
+
+    for (uint32_t i = 0U; i < CAPACITY + 1U; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        auto maybeChunkHeader = m_chunkReceiver.tryGet(chunksInUse);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunks.push_back(*maybeChunkHeader);
+    }
+
+    auto maybeChunkHeader = m_chunkReceiver.tryGet(chunksInUse);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+    EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CAPACITY));
+
+    for (auto* chunk : chunks)
+    {
+        m_chunkReceiver.release(chunk, chunksInUse);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(ChunkReceiver_test, getAndReleaseMultipleChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "32bfe8a5-8d17-4912-9591-c4f29bdd390e");
@@ -184,6 +218,67 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getMultipleChunksInOneCallReturnsThemInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9df04f12-4c18-4e21-8da2-dd05d89285c9");
+    constexpr uint64_t NUMBER_OF_CHUNKS{5U};
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        new (sharedChunk.getUserPayload()) DummySample();
+        static_cast<DummySample*>(sharedChunk.getUserPayload())->dummy = i;
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    std::array<const iox::mepoo::ChunkHeader*, NUMBER_OF_CHUNKS + 2U> chunks{};
+    auto result = m_chunkReceiver.tryGetMultiple(iox::span<const iox::mepoo::ChunkHeader*>(chunks));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(NUMBER_OF_CHUNKS));
+
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunks[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+
+    result = m_chunkReceiver.tryGetMultiple(iox::span<const iox::mepoo::ChunkHeader*>(chunks));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE));
+}
+
+TEST_F(ChunkReceiver_test, getMultipleChunksDoesNotTakeMoreChunksThanCanBeHeld)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "06f01b4b-65dd-4b67-8007-96f1cf30b3c5");
+    constexpr uint64_t NUMBER_OF_CHUNKS_LEFT_IN_QUEUE{3U};
+    std::vector<const iox::mepoo::ChunkHeader*> chunks(iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1U);
+    for (size_t i = 0; i < chunks.size() + NUMBER_OF_CHUNKS_LEFT_IN_QUEUE; i++)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        ASSERT_TRUE(sharedChunk);
+        m_chunkQueuePusher.push(sharedChunk);
+
+        if (i == iox::MAX_SUBSCRIBER_QUEUE_CAPACITY - 1U)
+        {
+            // the queue is full; drain it to be able to push the remaining chunks
+            auto result = m_chunkReceiver.tryGetMultiple(iox::span<const iox::mepoo::ChunkHeader*>(chunks));
+            ASSERT_FALSE(result.has_error());
+            EXPECT_THAT(result.value(), Eq(iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+        }
+    }
+
+    // only the remaining free slots are filled and the other chunks stay in the queue
+    auto result = m_chunkReceiver.tryGetMultiple(iox::span<const iox::mepoo::ChunkHeader*>(chunks));
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(chunks.size() - iox::MAX_SUBSCRIBER_QUEUE_CAPACITY));
+
+    result = m_chunkReceiver.tryGetMultiple(iox::span<const iox::mepoo::ChunkHeader*>(chunks));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(chunks.size() + NUMBER_OF_CHUNKS_LEFT_IN_QUEUE));
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
@@ -435,6 +435,46 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendChunksWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f0a4d27-e3b9-4c18-9a5d-b1c8e2f7403a");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    std::vector<iox::mepoo::ChunkHeader*> chunkHeaders;
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        auto sample = new ((*maybeChunkHeader)->userPayload()) DummySample();
+        sample->dummy = i;
+        chunkHeaders.push_back(*maybeChunkHeader);
+    }
+
+    auto numberOfDeliveries =
+        m_chunkSender.sendChunks(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders.data(), chunkHeaders.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_CHUNKS));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint64_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        auto dummySample = *reinterpret_cast<DummySample*>(popRet->getUserPayload());
+        EXPECT_THAT(dummySample.dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+
+    auto maybeLastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(maybeLastChunk.has_value());
+    EXPECT_THAT(*maybeLastChunk, Eq(chunkHeaders.back()));
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -492,7 +532,70 @@ TEST_F(ChunkSender_test, sendInvalidChunk)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
 }
 
-TEST_F(ChunkSender_test, sendToQueueWithoutReceiverReturnsFalse)
+TEST_F(ChunkSender_test, allocateWithExternalUsedChunkListStoresTheChunkInTheProvidedList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6b839aa1-e5f8-4ad6-9bf9-f66faf13b7e6");
+    iox::popo::UsedChunkList<1U> chunksInUse;
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(chunksInUse,
+                                                      UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+
+    auto secondChunkHeader = m_chunkSender.tryAllocate(chunksInUse,
+                                                       UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                       sizeof(DummySample),
+                                                       alignof(DummySample),
+                                                       USER_HEADER_SIZE,
+                                                       USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(secondChunkHeader.has_error());
+    EXPECT_THAT(secondChunkHeader.error(), Eq(iox::popo::AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL));
+
+    // the chunk is not known to the internal list of the chunk sender
+    m_chunkSender.release(*maybeChunkHeader);
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_FREE_FROM_USER);
+
+    m_chunkSender.release(*maybeChunkHeader, chunksInUse);
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendToQueueWithExternalUsedChunkListDeliversSampleAndDoesNotStoreLastChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af589a1f-94e0-4795-8be5-2c35a33b24a1");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> queuePopper(&m_chunkQueueData);
+    iox::popo::UsedChunkList<iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunksInUse;
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(chunksInUse,
+                                                      UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+
+    auto chunkHeader = *maybeChunkHeader;
+    uint64_t EXPECTED_SAMPLE_DATA{37};
+    new (chunkHeader->userPayload()) DummySample{EXPECTED_SAMPLE_DATA};
+    constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
+    EXPECT_TRUE(
+        m_chunkSender.sendToQueue(chunkHeader, m_chunkQueueData.m_uniqueId, EXPECTED_QUEUE_INDEX, chunksInUse));
+    EXPECT_FALSE(m_chunkSender.tryGetPreviousChunk().has_value());
+
+    {
+        auto maybeSharedChunk = queuePopper.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        auto receivedData = *(static_cast<DummySample*>(maybeSharedChunk.value().getUserPayload()));
+        EXPECT_THAT(receivedData.dummy, Eq(EXPECTED_SAMPLE_DATA));
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, sendToQueueWithoutReceiverReturnsFalseAndReleasesChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "7139bfdc-3df9-4def-a292-407f8e650b34");
     auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
@@ -506,8 +609,9 @@ TEST_F(ChunkSender_test, sendToQueueWithoutReceiverReturnsFalse)
     auto chunkHeader = *maybeChunkHeader;
     constexpr uint32_t EXPECTED_QUEUE_INDEX{0U};
     EXPECT_FALSE(m_chunkSender.sendToQueue(chunkHeader, m_chunkQueueData.m_uniqueId, EXPECTED_QUEUE_INDEX));
-    // chunk is still used because last chunk is stored
-    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    // an undelivered chunk is not stored as last chunk
+    EXPECT_FALSE(m_chunkSender.tryGetPreviousChunk().has_value());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
 TEST_F(ChunkSender_test, sendToQueueWithReceiverReturnsTrueAndDeliversSample)
@@ -770,6 +874,52 @@ TEST_F(ChunkSender_test, ReuseOfLastIfBiggerButFitsInChunk)
     EXPECT_TRUE((*chunkBigger)->userPayload() == (*maybeLastChunk)->userPayload());
 }
 
+TEST_F(ChunkSender_test, SendCountsSentChunksAndBytesInStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "771129e8-1c6d-4756-af3a-d895e7cfd2f7");
+    constexpr uint64_t NUMBER_OF_SENT_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SENT_CHUNKS; ++i)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                          sizeof(DummySample),
+                                                          alignof(DummySample),
+                                                          USER_HEADER_SIZE,
+                                                          USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        m_chunkSender.send(maybeChunkHeader.value());
+    }
+
+    const auto& statistics = m_chunkSenderData.m_statistics;
+    EXPECT_THAT(statistics.m_sentChunks.load(), Eq(NUMBER_OF_SENT_CHUNKS));
+    EXPECT_THAT(statistics.m_sentBytes.load(), Eq(NUMBER_OF_SENT_CHUNKS * sizeof(DummySample)));
+    EXPECT_THAT(statistics.m_allocationFailures.load(), Eq(0U));
+}
+
+TEST_F(ChunkSender_test, FailingAllocationIsCountedInStatistics)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11ce5ff3-6f0f-4229-96e0-3b2e879ec1e5");
+    for (size_t i = 0; i < iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY; i++)
+    {
+        ASSERT_FALSE(m_chunkSender
+                         .tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                      sizeof(DummySample),
+                                      alignof(DummySample),
+                                      USER_HEADER_SIZE,
+                                      USER_HEADER_ALIGNMENT)
+                         .has_error());
+    }
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(UniquePortId(iox::roudi::DEFAULT_UNIQUE_ROUDI_ID),
+                                                      sizeof(DummySample),
+                                                      alignof(DummySample),
+                                                      USER_HEADER_SIZE,
+                                                      USER_HEADER_ALIGNMENT);
+    ASSERT_TRUE(maybeChunkHeader.has_error());
+
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_allocationFailures.load(), Eq(1U));
+    EXPECT_THAT(m_chunkSenderData.m_statistics.m_sentChunks.load(), Eq(0U));
+}
+
 TEST_F(ChunkSender_test, Cleanup)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5e5ab921-24bf-45a9-9572-68e444120baa");
@@ -120,6 +120,27 @@ TEST_F(Client_test, SendCallsUnderlyingPort)
         });
 }
 
+TEST_F(Client_test, SendWithLoadBalancingKeyCallsUnderlyingPortWithKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a9c1e73-2f48-4b6d-8d0a-e7b3c6f1a924");
+    constexpr uint64_t LOAD_BALANCING_KEY{42U};
+
+    const iox::expected<RequestHeader*, AllocationError> allocateRequestResult = iox::ok(requestMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, allocateRequest(PAYLOAD_SIZE, PAYLOAD_ALIGNMENT)).WillOnce(Return(allocateRequestResult));
+
+    auto loanResult = sut.loan();
+    ASSERT_FALSE(loanResult.has_error());
+
+    EXPECT_CALL(sut.mockPort, sendRequest(requestMock.userHeader(), LOAD_BALANCING_KEY)).WillOnce(Return(iox::ok()));
+
+    sut.send(std::move(loanResult.value()), LOAD_BALANCING_KEY)
+        .and_then([&]() { GTEST_SUCCEED() << "Request successfully sent"; })
+        .or_else([&](auto error) {
+            GTEST_FAIL() << "Expected request to be sent but got error: " << static_cast<uint64_t>(error);
+        });
+}
+
 TEST_F(Client_test, TakeCallsUnderlyingPortWithSuccessResult)
 {
     ::testing::Test::RecordProperty("TEST_ID", "688ed3d9-4292-4cde-81e3-8c2b4d6e3a5f");
@@ -34,6 +34,7 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.connectOnCreate = false;
     testOptions.responseQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.serverTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.loadBalancingPolicy = iox::popo::LoadBalancingPolicy::STICKY_BY_KEY;
 
     iox::popo::ClientOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,6 +52,48 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Ne(defaultOptions.serverTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Eq(testOptions.serverTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Ne(defaultOptions.loadBalancingPolicy));
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Eq(testOptions.loadBalancingPolicy));
+        })
+        .or_else([&](auto&) {
+            constexpr bool DESERIALZATION_ERROR_OCCURED{true};
+            EXPECT_FALSE(DESERIALZATION_ERROR_OCCURED);
+        });
+}
+
+TEST(ClientOptions_test, BinarySerializationRoundTripIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cad14c6c-031b-4aa7-b53b-911177617832");
+    iox::popo::ClientOptions defaultOptions;
+    iox::popo::ClientOptions testOptions;
+
+    testOptions.responseQueueCapacity = 42;
+    testOptions.nodeName = "hypnotoad";
+    testOptions.connectOnCreate = false;
+    testOptions.responseQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    testOptions.serverTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.loadBalancingPolicy = iox::popo::LoadBalancingPolicy::STICKY_BY_KEY;
+
+    iox::popo::ClientOptions::deserialize(testOptions.serializeBinary())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.responseQueueCapacity, Ne(defaultOptions.responseQueueCapacity));
+            EXPECT_THAT(roundTripOptions.responseQueueCapacity, Eq(testOptions.responseQueueCapacity));
+
+            EXPECT_THAT(roundTripOptions.nodeName, Ne(defaultOptions.nodeName));
+            EXPECT_THAT(roundTripOptions.nodeName, Eq(testOptions.nodeName));
+
+            EXPECT_THAT(roundTripOptions.connectOnCreate, Ne(defaultOptions.connectOnCreate));
+            EXPECT_THAT(roundTripOptions.connectOnCreate, Eq(testOptions.connectOnCreate));
+
+            EXPECT_THAT(roundTripOptions.responseQueueFullPolicy, Ne(defaultOptions.responseQueueFullPolicy));
+            EXPECT_THAT(roundTripOptions.responseQueueFullPolicy, Eq(testOptions.responseQueueFullPolicy));
+
+            EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Ne(defaultOptions.serverTooSlowPolicy));
+            EXPECT_THAT(roundTripOptions.serverTooSlowPolicy, Eq(testOptions.serverTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Ne(defaultOptions.loadBalancingPolicy));
+            EXPECT_THAT(roundTripOptions.loadBalancingPolicy, Eq(testOptions.loadBalancingPolicy));
         })
         .or_else([&](auto&) {
             constexpr bool DESERIALZATION_ERROR_OCCURED{true};
@@ -58,6 +101,18 @@ TEST(ClientOptions_test, SerializationRoundTripIsSuccessful)
         });
 }
 
+TEST(ClientOptions_test, DeserializingTruncatedBinarySerializationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e57e697f-f2ab-4266-b2e1-f4604471f746");
+    const auto serialized = iox::popo::ClientOptions{}.serializeBinary();
+    const auto truncated =
+        iox::popo::ClientOptions::BinarySerialization_t::fromBytes(serialized.data(), serialized.size() - 1U);
+    ASSERT_TRUE(truncated.has_value());
+    iox::popo::ClientOptions::deserialize(truncated.value())
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 TEST(ClientOptions_test, DeserializingBogusDataFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "eb7341fd-f216-4422-8065-cbbadefd567b");
@@ -75,15 +130,21 @@ TEST(ClientOptions_test, DeserializingBogusDataFails)
 
 using QueueFullPolicyUT = std::underlying_type_t<iox::popo::QueueFullPolicy>;
 using ConsumerTooSlowPolicyUT = std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>;
+using LoadBalancingPolicyUT = std::underlying_type_t<iox::popo::LoadBalancingPolicy>;
 iox::Serialization enumSerialization(QueueFullPolicyUT responseQueueFullPolicy,
-                                     ConsumerTooSlowPolicyUT serverTooSlowPolicy)
+                                     ConsumerTooSlowPolicyUT serverTooSlowPolicy,
+                                     LoadBalancingPolicyUT loadBalancingPolicy = 0U)
 {
     constexpr uint64_t RESPONSE_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool CONNECT_ON_CREATE{true};
 
-    return iox::Serialization::create(
-        RESPONSE_QUEUE_CAPACITY, NODE_NAME, CONNECT_ON_CREATE, responseQueueFullPolicy, serverTooSlowPolicy);
+    return iox::Serialization::create(RESPONSE_QUEUE_CAPACITY,
+                                      NODE_NAME,
+                                      CONNECT_ON_CREATE,
+                                      responseQueueFullPolicy,
+                                      serverTooSlowPolicy,
+                                      loadBalancingPolicy);
 }
 
 TEST(ClientOptions_test, DeserializingValidResponseQueueFullAndServerTooSlowPolicyIsSuccessful)
@@ -144,6 +205,28 @@ TEST(ClientOptions_test, DeserializingInvalidServerTooSlowPolicyFails)
         });
 }
 
+TEST(ClientOptions_test, DeserializingInvalidLoadBalancingPolicyFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b0f6c2e-93d1-4a7e-b5f8-2c6e1d7a9f30");
+    constexpr QueueFullPolicyUT RESPONSE_QUEUE_FULL_POLICY{
+        static_cast<QueueFullPolicyUT>(iox::popo::QueueFullPolicy::BLOCK_PRODUCER)};
+    constexpr ConsumerTooSlowPolicyUT SERVER_TOO_SLOW_POLICY{
+        static_cast<ConsumerTooSlowPolicyUT>(iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)};
+    constexpr LoadBalancingPolicyUT LOAD_BALANCING_POLICY{111};
+
+    const auto serialized =
+        enumSerialization(RESPONSE_QUEUE_FULL_POLICY, SERVER_TOO_SLOW_POLICY, LOAD_BALANCING_POLICY);
+    iox::popo::ClientOptions::deserialize(serialized)
+        .and_then([&](auto&) {
+            constexpr bool DESERIALZATION_SUCCESSFUL{true};
+            EXPECT_FALSE(DESERIALZATION_SUCCESSFUL);
+        })
+        .or_else([&](auto&) {
+            constexpr bool DESERIALZATION_ERROR_OCCURED{true};
+            EXPECT_TRUE(DESERIALZATION_ERROR_OCCURED);
+        });
+}
+
 TEST(ClientOptions_test, ComparisonOperatorReturnsTrueWhenEqual)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ba0554b8-6b25-45c2-8a4c-66b6663de586");
@@ -215,4 +298,16 @@ TEST(ClientOptions_test, ComparisonOperatorReturnsFalseServerTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ClientOptions_test, ComparisonOperatorReturnsFalseWhenLoadBalancingPolicyDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7e2a915-0d4b-4f6a-8e31-5b9d2f7c4a86");
+    ClientOptions options1;
+    options1.loadBalancingPolicy = LoadBalancingPolicy::ROUND_ROBIN;
+    ClientOptions options2;
+    options2.loadBalancingPolicy = LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
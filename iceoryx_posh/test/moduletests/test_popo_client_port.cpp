@@ -134,6 +134,37 @@ class ClientPort_test : public Test
         return clientPortForStateTransitionTests.value();
     }
 
+    SutClientPort& initAndGetClientPortConnectedToTwoServers(const LoadBalancingPolicy loadBalancingPolicy)
+    {
+        auto clientOptions = m_clientOptionsWithoutConnectOnCreate;
+        clientOptions.loadBalancingPolicy = loadBalancingPolicy;
+        clientPortForStateTransitionTests.reset();
+        clientPortForStateTransitionTests.emplace(m_serviceDescription, m_runtimeName, clientOptions, m_memoryManager);
+        auto& sut = clientPortForStateTransitionTests.value();
+
+        sut.portUser.connect();
+        tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+        CaproMessage serverMessageAck{CaproMessageType::ACK, m_serviceDescription};
+        serverMessageAck.m_chunkQueueData = &additionalServerChunkQueueData;
+        sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(serverMessageAck);
+
+        return sut;
+    }
+
+    void sendRequests(SutClientPort& sut, const uint64_t numberOfRequests, const uint64_t loadBalancingKey = 0U)
+    {
+        for (uint64_t i = 0U; i < numberOfRequests; ++i)
+        {
+            sut.portUser.allocateRequest(USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+                .and_then([&](auto* requestHeader) {
+                    requestHeader->setSequenceId(static_cast<int64_t>(i));
+                    EXPECT_FALSE(sut.portUser.sendRequest(requestHeader, loadBalancingKey).has_error());
+                })
+                .or_else([](auto&) { GTEST_FAIL() << "Expected to allocate a request"; });
+        }
+    }
+
     uint32_t getNumberOfUsedChunks() const
     {
         return m_memoryManager.getMemPoolInfo(0U).m_usedChunks;
@@ -215,6 +246,9 @@ class ClientPort_test : public Test
     ServerChunkQueueData_t serverChunkQueueData{iox::popo::QueueFullPolicy::DISCARD_OLDEST_DATA,
                                                 iox::popo::VariantQueueTypes::SoFi_MultiProducerSingleConsumer};
     ChunkQueuePopper<ServerChunkQueueData_t> serverRequestQueue{&serverChunkQueueData};
+    ServerChunkQueueData_t additionalServerChunkQueueData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                          VariantQueueTypes::SoFi_MultiProducerSingleConsumer};
+    ChunkQueuePopper<ServerChunkQueueData_t> additionalServerRequestQueue{&additionalServerChunkQueueData};
 
     SutClientPort clientPortWithConnectOnCreate{
         m_serviceDescription, m_runtimeName, m_clientOptionsWithConnectOnCreate, m_memoryManager};
@@ -355,6 +389,68 @@ TEST_F(ClientPort_test, ConnectAfterPreviousSendRequestCallDoesNotEnqueuesReques
     EXPECT_FALSE(serverRequestQueue.tryPop().has_value());
 }
 
+TEST_F(ClientPort_test, SendRequestWithRoundRobinPolicyDeliversRequestsAlternatelyToTheServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6f0d2b71-4e8a-4c3f-9a52-d1b7e0c9a3f4");
+    constexpr uint64_t NUMBER_OF_REQUESTS{4U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::ROUND_ROBIN);
+
+    sendRequests(sut, NUMBER_OF_REQUESTS);
+
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS; ++i)
+    {
+        auto& requestQueue = (i % 2U == 0U) ? serverRequestQueue : additionalServerRequestQueue;
+        requestQueue.tryPop()
+            .and_then([&](auto& sharedChunk) {
+                auto* requestHeader = static_cast<RequestHeader*>(sharedChunk.getChunkHeader()->userHeader());
+                EXPECT_THAT(requestHeader->getSequenceId(), Eq(static_cast<int64_t>(i)));
+            })
+            .or_else([] { GTEST_FAIL() << "Expected a request in the server queue"; });
+    }
+    EXPECT_TRUE(serverRequestQueue.empty());
+    EXPECT_TRUE(additionalServerRequestQueue.empty());
+}
+
+TEST_F(ClientPort_test, SendRequestWithLeastOutstandingRequestsPolicyDeliversRequestsToTheLeastFilledServerQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a2e96c40-7b1d-4f58-8e3a-5c0f6d2b9e17");
+    constexpr uint64_t NUMBER_OF_OUTSTANDING_REQUESTS{2U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS);
+    ChunkQueuePusher<ServerChunkQueueData_t> serverRequestQueuePusher{&serverChunkQueueData};
+    for (uint64_t i = 0U; i < NUMBER_OF_OUTSTANDING_REQUESTS; ++i)
+    {
+        ASSERT_TRUE(serverRequestQueuePusher.push(getChunkFromMemoryManager(USER_PAYLOAD_SIZE, sizeof(RequestHeader))));
+    }
+
+    sendRequests(sut, NUMBER_OF_OUTSTANDING_REQUESTS);
+
+    EXPECT_THAT(serverRequestQueue.size(), Eq(NUMBER_OF_OUTSTANDING_REQUESTS));
+    EXPECT_THAT(additionalServerRequestQueue.size(), Eq(NUMBER_OF_OUTSTANDING_REQUESTS));
+
+    sendRequests(sut, 1U);
+
+    EXPECT_THAT(serverRequestQueue.size() + additionalServerRequestQueue.size(),
+                Eq(2U * NUMBER_OF_OUTSTANDING_REQUESTS + 1U));
+    serverRequestQueue.clear();
+    additionalServerRequestQueue.clear();
+}
+
+TEST_F(ClientPort_test, SendRequestWithStickyByKeyPolicyDeliversRequestsWithTheSameKeyToTheSameServer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d5b8f19-c6e2-4a07-b4d1-9e8a7f2c0b63");
+    constexpr uint64_t KEY_OF_ADDITIONAL_SERVER{7U};
+    constexpr uint64_t KEY_OF_SERVER{8U};
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::STICKY_BY_KEY);
+
+    sendRequests(sut, 3U, KEY_OF_ADDITIONAL_SERVER);
+    sendRequests(sut, 2U, KEY_OF_SERVER);
+
+    EXPECT_THAT(serverRequestQueue.size(), Eq(2U));
+    EXPECT_THAT(additionalServerRequestQueue.size(), Eq(3U));
+    serverRequestQueue.clear();
+    additionalServerRequestQueue.clear();
+}
+
 TEST_F(ClientPort_test, GetResponseOnNotConnectedClientPortHasNoResponse)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ecb320c9-1c95-410e-84d6-9aa9763b9768");
@@ -860,6 +956,73 @@ TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeDisconnectTransitionsT
     EXPECT_THAT(responseCaproMessage->m_chunkQueueData, Eq(&sut.portData.m_chunkReceiverData));
 }
 
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeOfferRemainsInStateConnectedAndRequestsConnect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e4c17a02-5b9f-43d8-a6e0-2f8c1d7b3a95");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+    auto caproMessage = CaproMessage{CaproMessageType::OFFER, sut.portData.m_serviceDescription};
+
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_TRUE(responseCaproMessage.has_value());
+    EXPECT_THAT(responseCaproMessage->m_type, Eq(iox::capro::CaproMessageType::CONNECT));
+    EXPECT_THAT(responseCaproMessage->m_chunkQueueData, Eq(&sut.portData.m_chunkReceiverData));
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeAckRemainsInStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b3f6e9d-0a47-4c21-b5e8-7d1c2a9f4e60");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+    auto caproMessage = CaproMessage{CaproMessageType::ACK, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &additionalServerChunkQueueData;
+
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeNackRemainsInStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c90e4d28-1f6b-4a73-8e5d-3b2a7c6f1d09");
+    auto& sut = initAndGetClientPortForStateTransitionTests();
+    sut.portUser.connect();
+    tryAdvanceToState(sut, iox::ConnectionState::CONNECTED);
+
+    auto caproMessage = CaproMessage{CaproMessageType::NACK, sut.portData.m_serviceDescription};
+
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+}
+
+TEST_F(ClientPort_test, StateConnectedWithCaProMessageTypeStopOfferOfOneOfMultipleServersRemainsInStateConnected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "17a5c3e8-9d2f-4b60-a4c1-e6f0b8d2597a");
+    auto& sut = initAndGetClientPortConnectedToTwoServers(LoadBalancingPolicy::ROUND_ROBIN);
+
+    auto caproMessage = CaproMessage{CaproMessageType::STOP_OFFER, sut.portData.m_serviceDescription};
+    caproMessage.m_chunkQueueData = &serverChunkQueueData;
+
+    auto responseCaproMessage = sut.portRouDi.dispatchCaProMessageAndGetPossibleResponse(caproMessage);
+
+    EXPECT_THAT(sut.portUser.getConnectionState(), Eq(iox::ConnectionState::CONNECTED));
+    ASSERT_FALSE(responseCaproMessage.has_value());
+
+    sendRequests(sut, 2U);
+    EXPECT_TRUE(serverRequestQueue.empty());
+    EXPECT_THAT(additionalServerRequestQueue.size(), Eq(2U));
+    additionalServerRequestQueue.clear();
+}
+
 TEST_F(ClientPort_test, StateDisconnectRequestedWithCaProMessageTypeAckTransitionsToStateNotConnected)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1c5f2052-7397-4e23-b53a-8127cce62063");
@@ -937,8 +1100,9 @@ TEST_F(ClientPort_test, InvalidStateTransitionsCallErrorHandler)
                 }
                 break;
             case iox::ConnectionState::CONNECTED:
-                if (caproMessageType == CaproMessageType::STOP_OFFER
-                    || caproMessageType == CaproMessageType::DISCONNECT)
+                if (caproMessageType == CaproMessageType::STOP_OFFER || caproMessageType == CaproMessageType::DISCONNECT
+                    || caproMessageType == CaproMessageType::OFFER || caproMessageType == CaproMessageType::ACK
+                    || caproMessageType == CaproMessageType::NACK)
                 {
                     continue;
                 }
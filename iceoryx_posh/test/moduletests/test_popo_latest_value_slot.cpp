@@ -0,0 +1,231 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/internal/popo/building_blocks/latest_value_slot.hpp"
+
+#include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::mepoo;
+using iox::popo::LatestValueSlot;
+
+class LatestValueSlot_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        MePooConfig mempoolconf;
+        mempoolconf.addMemPool({CHUNK_SIZE, NUM_CHUNKS_IN_POOL});
+        memoryManager.configureMemoryManager(mempoolconf, m_memoryAllocator, m_memoryAllocator);
+    }
+
+    void TearDown() override
+    {
+        sut.reset();
+    }
+
+    SharedChunk getChunkFromMemoryManager(const uint64_t value = 0U)
+    {
+        auto chunkSettings =
+            ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t)).expect("Valid 'ChunkSettings'");
+
+        auto chunk = memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+        *static_cast<uint64_t*>(chunk.getUserPayload()) = value;
+        return chunk;
+    }
+
+    uint64_t numberOfUsedChunks()
+    {
+        return memoryManager.getMemPoolInfo(0U).m_usedChunks;
+    }
+
+    static constexpr uint32_t NUM_CHUNKS_IN_POOL = 20;
+
+    MemoryManager memoryManager;
+    LatestValueSlot sut;
+
+  private:
+    static constexpr size_t KILOBYTE = 1 << 10;
+    static constexpr size_t MEMORY_SIZE = 100 * KILOBYTE;
+    std::unique_ptr<char[]> m_memory{new char[MEMORY_SIZE]};
+    static constexpr uint64_t CHUNK_SIZE = 128;
+
+    iox::BumpAllocator m_memoryAllocator{m_memory.get(), MEMORY_SIZE};
+};
+
+TEST_F(LatestValueSlot_test, DefaultConstructedSlotIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "71f6f71e-7d1a-42fd-b7dc-f5e5a09d9357");
+    uint64_t sequenceNumber{0U};
+
+    EXPECT_TRUE(sut.isEmpty());
+    EXPECT_THAT(sut.sequenceNumber(), Eq(0U));
+    EXPECT_FALSE(sut.tryAcquireNewerThan(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, StoredChunkCanBeAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a304af15-844d-4456-be9f-2c59d644fbd5");
+    auto chunk = getChunkFromMemoryManager(42U);
+    sut.store(chunk);
+    uint64_t sequenceNumber{0U};
+
+    auto acquiredChunk = sut.tryAcquireNewerThan(sequenceNumber);
+
+    ASSERT_TRUE(acquiredChunk.has_value());
+    EXPECT_THAT(acquiredChunk.value(), Eq(chunk));
+    EXPECT_THAT(*static_cast<uint64_t*>(acquiredChunk->getUserPayload()), Eq(42U));
+    EXPECT_THAT(sequenceNumber, Eq(sut.sequenceNumber()));
+    EXPECT_FALSE(sut.isEmpty());
+}
+
+TEST_F(LatestValueSlot_test, StoredChunkIsNotAcquiredAgainWithTheUpdatedSequenceNumber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "eb32b456-36f1-40da-a500-c40f7bb54761");
+    sut.store(getChunkFromMemoryManager());
+    uint64_t sequenceNumber{0U};
+    ASSERT_TRUE(sut.tryAcquireNewerThan(sequenceNumber).has_value());
+
+    EXPECT_FALSE(sut.tryAcquireNewerThan(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, OnlyTheLatestOfMultipleStoredChunksIsAcquired)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0812f6a1-2300-4d68-8831-92ad4cc6f62f");
+    uint64_t sequenceNumber{0U};
+    for (uint64_t i = 1U; i <= 3U; ++i)
+    {
+        sut.store(getChunkFromMemoryManager(i));
+    }
+
+    auto acquiredChunk = sut.tryAcquireNewerThan(sequenceNumber);
+
+    ASSERT_TRUE(acquiredChunk.has_value());
+    EXPECT_THAT(*static_cast<uint64_t*>(acquiredChunk->getUserPayload()), Eq(3U));
+    EXPECT_FALSE(sut.tryAcquireNewerThan(sequenceNumber).has_value());
+}
+
+TEST_F(LatestValueSlot_test, StoringAChunkReleasesThePreviousChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b176a523-f68c-4c7f-935c-cc247b77c7df");
+    sut.store(getChunkFromMemoryManager());
+    ASSERT_THAT(numberOfUsedChunks(), Eq(1U));
+
+    sut.store(getChunkFromMemoryManager());
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(1U));
+}
+
+TEST_F(LatestValueSlot_test, AcquiredChunkIsNotReleasedWhenItIsReplaced)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3aa4fa74-1c5c-4f45-83a3-014732fc714b");
+    sut.store(getChunkFromMemoryManager(1U));
+    uint64_t sequenceNumber{0U};
+    auto acquiredChunk = sut.tryAcquireNewerThan(sequenceNumber);
+    ASSERT_TRUE(acquiredChunk.has_value());
+
+    sut.store(getChunkFromMemoryManager(2U));
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(2U));
+    EXPECT_THAT(*static_cast<uint64_t*>(acquiredChunk->getUserPayload()), Eq(1U));
+    acquiredChunk.reset();
+    EXPECT_THAT(numberOfUsedChunks(), Eq(1U));
+}
+
+TEST_F(LatestValueSlot_test, ResetReleasesTheChunkAndEmptiesTheSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa87fbe7-527d-4cc5-94d3-dd44927cb62d");
+    sut.store(getChunkFromMemoryManager());
+    uint64_t sequenceNumber{0U};
+
+    sut.reset();
+
+    EXPECT_THAT(numberOfUsedChunks(), Eq(0U));
+    EXPECT_TRUE(sut.isEmpty());
+    EXPECT_FALSE(sut.tryAcquireNewerThan(sequenceNumber).has_value());
+    EXPECT_THAT(sequenceNumber, Eq(sut.sequenceNumber()));
+}
+
+TEST_F(LatestValueSlot_test, SequenceNumberIsIncreasedWithEachStore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1465a6c7-890d-4ab6-8151-c7b0c382ec03");
+    const auto initialSequenceNumber = sut.sequenceNumber();
+
+    sut.store(getChunkFromMemoryManager());
+    const auto sequenceNumberAfterStore = sut.sequenceNumber();
+    sut.reset();
+
+    EXPECT_THAT(sequenceNumberAfterStore, Gt(initialSequenceNumber));
+    EXPECT_THAT(sut.sequenceNumber(), Gt(sequenceNumberAfterStore));
+    EXPECT_THAT(sut.sequenceNumber() % 2U, Eq(0U));
+}
+
+TEST_F(LatestValueSlot_test, RelativePointerDataRoundTripResultsInTheSameSlot)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "feca475c-3eb3-4af8-b515-c770aae0336d");
+    EXPECT_THAT(LatestValueSlot::fromRelativePointerData(LatestValueSlot::toRelativePointerData(&sut)), Eq(&sut));
+    EXPECT_TRUE(LatestValueSlot::toRelativePointerData(nullptr).isLogicalNullptr());
+    EXPECT_THAT(LatestValueSlot::fromRelativePointerData(iox::RelativePointerData()), Eq(nullptr));
+}
+
+TEST_F(LatestValueSlot_test, ConcurrentlyAcquiredChunksAreNeverOlderThanPreviouslyAcquiredOnes)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "07afae7b-045e-47d3-b666-d5cec9ae8296");
+    constexpr uint64_t NUMBER_OF_STORES{10000U};
+    Watchdog watchdog{iox::units::Duration::fromSeconds(10U)};
+    watchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    std::atomic_bool isProducerFinished{false};
+    std::thread producer([&] {
+        for (uint64_t i = 1U; i <= NUMBER_OF_STORES; ++i)
+        {
+            sut.store(getChunkFromMemoryManager(i));
+        }
+        isProducerFinished = true;
+    });
+
+    uint64_t sequenceNumber{0U};
+    uint64_t lastValue{0U};
+    bool hasReceivedOlderValue{false};
+    do
+    {
+        auto acquiredChunk = sut.tryAcquireNewerThan(sequenceNumber);
+        if (acquiredChunk.has_value())
+        {
+            const auto value = *static_cast<uint64_t*>(acquiredChunk->getUserPayload());
+            hasReceivedOlderValue |= (value <= lastValue);
+            lastValue = value;
+        }
+    } while (!isProducerFinished || lastValue < NUMBER_OF_STORES);
+    producer.join();
+
+    EXPECT_FALSE(hasReceivedOlderValue);
+    EXPECT_THAT(numberOfUsedChunks(), Eq(1U));
+}
+
+} // namespace
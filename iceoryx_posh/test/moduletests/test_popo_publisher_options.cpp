@@ -50,6 +50,46 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
 
+TEST(PublisherOptions_test, BinarySerializationRoundTripIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "950c8fef-9042-4ccf-ad6f-4b7cac37b577");
+    iox::popo::PublisherOptions defaultOptions;
+    iox::popo::PublisherOptions testOptions;
+
+    testOptions.historyCapacity = 42;
+    testOptions.nodeName = "hypnotoad";
+    testOptions.offerOnCreate = false;
+    testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+
+    iox::popo::PublisherOptions::deserialize(testOptions.serializeBinary())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.historyCapacity, Ne(defaultOptions.historyCapacity));
+            EXPECT_THAT(roundTripOptions.historyCapacity, Eq(testOptions.historyCapacity));
+
+            EXPECT_THAT(roundTripOptions.nodeName, Ne(defaultOptions.nodeName));
+            EXPECT_THAT(roundTripOptions.nodeName, Eq(testOptions.nodeName));
+
+            EXPECT_THAT(roundTripOptions.offerOnCreate, Ne(defaultOptions.offerOnCreate));
+            EXPECT_THAT(roundTripOptions.offerOnCreate, Eq(testOptions.offerOnCreate));
+
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Binary serialization/deserialization of PublisherOptions failed!"; });
+}
+
+TEST(PublisherOptions_test, DeserializingTruncatedBinarySerializationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7d40e0f4-7e5e-4448-833e-5f706d8ff4c8");
+    const auto serialized = iox::popo::PublisherOptions{}.serializeBinary();
+    const auto truncated =
+        iox::popo::PublisherOptions::BinarySerialization_t::fromBytes(serialized.data(), serialized.size() - 1U);
+    ASSERT_TRUE(truncated.has_value());
+    iox::popo::PublisherOptions::deserialize(truncated.value())
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 TEST(PublisherOptions_test, DeserializingBogusDataFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "01c4b42b-5636-4bd2-b2de-c5320b170d71");
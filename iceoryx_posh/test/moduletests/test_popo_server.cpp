@@ -182,4 +182,124 @@ TEST_F(Server_test, SendCallsUnderlyingPort)
     EXPECT_CALL(sut.mockPort, releaseRequest(requestMock.userHeader())).Times(1);
 }
 
+TEST_F(Server_test, AcquireAndReleaseWorkerCallsUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d5e7c1a-93b2-4f48-a6e1-5c2b8f7d4e39");
+
+    constexpr uint32_t WORKER_INDEX{2U};
+    EXPECT_CALL(sut.mockPort, acquireWorker()).WillOnce(Return(iox::optional<uint32_t>(WORKER_INDEX)));
+    EXPECT_CALL(sut.mockPort, releaseWorker(WORKER_INDEX)).Times(1);
+
+    auto workerIndex = sut.acquireWorker();
+    ASSERT_TRUE(workerIndex.has_value());
+    EXPECT_THAT(workerIndex.value(), Eq(WORKER_INDEX));
+
+    sut.releaseWorker(workerIndex.value());
+}
+
+TEST_F(Server_test, TakeWithWorkerReleasesTheRequestWithTheWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8f2a4b6c-1e3d-4a57-9c08-b7d6e5f4a321");
+
+    constexpr uint32_t WORKER_INDEX{1U};
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, getRequest(WORKER_INDEX)).WillOnce(Return(getRequestResult));
+
+    {
+        const auto takeResult = sut.take(WORKER_INDEX);
+        ASSERT_FALSE(takeResult.has_error());
+        EXPECT_THAT(&takeResult.value().getRequestHeader(), Eq(requestMock.userHeader()));
+
+        EXPECT_CALL(sut.mockPort, releaseRequest(WORKER_INDEX, requestMock.userHeader())).Times(1);
+    }
+}
+
+TEST_F(Server_test, LoanWithWorkerReleasesTheResponseWithTheWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c4e91d27-5b8a-4f03-a6d2-3e7f1b9c0d58");
+
+    constexpr uint32_t WORKER_INDEX{3U};
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+    EXPECT_CALL(sut.mockPort, getRequest(WORKER_INDEX)).WillOnce(Return(getRequestResult));
+    auto takeResult = sut.take(WORKER_INDEX);
+    ASSERT_FALSE(takeResult.has_error());
+    const auto request = std::move(takeResult.value());
+
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+    EXPECT_CALL(sut.mockPort, allocateResponse(WORKER_INDEX, requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+
+    {
+        constexpr uint64_t DATA{73U};
+        auto loanResult = sut.loan(WORKER_INDEX, request, DummyResponse{DATA});
+        ASSERT_FALSE(loanResult.has_error());
+        EXPECT_THAT(loanResult.value()->data, Eq(DATA));
+
+        EXPECT_CALL(sut.mockPort, releaseResponse(WORKER_INDEX, responseMock.userHeader())).Times(1);
+    }
+
+    EXPECT_CALL(sut.mockPort, releaseRequest(WORKER_INDEX, requestMock.userHeader())).Times(1);
+}
+
+TEST_F(Server_test, SendOfResponseLoanedWithWorkerCallsUnderlyingPortWithTheWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5a7b3c9d-2e1f-4d86-b0a4-9f8e6d2c1b07");
+
+    constexpr uint32_t WORKER_INDEX{4U};
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+    EXPECT_CALL(sut.mockPort, getRequest(WORKER_INDEX)).WillOnce(Return(getRequestResult));
+    auto takeResult = sut.take(WORKER_INDEX);
+    ASSERT_FALSE(takeResult.has_error());
+    const auto request = std::move(takeResult.value());
+
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+    EXPECT_CALL(sut.mockPort, allocateResponse(WORKER_INDEX, requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+    auto loanResult = sut.loan(WORKER_INDEX, request);
+    ASSERT_FALSE(loanResult.has_error());
+
+    EXPECT_CALL(sut.mockPort, sendResponse(WORKER_INDEX, responseMock.userHeader())).WillOnce(Return(iox::ok()));
+
+    loanResult.value()
+        .send()
+        .and_then([&]() { GTEST_SUCCEED() << "Response successfully sent"; })
+        .or_else([&](auto error) {
+            GTEST_FAIL() << "Expected response to be sent but got error: " << static_cast<uint64_t>(error);
+        });
+
+    EXPECT_CALL(sut.mockPort, releaseRequest(WORKER_INDEX, requestMock.userHeader())).Times(1);
+}
+
+TEST_F(Server_test, SendWithWorkerCallsUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e6d3f2a1-7c4b-4e95-8a10-2b5c9d8e7f46");
+
+    constexpr uint32_t WORKER_INDEX{5U};
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+    EXPECT_CALL(sut.mockPort, getRequest(WORKER_INDEX)).WillOnce(Return(getRequestResult));
+    auto takeResult = sut.take(WORKER_INDEX);
+    ASSERT_FALSE(takeResult.has_error());
+    const auto request = std::move(takeResult.value());
+
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+    EXPECT_CALL(sut.mockPort, allocateResponse(WORKER_INDEX, requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+    auto loanResult = sut.loan(WORKER_INDEX, request);
+    ASSERT_FALSE(loanResult.has_error());
+
+    EXPECT_CALL(sut.mockPort, sendResponse(WORKER_INDEX, responseMock.userHeader())).WillOnce(Return(iox::ok()));
+
+    EXPECT_FALSE(sut.send(WORKER_INDEX, std::move(loanResult.value())).has_error());
+
+    EXPECT_CALL(sut.mockPort, releaseRequest(WORKER_INDEX, requestMock.userHeader())).Times(1);
+}
+
 } // namespace
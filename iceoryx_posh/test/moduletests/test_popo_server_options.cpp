@@ -34,6 +34,7 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.offerOnCreate = false;
     testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.allowMultipleServers = true;
 
     iox::popo::ServerOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -51,10 +52,61 @@ TEST(ServerOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Ne(defaultOptions.allowMultipleServers));
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Eq(testOptions.allowMultipleServers));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of ServerOptions failed!"; });
 }
 
+TEST(ServerOptions_test, BinarySerializationRoundTripIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cf49ae32-9c01-4ab3-be94-0b35fe20f842");
+    iox::popo::ServerOptions defaultOptions;
+    iox::popo::ServerOptions testOptions;
+
+    testOptions.requestQueueCapacity = 42;
+    testOptions.nodeName = "hypnotoad";
+    testOptions.offerOnCreate = false;
+    testOptions.requestQueueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    testOptions.clientTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.allowMultipleServers = true;
+
+    iox::popo::ServerOptions::deserialize(testOptions.serializeBinary())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.requestQueueCapacity, Ne(defaultOptions.requestQueueCapacity));
+            EXPECT_THAT(roundTripOptions.requestQueueCapacity, Eq(testOptions.requestQueueCapacity));
+
+            EXPECT_THAT(roundTripOptions.nodeName, Ne(defaultOptions.nodeName));
+            EXPECT_THAT(roundTripOptions.nodeName, Eq(testOptions.nodeName));
+
+            EXPECT_THAT(roundTripOptions.offerOnCreate, Ne(defaultOptions.offerOnCreate));
+            EXPECT_THAT(roundTripOptions.offerOnCreate, Eq(testOptions.offerOnCreate));
+
+            EXPECT_THAT(roundTripOptions.requestQueueFullPolicy, Ne(defaultOptions.requestQueueFullPolicy));
+            EXPECT_THAT(roundTripOptions.requestQueueFullPolicy, Eq(testOptions.requestQueueFullPolicy));
+
+            EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Ne(defaultOptions.clientTooSlowPolicy));
+            EXPECT_THAT(roundTripOptions.clientTooSlowPolicy, Eq(testOptions.clientTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Ne(defaultOptions.allowMultipleServers));
+            EXPECT_THAT(roundTripOptions.allowMultipleServers, Eq(testOptions.allowMultipleServers));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Binary serialization/deserialization of ServerOptions failed!"; });
+}
+
+TEST(ServerOptions_test, DeserializingTruncatedBinarySerializationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "89f40d37-274f-4e86-9755-dca19f97110b");
+    const auto serialized = iox::popo::ServerOptions{}.serializeBinary();
+    const auto truncated =
+        iox::popo::ServerOptions::BinarySerialization_t::fromBytes(serialized.data(), serialized.size() - 1U);
+    ASSERT_TRUE(truncated.has_value());
+    iox::popo::ServerOptions::deserialize(truncated.value())
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 TEST(ServerOptions_test, DeserializingBogusDataFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ebc97c23-87df-484c-8c3c-1b76f1351997");
@@ -72,9 +124,14 @@ iox::Serialization enumSerialization(QueueFullPolicyUT requsetQueueFullPolicy,
     constexpr uint64_t REQUEST_QUEUE_CAPACITY{42U};
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
-
-    return iox::Serialization::create(
-        REQUEST_QUEUE_CAPACITY, NODE_NAME, OFFER_ON_CREATE, requsetQueueFullPolicy, clientTooSlowPolicy);
+    constexpr bool ALLOW_MULTIPLE_SERVERS{false};
+
+    return iox::Serialization::create(REQUEST_QUEUE_CAPACITY,
+                                      NODE_NAME,
+                                      OFFER_ON_CREATE,
+                                      requsetQueueFullPolicy,
+                                      clientTooSlowPolicy,
+                                      ALLOW_MULTIPLE_SERVERS);
 }
 
 TEST(ServerOptions_test, DeserializingValidRequestQueueFullPolicyAndClientTooSlowPolicyIsSuccessful)
@@ -188,4 +245,16 @@ TEST(ServerOptions_test, ComparisonOperatorReturnsFalseClientTooSlowPolicyDoesNo
     EXPECT_FALSE(options2 == options1);
 }
 
+TEST(ServerOptions_test, ComparisonOperatorReturnsFalseWhenAllowMultipleServersDoesNotMatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1f9a4d63-8b2e-4c70-a5d9-6e3b0c8f2d14");
+    ServerOptions options1;
+    options1.allowMultipleServers = true;
+    ServerOptions options2;
+    options2.allowMultipleServers = false;
+
+    EXPECT_FALSE(options1 == options2);
+    EXPECT_FALSE(options2 == options1);
+}
+
 } // namespace
@@ -69,6 +69,29 @@ TEST_F(ServerPort_test, ReleaseAllChunksWorks)
     });
 }
 
+TEST_F(ServerPort_test, ReleaseAllChunksReleasesTheChunksHeldByWorkers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4bb391d5-3e7e-4b0c-8752-b4071294a1e8");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUEST_CHUNKS{2U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUEST_CHUNKS);
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    auto requestHeader = sut.portUser.getRequest(workerIndex).expect("Getting a request");
+    IOX_DISCARD_RESULT(
+        sut.portUser.allocateResponse(workerIndex, requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+            .expect("Allocating a response"));
+
+    constexpr uint64_t NUMBER_OF_RESPONSE_CHUNKS{1U};
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUEST_CHUNKS + NUMBER_OF_RESPONSE_CHUNKS));
+    sut.portRouDi.releaseAllChunks();
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(0U));
+
+    // the worker of the dead process is available again
+    EXPECT_THAT(sut.portUser.acquireWorker().value(), Eq(workerIndex));
+}
+
 // BEGIN tryGetCaProMessage tests
 
 TEST_F(ServerPort_test, TryGetCaProMessageOnOfferWhenPortIsNotOffering)
@@ -719,6 +719,219 @@ TEST_F(ServerPort_test, SendResponseWithValidClientQueueIdReleasesDeliversToTheC
 
 // END sendResponse tests
 
+// BEGIN server worker tests
+
+TEST_F(ServerPort_test, AcquireWorkerProvidesDistinctWorkersUntilAllWorkersAreInUse)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "967e7ffe-dd8c-4469-873f-039f646f6087");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    for (uint32_t i = 0U; i < iox::MAX_SERVER_WORKERS; ++i)
+    {
+        sut.portUser.acquireWorker()
+            .and_then([&](const auto workerIndex) { EXPECT_THAT(workerIndex, Eq(i)); })
+            .or_else([&] { GTEST_FAIL() << "Expected to acquire a worker"; });
+    }
+
+    EXPECT_FALSE(sut.portUser.acquireWorker().has_value());
+}
+
+TEST_F(ServerPort_test, ReleasedWorkerCanBeAcquiredAgain)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22d01ee1-4c73-4b06-af64-a56026a71d6d");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    for (uint32_t i = 0U; i < iox::MAX_SERVER_WORKERS; ++i)
+    {
+        IOX_DISCARD_RESULT(sut.portUser.acquireWorker());
+    }
+
+    constexpr uint32_t WORKER_INDEX{3U};
+    sut.portUser.releaseWorker(WORKER_INDEX);
+
+    sut.portUser.acquireWorker()
+        .and_then([&](const auto workerIndex) { EXPECT_THAT(workerIndex, Eq(WORKER_INDEX)); })
+        .or_else([&] { GTEST_FAIL() << "Expected to acquire a worker"; });
+}
+
+TEST_F(ServerPort_test, EachWorkerCanHoldTheMaximumNumberOfRequestsInParallel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56b7d110-eaab-4829-996c-fcfe5fe90a6a");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{2U * iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS));
+
+    auto workerA = sut.portUser.acquireWorker().expect("Acquiring worker A");
+    auto workerB = sut.portUser.acquireWorker().expect("Acquiring worker B");
+
+    uint64_t expectedData{DUMMY_DATA};
+    for (auto workerIndex : {workerA, workerB})
+    {
+        for (uint32_t i = 0U; i < iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY; ++i)
+        {
+            sut.portUser.getRequest(workerIndex)
+                .and_then([&](const auto& requestHeader) {
+                    EXPECT_THAT(getRequestData(requestHeader), Eq(expectedData));
+                })
+                .or_else([&](const auto& error) { GTEST_FAIL() << "Expected request but got error: " << error; });
+            ++expectedData;
+        }
+    }
+
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUESTS));
+}
+
+TEST_F(ServerPort_test, GetRequestFromWorkerWhichHoldsTooManyRequestsFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a25917ed-c92d-4d9d-819d-a74ba2758257");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY + 1U};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS));
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    for (uint32_t i = 0U; i < iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY; ++i)
+    {
+        EXPECT_FALSE(sut.portUser.getRequest(workerIndex).has_error());
+    }
+
+    auto result = sut.portUser.getRequest(workerIndex);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ServerRequestResult::TOO_MANY_REQUESTS_HELD_IN_PARALLEL));
+}
+
+TEST_F(ServerPort_test, ReleaseRequestFromWorkerReleasesTheChunkToTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8de786aa-5fad-44d2-acb4-c5f545ff2ca5");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS);
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    auto requestHeader = sut.portUser.getRequest(workerIndex).expect("Getting a request");
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUESTS));
+
+    sut.portUser.releaseRequest(workerIndex, requestHeader);
+
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(0U));
+}
+
+TEST_F(ServerPort_test, ReleaseRequestWithWrongWorkerCallsTheErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "56b420fb-7763-4676-bf58-ad4b5ba30b33");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS);
+
+    auto workerA = sut.portUser.acquireWorker().expect("Acquiring worker A");
+    auto workerB = sut.portUser.acquireWorker().expect("Acquiring worker B");
+    auto requestHeader = sut.portUser.getRequest(workerA).expect("Getting a request");
+
+    sut.portUser.releaseRequest(workerB, requestHeader);
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POPO__CHUNK_RECEIVER_INVALID_CHUNK_TO_RELEASE_FROM_USER);
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUESTS));
+}
+
+TEST_F(ServerPort_test, SendResponseFromWorkerDeliversToTheClientQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "015e1a4b-25b4-434d-9c52-79a2fd08283d");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    addClientQueue(sut);
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS);
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    auto requestHeader = sut.portUser.getRequest(workerIndex).expect("Getting a request");
+
+    constexpr uint64_t RESPONSE_DATA{111U};
+    auto responseHeader =
+        sut.portUser.allocateResponse(workerIndex, requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+            .expect("Allocating a response");
+    new (ChunkHeader::fromUserHeader(responseHeader)->userPayload()) uint64_t(RESPONSE_DATA);
+    sut.portUser.releaseRequest(workerIndex, requestHeader);
+
+    sut.portUser.sendResponse(workerIndex, responseHeader)
+        .or_else([&](auto error) { GTEST_FAIL() << "Expected response to be sent but got error: " << error; });
+
+    auto maybeChunk [[maybe_unused]] = clientResponseQueue.tryPop()
+                                           .and_then([&](const auto& chunk) {
+                                               auto data = *static_cast<uint64_t*>(chunk.getUserPayload());
+                                               EXPECT_THAT(data, Eq(RESPONSE_DATA));
+                                           })
+                                           .or_else([&]() { GTEST_FAIL() << "Expected response but got none"; });
+
+    constexpr uint64_t NUMBER_OF_RESPONSE_CHUNKS{1U};
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_RESPONSE_CHUNKS));
+}
+
+TEST_F(ServerPort_test, SendResponseFromWorkerWithInvalidClientQueueIdReleasesTheChunkToTheMempool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "edbb87da-857f-471d-8624-0f8ab4c725a4");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{1U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS);
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    auto requestHeader = sut.portUser.getRequest(workerIndex).expect("Getting a request");
+    auto responseHeader =
+        sut.portUser.allocateResponse(workerIndex, requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+            .expect("Allocating a response");
+
+    auto result = sut.portUser.sendResponse(workerIndex, responseHeader);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ServerSendError::CLIENT_NOT_AVAILABLE));
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUESTS));
+}
+
+TEST_F(ServerPort_test, ReleaseWorkerReleasesAllChunksHeldByTheWorker)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5bd7750a-8ed3-4b8c-adb9-cc09ff3bd608");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{2U};
+    pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS);
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    auto requestHeader = sut.portUser.getRequest(workerIndex).expect("Getting a request");
+    IOX_DISCARD_RESULT(
+        sut.portUser.allocateResponse(workerIndex, requestHeader, USER_PAYLOAD_SIZE, USER_PAYLOAD_ALIGNMENT)
+            .expect("Allocating a response"));
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_REQUESTS + 1U));
+
+    sut.portUser.releaseWorker(workerIndex);
+
+    constexpr uint64_t NUMBER_OF_QUEUED_REQUESTS{1U};
+    EXPECT_THAT(this->getNumberOfUsedChunks(), Eq(NUMBER_OF_QUEUED_REQUESTS));
+}
+
+TEST_F(ServerPort_test, WorkersAndNonWorkerApiHoldRequestsIndependently)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "32850f97-e854-4e3c-a683-174247aefa31");
+    auto& sut = serverPortWithOfferOnCreate;
+
+    constexpr uint64_t NUMBER_OF_REQUESTS{2U * iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY};
+    ASSERT_TRUE(pushRequests(sut.requestQueuePusher, NUMBER_OF_REQUESTS));
+
+    auto workerIndex = sut.portUser.acquireWorker().expect("Acquiring a worker");
+    for (uint32_t i = 0U; i < iox::MAX_REQUESTS_PROCESSED_SIMULTANEOUSLY; ++i)
+    {
+        EXPECT_FALSE(sut.portUser.getRequest(workerIndex).has_error());
+        EXPECT_FALSE(sut.portUser.getRequest().has_error());
+    }
+
+    EXPECT_FALSE(sut.portUser.hasNewRequests());
+}
+
+// END server worker tests
+
 // BEGIN condition variable tests
 
 TEST_F(ServerPort_test, ConditionVariableInitiallyNotSet)
@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -177,6 +179,50 @@ TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeBatchCallsTheCallbackWithASampleForEachTakenChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ac137207-3f46-4c73-8296-c1ad8b1f3eb9");
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_COUNT{4U};
+    ChunkMock<DummyData> anotherChunkMock;
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Invoke([&](iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+            EXPECT_EQ(chunkHeaders.size(), MAX_COUNT);
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = anotherChunkMock.chunkHeader();
+            return iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(iox::ok<uint64_t>(2U));
+        }));
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeBatch(MAX_COUNT, [&](const auto& sample) { userPayloads.push_back(sample.get()); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    ASSERT_EQ(userPayloads.size(), 2U);
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], anotherChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
+TEST_F(SubscriberTest, TakeBatchDoesNotCallTheCallbackWhenNoChunkIsAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2295ee06-522a-4b9b-92b0-0659e8244e60");
+    // ===== Setup ===== //
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Return(ByMove(iox::err(iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE))));
+    // ===== Test ===== //
+    bool callbackCalled{false};
+    auto result = sut.takeBatch(1U, [&](const auto&) { callbackCalled = true; });
+    // ===== Verify ===== //
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+    EXPECT_FALSE(callbackCalled);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f30fe1ae-046c-48b3-b5cd-b9adbf9b864f");
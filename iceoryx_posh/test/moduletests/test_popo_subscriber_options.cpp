@@ -34,6 +34,7 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.subscribeOnCreate = false;
     testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
     testOptions.requiresPublisherHistorySupport = true;
+    testOptions.latestValueMode = true;
 
     iox::popo::SubscriberOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -53,10 +54,64 @@ TEST(SubscriberOptions_test, SerializationRoundTripIsSuccessful)
             EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
             EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
                         Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.latestValueMode, Ne(defaultOptions.latestValueMode));
+            EXPECT_THAT(roundTripOptions.latestValueMode, Eq(testOptions.latestValueMode));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of SubscriberOptions failed!"; });
 }
 
+TEST(SubscriberOptions_test, BinarySerializationRoundTripIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "657ad4b9-1232-4a48-91e3-48fb079f9589");
+    iox::popo::SubscriberOptions defaultOptions;
+    iox::popo::SubscriberOptions testOptions;
+
+    testOptions.queueCapacity = 73;
+    testOptions.historyRequest = 42;
+    testOptions.nodeName = "hypnotoad";
+    testOptions.subscribeOnCreate = false;
+    testOptions.queueFullPolicy = iox::popo::QueueFullPolicy::BLOCK_PRODUCER;
+    testOptions.requiresPublisherHistorySupport = true;
+    testOptions.latestValueMode = true;
+
+    iox::popo::SubscriberOptions::deserialize(testOptions.serializeBinary())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.queueCapacity, Ne(defaultOptions.queueCapacity));
+            EXPECT_THAT(roundTripOptions.queueCapacity, Eq(testOptions.queueCapacity));
+
+            EXPECT_THAT(roundTripOptions.historyRequest, Ne(defaultOptions.historyRequest));
+            EXPECT_THAT(roundTripOptions.historyRequest, Eq(testOptions.historyRequest));
+
+            EXPECT_THAT(roundTripOptions.nodeName, Ne(defaultOptions.nodeName));
+            EXPECT_THAT(roundTripOptions.nodeName, Eq(testOptions.nodeName));
+
+            EXPECT_THAT(roundTripOptions.subscribeOnCreate, Ne(defaultOptions.subscribeOnCreate));
+            EXPECT_THAT(roundTripOptions.subscribeOnCreate, Eq(testOptions.subscribeOnCreate));
+
+            EXPECT_THAT(roundTripOptions.queueFullPolicy, Ne(defaultOptions.queueFullPolicy));
+            EXPECT_THAT(roundTripOptions.queueFullPolicy, Eq(testOptions.queueFullPolicy));
+            EXPECT_THAT(roundTripOptions.requiresPublisherHistorySupport,
+                        Eq(testOptions.requiresPublisherHistorySupport));
+
+            EXPECT_THAT(roundTripOptions.latestValueMode, Ne(defaultOptions.latestValueMode));
+            EXPECT_THAT(roundTripOptions.latestValueMode, Eq(testOptions.latestValueMode));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Binary serialization/deserialization of SubscriberOptions failed!"; });
+}
+
+TEST(SubscriberOptions_test, DeserializingTruncatedBinarySerializationFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0aa16a0-0193-4735-8b3c-e6c56e5ca98c");
+    const auto serialized = iox::popo::SubscriberOptions{}.serializeBinary();
+    const auto truncated =
+        iox::popo::SubscriberOptions::BinarySerialization_t::fromBytes(serialized.data(), serialized.size() - 1U);
+    ASSERT_TRUE(truncated.has_value());
+    iox::popo::SubscriberOptions::deserialize(truncated.value())
+        .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
+        .or_else([&](auto&) { GTEST_SUCCEED(); });
+}
+
 TEST(SubscriberOptions_test, DeserializingBogusDataFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "6b4b77cc-09ce-4f71-b2b5-371be27f863a");
@@ -136,6 +136,26 @@ TEST_F(SubscriberPortSingleProducer_test, SubscribeCallResultsInSubCaProMessage)
     EXPECT_THAT(caproMessage.m_type, Eq(iox::capro::CaproMessageType::SUB));
     EXPECT_THAT(caproMessage.m_serviceDescription, Eq(SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION));
     EXPECT_THAT(caproMessage.m_historyCapacity, Eq(0u));
+    EXPECT_FALSE(caproMessage.m_latestValueMode);
+}
+
+TEST_F(SubscriberPortSingleProducer_test, SubCaProMessageContainsTheLatestValueModeOfTheOptions)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ca916b6c-8c4c-479c-ad8b-0870d583528c");
+    iox::popo::SubscriberOptions options;
+    options.latestValueMode = true;
+    iox::popo::SubscriberPortData subscriberPortData{TEST_SERVICE_DESCRIPTION,
+                                                     "myApp",
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::SoFi_SingleProducerSingleConsumer,
+                                                     options};
+    iox::popo::SubscriberPortSingleProducer sutRouDiSide{&subscriberPortData};
+
+    auto maybeCaproMessage = sutRouDiSide.tryGetCaProMessage();
+
+    ASSERT_TRUE(maybeCaproMessage.has_value());
+    EXPECT_THAT(maybeCaproMessage->m_type, Eq(iox::capro::CaproMessageType::SUB));
+    EXPECT_TRUE(maybeCaproMessage->m_latestValueMode);
 }
 
 TEST_F(SubscriberPortSingleProducer_test, SubscribeRequestedWhenCallingSubscribe)
@@ -418,6 +438,7 @@ TEST_F(SubscriberPortMultiProducer_test, SubscribeCallResultsInSubCaProMessage)
     EXPECT_THAT(caproMessage.m_type, Eq(iox::capro::CaproMessageType::SUB));
     EXPECT_THAT(caproMessage.m_serviceDescription, Eq(SubscriberPortSingleProducer_test::TEST_SERVICE_DESCRIPTION));
     EXPECT_THAT(caproMessage.m_historyCapacity, Eq(0u));
+    EXPECT_FALSE(caproMessage.m_latestValueMode);
 }
 
 TEST_F(SubscriberPortMultiProducer_test, SubscribedWhenCallingSubscribe)
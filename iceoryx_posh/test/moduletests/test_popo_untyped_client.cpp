@@ -119,6 +119,18 @@ TEST_F(UntypedClient_test, SendWithValidPayloadPointerCallsUnderlyingPort)
         .or_else([&](auto error) { GTEST_FAIL() << "Expected request to be sent but got error: " << error; });
 }
 
+TEST_F(UntypedClient_test, SendWithLoadBalancingKeyCallsUnderlyingPortWithKey)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d8e2b4a1-6c73-4f05-9a1e-3b7f0c5d2e98");
+    constexpr uint64_t LOAD_BALANCING_KEY{73U};
+
+    EXPECT_CALL(sut.mockPort, sendRequest(requestMock.userHeader(), LOAD_BALANCING_KEY)).WillOnce(Return(iox::ok()));
+
+    sut.send(requestMock.sample(), LOAD_BALANCING_KEY)
+        .and_then([&]() { GTEST_SUCCEED() << "Request successfully sent"; })
+        .or_else([&](auto error) { GTEST_FAIL() << "Expected request to be sent but got error: " << error; });
+}
+
 TEST_F(UntypedClient_test, SendWithNullpointerDoesNotCallsUnderlyingPort)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d3b13638-a32d-48fd-a099-fa8516511ef8");
@@ -137,6 +137,26 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishBatchForwardsAllUserPayloadsInOneCallToUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c1f7e2a-93d5-4b8e-a0c6-5e2d8f7b1a34");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> anotherChunkMock;
+    void* userPayloads[] = {chunkMock.chunkHeader()->userPayload(), anotherChunkMock.chunkHeader()->userPayload()};
+    std::vector<iox::mepoo::ChunkHeader*> sentChunkHeaders;
+    EXPECT_CALL(portMock, sendChunks).WillOnce(Invoke([&](const auto chunkHeaders) {
+        sentChunkHeaders.assign(chunkHeaders.begin(), chunkHeaders.end());
+    }));
+    EXPECT_CALL(portMock, sendChunk).Times(0);
+    // ===== Test ===== //
+    sut.publishBatch(iox::span<void* const>(userPayloads));
+    // ===== Verify ===== //
+    ASSERT_THAT(sentChunkHeaders.size(), Eq(2U));
+    EXPECT_THAT(sentChunkHeaders[0], Eq(chunkMock.chunkHeader()));
+    EXPECT_THAT(sentChunkHeaders[1], Eq(anotherChunkMock.chunkHeader()));
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
@@ -178,4 +178,73 @@ TEST_F(UntypedServer_test, ReleaseResponseWithNullpointerDoesNotCallsUnderlyingP
     sut.releaseResponse(nullptr);
 }
 
+TEST_F(UntypedServer_test, AcquireAndReleaseWorkerCallsUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "aa071e87-1d76-49a0-8311-ef84caa09cb6");
+
+    constexpr uint32_t WORKER_INDEX{2U};
+    EXPECT_CALL(sut.mockPort, acquireWorker()).WillOnce(Return(iox::optional<uint32_t>(WORKER_INDEX)));
+    EXPECT_CALL(sut.mockPort, releaseWorker(WORKER_INDEX)).Times(1);
+
+    auto workerIndex = sut.acquireWorker();
+    ASSERT_TRUE(workerIndex.has_value());
+    EXPECT_THAT(workerIndex.value(), Eq(WORKER_INDEX));
+
+    sut.releaseWorker(workerIndex.value());
+}
+
+TEST_F(UntypedServer_test, TakeWithWorkerCallsUnderlyingPortWithSuccessResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b13301c-4f66-4a9c-ba40-06f357cf9ecd");
+
+    constexpr uint32_t WORKER_INDEX{1U};
+    const iox::expected<const RequestHeader*, ServerRequestResult> getRequestResult =
+        iox::ok<const RequestHeader*>(requestMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort, getRequest(WORKER_INDEX)).WillOnce(Return(getRequestResult));
+    EXPECT_CALL(sut.mockPort, releaseRequest(WORKER_INDEX, requestMock.userHeader())).Times(1);
+
+    auto takeResult = sut.take(WORKER_INDEX);
+    ASSERT_FALSE(takeResult.has_error());
+    EXPECT_THAT(takeResult.value(), Eq(requestMock.sample()));
+
+    sut.releaseRequest(WORKER_INDEX, takeResult.value());
+}
+
+TEST_F(UntypedServer_test, LoanWithWorkerCallsUnderlyingPortWithSuccessResult)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ebbf6eda-d7a7-4c0e-9ded-da6b1bd0296c");
+
+    constexpr uint32_t WORKER_INDEX{3U};
+    constexpr uint64_t PAYLOAD_SIZE{8U};
+    constexpr uint32_t PAYLOAD_ALIGNMENT{32U};
+    const iox::expected<ResponseHeader*, AllocationError> allocateResponseResult =
+        iox::ok<ResponseHeader*>(responseMock.userHeader());
+
+    EXPECT_CALL(sut.mockPort,
+                allocateResponse(WORKER_INDEX, requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT))
+        .WillOnce(Return(allocateResponseResult));
+    EXPECT_CALL(sut.mockPort, releaseResponse(WORKER_INDEX, responseMock.userHeader())).Times(1);
+
+    auto loanResult = sut.loan(WORKER_INDEX, requestMock.userHeader(), PAYLOAD_SIZE, PAYLOAD_ALIGNMENT);
+    ASSERT_FALSE(loanResult.has_error());
+    EXPECT_THAT(loanResult.value(), Eq(responseMock.sample()));
+
+    sut.releaseResponse(WORKER_INDEX, loanResult.value());
+}
+
+TEST_F(UntypedServer_test, SendWithWorkerCallsUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b379fce4-3800-4aca-ae98-ca4c876f089f");
+
+    constexpr uint32_t WORKER_INDEX{4U};
+    const iox::expected<void, ServerSendError> sendResponseResult = iox::ok();
+    EXPECT_CALL(sut.mockPort, sendResponse(WORKER_INDEX, responseMock.userHeader()))
+        .WillOnce(Return(sendResponseResult));
+
+    sut.send(WORKER_INDEX, responseMock.sample()).or_else([&](auto error) {
+        GTEST_FAIL() << "Expected response to be sent but got error: " << error;
+    });
+}
+
 } // namespace
@@ -21,6 +21,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -159,6 +161,32 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeBatchCallsTheCallbackWithTheUserPayloadOfEachTakenChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "16958f22-014d-4672-95dd-4d0eaeb9e534");
+    // ===== Setup ===== //
+    constexpr uint64_t MAX_COUNT{3U};
+    ChunkMock<DummyData> anotherChunkMock;
+    EXPECT_CALL(sut, takeChunks)
+        .Times(1)
+        .WillOnce(Invoke([&](iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+            EXPECT_EQ(chunkHeaders.size(), MAX_COUNT);
+            chunkHeaders[0] = chunkMock.chunkHeader();
+            chunkHeaders[1] = anotherChunkMock.chunkHeader();
+            return iox::expected<uint64_t, iox::popo::ChunkReceiveResult>(iox::ok<uint64_t>(2U));
+        }));
+    // ===== Test ===== //
+    std::vector<const void*> userPayloads;
+    auto result = sut.takeBatch(MAX_COUNT, [&](const void* userPayload) { userPayloads.push_back(userPayload); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_EQ(result.value(), 2U);
+    ASSERT_EQ(userPayloads.size(), 2U);
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], anotherChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
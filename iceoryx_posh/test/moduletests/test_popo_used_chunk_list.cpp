@@ -23,6 +23,9 @@
 
 #include "test.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -121,6 +124,30 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, SizeReflectsTheNumberOfInsertedAndRemovedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "67339002-e814-423c-a024-8f68613ed3ad");
+    EXPECT_THAT(sut.capacity(), Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_THAT(sut.size(), Eq(0U));
+
+    std::vector<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        EXPECT_TRUE(sut.insert(chunk));
+    });
+    EXPECT_THAT(sut.size(), Eq(USED_CHUNK_LIST_CAPACITY));
+
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+    EXPECT_THAT(sut.size(), Eq(USED_CHUNK_LIST_CAPACITY));
+
+    SharedChunk chunk;
+    EXPECT_TRUE(sut.remove(chunkHeaderInUse.back(), chunk));
+    EXPECT_THAT(sut.size(), Eq(USED_CHUNK_LIST_CAPACITY - 1U));
+
+    sut.cleanup();
+    EXPECT_THAT(sut.size(), Eq(0U));
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -316,4 +343,32 @@ TEST_F(UsedChunkList_test, CallingCleanupReleasesAllChunks)
     EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
     checkIfEmpty();
 }
+
+TEST_F(UsedChunkList_test, PeekOnEmptyListReturnsNullptr)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3d8e5f0a-9b1c-4e27-a6d4-7c2f1b8e0a93");
+    EXPECT_THAT(sut.peek(), Eq(nullptr));
+}
+
+TEST_F(UsedChunkList_test, RemovingThePeekedChunksEmptiesTheList)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b57c1e2d-4a3f-4f68-8e91-0d6a2c5b7f14");
+    std::vector<ChunkHeader*> chunkHeaderInUse;
+    createMultipleChunks(USED_CHUNK_LIST_CAPACITY, [&](SharedChunk&& chunk) {
+        chunkHeaderInUse.push_back(chunk.getChunkHeader());
+        sut.insert(chunk);
+    });
+
+    for (auto* chunkHeader = sut.peek(); chunkHeader != nullptr; chunkHeader = sut.peek())
+    {
+        EXPECT_THAT(std::find(chunkHeaderInUse.begin(), chunkHeaderInUse.end(), chunkHeader),
+                    Ne(chunkHeaderInUse.end()));
+        SharedChunk removedChunk;
+        ASSERT_TRUE(sut.remove(chunkHeader, removedChunk));
+    }
+
+    EXPECT_THAT(sut.size(), Eq(0U));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    checkIfEmpty();
+}
 } // namespace
@@ -18,6 +18,8 @@
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
 #include "test.hpp"
 
+#include <array>
+
 namespace
 {
 using namespace ::testing;
@@ -88,6 +90,26 @@ TYPED_TEST(VariantQueue_test, popsMultiElementsWhichWerePushed)
     EXPECT_THAT(element.value(), Eq(34123));
 }
 
+TYPED_TEST(VariantQueue_test, bulkPopRemovesMultiElementsWhichWerePushedInFifoOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8815128-550a-468f-93cb-e00900f7a5c7");
+    VariantQueue<int32_t, 5> sut(TypeParam::value);
+    sut.push(14123);
+    sut.push(24123);
+    sut.push(34123);
+
+    std::array<int32_t, 2> elements{};
+    ASSERT_THAT(sut.pop(span<int32_t>(elements)), Eq(2U));
+    EXPECT_THAT(elements[0], Eq(14123));
+    EXPECT_THAT(elements[1], Eq(24123));
+
+    ASSERT_THAT(sut.pop(span<int32_t>(elements)), Eq(1U));
+    EXPECT_THAT(elements[0], Eq(34123));
+
+    EXPECT_THAT(sut.pop(span<int32_t>(elements)), Eq(0U));
+    EXPECT_THAT(sut.empty(), Eq(true));
+}
+
 TYPED_TEST(VariantQueue_test, pushTwoElementsAfterSecondPopIsInvalid)
 {
     ::testing::Test::RecordProperty("TEST_ID", "22cc44ac-bebe-4516-b2fe-290fbefb60b7");
@@ -697,16 +697,18 @@ TEST_F(PoshRuntime_test, GetMiddlewareClientWhenMaxClientsAreUsedResultsInClient
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__CLIENTLIST_OVERFLOW);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareClientWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareClientWithNodeNameContainingIpcSeparatorIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b4433dfd-d2f8-4567-9483-aed956275ce8");
     const iox::capro::ServiceDescription sd{"great", "gig", "sky"};
     iox::popo::ClientOptions clientOptions;
+    // the client options are transferred in the binary serialization which is not affected by the IPC separator
     clientOptions.nodeName = m_invalidNodeName;
 
-    m_runtime->getMiddlewareClient(sd, clientOptions);
+    auto clientPort = m_runtime->getMiddlewareClient(sd, clientOptions);
 
-    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_CLIENT_INVALID_RESPONSE);
+    EXPECT_THAT(clientPort, Ne(nullptr));
+    IOX_TESTING_EXPECT_OK();
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareServerWithDefaultArgsIsSuccessful)
@@ -793,16 +795,18 @@ TEST_F(PoshRuntime_test, GetMiddlewareServerWhenMaxServerAreUsedResultsInServerl
     IOX_TESTING_EXPECT_ERROR(iox::PoshError::PORT_POOL__SERVERLIST_OVERFLOW);
 }
 
-TEST_F(PoshRuntime_test, GetMiddlewareServerWithInvalidNodeNameLeadsToErrorHandlerCall)
+TEST_F(PoshRuntime_test, GetMiddlewareServerWithNodeNameContainingIpcSeparatorIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "95603ddc-1051-4dd7-a163-1c621f8a211a");
     const iox::capro::ServiceDescription sd{"it's", "over", "now"};
     iox::popo::ServerOptions serverOptions;
+    // the server options are transferred in the binary serialization which is not affected by the IPC separator
     serverOptions.nodeName = m_invalidNodeName;
 
-    m_runtime->getMiddlewareServer(sd, serverOptions);
+    auto serverPort = m_runtime->getMiddlewareServer(sd, serverOptions);
 
-    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__RUNTIME_ROUDI_REQUEST_SERVER_INVALID_RESPONSE);
+    EXPECT_THAT(serverPort, Ne(nullptr));
+    IOX_TESTING_EXPECT_OK();
 }
 
 TEST_F(PoshRuntime_test, GetMiddlewareConditionVariableIsSuccessful)
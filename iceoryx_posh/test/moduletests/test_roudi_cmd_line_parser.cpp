@@ -575,6 +575,90 @@ TEST_F(CmdLineParser_test, OutOfBoundsUniqueIdOptionLeadsError)
     EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
 }
 
+TEST_F(CmdLineParser_test, IntrospectionOptionsLeadToCorrectCategoryConfig)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c3c84158-63c6-4245-a1e7-78688a7a2882");
+    constexpr uint8_t NUMBER_OF_ARGS{5U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char shortOption[] = "-i";
+    char allValue[] = "all:basic:250";
+    char longOption[] = "--introspection";
+    char portValue[] = "port:off";
+    args[0] = &appName[0];
+    args[1] = &shortOption[0];
+    args[2] = &allValue[0];
+    args[3] = &longOption[0];
+    args[4] = &portValue[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& introspection = result.value().roudiConfig.introspection;
+    EXPECT_EQ(introspection.mempool.level, IntrospectionLevel::BASIC);
+    EXPECT_EQ(introspection.mempool.interval, 250_ms);
+    EXPECT_EQ(introspection.process.level, IntrospectionLevel::BASIC);
+    EXPECT_EQ(introspection.process.interval, 250_ms);
+    EXPECT_EQ(introspection.port.level, IntrospectionLevel::OFF);
+    EXPECT_EQ(introspection.port.interval, 250_ms);
+    EXPECT_TRUE(result.value().introspectionOverrides.mempool);
+    EXPECT_TRUE(result.value().introspectionOverrides.process);
+    EXPECT_TRUE(result.value().introspectionOverrides.port);
+    EXPECT_TRUE(result.value().run);
+}
+
+TEST_F(CmdLineParser_test, IntrospectionOptionForSingleCategoryLeavesTheOthersUntouched)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "923683c6-8e54-4dcb-ab62-5520889e6854");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "-i";
+    char value[] = "mempool:off";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &value[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& introspection = result.value().roudiConfig.introspection;
+    EXPECT_EQ(introspection.mempool.level, IntrospectionLevel::OFF);
+    EXPECT_EQ(introspection.mempool.interval, DEFAULT_INTROSPECTION_INTERVAL);
+    EXPECT_EQ(introspection.port.level, IntrospectionLevel::FULL);
+    EXPECT_TRUE(result.value().introspectionOverrides.mempool);
+    EXPECT_FALSE(result.value().introspectionOverrides.process);
+    EXPECT_FALSE(result.value().introspectionOverrides.port);
+}
+
+TEST_F(CmdLineParser_test, WrongIntrospectionOptionLeadsToError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ff5f54b-37fc-4893-a2eb-289f8f12478d");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--introspection";
+    char valueArray[][20] = {"port", "port:on", "bus:off", "port:full:0", "port:full:fast", ":full"};
+    args[0] = &appName[0];
+    args[1] = &option[0];
+
+    for (auto wrongValue : valueArray)
+    {
+        args[2] = wrongValue;
+
+        CmdLineParser sut;
+        auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+        ASSERT_TRUE(result.has_error()) << wrongValue;
+        EXPECT_THAT(result.error(), Eq(CmdLineParserResult::INVALID_PARAMETER));
+
+        // Reset optind to be able to parse again
+        optind = 0;
+    }
+}
+
 TEST_F(CmdLineParser_test, CmdLineParsingModeEqualToOneHandlesOnlyTheFirstOption)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1e674db9-d71a-4b82-83cc-eea2e04f4601");
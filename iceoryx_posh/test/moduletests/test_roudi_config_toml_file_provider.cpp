@@ -98,6 +98,79 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingIntrospectionSectionIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5ffe9038-a1ab-426a-bc76-accd99285e78");
+    std::istringstream stream(R"(
+        [general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [introspection.mempool]
+        level = "off"
+
+        [introspection.port]
+        level = "basic"
+        interval_ms = 500
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& introspection = result.value().introspection;
+    EXPECT_EQ(introspection.mempool.level, iox::roudi::IntrospectionLevel::OFF);
+    EXPECT_EQ(introspection.process.level, iox::roudi::IntrospectionLevel::FULL);
+    EXPECT_EQ(introspection.process.interval, iox::roudi::DEFAULT_INTROSPECTION_INTERVAL);
+    EXPECT_EQ(introspection.port.level, iox::roudi::IntrospectionLevel::BASIC);
+    EXPECT_EQ(introspection.port.interval, iox::units::Duration::fromMilliseconds(500));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, IntrospectionSetOnCmdLineTakesPrecedenceOverConfigFile)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dedbdf23-2a09-4066-ab3e-a30adb79e879");
+
+    auto tempFilePath = std::filesystem::temp_directory_path();
+    tempFilePath.append("test_roudi_config_introspection.toml");
+
+    std::fstream tempFile{tempFilePath, std::ios_base::trunc | std::ios_base::out};
+    ASSERT_TRUE(tempFile.is_open());
+    tempFile << R"([general]
+        version = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [introspection.mempool]
+        level = "off"
+
+        [introspection.port]
+        level = "basic"
+    )";
+    tempFile.close();
+
+    cmdLineArgs.configFilePath =
+        iox::roudi::ConfigFilePathString_t(iox::TruncateToCapacity, tempFilePath.u8string().c_str());
+    cmdLineArgs.roudiConfig.introspection.port.interval = iox::units::Duration::fromMilliseconds(100);
+    cmdLineArgs.introspectionOverrides.port = true;
+
+    iox::config::TomlRouDiConfigFileProvider sut(cmdLineArgs);
+    auto result = sut.parse();
+
+    ASSERT_FALSE(result.has_error());
+    const auto& introspection = result.value().introspection;
+    EXPECT_EQ(introspection.mempool.level, iox::roudi::IntrospectionLevel::OFF);
+    EXPECT_EQ(introspection.port.level, iox::roudi::IntrospectionLevel::FULL);
+    EXPECT_EQ(introspection.port.interval, iox::units::Duration::fromMilliseconds(100));
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +254,34 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_INTROSPECTION_LEVEL = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+
+    [introspection.port]
+    level = "verbose"
+)";
+
+constexpr const char* CONFIG_INVALID_INTROSPECTION_INTERVAL = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+
+    [introspection.process]
+    interval_ms = 0
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +301,10 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_INTROSPECTION_LEVEL,
+                                 CONFIG_INVALID_INTROSPECTION_LEVEL},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_INTROSPECTION_INTERVAL,
+                                 CONFIG_INVALID_INTROSPECTION_INTERVAL},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
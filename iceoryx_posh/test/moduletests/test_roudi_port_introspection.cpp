@@ -437,6 +437,128 @@ TEST_F(PortIntrospection_test, addAndRemoveSubscriber)
     chunk->sample()->~PortIntrospectionFieldTopic();
 }
 
+TEST_F(PortIntrospection_test, throughputDataContainsTheStatisticsOfThePublisher)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "464ec695-acef-40a5-bb92-08abf34889f5");
+    using Topic = iox::roudi::PortThroughputIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name1"};
+    iox::capro::ServiceDescription service("a", "b", "c");
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    iox::popo::PublisherPortData portData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, publisherOptions);
+    EXPECT_THAT(m_introspectionAccess.addPublisher(portData), Eq(true));
+
+    portData.m_chunkSenderData.m_statistics.m_sentChunks = 4U;
+    portData.m_chunkSenderData.m_statistics.m_sentBytes = 32U;
+    portData.m_chunkSenderData.m_statistics.m_allocationFailures = 1U;
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+
+    bool chunkWasSent = false;
+    EXPECT_CALL(m_introspectionAccess.getPublisherPortThroughput().value(), sendChunk(_))
+        .WillRepeatedly(Invoke([&](iox::mepoo::ChunkHeader* const) { chunkWasSent = true; }));
+
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    {
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_sentChunks, Eq(4U));
+        EXPECT_THAT(throughput.m_sentBytes, Eq(32U));
+        EXPECT_THAT(throughput.m_allocationFailures, Eq(1U));
+        EXPECT_THAT(throughput.m_sampleSize, Eq(8U));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+
+    // the second topic only considers the chunks sent in between
+    portData.m_chunkSenderData.m_statistics.m_sentChunks = 6U;
+    portData.m_chunkSenderData.m_statistics.m_sentBytes = 72U;
+
+    chunkWasSent = false;
+    m_introspectionAccess.sendThroughputData();
+
+    ASSERT_THAT(chunkWasSent, Eq(true));
+    ASSERT_THAT(chunk->sample()->m_throughputList.size(), Eq(1U));
+    {
+        const auto& throughput = chunk->sample()->m_throughputList[0];
+        EXPECT_THAT(throughput.m_sentChunks, Eq(6U));
+        EXPECT_THAT(throughput.m_sentBytes, Eq(72U));
+        EXPECT_THAT(throughput.m_sampleSize, Eq(20U));
+        EXPECT_THAT(throughput.m_bytesPerSecond, Gt(0.0));
+    }
+    chunk->sample()->~PortThroughputIntrospectionFieldTopic();
+}
+
+
+TEST_F(PortIntrospection_test, disabledIntrospectionDoesNotTrackPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c7a53ac0-2624-4409-bda4-cb7725166a7c");
+    using Topic = iox::roudi::PortIntrospectionFieldTopic;
+
+    auto chunk = std::unique_ptr<ChunkMock<Topic>>(new ChunkMock<Topic>);
+
+    const iox::RuntimeName_t runtimeName{"name1"};
+    iox::capro::ServiceDescription service("a", "b", "c");
+    iox::mepoo::MemoryManager memoryManager;
+    iox::popo::PublisherOptions publisherOptions;
+    iox::popo::PublisherPortData publisherPortData(
+        service, runtimeName, iox::roudi::DEFAULT_UNIQUE_ROUDI_ID, &memoryManager, publisherOptions);
+    iox::popo::SubscriberPortData subscriberPortData{service,
+                                                     runtimeName,
+                                                     iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                     iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                     iox::popo::SubscriberOptions()};
+
+    m_introspectionAccess.setDetailLevel(iox::roudi::IntrospectionLevel::OFF);
+    EXPECT_THAT(m_introspectionAccess.addPublisher(publisherPortData), Eq(false));
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(subscriberPortData), Eq(false));
+
+    iox::expected<iox::mepoo::ChunkHeader*, iox::popo::AllocationError> tryAllocateChunkResult =
+        iox::ok(chunk.get()->chunkHeader());
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), tryAllocateChunk(_, _, _, _))
+        .WillRepeatedly(Return(tryAllocateChunkResult));
+    EXPECT_CALL(m_introspectionAccess.getPublisherPort().value(), sendChunk(_)).Times(1);
+
+    m_introspectionAccess.sendPortData();
+
+    EXPECT_THAT(chunk->sample()->m_publisherList.size(), Eq(0U));
+    EXPECT_THAT(chunk->sample()->m_subscriberList.size(), Eq(0U));
+
+    chunk->sample()->~PortIntrospectionFieldTopic();
+}
+
+TEST_F(PortIntrospection_test, maxQueueDepthIsOnlyTrackedWithFullIntrospectionLevel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94e1c7b3-5a2f-4d08-bc6e-1f3a8d7e2c59");
+
+    const iox::RuntimeName_t runtimeName{"name1"};
+    iox::popo::SubscriberPortData basicPortData{iox::capro::ServiceDescription("a", "b", "c"),
+                                                runtimeName,
+                                                iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                                iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                                iox::popo::SubscriberOptions()};
+    iox::popo::SubscriberPortData fullPortData{iox::capro::ServiceDescription("d", "e", "f"),
+                                               runtimeName,
+                                               iox::roudi::DEFAULT_UNIQUE_ROUDI_ID,
+                                               iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer,
+                                               iox::popo::SubscriberOptions()};
+
+    m_introspectionAccess.setDetailLevel(iox::roudi::IntrospectionLevel::BASIC);
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(basicPortData), Eq(true));
+    EXPECT_FALSE(basicPortData.m_chunkReceiverData.m_statistics.m_isMaxQueueDepthTracked.load());
+
+    m_introspectionAccess.setDetailLevel(iox::roudi::IntrospectionLevel::FULL);
+    EXPECT_THAT(m_introspectionAccess.addSubscriber(fullPortData), Eq(true));
+    EXPECT_TRUE(fullPortData.m_chunkReceiverData.m_statistics.m_isMaxQueueDepthTracked.load());
+}
 
 TEST_F(PortIntrospection_test, Thread)
 {
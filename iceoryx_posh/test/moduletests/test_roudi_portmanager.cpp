@@ -911,4 +911,90 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, ScheduledDeletionOfPortsOfProcessIsSpreadOverMultipleDiscoveryRuns)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "761a4924-83a1-444a-93da-ed20d31c6192");
+    iox::RuntimeName_t runtimeName = "manyPorts";
+    constexpr uint64_t NUMBER_OF_PUBLISHERS{iox::roudi::MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN + 1U};
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), true};
+    auto& publisherPorts = m_roudiMemoryManager->portPool().value()->getPublisherPortDataList();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_PUBLISHERS; ++i)
+    {
+        ASSERT_FALSE(m_portManager
+                         ->acquirePublisherPortData(getUniqueSD(),
+                                                    publisherOptions,
+                                                    runtimeName,
+                                                    m_payloadDataSegmentMemoryManager,
+                                                    PortConfigInfo())
+                         .has_error());
+    }
+
+    m_portManager->scheduleDeletionOfPortsOfProcess(runtimeName);
+    EXPECT_THAT(publisherPorts.size(), Eq(NUMBER_OF_PUBLISHERS));
+
+    m_portManager->doDiscovery();
+    EXPECT_TRUE(m_portManager->hasPendingPortTeardowns());
+    EXPECT_THAT(publisherPorts.size(), Eq(NUMBER_OF_PUBLISHERS - iox::roudi::MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN));
+
+    m_portManager->doDiscovery();
+    EXPECT_FALSE(m_portManager->hasPendingPortTeardowns());
+    EXPECT_THAT(publisherPorts.size(), Eq(0U));
+}
+
+TEST_F(PortManager_test, ScheduledDeletionOfPortsOfProcessDoesNotAffectPortsAcquiredAfterwards)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26b54632-225c-4d13-8a94-2da47878650c");
+    iox::RuntimeName_t runtimeName = "reRegisteredApp";
+    iox::capro::ServiceDescription service("1", "1", "1");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+
+    auto oldPublisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+
+    m_portManager->scheduleDeletionOfPortsOfProcess(runtimeName);
+
+    auto newPublisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, runtimeName, m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+
+    m_portManager->doDiscovery();
+
+    auto& publisherPorts = m_roudiMemoryManager->portPool().value()->getPublisherPortDataList();
+    ASSERT_THAT(publisherPorts.size(), Eq(1U));
+    EXPECT_THAT(&*publisherPorts.begin(), Eq(newPublisherData));
+    EXPECT_THAT(&*publisherPorts.begin(), Ne(oldPublisherData));
+    EXPECT_FALSE(newPublisherData->m_toBeDestroyed.load());
+}
+
+TEST_F(PortManager_test, ConditionVariablesOfScheduledProcessAreDestroyedAfterItsPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b63e48ff-28ef-4bda-b191-edd244b461f0");
+    iox::RuntimeName_t runtimeName = "manyPortsWithWaitSet";
+    constexpr uint64_t NUMBER_OF_SUBSCRIBERS{iox::roudi::MAX_PORT_TEARDOWNS_PER_DISCOVERY_RUN + 1U};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+    auto& condVars = m_roudiMemoryManager->portPool().value()->getConditionVariableDataList();
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SUBSCRIBERS; ++i)
+    {
+        ASSERT_FALSE(
+            m_portManager->acquireSubscriberPortData(getUniqueSD(), subscriberOptions, runtimeName, PortConfigInfo())
+                .has_error());
+    }
+    ASSERT_FALSE(m_portManager->acquireConditionVariableData(runtimeName).has_error());
+
+    m_portManager->scheduleDeletionOfPortsOfProcess(runtimeName);
+
+    m_portManager->doDiscovery();
+    EXPECT_THAT(condVars.size(), Eq(1U));
+
+    m_portManager->doDiscovery();
+    EXPECT_THAT(condVars.size(), Eq(0U));
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -142,6 +142,50 @@ TEST_F(PortManager_test, AcquireServerPortDataWithSameServiceDescriptionTwiceAnd
     IOX_TESTING_EXPECT_OK();
 }
 
+TEST_F(PortManager_test, AcquireServerPortDataWithSameServiceDescriptionTwiceAndMultipleServersAllowedReturnsPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2b8e5f0c-7a3d-4e91-b6c2-d49f1a8e7c53");
+    const ServiceDescription sd{"hyp", "no", "toad"};
+    const RuntimeName_t runtimeName{"hypnotoad"};
+    auto serverOptions = createTestServerOptions();
+    serverOptions.allowMultipleServers = true;
+
+    for (uint32_t i = 0U; i < 2U; ++i)
+    {
+        m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+            .or_else([&](const auto& error) {
+                GTEST_FAIL() << "Expected ServerPortData but got PortPoolError: " << static_cast<uint8_t>(error);
+            });
+    }
+
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(PortManager_test,
+       AcquireServerPortDataWithSameServiceDescriptionTwiceAndMultipleServersNotAllowedByFirstPortReturnsError)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f63a1d97-4c0e-4b28-9e75-0a2c8b6d3f14");
+    const ServiceDescription sd{"hyp", "no", "toad"};
+    const RuntimeName_t runtimeName{"hypnotoad"};
+    auto serverOptions = createTestServerOptions();
+
+    // first call must be successful
+    m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+        .or_else([&](const auto& error) {
+            GTEST_FAIL() << "Expected ServerPortData but got PortPoolError: " << static_cast<uint8_t>(error);
+        });
+
+    // second call must fail since the first server does not allow further servers
+    serverOptions.allowMultipleServers = true;
+    m_portManager->acquireServerPortData(sd, serverOptions, runtimeName, m_payloadDataSegmentMemoryManager, {})
+        .and_then([&](const auto&) {
+            GTEST_FAIL() << "Expected PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS but got ServerPortData";
+        })
+        .or_else([&](const auto& error) { EXPECT_THAT(error, Eq(PortPoolError::UNIQUE_SERVER_PORT_ALREADY_EXISTS)); });
+
+    IOX_TESTING_EXPECT_ERROR(iox::PoshError::POSH__PORT_MANAGER_SERVERPORT_NOT_UNIQUE);
+}
+
 // END aquireServerPortData tests
 
 // BEGIN discovery tests
@@ -733,4 +777,130 @@ TEST_F(PortManager_test, ConnectedClientCanCommunicateWithServer)
 
 // END communication tests
 
+// BEGIN multiple servers tests
+
+TEST_F(PortManager_test, CreateClientWithConnectOnCreateAndMultipleOfferingServersResultsInClientConnectedToAllServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9a4c7e21-3f68-4d0b-85e9-c2b1f7d06a38");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+    EXPECT_TRUE(serverPortUser1.hasClients());
+    EXPECT_TRUE(serverPortUser2.hasClients());
+}
+
+TEST_F(PortManager_test, CreateServerWithOfferOnCreateAndAlreadyConnectedClientResultsInClientConnectedToAllServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c5f08b36-e2d7-4a19-9b4e-7e6a3d1c2f90");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+    EXPECT_TRUE(serverPortUser1.hasClients());
+    EXPECT_TRUE(serverPortUser2.hasClients());
+}
+
+TEST_F(PortManager_test, ClientConnectedToMultipleServersDistributesRequestsAmongTheServers)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "47d2a9e6-0b5c-4f83-a1e7-6c9d8b2f5a04");
+    constexpr uint64_t NUMBER_OF_REQUESTS_PER_SERVER{2U};
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    clientOptions.loadBalancingPolicy = LoadBalancingPolicy::ROUND_ROBIN;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    for (uint64_t i = 0U; i < 2U * NUMBER_OF_REQUESTS_PER_SERVER; ++i)
+    {
+        auto allocateRequestResult = clientPortUser.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+        ASSERT_FALSE(allocateRequestResult.has_error());
+        EXPECT_FALSE(clientPortUser.sendRequest(allocateRequestResult.value()).has_error());
+    }
+
+    for (auto* serverPortUser : {&serverPortUser1, &serverPortUser2})
+    {
+        for (uint64_t i = 0U; i < NUMBER_OF_REQUESTS_PER_SERVER; ++i)
+        {
+            auto getRequestResult = serverPortUser->getRequest();
+            ASSERT_FALSE(getRequestResult.has_error());
+            serverPortUser->releaseRequest(getRequestResult.value());
+        }
+        EXPECT_FALSE(serverPortUser->hasNewRequests());
+    }
+}
+
+TEST_F(PortManager_test, DoDiscoveryWithClientConnectedToMultipleServersRemainsConnectedWhenOneServerStopsOffer)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e81b6c4f-5d29-4a70-b3f8-1a0e9c7d2b65");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    serverPortUser1.stopOffer();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::CONNECTED));
+
+    auto allocateRequestResult = clientPortUser.allocateRequest(sizeof(uint64_t), alignof(uint64_t));
+    ASSERT_FALSE(allocateRequestResult.has_error());
+    EXPECT_FALSE(clientPortUser.sendRequest(allocateRequestResult.value()).has_error());
+    EXPECT_FALSE(serverPortUser1.hasNewRequests());
+    EXPECT_TRUE(serverPortUser2.hasNewRequests());
+
+    serverPortUser2.stopOffer();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::WAIT_FOR_OFFER));
+}
+
+TEST_F(PortManager_test,
+       DoDiscoveryWithClientConnectedToMultipleServersResultsInClientNotConnectedWhenCallingDisconnect)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0f3e7a58-b69c-4d12-8e4a-d5c2f1b9a736");
+    auto clientOptions = createTestClientOptions();
+    clientOptions.connectOnCreate = true;
+    auto serverOptions = createTestServerOptions();
+    serverOptions.offerOnCreate = true;
+    serverOptions.allowMultipleServers = true;
+
+    auto serverPortUser1 = createServer(serverOptions);
+    auto serverPortUser2 = createServer(serverOptions);
+    auto clientPortUser = createClient(clientOptions);
+
+    clientPortUser.disconnect();
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(clientPortUser.getConnectionState(), Eq(ConnectionState::NOT_CONNECTED));
+    EXPECT_FALSE(serverPortUser1.hasClients());
+    EXPECT_FALSE(serverPortUser2.hasClients());
+}
+
+// END multiple servers tests
+
 } // namespace iox_test_roudi_portmanager
@@ -16,6 +16,8 @@
 
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
@@ -24,6 +26,7 @@
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/posix_user.hpp"
 #include "iox/string.hpp"
 #include "test.hpp"
@@ -88,6 +91,39 @@ TEST_F(ProcessManager_test, RegisterProcessWithMonitorningWorks)
     EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
 }
 
+TEST_F(ProcessManager_test, TerminatedMonitoredProcessIsRemovedBeforeHeartbeatTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "db12fe35-2272-4d1f-b5e3-3a9d8c07538f");
+    if (!ProcessTerminationMonitor::isSupported())
+    {
+        GTEST_SKIP() << "Process file descriptors are not supported on this platform";
+    }
+
+    ProcessTerminationMonitor processTerminationMonitor{[] {}};
+    m_sut->initProcessTerminationMonitor(&processTerminationMonitor);
+
+    const auto childPid = fork();
+    if (childPid == 0)
+    {
+        _exit(0);
+    }
+    ASSERT_THAT(childPid, Gt(0));
+    const auto pid = static_cast<uint32_t>(childPid);
+    ASSERT_TRUE(m_sut->registerProcess(m_processname, pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo));
+
+    deadline_timer timeout{runtime::PROCESS_KEEP_ALIVE_TIMEOUT};
+    while (!processTerminationMonitor.hasTerminated(pid) && !timeout.hasExpired())
+    {
+        std::this_thread::yield();
+    }
+    m_sut->run();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0));
+    int status{0};
+    EXPECT_THAT(waitpid(childPid, &status, 0), Eq(childPid));
+    m_sut->initProcessTerminationMonitor(nullptr);
+}
+
 TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ce0fcf0e-564c-4330-86c8-13b33c2a64c8");
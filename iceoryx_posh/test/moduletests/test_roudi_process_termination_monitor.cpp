@@ -0,0 +1,132 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/roudi/process_termination_monitor.hpp"
+#include "iox/deadline_timer.hpp"
+#include "test.hpp"
+
+#include <atomic>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::roudi;
+using namespace iox::units::duration_literals;
+
+class ProcessTerminationMonitor_test : public Test
+{
+  public:
+    void SetUp() override
+    {
+        if (!ProcessTerminationMonitor::isSupported())
+        {
+            GTEST_SKIP() << "Process file descriptors are not supported on this platform";
+        }
+    }
+
+    /// @brief creates a child process which terminates immediately; it is reaped with 'reapChildProcess'
+    static uint32_t createTerminatingChildProcess()
+    {
+        const auto pid = fork();
+        if (pid == 0)
+        {
+            _exit(0);
+        }
+        EXPECT_THAT(pid, Gt(0));
+        return static_cast<uint32_t>(pid);
+    }
+
+    static void reapChildProcess(const uint32_t pid)
+    {
+        int status{0};
+        EXPECT_THAT(waitpid(static_cast<pid_t>(pid), &status, 0), Eq(static_cast<pid_t>(pid)));
+    }
+
+    bool waitForTerminationCallback()
+    {
+        deadline_timer timeout{TIMEOUT};
+        while (!m_hasTerminationCallbackBeenCalled && !timeout.hasExpired())
+        {
+            std::this_thread::yield();
+        }
+        return m_hasTerminationCallbackBeenCalled;
+    }
+
+    static constexpr units::Duration TIMEOUT{5_s};
+    std::atomic_bool m_hasTerminationCallbackBeenCalled{false};
+    ProcessTerminationMonitor m_sut{[this] { m_hasTerminationCallbackBeenCalled = true; }};
+};
+
+TEST_F(ProcessTerminationMonitor_test, RunningProcessIsNotReportedAsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "46d75fa5-414c-4731-a38d-5f355e8e9ef5");
+    const auto ownPid = static_cast<uint32_t>(getpid());
+    ASSERT_TRUE(m_sut.add(ownPid));
+
+    constexpr uint64_t NUMBER_OF_UPDATE_INTERVALS{3U};
+    std::this_thread::sleep_for(std::chrono::milliseconds(
+        NUMBER_OF_UPDATE_INTERVALS * PROCESS_TERMINATION_MONITOR_UPDATE_INTERVAL.toMilliseconds()));
+
+    EXPECT_FALSE(m_sut.hasTerminated(ownPid));
+    EXPECT_FALSE(m_hasTerminationCallbackBeenCalled);
+}
+
+TEST_F(ProcessTerminationMonitor_test, TerminatedProcessIsDetected)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7820ce83-3a2e-47bd-9008-3d8f48104864");
+    const auto childPid = createTerminatingChildProcess();
+    ASSERT_TRUE(m_sut.add(childPid));
+
+    EXPECT_TRUE(waitForTerminationCallback());
+    EXPECT_TRUE(m_sut.hasTerminated(childPid));
+
+    reapChildProcess(childPid);
+}
+
+TEST_F(ProcessTerminationMonitor_test, RemovedProcessIsNotReportedAsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0c1725c1-5261-4809-a209-7e7e14f4afa3");
+    const auto childPid = createTerminatingChildProcess();
+    ASSERT_TRUE(m_sut.add(childPid));
+    ASSERT_TRUE(waitForTerminationCallback());
+
+    m_sut.remove(childPid);
+
+    EXPECT_FALSE(m_sut.hasTerminated(childPid));
+    reapChildProcess(childPid);
+}
+
+TEST_F(ProcessTerminationMonitor_test, AddingNonExistingProcessFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b98a6514-7180-4918-910c-57722ba6fa7e");
+    const auto childPid = createTerminatingChildProcess();
+    reapChildProcess(childPid);
+
+    EXPECT_FALSE(m_sut.add(childPid));
+    EXPECT_FALSE(m_sut.hasTerminated(childPid));
+}
+
+TEST_F(ProcessTerminationMonitor_test, UnknownProcessIsNotReportedAsTerminated)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d616a369-f7d7-45c6-b59d-b67940fc0b12");
+    EXPECT_FALSE(m_sut.hasTerminated(static_cast<uint32_t>(getpid())));
+}
+} // namespace
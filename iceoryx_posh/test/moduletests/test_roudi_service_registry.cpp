@@ -530,6 +530,60 @@ TYPED_TEST(ServiceRegistry_test, AddingMultipleServiceDescriptionAndRemovingAllD
     EXPECT_THAT(this->searchResult.size(), Eq(0));
 }
 
+TYPED_TEST(ServiceRegistry_test, FindWithoutWildcardsFindsOnlyTheExactMatchAmongServicesWithCommonPrefix)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f20d63d6-39aa-4574-bd22-d61de5624d6f");
+    const std::string prefix(iox::capro::IdString_t::capacity() - 1U, 'x');
+    for (char suffix = 'a'; suffix <= 'e'; ++suffix)
+    {
+        iox::capro::IdString_t service(iox::TruncateToCapacity, (prefix + suffix).c_str());
+        ASSERT_FALSE(this->sut.add(iox::capro::ServiceDescription(service, "instance", "event")).has_error());
+    }
+
+    iox::capro::IdString_t searchedService(iox::TruncateToCapacity, (prefix + 'c').c_str());
+    this->find(searchedService, iox::capro::IdString_t("instance"), iox::capro::IdString_t("event"));
+
+    ASSERT_THAT(this->searchResult.size(), Eq(1));
+    EXPECT_THAT(this->searchResult[0].serviceDescription.getServiceIDString(), Eq(searchedService));
+}
+
+TYPED_TEST(ServiceRegistry_test, FindWithoutWildcardsFindsAllEntriesAfterInterleavedRemovalsInAFullRegistry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a3f9e21-4c7b-4d0e-b5a8-2f1c7e9d3b64");
+    auto service = [](const uint32_t i) {
+        return ServiceDescription(
+            "Service", iox::capro::IdString_t(iox::TruncateToCapacity, std::to_string(i).c_str()), "Event");
+    };
+    auto isFound = [&](const uint32_t i) {
+        this->find(service(i).getServiceIDString(), service(i).getInstanceIDString(), service(i).getEventIDString());
+        return this->searchResult.size() == 1U && this->searchResult[0].serviceDescription == service(i);
+    };
+
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; ++i)
+    {
+        ASSERT_FALSE(this->sut.add(service(i)).has_error());
+    }
+    // the removal shifts colliding entries of the hash index, which must stay reachable
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; i += 3U)
+    {
+        this->sut.remove(service(i));
+    }
+
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; ++i)
+    {
+        EXPECT_THAT(isFound(i), Eq(i % 3U != 0U)) << "service " << i;
+    }
+
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; i += 3U)
+    {
+        ASSERT_FALSE(this->sut.add(service(i)).has_error());
+    }
+    for (uint32_t i = 0U; i < ServiceRegistry::CAPACITY; ++i)
+    {
+        EXPECT_TRUE(isFound(i)) << "service " << i;
+    }
+}
+
 template <typename T>
 T uniform(T max)
 {
@@ -0,0 +1,176 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+
+constexpr uint64_t NUMBER_OF_WAKE_UPS{500U};
+
+int64_t nowInNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int64_t threadCpuTimeInNanoseconds()
+{
+    timespec cpuTime{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime);
+    return cpuTime.tv_sec * 1000000000 + cpuTime.tv_nsec;
+}
+
+void publishSample(UntypedPublisher& publisher, const uint64_t value)
+{
+    publisher.loan(sizeof(uint64_t))
+        .and_then([&](auto* userPayload) {
+            *static_cast<uint64_t*>(userPayload) = value;
+            publisher.publish(userPayload);
+        })
+        .or_else([](auto) { std::cerr << "Could not loan sample!" << std::endl; });
+}
+
+void waitUntil(const std::atomic<uint64_t>& counter, const uint64_t value)
+{
+    while (counter.load(std::memory_order_acquire) < value)
+    {
+        std::this_thread::yield();
+    }
+}
+
+/// @brief Measures the time from a subscriber freeing a slot in its full queue until the publish call of the blocked
+/// publisher returns and the CPU time the publisher spends while it is blocked
+void benchmark(const std::chrono::microseconds blockingDuration,
+               UntypedPublisher& publisher,
+               UntypedSubscriber& subscriber)
+{
+    // fills the queue with capacity one, every further publish blocks until the subscriber takes the sample
+    publishSample(publisher, 0U);
+
+    std::atomic<uint64_t> numberOfBlockedPublishes{0U};
+    std::atomic<uint64_t> numberOfFinishedPublishes{0U};
+    std::atomic<int64_t> publishFinishedTime{0};
+    std::vector<int64_t> blockedCpuTimes;
+    blockedCpuTimes.reserve(NUMBER_OF_WAKE_UPS);
+
+    std::thread publisherThread([&] {
+        for (uint64_t i = 1U; i <= NUMBER_OF_WAKE_UPS; ++i)
+        {
+            numberOfBlockedPublishes.store(i, std::memory_order_release);
+            const auto cpuTimeStart = threadCpuTimeInNanoseconds();
+            publishSample(publisher, i);
+            publishFinishedTime.store(nowInNanoseconds(), std::memory_order_relaxed);
+            blockedCpuTimes.push_back(threadCpuTimeInNanoseconds() - cpuTimeStart);
+            numberOfFinishedPublishes.store(i, std::memory_order_release);
+        }
+    });
+
+    std::vector<int64_t> wakeUpLatencies;
+    wakeUpLatencies.reserve(NUMBER_OF_WAKE_UPS);
+    for (uint64_t i = 1U; i <= NUMBER_OF_WAKE_UPS; ++i)
+    {
+        waitUntil(numberOfBlockedPublishes, i);
+        std::this_thread::sleep_for(blockingDuration);
+
+        const auto slotFreedTime = nowInNanoseconds();
+        auto takeResult = subscriber.take();
+        if (takeResult.has_error())
+        {
+            std::cerr << "Could not take sample!" << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+        subscriber.release(takeResult.value());
+
+        waitUntil(numberOfFinishedPublishes, i);
+        wakeUpLatencies.push_back(publishFinishedTime.load(std::memory_order_relaxed) - slotFreedTime);
+    }
+    publisherThread.join();
+
+    // empties the queue for the next run
+    while (!subscriber.take().and_then([&](const void* userPayload) { subscriber.release(userPayload); }).has_error())
+    {
+    }
+
+    std::sort(wakeUpLatencies.begin(), wakeUpLatencies.end());
+    int64_t blockedCpuTimeSum{0};
+    for (const auto blockedCpuTime : blockedCpuTimes)
+    {
+        blockedCpuTimeSum += blockedCpuTime;
+    }
+    const auto blockedTimeSum = static_cast<int64_t>(NUMBER_OF_WAKE_UPS)
+                                * std::chrono::duration_cast<std::chrono::nanoseconds>(blockingDuration).count();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(6) << blockingDuration.count() << " (microsecs blocked) : " << std::setw(8)
+              << wakeUpLatencies[NUMBER_OF_WAKE_UPS / 2U] << " (p50 wake-up nanosecs) : " << std::setw(8)
+              << wakeUpLatencies[NUMBER_OF_WAKE_UPS * 99U / 100U] << " (p99 wake-up nanosecs) : " << std::setw(6)
+              << std::fixed << std::setprecision(2)
+              << 100.0 * static_cast<double>(blockedCpuTimeSum) / static_cast<double>(blockedTimeSum)
+              << " (% CPU while blocked)" << std::endl;
+}
+
+int main()
+{
+    auto config = MinimalIceoryxConfigBuilder().payloadChunkSize(256U).payloadChunkCount(1024U).create();
+    RouDiEnv roudi{config};
+
+    runtime::PoshRuntime::initRuntime("iox-bm-blocked-publisher-latency");
+
+    const capro::ServiceDescription service{"Benchmark", "BlockedPublisher", "Latency"};
+    PublisherOptions publisherOptions;
+    publisherOptions.subscriberTooSlowPolicy = ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.queueFullPolicy = QueueFullPolicy::BLOCK_PRODUCER;
+
+    UntypedPublisher publisher{service, publisherOptions};
+    UntypedSubscriber subscriber{service, subscriberOptions};
+    roudi.triggerDiscoveryLoopAndWaitToFinish();
+
+    if (!publisher.hasSubscribers())
+    {
+        std::cerr << "Subscriber could not connect to the publisher!" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Measuring " << NUMBER_OF_WAKE_UPS << " wake-ups of a publisher blocked by a full subscriber queue"
+              << std::endl;
+    for (const auto blockingDuration : {std::chrono::microseconds(100),
+                                        std::chrono::microseconds(1000),
+                                        std::chrono::microseconds(10000)})
+    {
+        benchmark(blockingDuration, publisher, subscriber);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/bump_allocator.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+constexpr uint32_t USER_PAYLOAD_SIZE{64U};
+constexpr uint32_t MAX_NUMBER_OF_SUBSCRIBERS{128U};
+constexpr uint32_t SUBSCRIBER_QUEUE_CAPACITY{16U};
+constexpr uint64_t NUMBER_OF_SAMPLES{100000U};
+constexpr uint64_t MEMORY_SIZE{1U << 20U};
+
+struct ChunkQueueConfig
+{
+    static constexpr uint64_t MAX_QUEUE_CAPACITY = SUBSCRIBER_QUEUE_CAPACITY;
+};
+
+struct ChunkDistributorConfig
+{
+    static constexpr uint32_t MAX_QUEUES = MAX_NUMBER_OF_SUBSCRIBERS;
+    static constexpr uint64_t MAX_HISTORY_CAPACITY = 1U;
+};
+
+using ChunkQueueData_t = ChunkQueueData<ChunkQueueConfig, ThreadSafePolicy>;
+using ChunkDistributorData_t =
+    ChunkDistributorData<ChunkDistributorConfig, ThreadSafePolicy, ChunkQueuePusher<ChunkQueueData_t>>;
+using ChunkDistributor_t = ChunkDistributor<ChunkDistributorData_t>;
+
+class ChunkSource
+{
+  public:
+    SharedChunk allocateChunk() noexcept
+    {
+        auto* chunkManagement = static_cast<ChunkManagement*>(m_chunkManagementPool.getChunk());
+        auto* chunkHeader = new (m_mempool.getChunk()) ChunkHeader(m_mempool.getChunkSize(), m_chunkSettings);
+        new (chunkManagement) ChunkManagement{chunkHeader, &m_mempool, &m_chunkManagementPool};
+        return SharedChunk(chunkManagement);
+    }
+
+  private:
+    std::unique_ptr<uint8_t[]> m_memory{new uint8_t[MEMORY_SIZE]};
+    BumpAllocator m_allocator{m_memory.get(), MEMORY_SIZE};
+    ChunkSettings m_chunkSettings{
+        ChunkSettings::create(USER_PAYLOAD_SIZE, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).expect("Valid chunk settings")};
+    MemPool m_mempool{m_chunkSettings.requiredChunkSize(), 2U * SUBSCRIBER_QUEUE_CAPACITY, m_allocator, m_allocator};
+    MemPool m_chunkManagementPool{sizeof(ChunkManagement), 2U * SUBSCRIBER_QUEUE_CAPACITY, m_allocator, m_allocator};
+};
+
+/// @brief publishes the chunks in rounds of SUBSCRIBER_QUEUE_CAPACITY samples; only the publishing is measured while
+/// the queues are drained between the rounds
+template <typename Deliver>
+void benchmark(const char* name, const uint32_t numberOfSubscribers, Deliver deliver)
+{
+    ChunkSource chunkSource;
+    std::vector<std::unique_ptr<ChunkQueueData_t>> queues;
+    for (uint32_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        queues.emplace_back(std::make_unique<ChunkQueueData_t>(QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                                               VariantQueueTypes::SoFi_SingleProducerSingleConsumer));
+    }
+
+    ChunkDistributorData_t distributorData{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
+    ChunkDistributor_t distributor{&distributorData};
+    for (auto& queue : queues)
+    {
+        distributor.tryAddQueue(queue.get()).expect("Adding queue");
+    }
+
+    std::chrono::nanoseconds publishDuration{0};
+    uint64_t numberOfReceivedSamples{0U};
+    for (uint64_t sample = 0U; sample < NUMBER_OF_SAMPLES; sample += SUBSCRIBER_QUEUE_CAPACITY)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0U; i < SUBSCRIBER_QUEUE_CAPACITY; ++i)
+        {
+            deliver(distributor, queues, chunkSource.allocateChunk());
+        }
+        publishDuration += std::chrono::steady_clock::now() - start;
+
+        for (auto& queue : queues)
+        {
+            ChunkQueuePopper<ChunkQueueData_t> popper(queue.get());
+            while (popper.tryPop().has_value())
+            {
+                ++numberOfReceivedSamples;
+            }
+        }
+    }
+
+    const auto publishedSamples = NUMBER_OF_SAMPLES - (NUMBER_OF_SAMPLES % SUBSCRIBER_QUEUE_CAPACITY);
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(18) << name << " : " << std::setw(3) << numberOfSubscribers << " (subscribers) : "
+              << std::setw(8) << static_cast<uint64_t>(publishDuration.count()) / publishedSamples
+              << " (nanosecs/publish) : received " << numberOfReceivedSamples << std::endl;
+}
+
+int main()
+{
+    for (uint32_t numberOfSubscribers : {1U, 8U, 32U, 128U})
+    {
+        // the former fan-out with one reference counter update per queue
+        benchmark("per-queue update",
+                  numberOfSubscribers,
+                  [](ChunkDistributor_t& distributor, auto& queues, SharedChunk chunk) {
+                      for (auto& queue : queues)
+                      {
+                          ChunkQueuePusher<ChunkQueueData_t>(queue.get()).push(chunk);
+                      }
+                      distributor.addToHistoryWithoutDelivery(chunk);
+                  });
+
+        benchmark("single update",
+                  numberOfSubscribers,
+                  [](ChunkDistributor_t& distributor, auto&, SharedChunk chunk) {
+                      distributor.deliverToAllStoredQueues(chunk);
+                  });
+    }
+
+    return 0;
+}
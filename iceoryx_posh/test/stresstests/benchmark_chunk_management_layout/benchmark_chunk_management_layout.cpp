@@ -0,0 +1,100 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env_node_builder.hpp"
+#include "iox/posh/experimental/node.hpp"
+#include "iox/vector.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+using namespace iox;
+using namespace iox::posh::experimental;
+using namespace iox::roudi_env;
+
+constexpr uint64_t USER_PAYLOAD_SIZE{64U};
+constexpr uint64_t MAX_NUMBER_OF_SUBSCRIBERS{8U};
+constexpr uint32_t CHUNK_COUNT{1024U};
+constexpr uint64_t NUMBER_OF_SAMPLES{1000000U};
+
+void benchmark(const char* name,
+               const uint16_t domainId,
+               const mepoo::ChunkManagementLayout layout,
+               const uint64_t numberOfSubscribers)
+{
+    auto config =
+        MinimalIceoryxConfigBuilder().payloadChunkSize(USER_PAYLOAD_SIZE).payloadChunkCount(CHUNK_COUNT).create();
+    config.m_sharedMemorySegments.front().m_mempoolConfig.m_chunkManagementLayout = layout;
+    RouDiEnv roudi{DomainId{domainId}, config};
+
+    auto node = RouDiEnvNodeBuilder("benchmark").domain_id(DomainId{domainId}).create().expect("Creating node");
+
+    const capro::ServiceDescription service{"Benchmark", "ChunkManagement", "Layout"};
+    auto publisher = node.publisher(service).create().expect("Creating publisher");
+    vector<unique_ptr<UntypedSubscriber>, MAX_NUMBER_OF_SUBSCRIBERS> subscribers;
+    for (uint64_t i = 0U; i < numberOfSubscribers; ++i)
+    {
+        subscribers.emplace_back(node.subscriber(service).create().expect("Creating subscriber"));
+    }
+
+    uint64_t checksum{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        publisher->loan(USER_PAYLOAD_SIZE)
+            .and_then([&](auto* userPayload) {
+                std::memcpy(userPayload, &i, sizeof(i));
+                publisher->publish(userPayload);
+            })
+            .or_else([](auto) { std::cerr << "Could not loan chunk!" << std::endl; });
+
+        for (auto& subscriber : subscribers)
+        {
+            subscriber->take().and_then([&](const void* userPayload) {
+                // the ChunkHeader is read like a receiving application would do it
+                checksum += mepoo::ChunkHeader::fromUserPayload(userPayload)->sequenceNumber();
+                subscriber->release(userPayload);
+            });
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const auto durationNanoseconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(14) << name << " : " << std::setw(3) << numberOfSubscribers << " (subscribers) : "
+              << std::setw(8) << durationNanoseconds / NUMBER_OF_SAMPLES << " (nanosecs/sample) : checksum "
+              << checksum << std::endl;
+}
+
+int main()
+{
+    uint16_t domainId{1U};
+    for (uint64_t numberOfSubscribers = 1U; numberOfSubscribers <= MAX_NUMBER_OF_SUBSCRIBERS; numberOfSubscribers *= 2U)
+    {
+        benchmark("separate pool", domainId++, mepoo::ChunkManagementLayout::SEPARATE_POOL, numberOfSubscribers);
+        benchmark("co-located", domainId++, mepoo::ChunkManagementLayout::CO_LOCATED, numberOfSubscribers);
+    }
+
+    return 0;
+}
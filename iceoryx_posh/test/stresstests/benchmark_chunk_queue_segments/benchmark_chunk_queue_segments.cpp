@@ -0,0 +1,119 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
+#include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iox/bump_allocator.hpp"
+#include "iox/relative_pointer.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace iox;
+using namespace iox::mepoo;
+using namespace iox::popo;
+
+constexpr uint64_t NUMBER_OF_ITERATIONS{1000000U};
+constexpr uint64_t MEMORY_SIZE{1U << 20U};
+constexpr uint64_t DUMMY_SEGMENT_SIZE{64U};
+constexpr uint64_t CHUNK_SIZE{128U};
+constexpr uint32_t NUMBER_OF_CHUNKS{16U};
+
+using ChunkQueueData_t = ChunkQueueData<DefaultChunkQueueConfig, ThreadSafePolicy>;
+
+uint64_t durationPerIterationInNanoseconds(const std::chrono::steady_clock::time_point start)
+{
+    const auto duration = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count())
+           / NUMBER_OF_ITERATIONS;
+}
+
+void benchmark(const uint64_t numberOfSegments)
+{
+    // the chunk memory is registered last and therefore the search of its segment has to check all other segments
+    std::vector<std::unique_ptr<uint8_t[]>> dummySegments;
+    for (uint64_t i = 1U; i < numberOfSegments; ++i)
+    {
+        dummySegments.emplace_back(new uint8_t[DUMMY_SEGMENT_SIZE]);
+        UntypedRelativePointer::registerPtr(dummySegments.back().get(), DUMMY_SEGMENT_SIZE)
+            .expect("Registering dummy segment");
+    }
+    std::unique_ptr<uint8_t[]> memory{new uint8_t[MEMORY_SIZE]};
+    UntypedRelativePointer::registerPtr(memory.get(), MEMORY_SIZE).expect("Registering chunk segment");
+
+    // the chunks must be released before the segments are unregistered
+    {
+        BumpAllocator allocator{memory.get(), MEMORY_SIZE};
+        MePooConfig mempoolConfig;
+        mempoolConfig.addMemPool({CHUNK_SIZE, NUMBER_OF_CHUNKS});
+        MemoryManager memoryManager;
+        memoryManager.configureMemoryManager(mempoolConfig, allocator, allocator);
+
+        ChunkQueueData_t queueData{QueueFullPolicy::DISCARD_OLDEST_DATA,
+                                   VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+        ChunkQueuePusher<ChunkQueueData_t> pusher{&queueData};
+        ChunkQueuePopper<ChunkQueueData_t> popper{&queueData};
+
+        auto chunkSettings = ChunkSettings::create(sizeof(uint64_t), alignof(uint64_t)).expect("Valid chunk settings");
+        auto chunk = memoryManager.getChunk(chunkSettings).expect("Obtaining chunk");
+
+        uint64_t checksum{0U};
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            pusher.push(chunk);
+            popper.tryPop().and_then(
+                [&](auto& poppedChunk) { checksum += poppedChunk.getChunkHeader()->chunkSize(); });
+        }
+        const auto pushPopDuration = durationPerIterationInNanoseconds(start);
+
+        // the former conversion of a ChunkManagement pointer to its shared memory representation
+        auto* chunkManagement = chunk.release();
+        start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0U; i < NUMBER_OF_ITERATIONS; ++i)
+        {
+            checksum += RelativePointer<ChunkManagement>(chunkManagement).getId();
+        }
+        const auto segmentSearchDuration = durationPerIterationInNanoseconds(start);
+        chunk = SharedChunk(chunkManagement);
+
+        // Not using iceoryx logger due to width requirements
+        std::cout << std::setw(5) << numberOfSegments << " (segments) : " << std::setw(6) << pushPopDuration
+                  << " (nanosecs/push+pop) : " << std::setw(6) << segmentSearchDuration
+                  << " (nanosecs/segment search) : checksum " << checksum << std::endl;
+    }
+
+    UntypedRelativePointer::unregisterAll();
+}
+
+int main()
+{
+    for (uint64_t numberOfSegments : {1U, 16U, 128U, 1024U})
+    {
+        benchmark(numberOfSegments);
+    }
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+
+#include "iceoryx_posh/popo/rpc_header.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+
+constexpr uint64_t NUMBER_OF_REQUESTS{100000U};
+constexpr uint64_t MAX_REQUESTS_IN_FLIGHT{64U};
+constexpr uint64_t NUMBER_OF_KEYS{MAX_REQUESTS_IN_FLIGHT};
+constexpr uint64_t PROCESSING_ITERATIONS{2000U};
+constexpr uint32_t MAX_NUMBER_OF_SERVERS{4U};
+
+const capro::ServiceDescription SERVICE{"Benchmark", "ClientLoadBalancing", "Server"};
+
+const char* toString(const LoadBalancingPolicy policy)
+{
+    switch (policy)
+    {
+    case LoadBalancingPolicy::ROUND_ROBIN:
+        return "round robin";
+    case LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS:
+        return "least outstanding";
+    case LoadBalancingPolicy::STICKY_BY_KEY:
+        return "sticky by key";
+    }
+    return "unknown";
+}
+
+/// @brief Simulates the computation which is required to answer a request
+uint64_t processRequest(uint64_t value)
+{
+    for (uint64_t i = 0U; i < PROCESSING_ITERATIONS; ++i)
+    {
+        value = value * 6364136223846793005U + 1442695040888963407U;
+    }
+    return value;
+}
+
+void serve(UntypedServer& server, std::atomic_bool& keepRunning)
+{
+    while (keepRunning.load(std::memory_order_relaxed))
+    {
+        auto takeResult = server.take();
+        if (takeResult.has_error())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const void* requestPayload = takeResult.value();
+        const uint64_t response = processRequest(*static_cast<const uint64_t*>(requestPayload));
+
+        server.loan(RequestHeader::fromPayload(requestPayload), sizeof(uint64_t), alignof(uint64_t))
+            .and_then([&](auto* responsePayload) {
+                *static_cast<uint64_t*>(responsePayload) = response;
+                server.send(responsePayload).or_else([](auto) {
+                    std::cerr << "Could not send response!" << std::endl;
+                });
+            })
+            .or_else([](auto) { std::cerr << "Could not loan response!" << std::endl; });
+
+        server.releaseRequest(requestPayload);
+    }
+}
+
+bool benchmark(RouDiEnv& roudi, const uint32_t numberOfServers, const LoadBalancingPolicy policy)
+{
+    ServerOptions serverOptions;
+    serverOptions.allowMultipleServers = true;
+    std::vector<std::unique_ptr<UntypedServer>> servers;
+    for (uint32_t i = 0U; i < numberOfServers; ++i)
+    {
+        servers.emplace_back(std::make_unique<UntypedServer>(SERVICE, serverOptions));
+    }
+
+    ClientOptions clientOptions;
+    clientOptions.loadBalancingPolicy = policy;
+    UntypedClient client{SERVICE, clientOptions};
+    roudi.triggerDiscoveryLoopAndWaitToFinish();
+
+    if (client.getConnectionState() != ConnectionState::CONNECTED)
+    {
+        std::cerr << "Client could not connect to the servers!" << std::endl;
+        return false;
+    }
+
+    std::atomic_bool keepRunning{true};
+    std::vector<std::thread> serverThreads;
+    for (auto& server : servers)
+    {
+        serverThreads.emplace_back([&] { serve(*server, keepRunning); });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t numberOfSentRequests{0U};
+    uint64_t numberOfReceivedResponses{0U};
+    while (numberOfReceivedResponses < NUMBER_OF_REQUESTS)
+    {
+        while (numberOfSentRequests < NUMBER_OF_REQUESTS
+               && numberOfSentRequests - numberOfReceivedResponses < MAX_REQUESTS_IN_FLIGHT)
+        {
+            auto loanResult = client.loan(sizeof(uint64_t), alignof(uint64_t));
+            if (loanResult.has_error())
+            {
+                break;
+            }
+            *static_cast<uint64_t*>(loanResult.value()) = numberOfSentRequests;
+            if (client.send(loanResult.value(), numberOfSentRequests % NUMBER_OF_KEYS).has_error())
+            {
+                break;
+            }
+            ++numberOfSentRequests;
+        }
+
+        bool hasReceivedResponse{false};
+        while (true)
+        {
+            auto takeResult = client.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            client.releaseResponse(takeResult.value());
+            ++numberOfReceivedResponses;
+            hasReceivedResponse = true;
+        }
+
+        if (!hasReceivedResponse)
+        {
+            std::this_thread::yield();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    keepRunning.store(false, std::memory_order_relaxed);
+    for (auto& t : serverThreads)
+    {
+        t.join();
+    }
+
+    const auto durationNanoseconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const double requestsPerSecond =
+        static_cast<double>(NUMBER_OF_REQUESTS) * 1e9 / static_cast<double>(durationNanoseconds);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(18) << toString(policy) << " : " << std::setw(2) << numberOfServers << " (servers) : "
+              << std::setw(8) << durationNanoseconds / NUMBER_OF_REQUESTS << " (nanosecs/request) : " << std::setw(12)
+              << std::fixed << std::setprecision(0) << requestsPerSecond << " (requests/s)" << std::endl;
+
+    return true;
+}
+
+int main()
+{
+    auto config = MinimalIceoryxConfigBuilder().payloadChunkSize(256U).payloadChunkCount(1024U).create();
+    RouDiEnv roudi{config};
+
+    runtime::PoshRuntime::initRuntime("iox-bm-client-load-balancing");
+
+    std::cout << "Processing " << NUMBER_OF_REQUESTS << " requests with " << MAX_REQUESTS_IN_FLIGHT
+              << " requests in flight on " << std::thread::hardware_concurrency() << " CPU cores" << std::endl;
+    for (const auto policy : {LoadBalancingPolicy::ROUND_ROBIN,
+                              LoadBalancingPolicy::LEAST_OUTSTANDING_REQUESTS,
+                              LoadBalancingPolicy::STICKY_BY_KEY})
+    {
+        for (uint32_t numberOfServers = 1U; numberOfServers <= MAX_NUMBER_OF_SERVERS; numberOfServers *= 2U)
+        {
+            if (!benchmark(roudi, numberOfServers, policy))
+            {
+                return EXIT_FAILURE;
+            }
+            // let RouDi remove the ports of the previous run
+            roudi.triggerDiscoveryLoopAndWaitToFinish();
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env_node_builder.hpp"
+#include "iox/posh/experimental/cross_domain_channel.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace iox;
+using namespace iox::posh::experimental;
+using namespace iox::roudi_env;
+
+constexpr uint64_t MAX_USER_PAYLOAD_SIZE{1024U * 1024U};
+constexpr uint64_t BATCH_SIZE{16U};
+constexpr uint64_t NUMBER_OF_BATCHES{2000U};
+
+/// @brief The copy path of a gateway to an external transport; the chunk is copied into the transport buffer and
+/// afterwards from the transport buffer into a loaned chunk
+void forwardViaIntermediateBuffer(UntypedSubscriber& subscriber,
+                                  UntypedPublisher& publisher,
+                                  std::vector<uint8_t>& transportBuffer)
+{
+    while (true)
+    {
+        auto takeResult = subscriber.take();
+        if (takeResult.has_error())
+        {
+            return;
+        }
+        const void* userPayload = takeResult.value();
+        const auto userPayloadSize = mepoo::ChunkHeader::fromUserPayload(userPayload)->userPayloadSize();
+        std::memcpy(transportBuffer.data(), userPayload, userPayloadSize);
+        subscriber.release(userPayload);
+
+        publisher.loan(userPayloadSize)
+            .and_then([&](auto* targetUserPayload) {
+                std::memcpy(targetUserPayload, transportBuffer.data(), userPayloadSize);
+                publisher.publish(targetUserPayload);
+            })
+            .or_else([](auto) { std::cerr << "Could not loan chunk in target domain!" << std::endl; });
+    }
+}
+
+template <typename Forward>
+void benchmark(const char* name,
+               const uint64_t userPayloadSize,
+               UntypedPublisher& sourcePublisher,
+               UntypedSubscriber& targetSubscriber,
+               Forward forward)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t batch = 0U; batch < NUMBER_OF_BATCHES; ++batch)
+    {
+        for (uint64_t i = 0U; i < BATCH_SIZE; ++i)
+        {
+            sourcePublisher.loan(userPayloadSize)
+                .and_then([&](auto* userPayload) {
+                    std::memset(userPayload, static_cast<int>(i), userPayloadSize);
+                    sourcePublisher.publish(userPayload);
+                })
+                .or_else([](auto) { std::cerr << "Could not loan chunk in source domain!" << std::endl; });
+        }
+
+        forward();
+
+        while (true)
+        {
+            auto takeResult = targetSubscriber.take();
+            if (takeResult.has_error())
+            {
+                break;
+            }
+            targetSubscriber.release(takeResult.value());
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    const auto durationNanoseconds =
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    const uint64_t numberOfSamples = NUMBER_OF_BATCHES * BATCH_SIZE;
+    const double gigaBytesPerSecond =
+        static_cast<double>(numberOfSamples * userPayloadSize) / static_cast<double>(durationNanoseconds);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(24) << name << " : " << std::setw(8) << userPayloadSize << " (bytes) : " << std::setw(8)
+              << durationNanoseconds / numberOfSamples << " (nanosecs/sample) : " << std::setw(8) << std::fixed
+              << std::setprecision(3) << gigaBytesPerSecond << " (GB/s)" << std::endl;
+}
+
+int main()
+{
+    constexpr uint16_t SOURCE_DOMAIN_ID{1U};
+    constexpr uint16_t TARGET_DOMAIN_ID{2U};
+
+    auto config = MinimalIceoryxConfigBuilder()
+                      .payloadChunkSize(MAX_USER_PAYLOAD_SIZE + sizeof(mepoo::ChunkHeader))
+                      .payloadChunkCount(4U * BATCH_SIZE)
+                      .create();
+    RouDiEnv sourceRouDi{DomainId{SOURCE_DOMAIN_ID}, config};
+    RouDiEnv targetRouDi{DomainId{TARGET_DOMAIN_ID}, config};
+
+    auto sourceNode =
+        RouDiEnvNodeBuilder("source").domain_id(DomainId{SOURCE_DOMAIN_ID}).create().expect("Creating source node");
+    auto targetNode =
+        RouDiEnvNodeBuilder("target").domain_id(DomainId{TARGET_DOMAIN_ID}).create().expect("Creating target node");
+
+    const capro::ServiceDescription service{"Benchmark", "CrossDomain", "Forwarding"};
+    auto sourcePublisher = sourceNode.publisher(service).create().expect("Creating source publisher");
+    auto targetSubscriber = targetNode.subscriber(service).queue_capacity(BATCH_SIZE).create().expect("Subscriber");
+
+    CrossDomainChannel::Options options;
+    options.sourceNode = &sourceNode;
+    options.targetNode = &targetNode;
+    options.queueCapacity = BATCH_SIZE;
+    auto channel = CrossDomainChannel::create(service, options).expect("Creating cross domain channel");
+
+    std::vector<uint8_t> transportBuffer(MAX_USER_PAYLOAD_SIZE);
+
+    for (uint64_t userPayloadSize = 64U; userPayloadSize <= MAX_USER_PAYLOAD_SIZE; userPayloadSize *= 16U)
+    {
+        benchmark("intermediate buffer", userPayloadSize, *sourcePublisher.get(), *targetSubscriber.get(), [&] {
+            forwardViaIntermediateBuffer(
+                *channel.getSourceSubscriber(), *channel.getTargetPublisher(), transportBuffer);
+        });
+        benchmark("cross domain channel", userPayloadSize, *sourcePublisher.get(), *targetSubscriber.get(), [&] {
+            channel.forward();
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/popo/rpc_header.hpp"
+#include "iceoryx_posh/popo/untyped_client.hpp"
+#include "iceoryx_posh/popo/untyped_server.hpp"
+#include "iceoryx_posh/roudi_env/minimal_iceoryx_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace iox;
+using namespace iox::popo;
+using namespace iox::roudi_env;
+
+constexpr uint64_t NUMBER_OF_ROUND_TRIPS{50000U};
+constexpr uint64_t MAX_NUMBER_OF_CLIENTS{128U};
+
+void respond(UntypedServer& server, std::atomic_bool& keepRunning)
+{
+    while (keepRunning.load(std::memory_order_relaxed))
+    {
+        auto takeResult = server.take();
+        if (takeResult.has_error())
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const void* requestPayload = takeResult.value();
+        server.loan(RequestHeader::fromPayload(requestPayload), sizeof(uint64_t), alignof(uint64_t))
+            .and_then([&](auto* responsePayload) {
+                *static_cast<uint64_t*>(responsePayload) = *static_cast<const uint64_t*>(requestPayload);
+                server.send(responsePayload).or_else([](auto) {
+                    std::cerr << "Could not send response!" << std::endl;
+                });
+            })
+            .or_else([](auto) { std::cerr << "Could not loan response!" << std::endl; });
+
+        server.releaseRequest(requestPayload);
+    }
+}
+
+/// @brief Measures the round trip time of the last connected client, i.e. the client whose response queue is found
+/// last when the server searches the stored queues linearly
+void benchmark(const uint64_t numberOfClients, UntypedServer& server, UntypedClient& client)
+{
+    std::atomic_bool keepRunning{true};
+    std::thread responder([&] { respond(server, keepRunning); });
+
+    std::vector<uint64_t> roundTripTimes;
+    roundTripTimes.reserve(NUMBER_OF_ROUND_TRIPS);
+    for (uint64_t i = 0U; i < NUMBER_OF_ROUND_TRIPS; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto loanResult = client.loan(sizeof(uint64_t), alignof(uint64_t));
+        if (loanResult.has_error())
+        {
+            std::cerr << "Could not loan request!" << std::endl;
+            break;
+        }
+        *static_cast<uint64_t*>(loanResult.value()) = i;
+        if (client.send(loanResult.value()).has_error())
+        {
+            std::cerr << "Could not send request!" << std::endl;
+            break;
+        }
+
+        while (true)
+        {
+            auto takeResult = client.take();
+            if (!takeResult.has_error())
+            {
+                client.releaseResponse(takeResult.value());
+                break;
+            }
+            std::this_thread::yield();
+        }
+        auto end = std::chrono::steady_clock::now();
+        roundTripTimes.push_back(
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+
+    keepRunning.store(false, std::memory_order_relaxed);
+    responder.join();
+
+    if (roundTripTimes.empty())
+    {
+        return;
+    }
+
+    std::sort(roundTripTimes.begin(), roundTripTimes.end());
+    uint64_t sum{0U};
+    for (const auto roundTripTime : roundTripTimes)
+    {
+        sum += roundTripTime;
+    }
+    const auto numberOfSamples = roundTripTimes.size();
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(4) << numberOfClients << " (clients) : " << std::setw(8) << sum / numberOfSamples
+              << " (avg nanosecs) : " << std::setw(8) << roundTripTimes[numberOfSamples / 2U]
+              << " (p50 nanosecs) : " << std::setw(8) << roundTripTimes[numberOfSamples * 99U / 100U]
+              << " (p99 nanosecs)" << std::endl;
+}
+
+int main()
+{
+    auto config = MinimalIceoryxConfigBuilder().payloadChunkSize(256U).payloadChunkCount(1024U).create();
+    RouDiEnv roudi{config};
+
+    runtime::PoshRuntime::initRuntime("iox-bm-request-response-latency");
+
+    const capro::ServiceDescription service{"Benchmark", "RequestResponse", "Latency"};
+    ClientOptions clientOptions;
+    clientOptions.responseQueueCapacity = 4U;
+
+    UntypedServer server{service};
+    std::vector<std::unique_ptr<UntypedClient>> clients;
+
+    std::cout << "Measuring " << NUMBER_OF_ROUND_TRIPS << " request/response round trips of the last connected client"
+              << std::endl;
+    for (uint64_t numberOfClients = 1U; numberOfClients <= MAX_NUMBER_OF_CLIENTS; numberOfClients *= 4U)
+    {
+        while (clients.size() < numberOfClients)
+        {
+            clients.emplace_back(std::make_unique<UntypedClient>(service, clientOptions));
+        }
+        roudi.triggerDiscoveryLoopAndWaitToFinish();
+
+        auto& client = *clients.back();
+        if (client.getConnectionState() != ConnectionState::CONNECTED)
+        {
+            std::cerr << "Client could not connect to the server!" << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        benchmark(numberOfClients, server, client);
+    }
+
+    return EXIT_SUCCESS;
+}
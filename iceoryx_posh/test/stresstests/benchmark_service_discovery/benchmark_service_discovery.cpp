@@ -0,0 +1,132 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/algorithm.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace iox;
+using namespace iox::capro;
+
+constexpr uint64_t MAX_NUMBER_OF_SERVICES{256U};
+constexpr uint64_t NUMBER_OF_SERVICES{
+    algorithm::minVal(static_cast<uint64_t>(roudi::ServiceRegistry::CAPACITY), MAX_NUMBER_OF_SERVICES)};
+constexpr uint64_t NUMBER_OF_LOOKUPS{1U << 14U};
+
+IdString_t createId(const std::string& prefix, const uint64_t index)
+{
+    const auto suffix = std::to_string(index);
+    const auto prefixLength = IdString_t::capacity() - suffix.size();
+    return IdString_t(TruncateToCapacity, (prefix.substr(0U, prefixLength) + suffix).c_str());
+}
+
+template <typename Lookup>
+void benchmark(const char* name, const std::vector<ServiceDescription>& services, const Lookup& lookup)
+{
+    uint64_t numberOfFoundServices{0U};
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0U; i < NUMBER_OF_LOOKUPS; ++i)
+    {
+        numberOfFoundServices += lookup(services[i % services.size()]);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (numberOfFoundServices != NUMBER_OF_LOOKUPS)
+    {
+        std::cerr << name << " found " << numberOfFoundServices << " instead of " << NUMBER_OF_LOOKUPS << " services"
+                  << std::endl;
+    }
+
+    const auto nanosecondsPerLookup =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count())
+        / static_cast<double>(NUMBER_OF_LOOKUPS);
+
+    // Not using iceoryx logger due to width requirements
+    std::cout << std::setw(34) << name << " : " << std::setw(10) << std::fixed << std::setprecision(1)
+              << nanosecondsPerLookup << " (ns/lookup)" << std::endl;
+}
+
+int main()
+{
+    const std::string prefix{"/vehicle/sensors/front/camera/left/image/raw/compressed/"
+                             "with/a/very/long/and/deeply/nested/topic/name/"};
+
+    std::vector<ServiceDescription> services;
+    auto registry = std::make_unique<roudi::ServiceRegistry>();
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        services.emplace_back(createId(prefix, i), createId(prefix, 0U), createId(prefix, 0U));
+        if (registry->addPublisher(services.back()).has_error())
+        {
+            std::cerr << "Could not add service to the registry!" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::cout << NUMBER_OF_SERVICES << " services with " << IdString_t::capacity()
+              << " characters per identifier which differ only in the last characters" << std::endl;
+
+    benchmark("string comparison", services, [&](const ServiceDescription& searched) {
+        uint64_t count{0U};
+        for (const auto& service : services)
+        {
+            if (service.getServiceIDString() == searched.getServiceIDString()
+                && service.getInstanceIDString() == searched.getInstanceIDString()
+                && service.getEventIDString() == searched.getEventIDString())
+            {
+                ++count;
+            }
+        }
+        return count;
+    });
+
+    benchmark("ServiceDescription::operator==", services, [&](const ServiceDescription& searched) {
+        uint64_t count{0U};
+        for (const auto& service : services)
+        {
+            if (service == searched)
+            {
+                ++count;
+            }
+        }
+        return count;
+    });
+
+    benchmark("ServiceRegistry::find", services, [&](const ServiceDescription& searched) {
+        uint64_t count{0U};
+        registry->find(searched.getServiceIDString(),
+                       searched.getInstanceIDString(),
+                       searched.getEventIDString(),
+                       [&](const auto&) { ++count; });
+        return count;
+    });
+
+    benchmark("ServiceRegistry::find (wildcards)", services, [&](const ServiceDescription& searched) {
+        uint64_t count{0U};
+        registry->find(searched.getServiceIDString(), Wildcard, Wildcard, [&](const auto&) { ++count; });
+        return count;
+    });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,126 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_INTROSPECTION_INTROSPECTION_EXPORTER_HPP
+#define IOX_TOOLS_ICEORYX_INTROSPECTION_INTROSPECTION_EXPORTER_HPP
+
+#include "iceoryx_introspection/introspection_types.hpp"
+#include "iceoryx_platform/getopt.hpp"
+#include "iceoryx_posh/popo/subscriber.hpp"
+#include "iox/duration.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+namespace iox
+{
+namespace client
+{
+namespace introspection
+{
+/// @brief the exporter uses its own runtime name to be able to run alongside the introspection client
+constexpr const char INTROSPECTION_EXPORTER_APP_NAME[] = "introspection-exporter";
+
+static constexpr option exporterLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                                 {"version", no_argument, nullptr, 'v'},
+                                                 {"time", required_argument, nullptr, 't'},
+                                                 {"http-port", required_argument, nullptr, 'p'},
+                                                 {"json-file", required_argument, nullptr, 'j'},
+                                                 {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* exporterShortOptions = "hvt:p:j:";
+
+static constexpr iox::units::Duration MIN_EXPORT_PERIOD = 100_ms;
+static constexpr iox::units::Duration DEFAULT_EXPORT_PERIOD = 1000_ms;
+static constexpr iox::units::Duration MAX_EXPORT_PERIOD = 60000_ms;
+
+/// @brief the latest samples of the introspection topics; a topic which was not yet received is empty
+/// @note the samples refer to the subscribers they were taken from, therefore the snapshot must not outlive them
+struct IntrospectionSnapshot
+{
+    optional<popo::Sample<const MemPoolIntrospectionInfoContainer>> mempool;
+    optional<popo::Sample<const ProcessIntrospectionFieldTopic>> process;
+    optional<popo::Sample<const PortIntrospectionFieldTopic>> port;
+    optional<popo::Sample<const PortThroughputIntrospectionFieldTopic>> portThroughput;
+    optional<popo::Sample<const SubscriberPortChangingIntrospectionFieldTopic>> subscriberPortChangingData;
+};
+
+/// @brief writes the snapshot in the OpenMetrics text format, terminated with '# EOF'
+/// @param[in] stream sink to write the metrics to
+/// @param[in] snapshot with the introspection data to export
+void writeOpenMetrics(std::ostream& stream, const IntrospectionSnapshot& snapshot) noexcept;
+
+/// @brief writes the snapshot as a single line JSON object
+/// @param[in] stream sink to write the JSON object to
+/// @param[in] snapshot with the introspection data to export
+/// @param[in] timestamp of the export in nanoseconds since the unix epoch
+void writeJsonLine(std::ostream& stream, const IntrospectionSnapshot& snapshot, const uint64_t timestamp) noexcept;
+
+/// @brief headless counterpart of the introspection client which exports the introspection topics for monitoring
+/// systems, either as OpenMetrics text served at 'GET /metrics' on a local HTTP port or as JSON lines appended to a
+/// file
+/// @details The introspection topics are subscribed with a queue capacity of one and the default queue full policy,
+/// i.e. RouDi overwrites an unread sample instead of waiting for the exporter. The samples are taken in the exporter
+/// process only, on each HTTP request or export period, and never delay RouDi.
+class IntrospectionExporter
+{
+  public:
+    /// @brief constructor to create an exporter
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    IntrospectionExporter(int argc, char* argv[]) noexcept;
+
+    ~IntrospectionExporter() noexcept;
+
+    IntrospectionExporter(const IntrospectionExporter&) = delete;
+    IntrospectionExporter(IntrospectionExporter&&) = delete;
+    IntrospectionExporter& operator=(const IntrospectionExporter&) = delete;
+    IntrospectionExporter& operator=(IntrospectionExporter&&) = delete;
+
+    /// @brief exports the introspection data until the termination is requested with SIGINT or SIGTERM
+    void run() noexcept;
+
+  private:
+    void printHelp() noexcept;
+
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+
+    /// @brief opens the listening socket on the loopback interface
+    /// @return true if the socket is ready to accept connections
+    bool openHttpSocket() noexcept;
+
+    /// @brief answers a single HTTP request with the OpenMetrics text of the snapshot
+    void serveHttpRequest(const int connection, const IntrospectionSnapshot& snapshot) noexcept;
+
+    /// @brief appends a JSON line with the snapshot to the JSON file
+    void appendJsonLine(const IntrospectionSnapshot& snapshot) noexcept;
+
+  private:
+    units::Duration m_exportPeriod{DEFAULT_EXPORT_PERIOD};
+    optional<uint16_t> m_httpPort;
+    optional<std::string> m_jsonFile;
+    int m_httpSocket{-1};
+};
+
+} // namespace introspection
+} // namespace client
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_INTROSPECTION_INTROSPECTION_EXPORTER_HPP
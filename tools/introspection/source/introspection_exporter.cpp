@@ -0,0 +1,685 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_introspection/introspection_exporter.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace client
+{
+namespace introspection
+{
+namespace
+{
+constexpr int32_t MAX_POLL_TIMEOUT_MS{100};
+constexpr int32_t HTTP_REQUEST_TIMEOUT_MS{1000};
+constexpr uint64_t MAX_HTTP_REQUEST_SIZE{4096U};
+constexpr int HTTP_BACKLOG{8};
+
+template <typename Topic>
+void takeLatestSample(popo::Subscriber<Topic>& subscriber, optional<popo::Sample<const Topic>>& latestSample) noexcept
+{
+    while (true)
+    {
+        auto result = subscriber.take();
+        if (result.has_error())
+        {
+            break;
+        }
+        latestSample.emplace(std::move(result.value()));
+    }
+}
+
+std::string escapeLabelValue(const char* value) noexcept
+{
+    std::string escaped;
+    for (const char* c = value; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+        case '\\':
+            escaped += "\\\\";
+            break;
+        case '"':
+            escaped += "\\\"";
+            break;
+        case '\n':
+            escaped += "\\n";
+            break;
+        default:
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+std::string escapeJsonString(const char* value) noexcept
+{
+    std::string escaped;
+    for (const char* c = value; *c != '\0'; ++c)
+    {
+        if (*c == '\\' || *c == '"')
+        {
+            escaped += '\\';
+            escaped += *c;
+        }
+        else if (static_cast<unsigned char>(*c) < 0x20U)
+        {
+            constexpr const char* HEX_DIGITS{"0123456789abcdef"};
+            escaped += "\\u00";
+            escaped += HEX_DIGITS[static_cast<unsigned char>(*c) >> 4U];
+            escaped += HEX_DIGITS[static_cast<unsigned char>(*c) & 0xFU];
+        }
+        else
+        {
+            escaped += *c;
+        }
+    }
+    return escaped;
+}
+
+const char* subscriptionStateToString(const SubscribeState state) noexcept
+{
+    switch (state)
+    {
+    case SubscribeState::NOT_SUBSCRIBED:
+        return "NOT_SUBSCRIBED";
+    case SubscribeState::SUBSCRIBE_REQUESTED:
+        return "SUBSCRIBE_REQUESTED";
+    case SubscribeState::SUBSCRIBED:
+        return "SUBSCRIBED";
+    case SubscribeState::UNSUBSCRIBE_REQUESTED:
+        return "UNSUBSCRIBE_REQUESTED";
+    case SubscribeState::WAIT_FOR_OFFER:
+        return "WAIT_FOR_OFFER";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+void writeFamilyHeader(std::ostream& stream, const char* name, const char* type, const char* help) noexcept
+{
+    stream << "# TYPE " << name << ' ' << type << '\n' << "# HELP " << name << ' ' << help << '\n';
+}
+
+void writePortLabels(std::ostream& stream, const PortData& port) noexcept
+{
+    stream << "runtime=\"" << escapeLabelValue(port.m_name.c_str()) << "\",service=\""
+           << escapeLabelValue(port.m_caproServiceID.c_str()) << "\",instance=\""
+           << escapeLabelValue(port.m_caproInstanceID.c_str()) << "\",event=\""
+           << escapeLabelValue(port.m_caproEventMethodID.c_str()) << '"';
+}
+
+void writePortFields(std::ostream& stream, const PortData& port) noexcept
+{
+    stream << "\"runtime\":\"" << escapeJsonString(port.m_name.c_str()) << "\",\"service\":\""
+           << escapeJsonString(port.m_caproServiceID.c_str()) << "\",\"instance\":\""
+           << escapeJsonString(port.m_caproInstanceID.c_str()) << "\",\"event\":\""
+           << escapeJsonString(port.m_caproEventMethodID.c_str()) << '"';
+}
+
+template <typename GetValue>
+void writeMemPoolFamily(std::ostream& stream,
+                        const MemPoolIntrospectionInfoContainer& segments,
+                        const char* name,
+                        const char* help,
+                        const GetValue& getValue) noexcept
+{
+    writeFamilyHeader(stream, name, "gauge", help);
+    for (const auto& segment : segments)
+    {
+        uint64_t index{0U};
+        for (const auto& mempool : segment.m_mempoolInfo)
+        {
+            stream << name << "{segment=\"" << segment.m_id << "\",writer_group=\""
+                   << escapeLabelValue(segment.m_writerGroupName.c_str()) << "\",reader_group=\""
+                   << escapeLabelValue(segment.m_readerGroupName.c_str()) << "\",mempool=\"" << index++
+                   << "\",chunk_size=\"" << mempool.m_chunkSize << "\"} " << getValue(mempool) << '\n';
+        }
+    }
+}
+
+/// @brief the subscriber port changing data is only valid when both topics were created from the same port list
+const SubscriberPortChangingData* subscriberPortChangingData(const IntrospectionSnapshot& snapshot,
+                                                             const uint64_t index) noexcept
+{
+    if (!snapshot.port.has_value() || !snapshot.subscriberPortChangingData.has_value())
+    {
+        return nullptr;
+    }
+    const auto& changingDataList = snapshot.subscriberPortChangingData.value()->subscriberPortChangingDataList;
+    if (changingDataList.size() != snapshot.port.value()->m_subscriberList.size())
+    {
+        return nullptr;
+    }
+    return &changingDataList[index];
+}
+
+std::map<uint64_t, const PortThroughputData*> throughputByPortId(const IntrospectionSnapshot& snapshot) noexcept
+{
+    std::map<uint64_t, const PortThroughputData*> throughput;
+    if (snapshot.portThroughput.has_value())
+    {
+        for (const auto& data : snapshot.portThroughput.value()->m_throughputList)
+        {
+            throughput[data.m_publisherPortID] = &data;
+        }
+    }
+    return throughput;
+}
+} // namespace
+
+void writeOpenMetrics(std::ostream& stream, const IntrospectionSnapshot& snapshot) noexcept
+{
+    if (snapshot.mempool.has_value())
+    {
+        const auto& segments = *snapshot.mempool.value();
+        writeMemPoolFamily(stream, segments, "iox_mempool_chunks", "Number of chunks of the mempool", [](auto& info) {
+            return info.m_numChunks;
+        });
+        writeMemPoolFamily(stream, segments, "iox_mempool_used_chunks", "Number of chunks in use", [](auto& info) {
+            return info.m_usedChunks;
+        });
+        writeMemPoolFamily(stream,
+                           segments,
+                           "iox_mempool_min_free_chunks",
+                           "Lowest number of free chunks since the start of RouDi",
+                           [](auto& info) { return info.m_minFreeChunks; });
+    }
+
+    if (snapshot.process.has_value())
+    {
+        writeFamilyHeader(stream, "iox_process", "info", "Process registered at RouDi");
+        for (const auto& process : snapshot.process.value()->m_processList)
+        {
+            stream << "iox_process_info{pid=\"" << process.m_pid << "\",runtime=\""
+                   << escapeLabelValue(process.m_name.c_str()) << "\"} 1\n";
+        }
+    }
+
+    if (snapshot.port.has_value())
+    {
+        const auto& publishers = snapshot.port.value()->m_publisherList;
+        const auto throughput = throughputByPortId(snapshot);
+
+        writeFamilyHeader(stream, "iox_publisher", "info", "Publisher port registered at RouDi");
+        for (const auto& publisher : publishers)
+        {
+            stream << "iox_publisher_info{port_id=\"" << publisher.m_publisherPortID << "\",";
+            writePortLabels(stream, publisher);
+            stream << "} 1\n";
+        }
+
+        auto writePublisherFamily = [&](const char* name, const char* type, const char* help, auto getValue) {
+            writeFamilyHeader(stream, name, type, help);
+            const char* suffix = (std::strcmp(type, "counter") == 0) ? "_total" : "";
+            for (const auto& publisher : publishers)
+            {
+                const auto data = throughput.find(publisher.m_publisherPortID);
+                if (data != throughput.end())
+                {
+                    stream << name << suffix << "{port_id=\"" << publisher.m_publisherPortID << "\",";
+                    writePortLabels(stream, publisher);
+                    stream << "} " << getValue(*data->second) << '\n';
+                }
+            }
+        };
+        writePublisherFamily("iox_publisher_sent_chunks",
+                             "counter",
+                             "Number of chunks sent by the publisher",
+                             [](const PortThroughputData& data) { return data.m_sentChunks; });
+        writePublisherFamily("iox_publisher_sent_bytes",
+                             "counter",
+                             "Sum of the user-payload sizes of the chunks sent by the publisher",
+                             [](const PortThroughputData& data) { return data.m_sentBytes; });
+        writePublisherFamily("iox_publisher_allocation_failures",
+                             "counter",
+                             "Number of chunks the publisher failed to allocate",
+                             [](const PortThroughputData& data) { return data.m_allocationFailures; });
+        writePublisherFamily("iox_publisher_bytes_per_second",
+                             "gauge",
+                             "User-payload bytes sent by the publisher per second",
+                             [](const PortThroughputData& data) { return data.m_bytesPerSecond; });
+        writePublisherFamily("iox_publisher_chunks_per_minute",
+                             "gauge",
+                             "Number of chunks sent by the publisher per minute",
+                             [](const PortThroughputData& data) { return data.m_chunksPerMinute; });
+        writePublisherFamily("iox_publisher_last_send_interval_seconds",
+                             "gauge",
+                             "Average interval between two chunks sent by the publisher",
+                             [](const PortThroughputData& data) {
+                                 return static_cast<double>(data.m_lastSendIntervalInNanoseconds) / 1.0e9;
+                             });
+
+        const auto& subscribers = snapshot.port.value()->m_subscriberList;
+        auto writeSubscriberFamily = [&](const char* name, const char* type, const char* help, auto getValue) {
+            writeFamilyHeader(stream, name, type, help);
+            const char* suffix = (std::strcmp(type, "counter") == 0) ? "_total" : "";
+            for (uint64_t index = 0U; index < subscribers.size(); ++index)
+            {
+                const auto* changingData = subscriberPortChangingData(snapshot, index);
+                if (changingData != nullptr)
+                {
+                    // the index distinguishes subscribers of the same runtime and service
+                    stream << name << suffix << "{index=\"" << index << "\",";
+                    writePortLabels(stream, subscribers[index]);
+                    stream << "} " << getValue(*changingData) << '\n';
+                }
+            }
+        };
+        writeSubscriberFamily("iox_subscriber_subscribed",
+                              "gauge",
+                              "Whether the subscriber port is subscribed",
+                              [](const SubscriberPortChangingData& data) {
+                                  return (data.subscriptionState == SubscribeState::SUBSCRIBED) ? 1U : 0U;
+                              });
+        writeSubscriberFamily("iox_subscriber_queue_size",
+                              "gauge",
+                              "Number of chunks in the queue of the subscriber",
+                              [](const SubscriberPortChangingData& data) { return data.fifoSize; });
+        writeSubscriberFamily("iox_subscriber_queue_capacity",
+                              "gauge",
+                              "Capacity of the queue of the subscriber",
+                              [](const SubscriberPortChangingData& data) { return data.fifoCapacity; });
+        writeSubscriberFamily("iox_subscriber_max_queue_depth",
+                              "gauge",
+                              "Highest number of chunks in the queue of the subscriber",
+                              [](const SubscriberPortChangingData& data) { return data.maxQueueDepth; });
+        writeSubscriberFamily("iox_subscriber_lost_chunks",
+                              "counter",
+                              "Number of chunks the subscriber lost due to a full queue",
+                              [](const SubscriberPortChangingData& data) { return data.lostChunks; });
+    }
+
+    stream << "# EOF\n";
+}
+
+void writeJsonLine(std::ostream& stream, const IntrospectionSnapshot& snapshot, const uint64_t timestamp) noexcept
+{
+    stream << "{\"timestamp_ns\":" << timestamp;
+
+    if (snapshot.mempool.has_value())
+    {
+        stream << ",\"segments\":[";
+        const char* segmentSeparator = "";
+        for (const auto& segment : *snapshot.mempool.value())
+        {
+            stream << segmentSeparator << "{\"segment\":" << segment.m_id << ",\"writer_group\":\""
+                   << escapeJsonString(segment.m_writerGroupName.c_str()) << "\",\"reader_group\":\""
+                   << escapeJsonString(segment.m_readerGroupName.c_str()) << "\",\"mempools\":[";
+            const char* mempoolSeparator = "";
+            for (const auto& mempool : segment.m_mempoolInfo)
+            {
+                stream << mempoolSeparator << "{\"chunk_size\":" << mempool.m_chunkSize
+                       << ",\"chunk_payload_size\":" << mempool.m_chunkPayloadSize
+                       << ",\"chunks\":" << mempool.m_numChunks << ",\"used_chunks\":" << mempool.m_usedChunks
+                       << ",\"min_free_chunks\":" << mempool.m_minFreeChunks << '}';
+                mempoolSeparator = ",";
+            }
+            stream << "]}";
+            segmentSeparator = ",";
+        }
+        stream << ']';
+    }
+
+    if (snapshot.process.has_value())
+    {
+        stream << ",\"processes\":[";
+        const char* separator = "";
+        for (const auto& process : snapshot.process.value()->m_processList)
+        {
+            stream << separator << "{\"pid\":" << process.m_pid << ",\"runtime\":\""
+                   << escapeJsonString(process.m_name.c_str()) << "\"}";
+            separator = ",";
+        }
+        stream << ']';
+    }
+
+    if (snapshot.port.has_value())
+    {
+        const auto throughput = throughputByPortId(snapshot);
+        stream << ",\"publishers\":[";
+        const char* separator = "";
+        for (const auto& publisher : snapshot.port.value()->m_publisherList)
+        {
+            stream << separator << "{\"port_id\":" << publisher.m_publisherPortID << ',';
+            writePortFields(stream, publisher);
+            const auto data = throughput.find(publisher.m_publisherPortID);
+            if (data != throughput.end())
+            {
+                stream << ",\"sent_chunks\":" << data->second->m_sentChunks
+                       << ",\"sent_bytes\":" << data->second->m_sentBytes
+                       << ",\"allocation_failures\":" << data->second->m_allocationFailures
+                       << ",\"bytes_per_second\":" << data->second->m_bytesPerSecond
+                       << ",\"chunks_per_minute\":" << data->second->m_chunksPerMinute
+                       << ",\"last_send_interval_ns\":" << data->second->m_lastSendIntervalInNanoseconds;
+            }
+            stream << '}';
+            separator = ",";
+        }
+
+        stream << "],\"subscribers\":[";
+        separator = "";
+        const auto& subscribers = snapshot.port.value()->m_subscriberList;
+        for (uint64_t index = 0U; index < subscribers.size(); ++index)
+        {
+            stream << separator << '{';
+            writePortFields(stream, subscribers[index]);
+            const auto* changingData = subscriberPortChangingData(snapshot, index);
+            if (changingData != nullptr)
+            {
+                stream << ",\"subscription_state\":\"" << subscriptionStateToString(changingData->subscriptionState)
+                       << "\",\"queue_size\":" << changingData->fifoSize
+                       << ",\"queue_capacity\":" << changingData->fifoCapacity
+                       << ",\"max_queue_depth\":" << changingData->maxQueueDepth
+                       << ",\"lost_chunks\":" << changingData->lostChunks;
+            }
+            stream << '}';
+            separator = ",";
+        }
+        stream << ']';
+    }
+
+    stream << "}\n";
+}
+
+IntrospectionExporter::IntrospectionExporter(int argc, char* argv[]) noexcept
+{
+    if (argc < 2)
+    {
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+
+    parseCmdLineArguments(argc, argv);
+}
+
+IntrospectionExporter::~IntrospectionExporter() noexcept
+{
+    if (m_httpSocket >= 0)
+    {
+        close(m_httpSocket);
+    }
+}
+
+void IntrospectionExporter::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-introspection-exporter [OPTIONS]\n"
+                 "  iox-introspection-exporter --help\n"
+                 "  iox-introspection-exporter --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help              Display help and exit.\n"
+                 "  -v, --version           Display latest official iceoryx release version and exit.\n"
+                 "  -p, --http-port <UINT>  Serve the OpenMetrics text at 'http://127.0.0.1:<UINT>/metrics'.\n"
+                 "  -j, --json-file <PATH>  Append the introspection data as JSON lines to <PATH>.\n"
+                 "  -t, --time <ms>         Period (in milliseconds) of the JSON lines\n"
+                 "                          [min: "
+              << MIN_EXPORT_PERIOD.toMilliseconds() << ", max: " << MAX_EXPORT_PERIOD.toMilliseconds()
+              << ", default: " << DEFAULT_EXPORT_PERIOD.toMilliseconds()
+              << "]\n"
+                 "\nAt least one of '--http-port' and '--json-file' is required.\n"
+              << std::endl;
+}
+
+void IntrospectionExporter::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void IntrospectionExporter::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int index;
+
+    while ((opt = getopt_long(argc, argv, exporterShortOptions, exporterLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 't':
+        {
+            auto result = convert::from_string<uint64_t>(optarg);
+            if (!result.has_value())
+            {
+                std::cout << "Invalid argument for 't'! Will be ignored!" << std::endl;
+                break;
+            }
+            const auto exportPeriod = units::Duration::fromMilliseconds(result.value());
+            m_exportPeriod = algorithm::minVal(algorithm::maxVal(exportPeriod, MIN_EXPORT_PERIOD), MAX_EXPORT_PERIOD);
+            break;
+        }
+
+        case 'p':
+        {
+            auto result = convert::from_string<uint16_t>(optarg);
+            if (!result.has_value() || result.value() == 0U)
+            {
+                std::cout << "Invalid argument for 'p'! The port must be in the range 1..65535!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            m_httpPort.emplace(result.value());
+            break;
+        }
+
+        case 'j':
+            m_jsonFile.emplace(optarg);
+            break;
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (!m_httpPort.has_value() && !m_jsonFile.has_value())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool IntrospectionExporter::openHttpSocket() noexcept
+{
+    m_httpSocket = socket(AF_INET, SOCK_STREAM, 0);
+    if (m_httpSocket < 0)
+    {
+        std::cerr << "Unable to create the HTTP socket: " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    int reuseAddress{1};
+    setsockopt(m_httpSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+    // the metrics are only served on the loopback interface; a remote scraper requires a local reverse proxy
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(m_httpPort.value());
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(m_httpSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || listen(m_httpSocket, HTTP_BACKLOG) != 0)
+    {
+        std::cerr << "Unable to listen on port " << m_httpPort.value() << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+void IntrospectionExporter::serveHttpRequest(const int connection, const IntrospectionSnapshot& snapshot) noexcept
+{
+    // a client which does not send its request in time must not stall the export
+    pollfd request{connection, POLLIN, 0};
+    if (poll(&request, 1, HTTP_REQUEST_TIMEOUT_MS) != 1)
+    {
+        return;
+    }
+
+    char buffer[MAX_HTTP_REQUEST_SIZE];
+    const auto receivedBytes = recv(connection, buffer, sizeof(buffer) - 1U, 0);
+    if (receivedBytes <= 0)
+    {
+        return;
+    }
+    buffer[receivedBytes] = '\0';
+
+    std::ostringstream response;
+    if (std::strncmp(buffer, "GET /metrics ", std::strlen("GET /metrics ")) == 0)
+    {
+        std::ostringstream body;
+        writeOpenMetrics(body, snapshot);
+        const auto content = body.str();
+        response << "HTTP/1.1 200 OK\r\n"
+                    "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+                 << "Content-Length: " << content.size() << "\r\nConnection: close\r\n\r\n"
+                 << content;
+    }
+    else
+    {
+        response << "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+    }
+
+    const auto data = response.str();
+    uint64_t sentBytes{0U};
+    while (sentBytes < data.size())
+    {
+        const auto result = send(connection, data.data() + sentBytes, data.size() - sentBytes, 0);
+        if (result <= 0)
+        {
+            break;
+        }
+        sentBytes += static_cast<uint64_t>(result);
+    }
+}
+
+void IntrospectionExporter::appendJsonLine(const IntrospectionSnapshot& snapshot) noexcept
+{
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch());
+
+    // the file is reopened for every line to support the rotation of the file by external tools
+    std::ofstream file(m_jsonFile.value(), std::ios::app);
+    if (!file)
+    {
+        std::cerr << "Unable to open '" << m_jsonFile.value() << "' for writing!" << std::endl;
+        return;
+    }
+    writeJsonLine(file, snapshot, static_cast<uint64_t>(timestamp.count()));
+}
+
+void IntrospectionExporter::run() noexcept
+{
+    // a scraper closing the connection early must not terminate the exporter
+    std::signal(SIGPIPE, SIG_IGN);
+
+    if (m_httpPort.has_value() && !openHttpSocket())
+    {
+        exit(EXIT_FAILURE);
+    }
+
+    runtime::PoshRuntime::initRuntime(INTROSPECTION_EXPORTER_APP_NAME);
+
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 1U;
+    subscriberOptions.historyRequest = 1U;
+
+    popo::Subscriber<MemPoolIntrospectionInfoContainer> memPoolSubscriber{IntrospectionMempoolService,
+                                                                           subscriberOptions};
+    popo::Subscriber<ProcessIntrospectionFieldTopic> processSubscriber{IntrospectionProcessService, subscriberOptions};
+    popo::Subscriber<PortIntrospectionFieldTopic> portSubscriber{IntrospectionPortService, subscriberOptions};
+    popo::Subscriber<PortThroughputIntrospectionFieldTopic> portThroughputSubscriber{
+        IntrospectionPortThroughputService, subscriberOptions};
+    popo::Subscriber<SubscriberPortChangingIntrospectionFieldTopic> subscriberPortChangingDataSubscriber{
+        IntrospectionSubscriberPortChangingDataService, subscriberOptions};
+
+    // declared after the subscribers to release the samples before the subscribers are destroyed
+    IntrospectionSnapshot snapshot;
+    auto takeLatestSamples = [&] {
+        takeLatestSample(memPoolSubscriber, snapshot.mempool);
+        takeLatestSample(processSubscriber, snapshot.process);
+        takeLatestSample(portSubscriber, snapshot.port);
+        takeLatestSample(portThroughputSubscriber, snapshot.portThroughput);
+        takeLatestSample(subscriberPortChangingDataSubscriber, snapshot.subscriberPortChangingData);
+    };
+
+    const auto exportPeriod = std::chrono::nanoseconds(m_exportPeriod.toNanoseconds());
+    auto nextJsonLine = std::chrono::steady_clock::now();
+    while (!hasTerminationRequested())
+    {
+        auto pollTimeout = MAX_POLL_TIMEOUT_MS;
+        if (m_jsonFile.has_value())
+        {
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= nextJsonLine)
+            {
+                takeLatestSamples();
+                appendJsonLine(snapshot);
+                nextJsonLine = std::max(nextJsonLine + exportPeriod, now);
+            }
+            const auto timeUntilNextJsonLine =
+                std::chrono::duration_cast<std::chrono::milliseconds>(nextJsonLine - now).count();
+            pollTimeout = static_cast<int32_t>(std::min<int64_t>(timeUntilNextJsonLine, MAX_POLL_TIMEOUT_MS));
+        }
+
+        // without the HTTP socket the poll just waits for the timeout
+        pollfd listener{m_httpSocket, POLLIN, 0};
+        const nfds_t numberOfFds = (m_httpSocket >= 0) ? 1U : 0U;
+        if (poll(&listener, numberOfFds, pollTimeout) == 1 && (listener.revents & POLLIN) != 0)
+        {
+            const int connection = accept(m_httpSocket, nullptr, nullptr);
+            if (connection >= 0)
+            {
+                takeLatestSamples();
+                serveHttpRequest(connection, snapshot);
+                close(connection);
+            }
+        }
+    }
+}
+
+} // namespace introspection
+} // namespace client
+} // namespace iox
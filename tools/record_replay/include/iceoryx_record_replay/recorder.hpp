@@ -0,0 +1,76 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDER_HPP
+
+#include "iceoryx_platform/getopt.hpp"
+#include "iceoryx_record_replay/recording_writer.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+constexpr const char RECORDER_APP_NAME[] = "iox-recorder";
+
+static constexpr option recorderLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                                 {"version", no_argument, nullptr, 'v'},
+                                                 {"output", required_argument, nullptr, 'o'},
+                                                 {"topic", required_argument, nullptr, 't'},
+                                                 {"queue-capacity", required_argument, nullptr, 'q'},
+                                                 {"window-size", required_argument, nullptr, 'w'},
+                                                 {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* recorderShortOptions = "hvo:t:q:w:";
+
+/// @brief records the chunks of a set of topics into a recording which can be replayed with the iox-replayer
+/// @details The topics are subscribed with untyped subscribers which are attached to a WaitSet. When a subscriber
+/// has data, all of its chunks are taken in one batch, copied into the memory mapped recording and released
+/// immediately, i.e. a chunk is held only for the duration of the copy.
+class Recorder
+{
+  public:
+    /// @brief constructor to create a recorder
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    Recorder(int argc, char* argv[]) noexcept;
+
+    /// @brief records the topics until the termination is requested with SIGINT or SIGTERM
+    /// @return false if the recording could not be created or a chunk could not be recorded
+    bool run() noexcept;
+
+  private:
+    void printHelp() noexcept;
+
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+
+  private:
+    std::string m_basePath;
+    std::vector<capro::ServiceDescription> m_topics;
+    uint64_t m_queueCapacity{MAX_SUBSCRIBER_QUEUE_CAPACITY};
+    uint64_t m_windowSize{DEFAULT_MAPPING_WINDOW_SIZE};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDER_HPP
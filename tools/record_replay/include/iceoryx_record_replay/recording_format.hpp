@@ -0,0 +1,122 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief A recording consists of two files which are written append-only through memory mappings
+///   - the data file '<BASE_PATH>.iorec' with the chunks as they were received, i.e. the ChunkHeader followed by the
+///     optional user-header and the user-payload, each chunk starting at a multiple of RECORD_ALIGNMENT
+///   - the index file '<BASE_PATH>.ioidx' with an IndexHeader followed by one IndexEntry per chunk in the order of
+///     reception, i.e. with non-decreasing timestamps
+constexpr const char DATA_FILE_SUFFIX[] = ".iorec";
+constexpr const char INDEX_FILE_SUFFIX[] = ".ioidx";
+
+/// @brief 'IOXRECRD' in little endian
+constexpr uint64_t RECORDING_MAGIC{0x44524345524f5849U};
+constexpr uint32_t RECORDING_FORMAT_VERSION{1U};
+constexpr uint32_t MAX_RECORDED_TOPICS{64U};
+constexpr uint64_t RECORD_ALIGNMENT{alignof(mepoo::ChunkHeader)};
+constexpr uint64_t TOPIC_ID_STRING_SIZE{capro::IdString_t::capacity() + 1U};
+
+/// @brief the service description of a recorded topic as null terminated strings
+struct RecordedTopic
+{
+    char service[TOPIC_ID_STRING_SIZE]{};
+    char instance[TOPIC_ID_STRING_SIZE]{};
+    char event[TOPIC_ID_STRING_SIZE]{};
+};
+
+/// @brief the header at the beginning of the index file
+/// @note 'numberOfEntries' and 'dataSize' are updated after each recorded chunk, therefore the recording stays
+/// readable up to the last complete chunk when the recorder terminates abnormally
+struct IndexHeader
+{
+    uint64_t magic{RECORDING_MAGIC};
+    uint32_t formatVersion{RECORDING_FORMAT_VERSION};
+    uint8_t chunkHeaderVersion{mepoo::ChunkHeader::CHUNK_HEADER_VERSION};
+    uint8_t reserved[3]{};
+    uint32_t numberOfTopics{0U};
+    uint32_t reserved2{0U};
+    uint64_t numberOfEntries{0U};
+    uint64_t dataSize{0U};
+    RecordedTopic topics[MAX_RECORDED_TOPICS];
+};
+
+/// @brief the index entry of a single recorded chunk
+struct IndexEntry
+{
+    /// @brief the reception time in nanoseconds since the unix epoch; taken from a monotonic clock which is anchored
+    /// to the wall clock at the start of the recording, therefore it never decreases
+    uint64_t timestamp{0U};
+    /// @brief the sequence number assigned by the publisher
+    uint64_t sequenceNumber{0U};
+    /// @brief the offset of the ChunkHeader in the data file
+    uint64_t dataOffset{0U};
+    /// @brief the used size of the chunk, i.e. the ChunkHeader, user-header and user-payload
+    uint64_t size{0U};
+    uint32_t topicIndex{0U};
+    uint32_t reserved{0U};
+};
+
+enum class RecordingError
+{
+    FILE_CREATION_FAILED,
+    FILE_OPEN_FAILED,
+    MEMORY_MAPPING_FAILED,
+    FILE_RESIZE_FAILED,
+    TOO_MANY_TOPICS,
+    INVALID_TOPIC_INDEX,
+    INVALID_FORMAT,
+    INCOMPATIBLE_FORMAT_VERSION,
+    INCOMPATIBLE_CHUNK_HEADER_VERSION,
+};
+
+/// @brief converts the RecordingError to a string literal
+/// @param[in] error to convert
+/// @return string literal of the error
+const char* asStringLiteral(const RecordingError error) noexcept;
+
+/// @brief creates the recorded topic from a service description
+/// @param[in] service to store
+/// @return the recorded topic
+RecordedTopic toRecordedTopic(const capro::ServiceDescription& service) noexcept;
+
+/// @brief creates the service description of a recorded topic
+/// @param[in] topic to convert
+/// @return the service description
+capro::ServiceDescription toServiceDescription(const RecordedTopic& topic) noexcept;
+
+/// @brief parses a topic in the form 'SERVICE/INSTANCE/EVENT'
+/// @param[in] value to parse
+/// @return the service description or nullopt if the value is malformed or one of the ids is too long
+optional<capro::ServiceDescription> topicFromString(const std::string& value) noexcept;
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_FORMAT_HPP
@@ -0,0 +1,110 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
+
+#include "iceoryx_record_replay/recording_format.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief a read-only memory mapping of a whole file
+class ReadOnlyMappedFile
+{
+  public:
+    /// @brief opens and maps the file
+    /// @param[in] path of the file
+    /// @return the mapped file or a RecordingError
+    static expected<ReadOnlyMappedFile, RecordingError> open(const std::string& path) noexcept;
+
+    ReadOnlyMappedFile(const ReadOnlyMappedFile&) = delete;
+    ReadOnlyMappedFile& operator=(const ReadOnlyMappedFile&) = delete;
+    ReadOnlyMappedFile(ReadOnlyMappedFile&& rhs) noexcept;
+    ReadOnlyMappedFile& operator=(ReadOnlyMappedFile&& rhs) noexcept;
+    ~ReadOnlyMappedFile() noexcept;
+
+    /// @brief the begin of the mapped file; nullptr for an empty file
+    const uint8_t* data() const noexcept;
+
+    /// @brief the size of the file
+    uint64_t size() const noexcept;
+
+  private:
+    ReadOnlyMappedFile(const uint8_t* data, const uint64_t size) noexcept;
+
+    void destroy() noexcept;
+
+  private:
+    const uint8_t* m_data{nullptr};
+    uint64_t m_size{0U};
+};
+
+/// @brief reads a recording in the format described in 'recording_format.hpp' without copying it
+/// @note a recording which is still written can be read up to the chunks recorded when it was opened
+class RecordingReader
+{
+  public:
+    /// @brief opens the data and index file of a recording and verifies the format
+    /// @param[in] basePath of the recording without the file suffixes
+    /// @return the reader or a RecordingError
+    static expected<RecordingReader, RecordingError> open(const std::string& basePath) noexcept;
+
+    /// @brief the number of recorded topics
+    uint32_t numberOfTopics() const noexcept;
+
+    /// @brief the recorded topic
+    /// @param[in] topicIndex of the topic; must be less than 'numberOfTopics'
+    const RecordedTopic& topic(const uint32_t topicIndex) const noexcept;
+
+    /// @brief the number of recorded chunks
+    uint64_t numberOfEntries() const noexcept;
+
+    /// @brief the index entry of a recorded chunk
+    /// @param[in] index of the entry; must be less than 'numberOfEntries'
+    const IndexEntry& entry(const uint64_t index) const noexcept;
+
+    /// @brief the recorded chunk of an index entry
+    /// @param[in] entry of the chunk
+    /// @return the ChunkHeader of the chunk or a nullptr if the entry does not refer to a consistent chunk of the
+    /// recording; the user-header and user-payload can be accessed with the ChunkHeader methods
+    const mepoo::ChunkHeader* chunk(const IndexEntry& entry) const noexcept;
+
+    /// @brief binary search for the first chunk which was recorded at or after the timestamp
+    /// @param[in] timestamp in nanoseconds since the unix epoch
+    /// @return the index of the entry or 'numberOfEntries' if all chunks were recorded before the timestamp
+    uint64_t findFirstEntryNotBefore(const uint64_t timestamp) const noexcept;
+
+  private:
+    RecordingReader(ReadOnlyMappedFile&& dataFile, ReadOnlyMappedFile&& indexFile) noexcept;
+
+  private:
+    ReadOnlyMappedFile m_dataFile;
+    ReadOnlyMappedFile m_indexFile;
+    const IndexHeader* m_header{nullptr};
+    const IndexEntry* m_entries{nullptr};
+    uint64_t m_numberOfEntries{0U};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_READER_HPP
@@ -0,0 +1,139 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
+
+#include "iceoryx_record_replay/recording_format.hpp"
+#include "iox/expected.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+/// @brief the default size of the memory mapped window of the data file
+constexpr uint64_t DEFAULT_MAPPING_WINDOW_SIZE{256U * 1024U * 1024U};
+
+/// @brief a file which is only appended to through a memory mapped window; when the window is exhausted, the file is
+/// extended and the window is moved to the current end of the file
+class AppendOnlyMappedFile
+{
+  public:
+    /// @brief creates the file, an existing file is truncated
+    /// @param[in] path of the file
+    /// @param[in] windowSize the minimal size of the memory mapped window
+    /// @return the file or a RecordingError
+    static expected<AppendOnlyMappedFile, RecordingError> create(const std::string& path,
+                                                                 const uint64_t windowSize) noexcept;
+
+    AppendOnlyMappedFile(const AppendOnlyMappedFile&) = delete;
+    AppendOnlyMappedFile& operator=(const AppendOnlyMappedFile&) = delete;
+    AppendOnlyMappedFile(AppendOnlyMappedFile&& rhs) noexcept;
+    AppendOnlyMappedFile& operator=(AppendOnlyMappedFile&& rhs) noexcept;
+
+    /// @brief truncates the file to the appended size and releases the mapping
+    ~AppendOnlyMappedFile() noexcept;
+
+    /// @brief provides the memory for the next 'size' bytes of the file without appending them
+    /// @param[in] size of the memory
+    /// @return the pointer to the memory or a RecordingError if the file could not be extended
+    /// @note the pointer is valid until the next call of 'reserve'
+    expected<uint8_t*, RecordingError> reserve(const uint64_t size) noexcept;
+
+    /// @brief appends the 'size' bytes which were previously reserved
+    /// @param[in] size of the reserved memory which was written
+    void commit(const uint64_t size) noexcept;
+
+    /// @brief the size of the appended data
+    uint64_t size() const noexcept;
+
+    /// @brief the native file handle
+    int fileHandle() const noexcept;
+
+  private:
+    AppendOnlyMappedFile(const int fileDescriptor, const uint64_t windowSize) noexcept;
+
+    expected<void, RecordingError> moveWindow(const uint64_t requiredSize) noexcept;
+
+    void destroy() noexcept;
+
+  private:
+    static constexpr int INVALID_FILE_DESCRIPTOR{-1};
+
+    int m_fileDescriptor{INVALID_FILE_DESCRIPTOR};
+    uint64_t m_windowSize{0U};
+    uint8_t* m_window{nullptr};
+    uint64_t m_windowOffset{0U};
+    uint64_t m_windowLength{0U};
+    uint64_t m_allocatedSize{0U};
+    uint64_t m_size{0U};
+};
+
+/// @brief writes a recording in the format described in 'recording_format.hpp'
+/// @details Recording a chunk copies it with a single memcpy into the memory mapped data file and appends the index
+/// entry to the memory mapped index file. The files are extended in steps of the window size, therefore no system
+/// call is required for most chunks and the throughput is only bound by the page cache and the disk.
+class RecordingWriter
+{
+  public:
+    /// @brief creates the data and index file of a recording; existing files are overwritten
+    /// @param[in] basePath of the recording without the file suffixes
+    /// @param[in] topics which are recorded; the position of a topic is the topic index for 'record'
+    /// @param[in] windowSize the minimal size of the memory mapped window of the data file
+    /// @return the writer or a RecordingError
+    static expected<RecordingWriter, RecordingError>
+    create(const std::string& basePath,
+           const std::vector<capro::ServiceDescription>& topics,
+           const uint64_t windowSize = DEFAULT_MAPPING_WINDOW_SIZE) noexcept;
+
+    RecordingWriter(const RecordingWriter&) = delete;
+    RecordingWriter& operator=(const RecordingWriter&) = delete;
+    RecordingWriter(RecordingWriter&& rhs) noexcept;
+    RecordingWriter& operator=(RecordingWriter&& rhs) noexcept;
+    ~RecordingWriter() noexcept;
+
+    /// @brief appends the chunk to the recording
+    /// @param[in] topicIndex of the topic the chunk was received from
+    /// @param[in] chunkHeader of the chunk; the ChunkHeader, user-header and user-payload are recorded
+    /// @param[in] timestamp of the reception in nanoseconds since the unix epoch; must not decrease
+    /// @return a RecordingError if the files could not be extended or the topic index is invalid
+    expected<void, RecordingError>
+    record(const uint32_t topicIndex, const mepoo::ChunkHeader& chunkHeader, const uint64_t timestamp) noexcept;
+
+    /// @brief the number of recorded chunks
+    uint64_t numberOfRecordedChunks() const noexcept;
+
+    /// @brief the size of the recorded chunks in bytes, including the alignment padding
+    uint64_t recordedDataSize() const noexcept;
+
+  private:
+    RecordingWriter(AppendOnlyMappedFile&& dataFile, AppendOnlyMappedFile&& indexFile, IndexHeader* header) noexcept;
+
+  private:
+    AppendOnlyMappedFile m_dataFile;
+    AppendOnlyMappedFile m_indexFile;
+    /// @brief the separately mapped header of the index file which is updated after each recorded chunk
+    IndexHeader* m_header{nullptr};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_RECORDING_WRITER_HPP
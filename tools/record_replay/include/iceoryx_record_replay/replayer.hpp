@@ -0,0 +1,77 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAYER_HPP
+#define IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAYER_HPP
+
+#include "iceoryx_platform/getopt.hpp"
+#include "iceoryx_record_replay/recording_reader.hpp"
+#include "iox/duration.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace iox
+{
+namespace record_replay
+{
+constexpr const char REPLAYER_APP_NAME[] = "iox-replayer";
+
+static constexpr option replayerLongOptions[] = {{"help", no_argument, nullptr, 'h'},
+                                                 {"version", no_argument, nullptr, 'v'},
+                                                 {"input", required_argument, nullptr, 'i'},
+                                                 {"rate", required_argument, nullptr, 'r'},
+                                                 {"start", required_argument, nullptr, 's'},
+                                                 {"delay", required_argument, nullptr, 'd'},
+                                                 {nullptr, 0, nullptr, 0}};
+
+static constexpr const char* replayerShortOptions = "hvi:r:s:d:";
+
+/// @brief publishes the chunks of a recording of the iox-recorder on the recorded topics
+/// @details The recording is memory mapped read-only. Each chunk is copied from the mapping into a chunk which is
+/// loaned with the recorded user-payload size and alignment and the recorded user-header size. The chunks are
+/// published with the time intervals of the recording divided by the rate; with a rate of 0 they are published as
+/// fast as possible.
+class Replayer
+{
+  public:
+    /// @brief constructor to create a replayer
+    /// @param[in] argc forwarding of command line arguments
+    /// @param[in] argv forwarding of command line arguments
+    Replayer(int argc, char* argv[]) noexcept;
+
+    /// @brief replays the recording until its end or until the termination is requested with SIGINT or SIGTERM
+    /// @return false if the recording could not be opened
+    bool run() noexcept;
+
+  private:
+    void printHelp() noexcept;
+
+    void printShortInfo(const std::string& binaryName) noexcept;
+
+    void parseCmdLineArguments(int argc, char** argv) noexcept;
+
+  private:
+    std::string m_basePath;
+    double m_rate{1.0};
+    units::Duration m_start{units::Duration::zero()};
+    units::Duration m_delay{units::Duration::zero()};
+};
+
+} // namespace record_replay
+} // namespace iox
+
+#endif // IOX_TOOLS_ICEORYX_RECORD_REPLAY_REPLAYER_HPP
@@ -0,0 +1,255 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recorder.hpp"
+#include "iceoryx_posh/popo/untyped_subscriber.hpp"
+#include "iceoryx_posh/popo/wait_set.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+#include "iox/attributes.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+constexpr units::Duration WAIT_TIMEOUT{units::Duration::fromMilliseconds(100U)};
+constexpr uint64_t MEBIBYTE{1024U * 1024U};
+
+/// @brief a monotonic clock which is anchored to the wall clock when it is created
+class RecordingClock
+{
+  public:
+    uint64_t now() const noexcept
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - m_steadyStart;
+        return m_wallClockStart + static_cast<uint64_t>(std::chrono::nanoseconds(elapsed).count());
+    }
+
+  private:
+    std::chrono::steady_clock::time_point m_steadyStart{std::chrono::steady_clock::now()};
+    uint64_t m_wallClockStart{static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count())};
+};
+} // namespace
+
+Recorder::Recorder(int argc, char* argv[]) noexcept
+{
+    parseCmdLineArguments(argc, argv);
+}
+
+void Recorder::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-recorder -o <BASE_PATH> -t <TOPIC> [-t <TOPIC> ...] [OPTIONS]\n"
+                 "  iox-recorder --help\n"
+                 "  iox-recorder --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help                   Display help and exit.\n"
+                 "  -v, --version                Display latest official iceoryx release version and exit.\n"
+                 "  -o, --output <BASE_PATH>     Writes the recording to '<BASE_PATH>"
+              << DATA_FILE_SUFFIX << "' and '<BASE_PATH>" << INDEX_FILE_SUFFIX
+              << "'.\n"
+                 "  -t, --topic <TOPIC>          Records the topic 'SERVICE/INSTANCE/EVENT'; can be given up to "
+              << MAX_RECORDED_TOPICS
+              << " times.\n"
+                 "  -q, --queue-capacity <UINT>  Queue capacity of the subscribers [max: "
+              << MAX_SUBSCRIBER_QUEUE_CAPACITY << ", default: " << MAX_SUBSCRIBER_QUEUE_CAPACITY
+              << "]\n"
+                 "  -w, --window-size <MiB>      Size of the memory mapped window of the data file [default: "
+              << DEFAULT_MAPPING_WINDOW_SIZE / MEBIBYTE << "]\n"
+              << std::endl;
+}
+
+void Recorder::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void Recorder::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int index;
+
+    while ((opt = getopt_long(argc, argv, recorderShortOptions, recorderLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'o':
+            m_basePath = optarg;
+            break;
+
+        case 't':
+        {
+            auto topic = topicFromString(optarg);
+            if (!topic.has_value())
+            {
+                std::cout << "Invalid argument for 't'! The topic must be given as 'SERVICE/INSTANCE/EVENT'!"
+                          << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            if (m_topics.size() == MAX_RECORDED_TOPICS)
+            {
+                std::cout << "Too many topics! At most " << MAX_RECORDED_TOPICS << " topics can be recorded!"
+                          << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            m_topics.push_back(topic.value());
+            break;
+        }
+
+        case 'q':
+        {
+            auto result = convert::from_string<uint64_t>(optarg);
+            if (!result.has_value() || result.value() == 0U || result.value() > MAX_SUBSCRIBER_QUEUE_CAPACITY)
+            {
+                std::cout << "Invalid argument for 'q'! The queue capacity must be in the range 1.."
+                          << MAX_SUBSCRIBER_QUEUE_CAPACITY << "!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            m_queueCapacity = result.value();
+            break;
+        }
+
+        case 'w':
+        {
+            auto result = convert::from_string<uint64_t>(optarg);
+            if (!result.has_value() || result.value() == 0U || result.value() > 64U * 1024U)
+            {
+                std::cout << "Invalid argument for 'w'! The window size must be in the range 1..65536!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            m_windowSize = result.value() * MEBIBYTE;
+            break;
+        }
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (m_basePath.empty() || m_topics.empty())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool Recorder::run() noexcept
+{
+    auto writer = RecordingWriter::create(m_basePath, m_topics, m_windowSize);
+    if (writer.has_error())
+    {
+        std::cerr << "Unable to create the recording '" << m_basePath << "': " << asStringLiteral(writer.error())
+                  << std::endl;
+        return false;
+    }
+
+    runtime::PoshRuntime::initRuntime(RECORDER_APP_NAME);
+
+    popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = m_queueCapacity;
+
+    std::vector<std::unique_ptr<popo::UntypedSubscriber>> subscribers;
+    popo::WaitSet<> waitset;
+    for (uint64_t i = 0U; i < m_topics.size(); ++i)
+    {
+        subscribers.emplace_back(new popo::UntypedSubscriber(m_topics[i], subscriberOptions));
+        waitset.attachState(*subscribers.back(), popo::SubscriberState::HAS_DATA, i).or_else([](auto) {
+            std::cerr << "Unable to attach the subscriber to the WaitSet!" << std::endl;
+            exit(EXIT_FAILURE);
+        });
+    }
+
+    std::cout << "Recording " << m_topics.size() << " topic(s) to '" << m_basePath << "'. Stop with Ctrl+C."
+              << std::endl;
+
+    const RecordingClock clock;
+    const auto recordingStart = std::chrono::steady_clock::now();
+    uint64_t numberOfQueueOverflows{0U};
+    bool hasRecordingError{false};
+    std::vector<const void*> takenChunks;
+    takenChunks.reserve(MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY);
+
+    while (!hasTerminationRequested() && !hasRecordingError)
+    {
+        for (auto notification : waitset.timedWait(WAIT_TIMEOUT))
+        {
+            const auto topicIndex = static_cast<uint32_t>(notification->getNotificationId());
+            auto& subscriber = *subscribers[topicIndex];
+            if (subscriber.hasMissedData())
+            {
+                ++numberOfQueueOverflows;
+            }
+
+            takenChunks.clear();
+            auto recordChunk = [&](const void* userPayload) {
+                takenChunks.push_back(userPayload);
+                if (!hasRecordingError)
+                {
+                    writer->record(topicIndex, *mepoo::ChunkHeader::fromUserPayload(userPayload), clock.now())
+                        .or_else([&](auto& error) {
+                            std::cerr << "Unable to record the chunk: " << asStringLiteral(error) << std::endl;
+                            hasRecordingError = true;
+                        });
+                }
+            };
+            // the queue can only be empty since the chunks are released immediately, which is not an error here
+            IOX_DISCARD_RESULT(subscriber.takeBatch(MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY, recordChunk));
+            for (auto userPayload : takenChunks)
+            {
+                subscriber.release(userPayload);
+            }
+        }
+    }
+
+    const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - recordingStart).count();
+    const auto recordedSize = static_cast<double>(writer->recordedDataSize()) / static_cast<double>(MEBIBYTE);
+    std::cout << "Recorded " << writer->numberOfRecordedChunks() << " chunk(s) with " << recordedSize << " MiB in "
+              << duration << " s";
+    if (numberOfQueueOverflows > 0U)
+    {
+        std::cout << "; the subscriber queues overflowed " << numberOfQueueOverflows
+                  << " time(s), consider increasing the queue capacity";
+    }
+    std::cout << std::endl;
+
+    return !hasRecordingError;
+}
+
+} // namespace record_replay
+} // namespace iox
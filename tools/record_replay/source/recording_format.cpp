@@ -0,0 +1,109 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_format.hpp"
+
+#include <cstring>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+void copyIdString(char (&destination)[TOPIC_ID_STRING_SIZE], const capro::IdString_t& source) noexcept
+{
+    std::memcpy(destination, source.c_str(), source.size());
+    destination[source.size()] = '\0';
+}
+} // namespace
+
+const char* asStringLiteral(const RecordingError error) noexcept
+{
+    switch (error)
+    {
+    case RecordingError::FILE_CREATION_FAILED:
+        return "RecordingError::FILE_CREATION_FAILED";
+    case RecordingError::FILE_OPEN_FAILED:
+        return "RecordingError::FILE_OPEN_FAILED";
+    case RecordingError::MEMORY_MAPPING_FAILED:
+        return "RecordingError::MEMORY_MAPPING_FAILED";
+    case RecordingError::FILE_RESIZE_FAILED:
+        return "RecordingError::FILE_RESIZE_FAILED";
+    case RecordingError::TOO_MANY_TOPICS:
+        return "RecordingError::TOO_MANY_TOPICS";
+    case RecordingError::INVALID_TOPIC_INDEX:
+        return "RecordingError::INVALID_TOPIC_INDEX";
+    case RecordingError::INVALID_FORMAT:
+        return "RecordingError::INVALID_FORMAT";
+    case RecordingError::INCOMPATIBLE_FORMAT_VERSION:
+        return "RecordingError::INCOMPATIBLE_FORMAT_VERSION";
+    case RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION:
+        return "RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION";
+    }
+
+    return "[Undefined RecordingError]";
+}
+
+RecordedTopic toRecordedTopic(const capro::ServiceDescription& service) noexcept
+{
+    RecordedTopic topic;
+    copyIdString(topic.service, service.getServiceIDString());
+    copyIdString(topic.instance, service.getInstanceIDString());
+    copyIdString(topic.event, service.getEventIDString());
+    return topic;
+}
+
+capro::ServiceDescription toServiceDescription(const RecordedTopic& topic) noexcept
+{
+    // the strings are terminated explicitly since the recording might be corrupted
+    auto toIdString = [](const char(&value)[TOPIC_ID_STRING_SIZE]) {
+        return capro::IdString_t(TruncateToCapacity, value, strnlen(value, TOPIC_ID_STRING_SIZE - 1U));
+    };
+    return capro::ServiceDescription(toIdString(topic.service), toIdString(topic.instance), toIdString(topic.event));
+}
+
+optional<capro::ServiceDescription> topicFromString(const std::string& value) noexcept
+{
+    const auto firstSeparator = value.find('/');
+    if (firstSeparator == std::string::npos)
+    {
+        return nullopt;
+    }
+    const auto secondSeparator = value.find('/', firstSeparator + 1U);
+    if (secondSeparator == std::string::npos || value.find('/', secondSeparator + 1U) != std::string::npos)
+    {
+        return nullopt;
+    }
+
+    const auto service = value.substr(0U, firstSeparator);
+    const auto instance = value.substr(firstSeparator + 1U, secondSeparator - firstSeparator - 1U);
+    const auto event = value.substr(secondSeparator + 1U);
+    for (const auto& id : {service, instance, event})
+    {
+        if (id.empty() || id.size() > capro::IdString_t::capacity())
+        {
+            return nullopt;
+        }
+    }
+
+    return capro::ServiceDescription(capro::IdString_t(TruncateToCapacity, service.c_str(), service.size()),
+                                     capro::IdString_t(TruncateToCapacity, instance.c_str(), instance.size()),
+                                     capro::IdString_t(TruncateToCapacity, event.c_str(), event.size()));
+}
+
+} // namespace record_replay
+} // namespace iox
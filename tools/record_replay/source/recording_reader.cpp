@@ -0,0 +1,212 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_reader.hpp"
+#include "iox/algorithm.hpp"
+
+#include <algorithm>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace record_replay
+{
+expected<ReadOnlyMappedFile, RecordingError> ReadOnlyMappedFile::open(const std::string& path) noexcept
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) open is a POSIX function
+    const int fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (fileDescriptor == -1)
+    {
+        return err(RecordingError::FILE_OPEN_FAILED);
+    }
+
+    struct stat fileStatus
+    {
+    };
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        close(fileDescriptor);
+        return err(RecordingError::FILE_OPEN_FAILED);
+    }
+
+    const auto size = static_cast<uint64_t>(fileStatus.st_size);
+    if (size == 0U)
+    {
+        close(fileDescriptor);
+        return ok(ReadOnlyMappedFile(nullptr, 0U));
+    }
+
+    // the mapping stays valid after the file descriptor is closed
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        return err(RecordingError::MEMORY_MAPPING_FAILED);
+    }
+    // the replay reads the files front to back
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    return ok(ReadOnlyMappedFile(static_cast<const uint8_t*>(data), size));
+}
+
+ReadOnlyMappedFile::ReadOnlyMappedFile(const uint8_t* data, const uint64_t size) noexcept
+    : m_data(data)
+    , m_size(size)
+{
+}
+
+ReadOnlyMappedFile::ReadOnlyMappedFile(ReadOnlyMappedFile&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+ReadOnlyMappedFile& ReadOnlyMappedFile::operator=(ReadOnlyMappedFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_data = rhs.m_data;
+        m_size = rhs.m_size;
+        rhs.m_data = nullptr;
+        rhs.m_size = 0U;
+    }
+    return *this;
+}
+
+ReadOnlyMappedFile::~ReadOnlyMappedFile() noexcept
+{
+    destroy();
+}
+
+void ReadOnlyMappedFile::destroy() noexcept
+{
+    if (m_data != nullptr)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast) munmap requires a non-const pointer
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+        m_data = nullptr;
+    }
+}
+
+const uint8_t* ReadOnlyMappedFile::data() const noexcept
+{
+    return m_data;
+}
+
+uint64_t ReadOnlyMappedFile::size() const noexcept
+{
+    return m_size;
+}
+
+expected<RecordingReader, RecordingError> RecordingReader::open(const std::string& basePath) noexcept
+{
+    auto indexFile = ReadOnlyMappedFile::open(basePath + INDEX_FILE_SUFFIX);
+    if (indexFile.has_error())
+    {
+        return err(indexFile.error());
+    }
+    if (indexFile->size() < sizeof(IndexHeader))
+    {
+        return err(RecordingError::INVALID_FORMAT);
+    }
+
+    const auto* header = reinterpret_cast<const IndexHeader*>(indexFile->data());
+    if (header->magic != RECORDING_MAGIC || header->numberOfTopics > MAX_RECORDED_TOPICS)
+    {
+        return err(RecordingError::INVALID_FORMAT);
+    }
+    if (header->formatVersion != RECORDING_FORMAT_VERSION)
+    {
+        return err(RecordingError::INCOMPATIBLE_FORMAT_VERSION);
+    }
+    if (header->chunkHeaderVersion != mepoo::ChunkHeader::CHUNK_HEADER_VERSION)
+    {
+        return err(RecordingError::INCOMPATIBLE_CHUNK_HEADER_VERSION);
+    }
+
+    auto dataFile = ReadOnlyMappedFile::open(basePath + DATA_FILE_SUFFIX);
+    if (dataFile.has_error())
+    {
+        return err(dataFile.error());
+    }
+
+    return ok(RecordingReader(std::move(dataFile.value()), std::move(indexFile.value())));
+}
+
+RecordingReader::RecordingReader(ReadOnlyMappedFile&& dataFile, ReadOnlyMappedFile&& indexFile) noexcept
+    : m_dataFile(std::move(dataFile))
+    , m_indexFile(std::move(indexFile))
+    , m_header(reinterpret_cast<const IndexHeader*>(m_indexFile.data()))
+    , m_entries(reinterpret_cast<const IndexEntry*>(m_indexFile.data() + sizeof(IndexHeader)))
+{
+    // the header might be ahead of the file size when the recording is still written
+    const uint64_t numberOfMappedEntries = (m_indexFile.size() - sizeof(IndexHeader)) / sizeof(IndexEntry);
+    m_numberOfEntries = algorithm::minVal(m_header->numberOfEntries, numberOfMappedEntries);
+}
+
+uint32_t RecordingReader::numberOfTopics() const noexcept
+{
+    return m_header->numberOfTopics;
+}
+
+const RecordedTopic& RecordingReader::topic(const uint32_t topicIndex) const noexcept
+{
+    return m_header->topics[topicIndex];
+}
+
+uint64_t RecordingReader::numberOfEntries() const noexcept
+{
+    return m_numberOfEntries;
+}
+
+const IndexEntry& RecordingReader::entry(const uint64_t index) const noexcept
+{
+    return m_entries[index];
+}
+
+const mepoo::ChunkHeader* RecordingReader::chunk(const IndexEntry& entry) const noexcept
+{
+    if (entry.topicIndex >= m_header->numberOfTopics || entry.size < sizeof(mepoo::ChunkHeader)
+        || entry.dataOffset % RECORD_ALIGNMENT != 0U || entry.dataOffset > m_dataFile.size()
+        || entry.size > m_dataFile.size() - entry.dataOffset)
+    {
+        return nullptr;
+    }
+
+    const auto* chunkHeader = reinterpret_cast<const mepoo::ChunkHeader*>(m_dataFile.data() + entry.dataOffset);
+    const uint64_t userPayloadOffset = entry.size - chunkHeader->userPayloadSize();
+    if (chunkHeader->userPayloadSize() > entry.size || chunkHeader->usedSizeOfChunk() != entry.size
+        || sizeof(mepoo::ChunkHeader) + chunkHeader->userHeaderSize() > userPayloadOffset)
+    {
+        return nullptr;
+    }
+    return chunkHeader;
+}
+
+uint64_t RecordingReader::findFirstEntryNotBefore(const uint64_t timestamp) const noexcept
+{
+    const auto* firstEntry =
+        std::lower_bound(m_entries, m_entries + m_numberOfEntries, timestamp, [](const auto& entry, const auto value) {
+            return entry.timestamp < value;
+        });
+    return static_cast<uint64_t>(firstEntry - m_entries);
+}
+
+} // namespace record_replay
+} // namespace iox
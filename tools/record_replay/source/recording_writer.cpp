@@ -0,0 +1,320 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/recording_writer.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/logging.hpp"
+#include "iox/memory.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+/// @brief the index grows by 40 bytes per chunk, therefore a smaller window suffices
+constexpr uint64_t INDEX_MAPPING_WINDOW_SIZE{16U * 1024U * 1024U};
+
+uint64_t pageSize() noexcept
+{
+    static const uint64_t PAGE_SIZE{static_cast<uint64_t>(sysconf(_SC_PAGESIZE))};
+    return PAGE_SIZE;
+}
+} // namespace
+
+expected<AppendOnlyMappedFile, RecordingError> AppendOnlyMappedFile::create(const std::string& path,
+                                                                            const uint64_t windowSize) noexcept
+{
+    constexpr mode_t PERMISSIONS{S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH};
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg) open is a POSIX function
+    const int fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, PERMISSIONS);
+    if (fileDescriptor == INVALID_FILE_DESCRIPTOR)
+    {
+        return err(RecordingError::FILE_CREATION_FAILED);
+    }
+    return ok(AppendOnlyMappedFile(fileDescriptor, align(windowSize, pageSize())));
+}
+
+AppendOnlyMappedFile::AppendOnlyMappedFile(const int fileDescriptor, const uint64_t windowSize) noexcept
+    : m_fileDescriptor(fileDescriptor)
+    , m_windowSize(windowSize)
+{
+}
+
+AppendOnlyMappedFile::AppendOnlyMappedFile(AppendOnlyMappedFile&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+AppendOnlyMappedFile& AppendOnlyMappedFile::operator=(AppendOnlyMappedFile&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        destroy();
+        m_fileDescriptor = rhs.m_fileDescriptor;
+        m_windowSize = rhs.m_windowSize;
+        m_window = rhs.m_window;
+        m_windowOffset = rhs.m_windowOffset;
+        m_windowLength = rhs.m_windowLength;
+        m_allocatedSize = rhs.m_allocatedSize;
+        m_size = rhs.m_size;
+
+        rhs.m_fileDescriptor = INVALID_FILE_DESCRIPTOR;
+        rhs.m_window = nullptr;
+    }
+    return *this;
+}
+
+AppendOnlyMappedFile::~AppendOnlyMappedFile() noexcept
+{
+    destroy();
+}
+
+void AppendOnlyMappedFile::destroy() noexcept
+{
+    if (m_window != nullptr)
+    {
+        munmap(m_window, m_windowLength);
+        m_window = nullptr;
+    }
+    if (m_fileDescriptor != INVALID_FILE_DESCRIPTOR)
+    {
+        // removes the preallocated but unused space at the end of the file
+        if (ftruncate(m_fileDescriptor, static_cast<off_t>(m_size)) != 0)
+        {
+            IOX_LOG(WARN, "Unable to truncate the recording to its final size");
+        }
+        close(m_fileDescriptor);
+        m_fileDescriptor = INVALID_FILE_DESCRIPTOR;
+    }
+}
+
+expected<uint8_t*, RecordingError> AppendOnlyMappedFile::reserve(const uint64_t size) noexcept
+{
+    if (m_window == nullptr || m_size + size > m_windowOffset + m_windowLength)
+    {
+        auto result = moveWindow(size);
+        if (result.has_error())
+        {
+            return err(result.error());
+        }
+    }
+    return ok(m_window + (m_size - m_windowOffset));
+}
+
+void AppendOnlyMappedFile::commit(const uint64_t size) noexcept
+{
+    m_size += size;
+}
+
+uint64_t AppendOnlyMappedFile::size() const noexcept
+{
+    return m_size;
+}
+
+int AppendOnlyMappedFile::fileHandle() const noexcept
+{
+    return m_fileDescriptor;
+}
+
+expected<void, RecordingError> AppendOnlyMappedFile::moveWindow(const uint64_t requiredSize) noexcept
+{
+    // the window starts at the page which contains the end of the file and is large enough for chunks which exceed
+    // the window size
+    const uint64_t windowOffset = (m_size / pageSize()) * pageSize();
+    const uint64_t windowLength =
+        algorithm::maxVal(m_windowSize, align(m_size - windowOffset + requiredSize, pageSize()));
+    const uint64_t requiredFileSize = windowOffset + windowLength;
+
+    if (requiredFileSize > m_allocatedSize)
+    {
+        if (ftruncate(m_fileDescriptor, static_cast<off_t>(requiredFileSize)) != 0)
+        {
+            return err(RecordingError::FILE_RESIZE_FAILED);
+        }
+        m_allocatedSize = requiredFileSize;
+    }
+
+    if (m_window != nullptr)
+    {
+        munmap(m_window, m_windowLength);
+        m_window = nullptr;
+    }
+
+    void* window = mmap(nullptr,
+                        windowLength,
+                        PROT_READ | PROT_WRITE,
+                        MAP_SHARED,
+                        m_fileDescriptor,
+                        static_cast<off_t>(windowOffset));
+    if (window == MAP_FAILED)
+    {
+        return err(RecordingError::MEMORY_MAPPING_FAILED);
+    }
+
+    m_window = static_cast<uint8_t*>(window);
+    m_windowOffset = windowOffset;
+    m_windowLength = windowLength;
+    return ok();
+}
+
+expected<RecordingWriter, RecordingError> RecordingWriter::create(const std::string& basePath,
+                                                                  const std::vector<capro::ServiceDescription>& topics,
+                                                                  const uint64_t windowSize) noexcept
+{
+    if (topics.size() > MAX_RECORDED_TOPICS)
+    {
+        return err(RecordingError::TOO_MANY_TOPICS);
+    }
+
+    auto dataFile = AppendOnlyMappedFile::create(basePath + DATA_FILE_SUFFIX, windowSize);
+    if (dataFile.has_error())
+    {
+        return err(dataFile.error());
+    }
+    auto indexFile = AppendOnlyMappedFile::create(basePath + INDEX_FILE_SUFFIX, INDEX_MAPPING_WINDOW_SIZE);
+    if (indexFile.has_error())
+    {
+        return err(indexFile.error());
+    }
+
+    auto headerMemory = indexFile->reserve(sizeof(IndexHeader));
+    if (headerMemory.has_error())
+    {
+        return err(headerMemory.error());
+    }
+    auto* initialHeader = new (headerMemory.value()) IndexHeader();
+    initialHeader->numberOfTopics = static_cast<uint32_t>(topics.size());
+    for (uint64_t i = 0U; i < topics.size(); ++i)
+    {
+        initialHeader->topics[i] = toRecordedTopic(topics[i]);
+    }
+    indexFile->commit(sizeof(IndexHeader));
+
+    // the window of the index file moves with the entries, therefore the header gets its own mapping
+    void* header = mmap(
+        nullptr, sizeof(IndexHeader), PROT_READ | PROT_WRITE, MAP_SHARED, indexFile->fileHandle(), 0);
+    if (header == MAP_FAILED)
+    {
+        return err(RecordingError::MEMORY_MAPPING_FAILED);
+    }
+
+    return ok(RecordingWriter(
+        std::move(dataFile.value()), std::move(indexFile.value()), static_cast<IndexHeader*>(header)));
+}
+
+RecordingWriter::RecordingWriter(AppendOnlyMappedFile&& dataFile,
+                                 AppendOnlyMappedFile&& indexFile,
+                                 IndexHeader* header) noexcept
+    : m_dataFile(std::move(dataFile))
+    , m_indexFile(std::move(indexFile))
+    , m_header(header)
+{
+}
+
+RecordingWriter::RecordingWriter(RecordingWriter&& rhs) noexcept
+    : m_dataFile(std::move(rhs.m_dataFile))
+    , m_indexFile(std::move(rhs.m_indexFile))
+    , m_header(rhs.m_header)
+{
+    rhs.m_header = nullptr;
+}
+
+RecordingWriter& RecordingWriter::operator=(RecordingWriter&& rhs) noexcept
+{
+    if (this != &rhs)
+    {
+        if (m_header != nullptr)
+        {
+            munmap(m_header, sizeof(IndexHeader));
+        }
+        m_dataFile = std::move(rhs.m_dataFile);
+        m_indexFile = std::move(rhs.m_indexFile);
+        m_header = rhs.m_header;
+        rhs.m_header = nullptr;
+    }
+    return *this;
+}
+
+RecordingWriter::~RecordingWriter() noexcept
+{
+    if (m_header != nullptr)
+    {
+        munmap(m_header, sizeof(IndexHeader));
+        m_header = nullptr;
+    }
+}
+
+expected<void, RecordingError> RecordingWriter::record(const uint32_t topicIndex,
+                                                       const mepoo::ChunkHeader& chunkHeader,
+                                                       const uint64_t timestamp) noexcept
+{
+    if (topicIndex >= m_header->numberOfTopics)
+    {
+        return err(RecordingError::INVALID_TOPIC_INDEX);
+    }
+
+    const uint64_t chunkSize = chunkHeader.usedSizeOfChunk();
+    const uint64_t alignedChunkSize = align(chunkSize, RECORD_ALIGNMENT);
+
+    auto chunkMemory = m_dataFile.reserve(alignedChunkSize);
+    if (chunkMemory.has_error())
+    {
+        return err(chunkMemory.error());
+    }
+    auto entryMemory = m_indexFile.reserve(sizeof(IndexEntry));
+    if (entryMemory.has_error())
+    {
+        return err(entryMemory.error());
+    }
+
+    const uint64_t dataOffset = m_dataFile.size();
+    std::memcpy(chunkMemory.value(), &chunkHeader, chunkSize);
+    m_dataFile.commit(alignedChunkSize);
+
+    auto* entry = new (entryMemory.value()) IndexEntry();
+    entry->timestamp = timestamp;
+    entry->sequenceNumber = chunkHeader.sequenceNumber();
+    entry->dataOffset = dataOffset;
+    entry->size = chunkSize;
+    entry->topicIndex = topicIndex;
+    m_indexFile.commit(sizeof(IndexEntry));
+
+    // the header is updated last so that it only covers completely written chunks
+    m_header->dataSize = m_dataFile.size();
+    m_header->numberOfEntries = (m_indexFile.size() - sizeof(IndexHeader)) / sizeof(IndexEntry);
+
+    return ok();
+}
+
+uint64_t RecordingWriter::numberOfRecordedChunks() const noexcept
+{
+    return m_header->numberOfEntries;
+}
+
+uint64_t RecordingWriter::recordedDataSize() const noexcept
+{
+    return m_header->dataSize;
+}
+
+} // namespace record_replay
+} // namespace iox
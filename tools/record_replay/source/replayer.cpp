@@ -0,0 +1,227 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_record_replay/replayer.hpp"
+#include "iceoryx_posh/popo/untyped_publisher.hpp"
+#include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iceoryx_versions.hpp"
+#include "iox/signal_watcher.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace iox
+{
+namespace record_replay
+{
+namespace
+{
+constexpr uint64_t MEBIBYTE{1024U * 1024U};
+} // namespace
+
+Replayer::Replayer(int argc, char* argv[]) noexcept
+{
+    parseCmdLineArguments(argc, argv);
+}
+
+void Replayer::printHelp() noexcept
+{
+    std::cout << "Usage:\n"
+                 "  iox-replayer -i <BASE_PATH> [OPTIONS]\n"
+                 "  iox-replayer --help\n"
+                 "  iox-replayer --version\n"
+                 "\nOptions:\n"
+                 "  -h, --help              Display help and exit.\n"
+                 "  -v, --version           Display latest official iceoryx release version and exit.\n"
+                 "  -i, --input <BASE_PATH> Replays the recording '<BASE_PATH>"
+              << DATA_FILE_SUFFIX << "' and '<BASE_PATH>" << INDEX_FILE_SUFFIX
+              << "'.\n"
+                 "  -r, --rate <FACTOR>     Replay speed relative to the recording; 0 publishes the chunks as fast\n"
+                 "                          as possible [default: 1.0]\n"
+                 "  -s, --start <ms>        Starts the replay with the first chunk recorded at least <ms>\n"
+                 "                          milliseconds after the begin of the recording [default: 0]\n"
+                 "  -d, --delay <ms>        Waits <ms> milliseconds after offering the topics to give the\n"
+                 "                          subscribers time to connect [default: 0]\n"
+              << std::endl;
+}
+
+void Replayer::printShortInfo(const std::string& binaryName) noexcept
+{
+    std::cout << "Run '" << binaryName << " --help' for more information." << std::endl;
+}
+
+void Replayer::parseCmdLineArguments(int argc, char** argv) noexcept
+{
+    int32_t opt;
+    int index;
+
+    while ((opt = getopt_long(argc, argv, replayerShortOptions, replayerLongOptions, &index)) != -1)
+    {
+        switch (opt)
+        {
+        case 'h':
+            printHelp();
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'v':
+            std::cout << "Latest official iceoryx release version: " << ICEORYX_LATEST_RELEASE_VERSION << "\n"
+                      << std::endl;
+            exit(EXIT_SUCCESS);
+            break;
+
+        case 'i':
+            m_basePath = optarg;
+            break;
+
+        case 'r':
+        {
+            auto result = convert::from_string<double>(optarg);
+            if (!result.has_value() || !(result.value() >= 0.0))
+            {
+                std::cout << "Invalid argument for 'r'! The rate must not be negative!" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            m_rate = result.value();
+            break;
+        }
+
+        case 's':
+        case 'd':
+        {
+            auto result = convert::from_string<uint64_t>(optarg);
+            if (!result.has_value())
+            {
+                std::cout << "Invalid argument for '" << static_cast<char>(opt) << "'! Will be ignored!" << std::endl;
+                break;
+            }
+            (opt == 's' ? m_start : m_delay) = units::Duration::fromMilliseconds(result.value());
+            break;
+        }
+
+        case '?':
+        default:
+            printShortInfo(argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (m_basePath.empty())
+    {
+        std::cout << "Wrong usage. ";
+        printShortInfo(argv[0]);
+        exit(EXIT_FAILURE);
+    }
+}
+
+bool Replayer::run() noexcept
+{
+    auto reader = RecordingReader::open(m_basePath);
+    if (reader.has_error())
+    {
+        std::cerr << "Unable to open the recording '" << m_basePath << "': " << asStringLiteral(reader.error())
+                  << std::endl;
+        return false;
+    }
+
+    runtime::PoshRuntime::initRuntime(REPLAYER_APP_NAME);
+
+    std::vector<std::unique_ptr<popo::UntypedPublisher>> publishers;
+    for (uint32_t i = 0U; i < reader->numberOfTopics(); ++i)
+    {
+        publishers.emplace_back(new popo::UntypedPublisher(toServiceDescription(reader->topic(i))));
+    }
+
+    std::this_thread::sleep_for(std::chrono::nanoseconds(m_delay.toNanoseconds()));
+
+    if (reader->numberOfEntries() == 0U)
+    {
+        std::cout << "The recording is empty." << std::endl;
+        return true;
+    }
+
+    const uint64_t firstTimestamp = reader->entry(0U).timestamp;
+    const uint64_t startIndex = reader->findFirstEntryNotBefore(firstTimestamp + m_start.toNanoseconds());
+    const uint64_t startTimestamp =
+        (startIndex < reader->numberOfEntries()) ? reader->entry(startIndex).timestamp : firstTimestamp;
+
+    std::cout << "Replaying " << reader->numberOfEntries() - startIndex << " chunk(s) of " << publishers.size()
+              << " topic(s) from '" << m_basePath << "'." << std::endl;
+
+    const auto replayStart = std::chrono::steady_clock::now();
+    uint64_t numberOfPublishedChunks{0U};
+    uint64_t publishedSize{0U};
+    uint64_t numberOfSkippedChunks{0U};
+    for (uint64_t i = startIndex; i < reader->numberOfEntries() && !hasTerminationRequested(); ++i)
+    {
+        const auto& entry = reader->entry(i);
+        const auto* chunk = reader->chunk(entry);
+        if (chunk == nullptr)
+        {
+            ++numberOfSkippedChunks;
+            continue;
+        }
+
+        if (m_rate > 0.0)
+        {
+            const auto offset = static_cast<double>(entry.timestamp - startTimestamp) / m_rate;
+            std::this_thread::sleep_until(replayStart + std::chrono::nanoseconds(static_cast<int64_t>(offset)));
+        }
+
+        const uint32_t userHeaderAlignment =
+            (chunk->userHeaderSize() == CHUNK_NO_USER_HEADER_SIZE) ? CHUNK_NO_USER_HEADER_ALIGNMENT
+                                                                   : static_cast<uint32_t>(alignof(mepoo::ChunkHeader));
+        auto& publisher = *publishers[entry.topicIndex];
+        publisher
+            .loan(chunk->userPayloadSize(),
+                  chunk->userPayloadAlignment(),
+                  chunk->userHeaderSize(),
+                  userHeaderAlignment)
+            .and_then([&](auto& userPayload) {
+                if (chunk->userHeaderSize() != CHUNK_NO_USER_HEADER_SIZE)
+                {
+                    std::memcpy(mepoo::ChunkHeader::fromUserPayload(userPayload)->userHeader(),
+                                chunk->userHeader(),
+                                chunk->userHeaderSize());
+                }
+                std::memcpy(userPayload, chunk->userPayload(), chunk->userPayloadSize());
+                publisher.publish(userPayload);
+                ++numberOfPublishedChunks;
+                publishedSize += chunk->userPayloadSize();
+            })
+            .or_else([&](auto&) { ++numberOfSkippedChunks; });
+    }
+
+    const auto duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+    std::cout << "Published " << numberOfPublishedChunks << " chunk(s) with "
+              << static_cast<double>(publishedSize) / static_cast<double>(MEBIBYTE) << " MiB user-payload in "
+              << duration << " s";
+    if (numberOfSkippedChunks > 0U)
+    {
+        std::cout << "; " << numberOfSkippedChunks
+                  << " chunk(s) were skipped since they were corrupted or no chunk could be loaned";
+    }
+    std::cout << std::endl;
+
+    return true;
+}
+
+} // namespace record_replay
+} // namespace iox
@@ -0,0 +1,284 @@
+// Copyright (c) 2026 by Apex.AI Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/platform_settings.hpp"
+#include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iceoryx_record_replay/recording_reader.hpp"
+#include "iceoryx_record_replay/recording_writer.hpp"
+
+#include "test.hpp"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::record_replay;
+
+/// @brief a chunk on the heap which is filled with a pattern that depends on 'value'
+class TestChunk
+{
+  public:
+    TestChunk(const uint64_t userPayloadSize, const uint8_t value)
+    {
+        auto chunkSettings = mepoo::ChunkSettings::create(userPayloadSize, CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT)
+                                 .expect("valid chunk settings");
+        const auto chunkSize = chunkSettings.requiredChunkSize();
+        // uint64_t provides the alignment of the ChunkHeader
+        m_memory.reset(new uint64_t[(chunkSize + sizeof(uint64_t) - 1U) / sizeof(uint64_t)]);
+        m_chunkHeader = new (m_memory.get()) mepoo::ChunkHeader(chunkSize, chunkSettings);
+        fillPattern(static_cast<uint8_t*>(m_chunkHeader->userPayload()), userPayloadSize, value);
+    }
+
+    const mepoo::ChunkHeader& header() const
+    {
+        return *m_chunkHeader;
+    }
+
+    static void fillPattern(uint8_t* data, const uint64_t size, const uint8_t value)
+    {
+        for (uint64_t i = 0U; i < size; ++i)
+        {
+            data[i] = static_cast<uint8_t>(value + i);
+        }
+    }
+
+    static bool hasPattern(const mepoo::ChunkHeader& chunkHeader, const uint8_t value)
+    {
+        const auto* data = static_cast<const uint8_t*>(chunkHeader.userPayload());
+        for (uint64_t i = 0U; i < chunkHeader.userPayloadSize(); ++i)
+        {
+            if (data[i] != static_cast<uint8_t>(value + i))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    std::unique_ptr<uint64_t[]> m_memory;
+    mepoo::ChunkHeader* m_chunkHeader{nullptr};
+};
+
+class Recording_test : public Test
+{
+  public:
+    void TearDown() override
+    {
+        unlink((m_basePath + DATA_FILE_SUFFIX).c_str());
+        unlink((m_basePath + INDEX_FILE_SUFFIX).c_str());
+    }
+
+    static constexpr uint64_t SMALL_WINDOW_SIZE{4096U};
+
+    const std::string m_basePath{std::string(platform::IOX_TEMP_DIR) + "iox_record_replay_test_"
+                                 + std::to_string(getpid())};
+    const std::vector<capro::ServiceDescription> m_topics{{"Radar", "FrontLeft", "Objects"},
+                                                          {"Camera", "Rear", "Image"}};
+};
+constexpr uint64_t Recording_test::SMALL_WINDOW_SIZE;
+
+TEST_F(Recording_test, RecordedChunksAreReadBackWithTopicsAndPayloads)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da9a9403-7eaf-425b-ba34-d17cd25074ab");
+    constexpr uint64_t NUMBER_OF_CHUNKS{10U};
+    {
+        auto writer = RecordingWriter::create(m_basePath, m_topics);
+        ASSERT_FALSE(writer.has_error());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            TestChunk chunk(16U + i * 8U, static_cast<uint8_t>(i));
+            ASSERT_FALSE(writer->record(static_cast<uint32_t>(i % 2U), chunk.header(), 1000U + i).has_error());
+        }
+        EXPECT_THAT(writer->numberOfRecordedChunks(), Eq(NUMBER_OF_CHUNKS));
+    }
+
+    auto reader = RecordingReader::open(m_basePath);
+    ASSERT_FALSE(reader.has_error());
+
+    ASSERT_THAT(reader->numberOfTopics(), Eq(m_topics.size()));
+    for (uint32_t topicIndex = 0U; topicIndex < reader->numberOfTopics(); ++topicIndex)
+    {
+        EXPECT_THAT(toServiceDescription(reader->topic(topicIndex)), Eq(m_topics[topicIndex]));
+    }
+
+    ASSERT_THAT(reader->numberOfEntries(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        const auto& entry = reader->entry(i);
+        EXPECT_THAT(entry.timestamp, Eq(1000U + i));
+        EXPECT_THAT(entry.topicIndex, Eq(i % 2U));
+
+        const auto* chunkHeader = reader->chunk(entry);
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(entry.sequenceNumber, Eq(chunkHeader->sequenceNumber()));
+        EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(16U + i * 8U));
+        EXPECT_TRUE(TestChunk::hasPattern(*chunkHeader, static_cast<uint8_t>(i)));
+    }
+}
+
+TEST_F(Recording_test, RecordingWithInvalidTopicIndexFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "00916d9f-81ef-443e-8277-886f09dad226");
+    auto writer = RecordingWriter::create(m_basePath, m_topics);
+    ASSERT_FALSE(writer.has_error());
+
+    TestChunk chunk(8U, 0U);
+    auto result = writer->record(static_cast<uint32_t>(m_topics.size()), chunk.header(), 0U);
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(RecordingError::INVALID_TOPIC_INDEX));
+    EXPECT_THAT(writer->numberOfRecordedChunks(), Eq(0U));
+}
+
+TEST_F(Recording_test, FindFirstEntryNotBeforeFindsTheFirstAndTheLastEntry)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40c003db-786c-4c6a-8ff9-39648406f042");
+    const std::vector<uint64_t> timestamps{100U, 200U, 200U, 300U, 400U, 500U};
+    {
+        auto writer = RecordingWriter::create(m_basePath, m_topics);
+        ASSERT_FALSE(writer.has_error());
+        for (const auto timestamp : timestamps)
+        {
+            TestChunk chunk(8U, static_cast<uint8_t>(timestamp));
+            ASSERT_FALSE(writer->record(0U, chunk.header(), timestamp).has_error());
+        }
+    }
+
+    auto reader = RecordingReader::open(m_basePath);
+    ASSERT_FALSE(reader.has_error());
+    ASSERT_THAT(reader->numberOfEntries(), Eq(timestamps.size()));
+
+    EXPECT_THAT(reader->findFirstEntryNotBefore(0U), Eq(0U));
+    EXPECT_THAT(reader->findFirstEntryNotBefore(100U), Eq(0U));
+    EXPECT_THAT(reader->findFirstEntryNotBefore(101U), Eq(1U));
+    // the first of multiple chunks with the same timestamp is found
+    EXPECT_THAT(reader->findFirstEntryNotBefore(200U), Eq(1U));
+    EXPECT_THAT(reader->findFirstEntryNotBefore(250U), Eq(3U));
+    EXPECT_THAT(reader->findFirstEntryNotBefore(500U), Eq(timestamps.size() - 1U));
+    EXPECT_THAT(reader->findFirstEntryNotBefore(501U), Eq(timestamps.size()));
+
+    const auto& lastEntry = reader->entry(reader->findFirstEntryNotBefore(500U));
+    const auto* lastChunk = reader->chunk(lastEntry);
+    ASSERT_THAT(lastChunk, Ne(nullptr));
+    EXPECT_TRUE(TestChunk::hasPattern(*lastChunk, static_cast<uint8_t>(500U)));
+}
+
+TEST_F(Recording_test, ChunksAreReadBackWhenTheMappingWindowIsMovedAndGrows)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8710f093-be98-43fa-95f4-a63c55cfee1d");
+    constexpr uint64_t NUMBER_OF_CHUNKS{64U};
+    constexpr uint64_t SMALL_PAYLOAD_SIZE{1000U};
+    // exceeds the window, therefore the window grows for this chunk
+    constexpr uint64_t LARGE_PAYLOAD_SIZE{3U * SMALL_WINDOW_SIZE};
+    constexpr uint64_t LARGE_CHUNK_INDEX{NUMBER_OF_CHUNKS / 2U};
+
+    auto payloadSize = [&](const uint64_t index) {
+        return index == LARGE_CHUNK_INDEX ? LARGE_PAYLOAD_SIZE : SMALL_PAYLOAD_SIZE;
+    };
+
+    {
+        auto writer = RecordingWriter::create(m_basePath, m_topics, SMALL_WINDOW_SIZE);
+        ASSERT_FALSE(writer.has_error());
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            TestChunk chunk(payloadSize(i), static_cast<uint8_t>(i));
+            ASSERT_FALSE(writer->record(0U, chunk.header(), i).has_error());
+        }
+        EXPECT_THAT(writer->recordedDataSize(), Gt(NUMBER_OF_CHUNKS * SMALL_PAYLOAD_SIZE + LARGE_PAYLOAD_SIZE));
+    }
+
+    auto reader = RecordingReader::open(m_basePath);
+    ASSERT_FALSE(reader.has_error());
+    ASSERT_THAT(reader->numberOfEntries(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        const auto* chunkHeader = reader->chunk(reader->entry(i));
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_THAT(chunkHeader->userPayloadSize(), Eq(payloadSize(i)));
+        EXPECT_TRUE(TestChunk::hasPattern(*chunkHeader, static_cast<uint8_t>(i)));
+    }
+}
+
+TEST_F(Recording_test, RecordingOfAnAbortedWriterIsReadableUpToTheLastRecordedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9c81770f-e7d6-4f3d-bfff-506b0960326f");
+    constexpr uint64_t NUMBER_OF_CHUNKS{20U};
+    constexpr int WRITER_FAILED{1};
+
+    // the writer process terminates without running the destructors, therefore the files are neither truncated nor
+    // unmapped
+    const auto writerPid = fork();
+    ASSERT_THAT(writerPid, Ne(-1));
+    if (writerPid == 0)
+    {
+        auto writer = RecordingWriter::create(m_basePath, m_topics, SMALL_WINDOW_SIZE);
+        if (writer.has_error())
+        {
+            _exit(WRITER_FAILED);
+        }
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            TestChunk chunk(512U, static_cast<uint8_t>(i));
+            if (writer->record(1U, chunk.header(), i).has_error())
+            {
+                _exit(WRITER_FAILED);
+            }
+        }
+        _exit(0);
+    }
+
+    int status{0};
+    ASSERT_THAT(waitpid(writerPid, &status, 0), Eq(writerPid));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_THAT(WEXITSTATUS(status), Eq(0));
+
+    // the index file still contains the preallocated but unused entries
+    struct stat indexFileStatus
+    {
+    };
+    ASSERT_THAT(stat((m_basePath + INDEX_FILE_SUFFIX).c_str(), &indexFileStatus), Eq(0));
+    EXPECT_THAT(static_cast<uint64_t>(indexFileStatus.st_size),
+                Gt(sizeof(IndexHeader) + NUMBER_OF_CHUNKS * sizeof(IndexEntry)));
+
+    auto reader = RecordingReader::open(m_basePath);
+    ASSERT_FALSE(reader.has_error());
+    ASSERT_THAT(reader->numberOfEntries(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        const auto* chunkHeader = reader->chunk(reader->entry(i));
+        ASSERT_THAT(chunkHeader, Ne(nullptr));
+        EXPECT_TRUE(TestChunk::hasPattern(*chunkHeader, static_cast<uint8_t>(i)));
+    }
+    // the zeroed entries in the preallocated space are not searched
+    EXPECT_THAT(reader->findFirstEntryNotBefore(NUMBER_OF_CHUNKS), Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(Recording_test, OpeningAMissingRecordingFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "717e91bd-0cf6-44a1-8c7f-de0b15598b1a");
+    auto reader = RecordingReader::open(m_basePath);
+    ASSERT_TRUE(reader.has_error());
+    EXPECT_THAT(reader.error(), Eq(RecordingError::FILE_OPEN_FAILED));
+}
+} // namespace